@@ -7,8 +7,9 @@ uniform sampler2D noiseTwo;
 uniform vec2 spriteSheetSize;
 uniform vec4 textureRect;
 
-uniform vec4 surroundingWaterColors[8];
-uniform vec4 waterColor;
+// Water colour of each chunk in view, with border of surrounding chunks
+// Chunk index in view is held in vertex colour
+uniform sampler2D waterColorGrid;
 
 uniform float time;
 
@@ -63,6 +64,19 @@ void main()
 
     vec4 texColor = texture2D(texture, texCoord);
 
+    ivec2 gridPos = ivec2(round(fragColor.rg * 255.0)) + ivec2(1, 1);
+
+    vec4 waterColor = texelFetch(waterColorGrid, gridPos, 0);
+    vec4 surroundingWaterColors[8];
+    surroundingWaterColors[0] = texelFetch(waterColorGrid, gridPos + ivec2(0, -1), 0);
+    surroundingWaterColors[1] = texelFetch(waterColorGrid, gridPos + ivec2(1, 0), 0);
+    surroundingWaterColors[2] = texelFetch(waterColorGrid, gridPos + ivec2(0, 1), 0);
+    surroundingWaterColors[3] = texelFetch(waterColorGrid, gridPos + ivec2(-1, 0), 0);
+    surroundingWaterColors[4] = texelFetch(waterColorGrid, gridPos + ivec2(-1, -1), 0);
+    surroundingWaterColors[5] = texelFetch(waterColorGrid, gridPos + ivec2(1, -1), 0);
+    surroundingWaterColors[6] = texelFetch(waterColorGrid, gridPos + ivec2(1, 1), 0);
+    surroundingWaterColors[7] = texelFetch(waterColorGrid, gridPos + ivec2(-1, 1), 0);
+
     const float edgeBlend = 0.3;
 
     float centreWeight = min((1.0 - abs(normalizedTexX / noiseSampleDivide - 0.5)), (1.0 - abs(normalizedTexY / noiseSampleDivide - 0.5)));
@@ -85,5 +99,5 @@ void main()
     if (texColor.a == 0.0) color = adjustedWaterColor;
     else if (waterColor != vec4(1.0, 1.0, 1.0, 1.0)) color = mix(texColor, adjustedWaterColor, 0.7);
 
-    FragColor = color * fragColor;
+    FragColor = color;
 }
\ No newline at end of file
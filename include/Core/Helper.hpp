@@ -4,10 +4,14 @@
 #include <cmath>
 #include <string>
 #include <format>
+#include <random>
+#include <thread>
 
 #include <Graphics/Color.hpp>
 #include <Vector.hpp>
 
+#include "Core/Random.hpp"
+
 #include "GameConstants.hpp"
 
 namespace Helper
@@ -18,16 +22,23 @@ inline float lerp(float start, float dest, float weight)
     return std::min(std::max(start + weight * (dest - start), std::min(dest, start)), std::max(dest, start));
 }
 
+// Random generator for non-gameplay randomness (sounds, particles, visual effects etc)
+// Gameplay randomness should use RandomStreams, e.g. from ChunkManager
+inline RandomStream& getRandom()
+{
+    thread_local RandomStream random(std::random_device{}(), std::hash<std::thread::id>{}(std::this_thread::get_id()));
+    return random;
+}
+
 // High is inclusive
 inline int randInt(int low, int high)
 {
-    return rand() % (high + 1 - low) + low;
+    return getRandom().randInt(low, high);
 }
 
 inline float randFloat(float low, float high)
 {
-    float t = randInt(0, 10000) / 10000.0f;
-    return (high - low) * t + low;
+    return getRandom().randFloat(low, high);
 }
 
 inline float roundTo(float number, int decimalPoints)
@@ -157,4 +168,16 @@ inline pl::Vector2f wrapPosition(pl::Vector2f position, int worldSize)
     return position;
 }
 
+// FNV-1a hash of bytes, pass previous hash to combine
+inline uint64_t hashBytes(const void* data, size_t size, uint64_t hash = 14695981039346656037ULL)
+{
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    for (size_t i = 0; i < size; i++)
+    {
+        hash ^= bytes[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
 }
\ No newline at end of file
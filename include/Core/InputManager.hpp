@@ -215,6 +215,21 @@ inline void to_json(nlohmann::json& json, const InputBindingsSave& bindingsSave)
     json["controller-axis-deadzone"] = bindingsSave.controllerAxisDeadzone;
 }
 
+// Input state at end of frame, used to record and replay input
+struct InputFrameState
+{
+    // Only non-zero activations are stored
+    std::unordered_map<InputAction, float> inputActivation;
+    pl::Vector2f mousePosition;
+    bool controllerActive = false;
+
+    template <class Archive>
+    void serialize(Archive& ar)
+    {
+        ar(inputActivation, mousePosition.x, mousePosition.y, controllerActive);
+    }
+};
+
 class InputManager
 {
     InputManager() = delete;
@@ -268,6 +283,12 @@ public:
     static bool getControllerRelativeAimMode();
     static float getControllerRelativeCursorAlpha();
 
+    static InputFrameState getInputFrameState(SDL_Window* window);
+
+    // While replay input is set, update uses replay input rather than devices, and input events are ignored
+    static void setReplayInputFrameState(const InputFrameState& inputFrameState);
+    static void clearReplayInputFrameState();
+
 private:
     template <typename InputType>
     static void bindInput(InputAction action, std::optional<InputType> input, std::unordered_map<InputAction, InputType>& bindMap, bool overwrite);
@@ -303,4 +324,6 @@ private:
     static std::unordered_map<InputAction, float> inputActivation;
     static std::unordered_map<InputAction, float> inputActivationLastFrame;
 
+    static std::optional<InputFrameState> replayInputFrameState;
+
 };
\ No newline at end of file
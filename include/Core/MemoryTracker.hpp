@@ -0,0 +1,143 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <array>
+#include <atomic>
+#include <memory>
+#include <functional>
+
+// Subsystems which tagged allocations are counted against
+enum class MemoryCategory : uint8_t
+{
+    Chunks,
+    TileMaps,
+    Objects,
+    Entities,
+    ChestData,
+    Rooms,
+    Packets,
+    Textures,
+    Count
+};
+
+constexpr int MEMORY_CATEGORY_COUNT = static_cast<int>(MemoryCategory::Count);
+
+const char* getMemoryCategoryName(MemoryCategory category);
+
+struct MemoryCategoryStats
+{
+    int64_t liveBytes = 0;
+    int64_t liveCount = 0;
+    int64_t highWaterBytes = 0;
+
+    // Bytes of untagged containers inside tagged objects, as of last measurement
+    int64_t measuredBytes = 0;
+};
+
+using MemorySnapshot = std::array<MemoryCategoryStats, MEMORY_CATEGORY_COUNT>;
+
+// Counts live bytes, live allocations and high-water mark of tagged allocations for each category
+// Allocations are tagged through MemoryTracked (class heap allocations), TrackedAllocator (containers),
+// or recorded directly for memory not allocated through the heap, e.g. textures
+// Containers inside tagged objects which cannot use TrackedAllocator (e.g. tile map vertices) are measured instead,
+// by walking them when stats are logged or shown
+// Counters are atomic, as allocations can be made from worker threads
+class MemoryTracker
+{
+private:
+    MemoryTracker() = delete;
+
+public:
+    static void recordAllocation(MemoryCategory category, size_t bytes);
+    static void recordFree(MemoryCategory category, size_t bytes);
+
+    static void setMeasuredBytes(MemoryCategory category, size_t bytes);
+
+    // Called before stats are logged, to update measured bytes
+    static void setMeasureCallback(std::function<void()> callback);
+
+    static MemoryCategoryStats getStats(MemoryCategory category);
+    static MemorySnapshot getSnapshot();
+
+    static void resetHighWaterMarks();
+
+    // Logs stats every LOG_INTERVAL seconds
+    static void update(float dt);
+
+    static void logStats();
+
+    static constexpr float LOG_INTERVAL = 600.0f;
+
+private:
+    struct CategoryCounters
+    {
+        std::atomic<int64_t> liveBytes = 0;
+        std::atomic<int64_t> liveCount = 0;
+        std::atomic<int64_t> highWaterBytes = 0;
+        std::atomic<int64_t> measuredBytes = 0;
+    };
+
+    static std::array<CategoryCounters, MEMORY_CATEGORY_COUNT> counters;
+
+    static std::function<void()> measureCallback;
+
+    static float logTime;
+
+};
+
+// Base class counting heap allocations of derived classes against category
+// Size given on delete is size of dynamic type, so polymorphic classes must have virtual destructor
+template <MemoryCategory Category>
+class MemoryTracked
+{
+public:
+    static void* operator new(size_t size)
+    {
+        MemoryTracker::recordAllocation(Category, size);
+        return ::operator new(size);
+    }
+
+    static void operator delete(void* ptr, size_t size)
+    {
+        MemoryTracker::recordFree(Category, size);
+        ::operator delete(ptr);
+    }
+};
+
+// Allocator counting container allocations against category
+template <class T, MemoryCategory Category>
+class TrackedAllocator
+{
+public:
+    using value_type = T;
+
+    template <class U>
+    struct rebind
+    {
+        using other = TrackedAllocator<U, Category>;
+    };
+
+    TrackedAllocator() = default;
+
+    template <class U>
+    TrackedAllocator(const TrackedAllocator<U, Category>&) {}
+
+    inline T* allocate(size_t count)
+    {
+        MemoryTracker::recordAllocation(Category, count * sizeof(T));
+        return std::allocator<T>().allocate(count);
+    }
+
+    inline void deallocate(T* ptr, size_t count)
+    {
+        MemoryTracker::recordFree(Category, count * sizeof(T));
+        std::allocator<T>().deallocate(ptr, count);
+    }
+
+    template <class U>
+    inline bool operator==(const TrackedAllocator<U, Category>&) const {return true;}
+
+    template <class U>
+    inline bool operator!=(const TrackedAllocator<U, Category>&) const {return false;}
+};
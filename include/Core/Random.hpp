@@ -1,5 +1,10 @@
 #pragma once
 
+#include <cstdint>
+#include <array>
+
+#include <extlib/cereal/archives/binary.hpp>
+
 class RandInt
 {
 public:
@@ -10,4 +15,72 @@ public:
 private:
     unsigned long int next = 1;
 
-};
\ No newline at end of file
+};
+
+// PCG32 generator, with independent sequences selected by stream ID
+// Streams with the same seed and stream ID always produce the same sequence
+class RandomStream
+{
+public:
+    RandomStream(uint64_t seed = 0, uint64_t streamID = 0);
+
+    uint32_t next();
+
+    // High is inclusive
+    int randInt(int low, int high);
+
+    // High is inclusive
+    float randFloat(float low, float high);
+
+    // Saved so stream continues from same point when loaded
+    template <class Archive>
+    void serialize(Archive& ar, const std::uint32_t version)
+    {
+        ar(state, increment);
+    }
+
+private:
+    uint64_t state = 0;
+    uint64_t increment = 1;
+
+};
+
+CEREAL_CLASS_VERSION(RandomStream, 1);
+
+// Gameplay systems which use their own random stream
+enum class RandomStreamType : uint8_t
+{
+    TileVariation,
+    ResourceRegeneration,
+    EntitySpawn,
+    Boss,
+    Object,
+    ItemDrop,
+    Fishing,
+    Room,
+    Projectile,
+    Entity,
+    Count
+};
+
+// Random streams for each gameplay system at a location (e.g. a planet), derived from world seed
+// Each system uses its own stream so randomness used in one system does not change results in others
+class RandomStreams
+{
+public:
+    RandomStreams() = default;
+
+    void seed(uint64_t seed, uint64_t locationID);
+
+    RandomStream& get(RandomStreamType type);
+
+    // Creates stream for key (e.g. chunk) within location, independent of use of shared streams
+    RandomStream createStream(RandomStreamType type, uint64_t key) const;
+
+    static RandomStream createStream(uint64_t seed, RandomStreamType type, uint64_t key);
+
+private:
+    uint64_t locationSeed = 0;
+    std::array<RandomStream, static_cast<int>(RandomStreamType::Count)> streams;
+
+};
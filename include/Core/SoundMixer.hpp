@@ -0,0 +1,153 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <memory>
+#include <optional>
+#include <unordered_map>
+
+#include <Vector.hpp>
+
+#include "GameConstants.hpp"
+
+enum class SoundType;
+
+// Sound effect chosen to play by mixer, with attenuation and pan applied
+struct SoundVoice
+{
+    uint64_t id = 0;
+    SoundType type;
+
+    // 0 - 100, after distance attenuation (not including sound volume option)
+    float volume = 0.0f;
+
+    // -1 (left) to 1 (right)
+    float pan = 0.0f;
+
+    // Time until voice is no longer counted against limits
+    float timeRemaining = 0.0f;
+};
+
+// Plays voices chosen by mixer
+class ISoundBackend
+{
+public:
+    virtual ~ISoundBackend() = default;
+
+    virtual void playVoice(const SoundVoice& voice) = 0;
+
+    // Voice was stolen by a higher priority voice
+    virtual void stopVoice(const SoundVoice& voice) = 0;
+
+    // Backends that cannot stop individual voices leave stopped voices playing until finished
+    // Mixer keeps merged voices rather than replacing them, and counts stolen voices that keep playing in stats
+    virtual bool canStopVoices() const {return true;}
+};
+
+// Plays nothing, used when no audio device is available
+// Can record voices to check which voices would play
+class NullSoundBackend : public ISoundBackend
+{
+public:
+    inline void playVoice(const SoundVoice& voice) override {if (recording) playedVoices.push_back(voice);}
+    inline void stopVoice(const SoundVoice& voice) override {if (recording) stoppedVoices.push_back(voice);}
+    inline bool canStopVoices() const override {return stopsVoices;}
+
+    // Used to check mixer behaviour with backends that cannot stop voices
+    inline void setCanStopVoices(bool canStop) {stopsVoices = canStop;}
+
+    inline void setRecording(bool recording) {this->recording = recording;}
+    inline void clear() {playedVoices.clear(); stoppedVoices.clear();}
+
+    std::vector<SoundVoice> playedVoices;
+    std::vector<SoundVoice> stoppedVoices;
+
+private:
+    bool recording = false;
+    bool stopsVoices = true;
+};
+
+struct SoundMixerStats
+{
+    int voicesPlayed = 0;
+    int voicesMerged = 0;
+    int voicesCulled = 0;
+    int voicesStolen = 0;
+
+    // Stolen voices the backend could not stop, so still playing over limits
+    int voicesStolenStillPlaying = 0;
+
+    int voicesRejected = 0;
+};
+
+// Decides which sound effects play, and at what volume / pan
+// Positional sounds are attenuated and panned by world-wrapped distance from listener
+// Active voices are limited per sound type and globally, with quietest voice stolen by a louder one when full
+// Identical sounds started within a short time of each other are merged into one voice
+class SoundMixer
+{
+public:
+    SoundMixer();
+
+    // Backend is not owned by mixer
+    void setBackend(ISoundBackend* backend);
+
+    void setListener(pl::Vector2f position, int worldSize);
+
+    void update(float dt);
+
+    // Returns voice ID if played
+    std::optional<uint64_t> playSound(SoundType type, float volume);
+    std::optional<uint64_t> playSoundAt(SoundType type, pl::Vector2f worldPosition, float volume);
+
+    void setVoiceLimit(SoundType type, int limit);
+    inline void setGlobalVoiceLimit(int limit) {globalVoiceLimit = limit;}
+
+    void stopAllVoices();
+
+    inline const std::vector<SoundVoice>& getActiveVoices() const {return activeVoices;}
+    inline const SoundMixerStats& getStats() const {return stats;}
+    inline void resetStats() {stats = SoundMixerStats();}
+
+    // Distances in pixels, full volume within inner distance, fading to silent at max distance
+    static constexpr float ATTENUATION_INNER_DISTANCE = 4 * TILE_SIZE_PIXELS_UNSCALED;
+    static constexpr float ATTENUATION_MAX_DISTANCE = 24 * TILE_SIZE_PIXELS_UNSCALED;
+
+    // Voices are counted against limits for this long after starting, as sound lengths are not known
+    static constexpr float VOICE_DURATION = 0.35f;
+
+    static constexpr float MERGE_COOLDOWN = 0.04f;
+
+    static constexpr int DEFAULT_VOICE_LIMIT = 4;
+    static constexpr int DEFAULT_GLOBAL_VOICE_LIMIT = 16;
+
+    // Voices quieter than this after attenuation are not played
+    static constexpr float MIN_AUDIBLE_VOLUME = 1.0f;
+
+private:
+    std::optional<uint64_t> playVoice(SoundType type, float volume, float pan);
+
+    // Removes quietest active voice (of type, if given) if quieter than volume, returning whether voice was freed
+    bool stealVoice(std::optional<SoundType> type, float volume);
+
+    int getActiveVoiceCount(SoundType type) const;
+
+private:
+    ISoundBackend* backend = nullptr;
+    NullSoundBackend nullBackend;
+
+    pl::Vector2f listenerPosition;
+    int listenerWorldSize = 0;
+
+    std::vector<SoundVoice> activeVoices;
+    uint64_t voiceCounter = 0;
+
+    std::unordered_map<SoundType, int> voiceLimits;
+    int globalVoiceLimit = DEFAULT_GLOBAL_VOICE_LIMIT;
+
+    float mixerTime = 0.0f;
+    std::unordered_map<SoundType, float> lastStartTimes;
+
+    SoundMixerStats stats;
+
+};
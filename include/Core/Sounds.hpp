@@ -6,7 +6,10 @@
 #include <memory>
 #include <optional>
 
+#include <Vector.hpp>
+
 #include "Core/Tween.hpp"
+#include "Core/SoundMixer.hpp"
 
 // Enum containing all sound effects
 enum class SoundType
@@ -48,9 +51,17 @@ public:
 
     static void update(float dt);
 
-    // Play sound effect
+    // Play sound effect, not affected by listener position (e.g. UI sounds)
     static void playSound(SoundType type, float volume = 100.0f);
 
+    // Play sound effect at world position, attenuated and panned by distance from listener
+    static void playSoundAt(SoundType type, pl::Vector2f worldPosition, float volume = 100.0f);
+
+    // Use worldSize = 0 to disable planet wrapping
+    static void setListener(pl::Vector2f position, int worldSize);
+
+    inline static SoundMixer& getMixer() {return mixer;}
+
     // Play music track
     static void playMusic(MusicType type, float volume = 100.0f, float fadeTimeForCurrentMusic = 1.0f);
 
@@ -88,6 +99,10 @@ private:
     // Map storing sound objects which interface the sound buffers
     static std::unordered_map<SoundType, std::unique_ptr<pl::Sound>> soundMap;
 
+    // Chooses which sound effects play, played through sound map once sounds are loaded
+    static SoundMixer mixer;
+    static std::unique_ptr<ISoundBackend> soundBackend;
+
     // Constant map storing file paths for all sound effects
     static const std::unordered_map<SoundType, std::string> soundPaths;
 
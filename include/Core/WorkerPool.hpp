@@ -0,0 +1,49 @@
+#pragma once
+
+#include <vector>
+#include <deque>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+// Fixed set of worker threads which run dispatched jobs
+// Jobs start in dispatch order, but may complete in any order
+// Worker threads are only started on first dispatch
+class WorkerPool
+{
+public:
+    // Worker count of 0 uses hardware thread count, excluding main thread
+    WorkerPool(int workerCount = 0);
+    ~WorkerPool();
+
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    // Job is run on calling thread if no workers are available
+    void dispatch(std::function<void()> job);
+
+    // Blocks until all dispatched jobs have completed
+    void wait();
+
+    inline int getWorkerCount() const {return workerCount;}
+
+private:
+    void startWorkers();
+
+    void workerLoop();
+
+private:
+    int workerCount = 0;
+
+    std::vector<std::thread> workers;
+
+    std::deque<std::function<void()>> jobs;
+    int activeJobCount = 0;
+    bool stopping = false;
+
+    std::mutex mutex;
+    std::condition_variable jobAvailable;
+    std::condition_variable jobsFinished;
+
+};
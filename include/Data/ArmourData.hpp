@@ -6,7 +6,12 @@
 #include <Vector.hpp>
 #include <Rect.hpp>
 
+#include <extlib/cereal/types/vector.hpp>
+
+#include "Data/Serialise/Vector2Serialise.hpp"
+#include "Data/Serialise/IntRectSerialise.hpp"
 #include "Data/typedefs.hpp"
+#include "Data/GameDataCache.hpp"
 
 enum class ArmourWearType
 {
@@ -25,4 +30,12 @@ struct ArmourData
     pl::Vector2f wearTextureOffset = pl::Vector2f(0, 0);
 
     int defence = 0;
+
+    // Game data cache
+    template <class Archive>
+    void serialize(Archive& ar)
+    {
+        GameDataCache::serialiseString(ar, name);
+        ar(armourWearType, itemTexture, wearTextures, wearTextureOffset, defence);
+    }
 };
@@ -7,6 +7,8 @@
 #include <Vector.hpp>
 #include <Rect.hpp>
 
+#include <extlib/cereal/archives/binary.hpp>
+
 #include "Core/json.hpp"
 #include "Data/Serialise/Vector2Serialise.hpp"
 #include "Data/Serialise/IntRectSerialise.hpp"
@@ -19,7 +21,8 @@ class ArmourDataLoader
     ArmourDataLoader() = delete;
 
 public:
-    static bool loadData(std::string armourDataPath);
+    // Loads from json text, with any data packs already merged in
+    static bool loadData(const std::string& armourDataJson);
 
     static const ArmourData& getArmourData(ArmourType armourType);
 
@@ -27,6 +30,10 @@ public:
     
     static inline const std::string& getDataHash() {return dataHash;}
 
+    // Game data cache
+    static void saveCache(cereal::BinaryOutputArchive& archive);
+    static void loadCache(cereal::BinaryInputArchive& archive);
+
 private:
     static ArmourWearType getArmourWearTypeFromStr(const std::string& armourWearStr);
 
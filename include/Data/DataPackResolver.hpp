@@ -0,0 +1,54 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <optional>
+#include <unordered_map>
+
+#include "Core/json.hpp"
+
+// Merges data files from base data directory with data packs, applied in order
+// Data pack directories contain any of the base data files (e.g. "items.data"), whose entries add to or override
+// base entries, matched by name (or by key for keyed objects, e.g. planets)
+// Overriding entries only need to contain fields which change, e.g. {"name": "Wood", "sell-value": 5}
+// Null removes key from keyed object, e.g. {"product": "Torch", "item-requirements": {"Coal": null}}
+// New entries are added after base entries, so existing types are unchanged
+class DataPackResolver
+{
+public:
+    DataPackResolver(const std::string& baseDirectory, const std::vector<std::string>& dataPackDirectories);
+
+    // Returns merged json text of data file, or nullopt if base file could not be read
+    std::optional<std::string> loadMergedData(const std::string& fileName);
+
+    // Fields set by more than one data pack (later data pack is used)
+    inline const std::vector<std::string>& getConflicts() const {return conflicts;}
+
+    // Name of data pack, used in logs and conflicts
+    static std::string getDataPackName(const std::string& dataPackDirectory);
+
+private:
+    // Returns false if patch could not be merged, e.g. entry matches more than one base entry
+    bool mergeJson(nlohmann::ordered_json& base, const nlohmann::ordered_json& patch, const std::string& path, const std::string& dataPackName);
+
+    bool mergeEntryArray(nlohmann::ordered_json& base, const nlohmann::ordered_json& patch, const std::string& path, const std::string& dataPackName);
+
+    void setField(nlohmann::ordered_json& field, const nlohmann::ordered_json& value, const std::string& path, const std::string& dataPackName);
+
+    void logConflict(const std::string& path, const std::string& dataPackName);
+
+    // Name used to match array entries, e.g. "name" of item, or "product@crafting-station" of recipe
+    static std::optional<std::string> getEntryName(const nlohmann::ordered_json& entry);
+
+    static std::optional<nlohmann::ordered_json> readJson(const std::string& filePath);
+
+private:
+    std::string baseDirectory;
+    std::vector<std::string> dataPackDirectories;
+
+    // Data pack which last set each field path
+    std::unordered_map<std::string, std::string> fieldDataPacks;
+
+    std::vector<std::string> conflicts;
+
+};
@@ -8,8 +8,13 @@
 #include <Rect.hpp>
 
 #include "Core/CollisionRect.hpp"
+#include <extlib/cereal/types/vector.hpp>
+
+#include "Data/Serialise/Vector2Serialise.hpp"
+#include "Data/Serialise/IntRectSerialise.hpp"
 #include "Data/typedefs.hpp"
 #include "Data/ItemDrop.hpp"
+#include "Data/GameDataCache.hpp"
 
 struct EntityData
 {
@@ -33,4 +38,39 @@ struct EntityData
 
     std::string behaviour;
     std::unordered_map<std::string, float> behaviourParameters;
+
+    // Game data cache
+    template <class Archive>
+    void serialize(Archive& ar)
+    {
+        GameDataCache::serialiseString(ar, name);
+        ar(health, idleTextureRects, walkTextureRects, idleAnimSpeed, walkAnimSpeed, textureOrigin, size, itemDrops);
+        ar(hitCollision.x, hitCollision.y, hitCollision.width, hitCollision.height, damage);
+        GameDataCache::serialiseString(ar, behaviour);
+
+        uint32_t behaviourParameterCount = behaviourParameters.size();
+        ar(behaviourParameterCount);
+
+        if constexpr (Archive::is_saving::value)
+        {
+            for (auto& behaviourParameter : behaviourParameters)
+            {
+                std::string parameterName = behaviourParameter.first;
+                GameDataCache::serialiseString(ar, parameterName);
+                ar(behaviourParameter.second);
+            }
+        }
+        else
+        {
+            behaviourParameters.clear();
+            for (uint32_t i = 0; i < behaviourParameterCount; i++)
+            {
+                std::string parameterName;
+                float parameterValue;
+                GameDataCache::serialiseString(ar, parameterName);
+                ar(parameterValue);
+                behaviourParameters[parameterName] = parameterValue;
+            }
+        }
+    }
 };
\ No newline at end of file
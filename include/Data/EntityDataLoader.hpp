@@ -4,6 +4,8 @@
 #include <vector>
 #include <unordered_map>
 
+#include <extlib/cereal/archives/binary.hpp>
+
 #include "Core/json.hpp"
 #include "Data/Serialise/Vector2Serialise.hpp"
 #include "Data/Serialise/IntRectSerialise.hpp"
@@ -17,7 +19,8 @@ class EntityDataLoader
     EntityDataLoader() = delete;
 
 public:
-    static bool loadData(std::string entityDataPath);
+    // Loads from json text, with any data packs already merged in
+    static bool loadData(const std::string& entityDataJson);
 
     static const EntityData& getEntityData(EntityType entity);
 
@@ -25,6 +28,10 @@ public:
     
     static inline const std::string& getDataHash() {return dataHash;}
 
+    // Game data cache
+    static void saveCache(cereal::BinaryOutputArchive& archive);
+    static void loadCache(cereal::BinaryInputArchive& archive);
+
 private:
     static std::vector<EntityData> loaded_entityData;
 
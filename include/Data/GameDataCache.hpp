@@ -0,0 +1,139 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <optional>
+#include <unordered_map>
+#include <stdexcept>
+
+#include <extlib/cereal/archives/binary.hpp>
+
+// Compiles all game data loaded from json into a single versioned binary blob, which is
+// read directly by the data loaders on later launches while the source data files are unchanged.
+// All strings in the blob are interned into a shared string table, written ahead of the data.
+class GameDataCache
+{
+    GameDataCache() = delete;
+
+public:
+    // Loads all game data, from the cache if valid for the current data files, otherwise from json
+    // Cache is (re)written after a json load
+    static bool loadGameData(const std::string& dataDirectory, const std::string& cachePath);
+
+    // Loads all game data from json and writes the cache, for compiling ahead of distribution
+    static bool compileGameData(const std::string& dataDirectory, const std::string& cachePath);
+
+    static std::string getDefaultCachePath();
+
+    // Data pack directories, applied over base data in order (see DataPackResolver)
+    // Must be set before loading game data
+    static inline void setDataPackDirectories(const std::vector<std::string>& directories) {dataPackDirectories = directories;}
+    static inline const std::vector<std::string>& getDataPackDirectories() {return dataPackDirectories;}
+
+    // Single hash over all data files, data packs and game version, compared between host and clients
+    static inline const std::string& getDataHash() {return dataHash;}
+
+    // Hash of data files in data directory and data packs, in order applied, which cache must match to be used
+    static std::string createSourceHash(const std::string& dataDirectory);
+
+    // Used in game data serialise functions
+    template <class Archive>
+    static void serialiseString(Archive& ar, std::string& string);
+
+    template <class Archive>
+    static void serialiseOptionalString(Archive& ar, std::optional<std::string>& string);
+
+    // Container of strings, e.g. std::vector<std::string> or std::unordered_set<std::string>
+    template <class Archive, class StringContainer>
+    static void serialiseStrings(Archive& ar, StringContainer& strings);
+
+private:
+    static bool loadGameDataFromSource(const std::string& dataDirectory);
+
+    static bool readCache(const std::string& cachePath);
+    static bool writeCache(const std::string& cachePath);
+
+    static uint32_t internString(const std::string& string);
+
+private:
+    static constexpr uint32_t CACHE_MAGIC = 0x43444C50; // "PLDC"
+    static constexpr uint32_t CACHE_VERSION = 1;
+
+    static std::string dataHash;
+
+    static std::vector<std::string> dataPackDirectories;
+
+    static std::vector<std::string> stringTable;
+    static std::unordered_map<std::string, uint32_t> stringTableIndexMap;
+
+};
+
+template <class Archive>
+inline void GameDataCache::serialiseString(Archive& ar, std::string& string)
+{
+    uint32_t stringIndex = 0;
+
+    if constexpr (Archive::is_saving::value)
+    {
+        stringIndex = internString(string);
+        ar(stringIndex);
+    }
+    else
+    {
+        ar(stringIndex);
+
+        if (stringIndex >= stringTable.size())
+        {
+            throw std::out_of_range("Game data cache string index out of range");
+        }
+
+        string = stringTable[stringIndex];
+    }
+}
+
+template <class Archive>
+inline void GameDataCache::serialiseOptionalString(Archive& ar, std::optional<std::string>& string)
+{
+    bool hasValue = string.has_value();
+    ar(hasValue);
+
+    if (!hasValue)
+    {
+        string = std::nullopt;
+        return;
+    }
+
+    if constexpr (Archive::is_loading::value)
+    {
+        string = std::string();
+    }
+
+    serialiseString(ar, string.value());
+}
+
+template <class Archive, class StringContainer>
+inline void GameDataCache::serialiseStrings(Archive& ar, StringContainer& strings)
+{
+    uint32_t size = strings.size();
+    ar(size);
+
+    if constexpr (Archive::is_saving::value)
+    {
+        for (const std::string& string : strings)
+        {
+            uint32_t stringIndex = internString(string);
+            ar(stringIndex);
+        }
+    }
+    else
+    {
+        strings.clear();
+        for (uint32_t i = 0; i < size; i++)
+        {
+            std::string string;
+            serialiseString(ar, string);
+            strings.insert(strings.end(), string);
+        }
+    }
+}
@@ -8,13 +8,25 @@
 #include <Vector.hpp>
 #include <Rect.hpp>
 
+#include <extlib/cereal/types/optional.hpp>
+
+#include "Data/Serialise/IntRectSerialise.hpp"
+#include "Data/Serialise/ColorSerialise.hpp"
 #include "Data/typedefs.hpp"
 #include "Data/ObjectData.hpp"
+#include "Data/GameDataCache.hpp"
 
 struct BossSummonData
 {
     std::string bossName;
     bool useAtNight = false;
+
+    template <class Archive>
+    void serialize(Archive& ar)
+    {
+        GameDataCache::serialiseString(ar, bossName);
+        ar(useAtNight);
+    }
 };
 
 struct ConsumableData
@@ -23,6 +35,12 @@ struct ConsumableData
     int healthIncrease = 0;
     int permanentHealthIncrease = 0;
     int speedIncreaseDuration = 0;
+
+    template <class Archive>
+    void serialize(Archive& ar)
+    {
+        ar(cooldownTime, healthIncrease, permanentHealthIncrease, speedIncreaseDuration);
+    }
 };
 
 struct ItemData
@@ -76,4 +94,16 @@ struct ItemData
 
         return nameColor;
     }
+
+    // Game data cache
+    template <class Archive>
+    void serialize(Archive& ar)
+    {
+        GameDataCache::serialiseString(ar, name);
+        GameDataCache::serialiseOptionalString(ar, displayName);
+        GameDataCache::serialiseString(ar, description);
+        ar(textureRect, maxStackSize, placesObjectType, toolType, armourType, projectileType, placesLand, bossSummonData, consumableData,
+            isMaterial, currencyValue, sellValue, nameColor);
+        GameDataCache::serialiseString(ar, achievementUnlockOnObtain);
+    }
 };
\ No newline at end of file
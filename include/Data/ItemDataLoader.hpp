@@ -8,6 +8,8 @@
 #include <Vector.hpp>
 #include <Rect.hpp>
 
+#include <extlib/cereal/archives/binary.hpp>
+
 #include "Core/json.hpp"
 #include "Data/Serialise/IntRectSerialise.hpp"
 #include "Data/Serialise/ColorSerialise.hpp"
@@ -22,7 +24,8 @@ class ItemDataLoader
     ItemDataLoader() = delete;
 
 public:
-    static bool loadData(std::string itemDataPath);
+    // Loads from json text, with any data packs already merged in
+    static bool loadData(const std::string& itemDataJson);
 
     static const ItemData& getItemData(ItemType item);
 
@@ -52,6 +55,10 @@ public:
     
     static inline const std::string& getDataHash() {return dataHash;}
 
+    // Game data cache
+    static void saveCache(cereal::BinaryOutputArchive& archive);
+    static void loadCache(cereal::BinaryInputArchive& archive);
+
 private:
     static void createCurrencyItemOrderVector();
 
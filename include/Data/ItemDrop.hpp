@@ -8,4 +8,10 @@ struct ItemDrop
     unsigned int minAmount;
     unsigned int maxAmount;
     float chance;
+
+    template <class Archive>
+    void serialize(Archive& ar)
+    {
+        ar(item, minAmount, maxAmount, chance);
+    }
 };
\ No newline at end of file
@@ -8,8 +8,16 @@
 #include <Vector.hpp>
 #include <Rect.hpp>
 
+#include <extlib/cereal/types/vector.hpp>
+#include <extlib/cereal/types/optional.hpp>
+#include <extlib/cereal/types/unordered_map.hpp>
+#include <extlib/cereal/types/utility.hpp>
+
+#include "Data/Serialise/Vector2Serialise.hpp"
+#include "Data/Serialise/IntRectSerialise.hpp"
 #include "Data/typedefs.hpp"
 #include "Data/ItemDrop.hpp"
+#include "Data/GameDataCache.hpp"
 
 struct PlantStageObjectData
 {
@@ -21,6 +29,12 @@ struct PlantStageObjectData
     int maxDay = 0;
 
     std::vector<ItemDrop> itemDrops;
+
+    template <class Archive>
+    void serialize(Archive& ar)
+    {
+        ar(textureRects, textureOrigin, health, minDay, maxDay, itemDrops);
+    }
 };
 
 struct RocketObjectData
@@ -36,6 +50,14 @@ struct RocketObjectData
     // So string is stored, then planet type is loaded into available destinations
     std::vector<std::string> availableDestinationStrings;
     std::vector<std::string> availableRoomDestinationStrings;
+
+    template <class Archive>
+    void serialize(Archive& ar)
+    {
+        ar(textureRect, textureOrigin, launchPosition, availableDestinations, availableRoomDestinations);
+        GameDataCache::serialiseStrings(ar, availableDestinationStrings);
+        GameDataCache::serialiseStrings(ar, availableRoomDestinationStrings);
+    }
 };
 
 struct NPCObjectData
@@ -48,6 +70,15 @@ struct NPCObjectData
     std::vector<ItemCount> shopItems;
     std::unordered_map<ItemType, float> buyPriceMults;
     std::unordered_map<ItemType, float> sellPriceMults;
+
+    template <class Archive>
+    void serialize(Archive& ar)
+    {
+        GameDataCache::serialiseString(ar, npcName);
+        ar(behaviour, portraitTextureOffset);
+        GameDataCache::serialiseStrings(ar, dialogueLines);
+        ar(shopItems, buyPriceMults, sellPriceMults);
+    }
 };
 
 struct ObjectData
@@ -96,4 +127,16 @@ struct ObjectData
     bool setSpawnPoint = false;
 
     bool mythicalItem = false;
+
+    // Game data cache
+    template <class Archive>
+    void serialize(Archive& ar)
+    {
+        GameDataCache::serialiseString(ar, name);
+        ar(health, textureRects, textureFrameDelay, textureOrigin, size, lightEmissionFrames, lightAbsorption, hasCollision, placeOnWater,
+            drawLayer);
+        GameDataCache::serialiseString(ar, craftingStation);
+        ar(craftingStationLevel, chestCapacity, minimumDamage, itemDrops, rocketObjectData, plantStageObjectData, npcObjectData, isLandmark,
+            setSpawnPoint, mythicalItem);
+    }
 };
\ No newline at end of file
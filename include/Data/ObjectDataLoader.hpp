@@ -8,6 +8,8 @@
 #include <Vector.hpp>
 #include <Rect.hpp>
 
+#include <extlib/cereal/archives/binary.hpp>
+
 #include "Core/json.hpp"
 #include "Data/Serialise/Vector2Serialise.hpp"
 #include "Data/Serialise/ColorSerialise.hpp"
@@ -20,7 +22,8 @@ class ObjectDataLoader
     ObjectDataLoader() = delete;
 
 public:
-    static bool loadData(std::string objectDataPath);
+    // Loads from json text, with any data packs already merged in
+    static bool loadData(const std::string& objectDataJson);
 
     static bool loadRocketPlanetDestinations(const std::unordered_map<std::string, PlanetType>& planetStringToTypeMap,
         const std::unordered_map<std::string, RoomType>& roomStringToTypeMap);
@@ -33,6 +36,10 @@ public:
     
     static inline const std::string& getDataHash() {return dataHash;}
 
+    // Game data cache
+    static void saveCache(cereal::BinaryOutputArchive& archive);
+    static void loadCache(cereal::BinaryInputArchive& archive);
+
 private:
     static std::vector<ObjectData> loaded_objectData;
 
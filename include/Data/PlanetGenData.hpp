@@ -9,7 +9,14 @@
 #include <Graphics/Color.hpp>
 #include <Vector.hpp>
 
+#include <extlib/cereal/types/map.hpp>
+#include <extlib/cereal/types/vector.hpp>
+
+#include "Data/Serialise/Vector2Serialise.hpp"
+#include "Data/Serialise/ColorSerialise.hpp"
 #include "Data/typedefs.hpp"
+#include "Data/GameDataCache.hpp"
+#include "Data/SpawnTable.hpp"
 
 struct TileMapData
 {
@@ -20,6 +27,14 @@ struct TileMapData
     pl::Vector2<int> textureOffset;
     int variation;
     pl::Color mapColor;
+
+    // Game data cache
+    template <class Archive>
+    void serialize(Archive& ar)
+    {
+        GameDataCache::serialiseString(ar, name);
+        ar(tileID, drawLayer, textureOffset, variation, mapColor);
+    }
 };
 
 struct TileGenData
@@ -29,24 +44,48 @@ struct TileGenData
     float noiseRangeMax;
     bool objectsCanSpawn;
     int tileID;
+
+    template <class Archive>
+    void serialize(Archive& ar)
+    {
+        ar(noiseRangeMin, noiseRangeMax, objectsCanSpawn, tileID);
+    }
 };
 
 struct ObjectGenData
 {
     ObjectType object;
     float spawnChance;
+
+    template <class Archive>
+    void serialize(Archive& ar)
+    {
+        ar(object, spawnChance);
+    }
 };
 
 struct EntityGenData
 {
     EntityType entity;
     float spawnChance;
+
+    template <class Archive>
+    void serialize(Archive& ar)
+    {
+        ar(entity, spawnChance);
+    }
 };
 
 struct StructureGenData
 {
     StructureType structure;
     float spawnChance;
+
+    template <class Archive>
+    void serialize(Archive& ar)
+    {
+        ar(structure, spawnChance);
+    }
 };
 
 struct FishCatchData
@@ -54,6 +93,12 @@ struct FishCatchData
     ItemType itemCatch;
     int count;
     float chance;
+
+    template <class Archive>
+    void serialize(Archive& ar)
+    {
+        ar(itemCatch, count, chance);
+    }
 };
 
 struct BiomeGenData
@@ -78,6 +123,67 @@ struct BiomeGenData
     float resourceRegenerationDensity;
 
     std::unordered_set<std::string> bossesSpawnAllowedNames;
+
+    // Compiled from gen datas after loading, not serialised
+    SpawnTable<ObjectType> objectSpawnTable;
+    SpawnTable<EntityType> entitySpawnTable;
+    SpawnTable<StructureType> structureSpawnTable;
+    SpawnTable<int> fishCatchSpawnTable; // index into fishCatchDatas
+
+    // Indexed by tile ID
+    std::vector<bool> tileObjectsCanSpawn;
+
+    inline bool canObjectsSpawnOnTile(int tileID) const
+    {
+        return (tileID >= 0 && tileID < tileObjectsCanSpawn.size() && tileObjectsCanSpawn[tileID]);
+    }
+
+    inline void compileSpawnTables()
+    {
+        objectSpawnTable.clear();
+        for (const ObjectGenData& objectGenData : objectGenDatas)
+        {
+            objectSpawnTable.addEntry(objectGenData.object, objectGenData.spawnChance);
+        }
+
+        entitySpawnTable.clear();
+        for (const EntityGenData& entityGenData : entityGenDatas)
+        {
+            entitySpawnTable.addEntry(entityGenData.entity, entityGenData.spawnChance);
+        }
+
+        structureSpawnTable.clear();
+        for (const StructureGenData& structureGenData : structureGenDatas)
+        {
+            structureSpawnTable.addEntry(structureGenData.structure, structureGenData.spawnChance);
+        }
+
+        fishCatchSpawnTable.clear();
+        for (int i = 0; i < fishCatchDatas.size(); i++)
+        {
+            fishCatchSpawnTable.addEntry(i, fishCatchDatas[i].chance);
+        }
+
+        tileObjectsCanSpawn.clear();
+        for (const auto& [tileID, tileGenData] : tileGenDatas)
+        {
+            if (tileID >= tileObjectsCanSpawn.size())
+            {
+                tileObjectsCanSpawn.resize(tileID + 1, false);
+            }
+            tileObjectsCanSpawn[tileID] = tileGenData.objectsCanSpawn;
+        }
+    }
+
+    // Game data cache
+    template <class Archive>
+    void serialize(Archive& ar)
+    {
+        GameDataCache::serialiseString(ar, name);
+        ar(tileGenDatas, tileGenDataDrawOrder, objectGenDatas, entityGenDatas, structureGenDatas, fishCatchDatas, waterColor, noiseRangeMin,
+            noiseRangeMax, resourceRegenerationTimeMin, resourceRegenerationTimeMax, resourceRegenerationDensity);
+        GameDataCache::serialiseStrings(ar, bossesSpawnAllowedNames);
+    }
 };
 
 struct PlanetGenData
@@ -104,4 +210,16 @@ struct PlanetGenData
     std::unordered_set<std::string> bossesSpawnAllowedNames;
 
     std::string achievementUnlockOnTravel;
+
+    // Game data cache
+    template <class Archive>
+    void serialize(Archive& ar)
+    {
+        GameDataCache::serialiseString(ar, name);
+        GameDataCache::serialiseString(ar, displayName);
+        ar(biomeGenDatas, waterTextureOffset, cliffTextureOffset, worldSize, heightNoiseFrequency, biomeNoiseFrequency, riverNoiseFrequency,
+            riverNoiseRangeMin, riverNoiseRangeMax);
+        GameDataCache::serialiseStrings(ar, bossesSpawnAllowedNames);
+        GameDataCache::serialiseString(ar, achievementUnlockOnTravel);
+    }
 };
\ No newline at end of file
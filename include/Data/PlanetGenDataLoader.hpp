@@ -8,6 +8,8 @@
 #include <Vector.hpp>
 #include <Rect.hpp>
 
+#include <extlib/cereal/archives/binary.hpp>
+
 #include "Core/json.hpp"
 #include "Data/PlanetGenData.hpp"
 #include "Data/typedefs.hpp"
@@ -26,7 +28,8 @@ class PlanetGenDataLoader
     PlanetGenDataLoader() = delete;
 
 public:
-    static bool loadData(std::string planetGenDataPath);
+    // Loads from json text, with any data packs already merged in
+    static bool loadData(const std::string& planetGenDataJson);
 
     static const PlanetGenData& getPlanetGenData(PlanetType planetType);
 
@@ -40,6 +43,10 @@ public:
 
     static inline const std::string& getDataHash() {return dataHash;}
 
+    // Game data cache
+    static void saveCache(cereal::BinaryOutputArchive& archive);
+    static void loadCache(cereal::BinaryInputArchive& archive);
+
 private:
     static bool loadPlanet(nlohmann::ordered_json::iterator& planetData, const nlohmann::ordered_json& allPlanetGenData);
 
@@ -5,8 +5,13 @@
 #include <vector>
 #include <string>
 
+#include <extlib/cereal/types/map.hpp>
+#include <extlib/cereal/types/vector.hpp>
+#include <extlib/cereal/types/optional.hpp>
+
 #include "Data/ItemData.hpp"
 #include "Data/ItemDataLoader.hpp"
+#include "Data/GameDataCache.hpp"
 
 struct RecipeData
 {
@@ -38,4 +43,13 @@ struct RecipeData
         }
         return std::hash<std::string>{}(toHash);
     }
+
+    // Game data cache
+    template <class Archive>
+    void serialize(Archive& ar)
+    {
+        ar(product, productAmount, itemRequirements, keyItems);
+        GameDataCache::serialiseString(ar, craftingStationRequired);
+        ar(craftingStationLevelRequired);
+    }
 };
\ No newline at end of file
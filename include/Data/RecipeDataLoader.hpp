@@ -5,6 +5,8 @@
 #include <string>
 #include <iostream>
 
+#include <extlib/cereal/archives/binary.hpp>
+
 #include "Core/json.hpp"
 
 #include "Data/RecipeData.hpp"
@@ -16,7 +18,8 @@ class RecipeDataLoader
     RecipeDataLoader() = delete;
 
 public:
-    static bool loadData(std::string recipeDataPath);
+    // Loads from json text, with any data packs already merged in
+    static bool loadData(const std::string& recipeDataJson);
 
     // static const std::vector<RecipeData>& getRecipeData();
 
@@ -30,6 +33,10 @@ public:
     
     static inline const std::string& getDataHash() {return dataHash;}
 
+    // Game data cache
+    static void saveCache(cereal::BinaryOutputArchive& archive);
+    static void loadCache(cereal::BinaryInputArchive& archive);
+
 private:
     // static std::vector<RecipeData> loaded_recipeData;
     static std::unordered_map<uint64_t, RecipeData> loaded_recipeData;
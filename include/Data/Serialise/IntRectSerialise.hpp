@@ -23,6 +23,12 @@ void serialize(Archive& ar, pl::Rect<uint16_t>& rect)
     ar(rect.x, rect.y, rect.width, rect.height);
 }
 
+template <class Archive>
+void serialize(Archive& ar, pl::Rect<int>& rect)
+{
+    ar(rect.x, rect.y, rect.width, rect.height);
+}
+
 };
 
 inline void from_json(const nlohmann::json& json, CollisionRect& rect)
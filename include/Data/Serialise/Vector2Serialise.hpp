@@ -14,6 +14,12 @@ inline void from_json(const nlohmann::json& json, pl::Vector2<T>& vector)
     vector.y = json[1];
 }
 
+template <class Archive, class T>
+void serialize(Archive& ar, pl::Vector2<T>& vector)
+{
+    ar(vector.x, vector.y);
+}
+
 template <class T>
 inline void to_json(nlohmann::json& json, const pl::Vector2<T>& vector)
 {
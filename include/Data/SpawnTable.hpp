@@ -0,0 +1,65 @@
+#pragma once
+
+#include <vector>
+#include <optional>
+#include <algorithm>
+
+// Cumulative spawn chances compiled from gen datas, sampled by binary search
+// Gives the same result as walking gen datas in order and accumulating chances until reaching roll,
+// so world generation from a seed is unchanged
+template <typename T>
+class SpawnTable
+{
+public:
+    SpawnTable() = default;
+
+    inline void clear()
+    {
+        values.clear();
+        cumulativeChances.clear();
+    }
+
+    inline void addEntry(T value, float chance)
+    {
+        float cumulativeChance = cumulativeChances.empty() ? 0.0f : cumulativeChances.back();
+        cumulativeChance += chance;
+
+        values.push_back(value);
+        cumulativeChances.push_back(cumulativeChance);
+    }
+
+    // Gets first entry where cumulative chance (scaled by probability mult) reaches roll
+    // Returns nullopt if roll is greater than total chance
+    inline std::optional<T> sample(float roll, float probabilityMult = 1.0f) const
+    {
+        auto iter = cumulativeChances.end();
+
+        if (probabilityMult == 1.0f)
+        {
+            iter = std::lower_bound(cumulativeChances.begin(), cumulativeChances.end(), roll);
+        }
+        else
+        {
+            iter = std::lower_bound(cumulativeChances.begin(), cumulativeChances.end(), roll, [probabilityMult](float cumulativeChance, float roll)
+            {
+                return cumulativeChance * probabilityMult < roll;
+            });
+        }
+
+        if (iter == cumulativeChances.end())
+        {
+            return std::nullopt;
+        }
+
+        return values[iter - cumulativeChances.begin()];
+    }
+
+    inline float getTotalChance() const {return cumulativeChances.empty() ? 0.0f : cumulativeChances.back();}
+
+    inline bool isEmpty() const {return values.empty();}
+
+private:
+    std::vector<T> values;
+    std::vector<float> cumulativeChances;
+
+};
@@ -12,7 +12,10 @@
 #include <extlib/cereal/types/unordered_map.hpp>
 #include <extlib/cereal/types/optional.hpp>
 
+#include "Data/Serialise/Vector2Serialise.hpp"
+#include "Data/Serialise/IntRectSerialise.hpp"
 #include "Data/typedefs.hpp"
+#include "Data/GameDataCache.hpp"
 #include "Player/InventoryData.hpp"
 
 struct RoomObjectData
@@ -22,11 +25,11 @@ struct RoomObjectData
     // Chest contents, if is chest
     std::optional<std::vector<InventoryData>> chestContents = std::nullopt;
 
-    // template <class Archive>
-    // void serialize(Archive& ar)
-    // {
-    //     ar(objectType, chestContents);
-    // }
+    template <class Archive>
+    void serialize(Archive& ar)
+    {
+        ar(objectType, chestContents);
+    }
 };
 
 struct RoomData
@@ -45,6 +48,17 @@ struct RoomData
     std::unordered_map<uint8_t, RoomObjectData> objectsInRoom;
 
     std::string achievementUnlockOnTravel;
+
+    // Game data cache
+    template <class Archive>
+    void serialize(Archive& ar)
+    {
+        ar(tileSize, textureRect, collisionBitmaskOffset);
+        GameDataCache::serialiseString(ar, name);
+        GameDataCache::serialiseString(ar, displayName);
+        ar(isTravelLocation, objectsInRoom);
+        GameDataCache::serialiseString(ar, achievementUnlockOnTravel);
+    }
 };
 
 struct StructureData
@@ -61,4 +75,12 @@ struct StructureData
 
     // RoomData roomData;
     RoomType roomType;
+
+    // Game data cache
+    template <class Archive>
+    void serialize(Archive& ar)
+    {
+        GameDataCache::serialiseString(ar, name);
+        ar(size, textureRect, textureOrigin, collisionBitmaskOffset, lightBitmaskOffset, roomType);
+    }
 };
\ No newline at end of file
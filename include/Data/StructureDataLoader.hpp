@@ -7,6 +7,8 @@
 #include <Vector.hpp>
 #include <Rect.hpp>
 
+#include <extlib/cereal/archives/binary.hpp>
+
 #include "Core/json.hpp"
 #include "Data/StructureData.hpp"
 #include "Data/typedefs.hpp"
@@ -22,7 +24,8 @@ class StructureDataLoader
     StructureDataLoader() = delete;
 
 public:
-    static bool loadData(std::string structureDataPath);
+    // Loads from json text, with any data packs already merged in
+    static bool loadData(const std::string& structureDataJson);
 
     static const StructureData& getStructureData(StructureType structureType);
 
@@ -36,6 +39,10 @@ public:
 
     static inline const std::string& getDataHash() {return dataHash;}
 
+    // Game data cache
+    static void saveCache(cereal::BinaryOutputArchive& archive);
+    static void loadCache(cereal::BinaryInputArchive& archive);
+
 private:
     static void loadChestContents(RoomObjectData& roomObjectData, nlohmann::ordered_json::iterator objectIter);
 
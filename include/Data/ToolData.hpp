@@ -7,6 +7,13 @@
 #include <Vector.hpp>
 #include <Rect.hpp>
 
+#include <extlib/cereal/types/vector.hpp>
+
+#include "Data/Serialise/Vector2Serialise.hpp"
+#include "Data/Serialise/IntRectSerialise.hpp"
+#include "Data/typedefs.hpp"
+#include "Data/GameDataCache.hpp"
+
 enum ToolBehaviourType
 {
     Pickaxe,
@@ -41,6 +48,14 @@ struct ProjectileData
     // Double link with item data, as projectiles are required to be dynamically taken from inventory
     // based on projectile type, not item type
     ItemType itemType;
+
+    // Game data cache
+    template <class Archive>
+    void serialize(Archive& ar)
+    {
+        GameDataCache::serialiseString(ar, name);
+        ar(textureRect, origin, damageLow, damageHigh, speed, collisionRadius, collisionOffset, itemType);
+    }
 };
 
 struct ToolData
@@ -66,5 +81,13 @@ struct ToolData
     pl::Vector2<int> shootOffset;
 
     // Melee weapon stuff
-    
+
+    // Game data cache
+    template <class Archive>
+    void serialize(Archive& ar)
+    {
+        GameDataCache::serialiseString(ar, name);
+        ar(toolBehaviourType, textureRects, pivot, holdOffset, damage, fishingRodLineOffset, fishingEfficiency, projectileShootTypes, shootPower,
+            projectileDamageMult, shootOffset);
+    }
 };
\ No newline at end of file
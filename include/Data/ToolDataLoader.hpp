@@ -7,6 +7,8 @@
 #include <Vector.hpp>
 #include <Rect.hpp>
 
+#include <extlib/cereal/archives/binary.hpp>
+
 #include "Core/json.hpp"
 #include "Data/Serialise/Vector2Serialise.hpp"
 #include "Data/Serialise/IntRectSerialise.hpp"
@@ -19,7 +21,8 @@ class ToolDataLoader
     ToolDataLoader() = delete;
 
 public:
-    static bool loadData(std::string toolDataPath);
+    // Loads from json text, with any data packs already merged in
+    static bool loadData(const std::string& toolDataJson);
 
     static const ToolData& getToolData(ToolType tool);
 
@@ -31,6 +34,10 @@ public:
     
     static inline const std::string& getDataHash() {return dataHash;}
 
+    // Game data cache
+    static void saveCache(cereal::BinaryOutputArchive& archive);
+    static void loadCache(cereal::BinaryInputArchive& archive);
+
 private:
     static ToolBehaviourType getToolBehaviourTypeFromStr(const std::string& toolBehaviourStr);
 
@@ -69,6 +69,7 @@ public:
     void testCollisionWithPlayer(Player& player, int worldSize) override;
 
     void testProjectileCollision(Projectile& projectile, int worldSize) override;
+    std::optional<CollisionRect> getProjectileHitBounds() const override;
 
     void getWorldObjects(std::vector<WorldObject*>& worldObjects) override;
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <vector>
+#include <optional>
 
 #include <extlib/cereal/archives/binary.hpp>
 #include <extlib/cereal/types/memory.hpp>
@@ -16,9 +17,12 @@
 
 #include "Object/WorldObject.hpp"
 
+#include "Core/CollisionRect.hpp"
+
 #include "Entity/Projectile/Projectile.hpp"
 #include "Entity/Projectile/ProjectileManager.hpp"
 #include "Entity/HitRect.hpp"
+#include "Entity/HitboxHistory.hpp"
 
 class Game;
 class Player;
@@ -50,6 +54,10 @@ public:
 
     virtual void testProjectileCollision(Projectile& projectile, int worldSize) {}
 
+    // Bounds of collision tested in testProjectileCollision, used to only test nearby projectiles
+    // All projectiles are tested if no bounds
+    virtual std::optional<CollisionRect> getProjectileHitBounds() const {return std::nullopt;}
+
     virtual void testHitRectCollision(const std::vector<HitRect>& hitRects, int worldSize) {}
 
     virtual void getWorldObjects(std::vector<WorldObject*>& worldObjects) = 0;
@@ -62,6 +70,8 @@ public:
     void setName(const std::string& name);
     const std::string& getName();
 
+    inline HitboxObjectID getHitboxObjectID() const {return hitboxObjectID;}
+
     template <class Archive>
     void save(Archive& ar) const
     {
@@ -93,6 +103,8 @@ protected:
 
     std::string name;
 
+    HitboxObjectID hitboxObjectID = HitboxHistory::createObjectID();
+
 };
 
 // CEREAL_REGISTER_TYPE(BossEntity);
\ No newline at end of file
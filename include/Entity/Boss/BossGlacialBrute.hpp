@@ -69,6 +69,7 @@ public:
     void testCollisionWithPlayer(Player& player, int worldSize) override;
 
     void testProjectileCollision(Projectile& projectile, int worldSize) override;
+    std::optional<CollisionRect> getProjectileHitBounds() const override;
 
     void testHitRectCollision(const std::vector<HitRect>& hitRects, int worldSize) override;
 
@@ -115,9 +116,9 @@ private:
 
     void updateCollision();
 
-    void throwSnowball(ProjectileManager& projectileManager, Player& player, int worldSize);
+    void throwSnowball(ProjectileManager& projectileManager, ChunkManager& chunkManager, Player& player, int worldSize);
 
-    void shootSnowball(ProjectileManager& projectileManager, Player& player, int worldSize);
+    void shootSnowball(ProjectileManager& projectileManager, ChunkManager& chunkManager, Player& player, int worldSize);
 
 private:
     enum class BossGlacialBruteState : uint8_t
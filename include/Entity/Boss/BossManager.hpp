@@ -32,6 +32,7 @@
 class Player;
 class Game;
 class ChunkManager;
+struct HitboxSnapshot;
 
 class BossManager
 {
@@ -44,7 +45,7 @@ public:
 
     void update(Game& game, ProjectileManager& projectileManager, ChunkManager& chunkManager, std::vector<Player*>& players, float dt, float gameTime);
 
-    void testHitRectCollision(const std::vector<HitRect>& hitRects, int worldSize);
+    void testHitRectCollision(const std::vector<HitRect>& hitRects, int worldSize, const HitboxSnapshot* rewindSnapshot = nullptr);
 
     // void handleWorldWrap(pl::Vector2f positionDelta);
 
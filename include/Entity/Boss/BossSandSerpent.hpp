@@ -71,6 +71,7 @@ public:
     void testCollisionWithPlayer(Player& player, int worldSize) override;
 
     void testProjectileCollision(Projectile& projectile, int worldSize) override;
+    std::optional<CollisionRect> getProjectileHitBounds() const override;
 
     void testHitRectCollision(const std::vector<HitRect>& hitRects, int worldSize) override;
 
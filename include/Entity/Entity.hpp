@@ -14,9 +14,12 @@
 #include "Core/ResolutionHandler.hpp"
 #include "Core/CollisionRect.hpp"
 #include "Core/AnimatedTexture.hpp"
+#include "Core/Random.hpp"
+#include "Core/MemoryTracker.hpp"
 
 #include "Object/WorldObject.hpp"
 #include "World/ChunkManager.hpp"
+#include "World/EntityUpdateScheduler.hpp"
 #include "Data/EntityData.hpp"
 #include "Data/EntityDataLoader.hpp"
 #include "Data/ItemData.hpp"
@@ -24,6 +27,7 @@
 
 #include "Entity/EntityPOD.hpp"
 #include "Entity/HitRect.hpp"
+#include "Entity/HitboxHistory.hpp"
 #include "Entity/Projectile/ProjectileManager.hpp"
 #include "Entity/EntityBehaviour/EntityBehaviour.hpp"
 
@@ -36,13 +40,16 @@
 class Game;
 class ChunkManager;
 
-class Entity : public WorldObject
+class Entity : public WorldObject, public MemoryTracked<MemoryCategory::Entities>
 {
 public:
-    Entity(pl::Vector2f position, EntityType entityType);
+    // Random stream should be derived from planet seed, e.g. from planet entity spawn stream, so entity behaviour is reproducible
+    Entity(pl::Vector2f position, EntityType entityType, const RandomStream& randomStream = RandomStream());
     Entity() = default;
 
-    void update(float dt, ProjectileManager& projectileManager, ChunkManager& chunkManager, Game& game, bool onWater, float gameTime, bool networkUpdateOnly);
+    // Behaviour is only updated if updateBehaviour is true, and is given time since it was last updated
+    void update(float dt, ProjectileManager& projectileManager, ChunkManager& chunkManager, Game& game, bool onWater, float gameTime, bool networkUpdateOnly,
+        bool updateBehaviour = true);
 
     void draw(pl::RenderTarget& window, pl::SpriteBatch& spriteBatch, Game& game, const Camera& camera, float dt, float gameTime, int worldSize, const pl::Color& color) const override;
     // void createLightSource(LightingEngine& lightingEngine, pl::Vector2f topLeftChunkPos) const override;
@@ -75,6 +82,13 @@ public:
 
     inline bool isAlive() {return health > 0;}
 
+    // Used by behaviours, so entity movement does not depend on global random state
+    inline RandomStream& getRandomStream() {return randomStream;}
+
+    inline EntityUpdateSchedule& getUpdateSchedule() {return updateSchedule;}
+
+    inline HitboxObjectID getHitboxObjectID() const {return hitboxObjectID;}
+
     EntityPOD getPOD(pl::Vector2f chunkPosition);
     void loadFromPOD(const EntityPOD& pod, pl::Vector2f chunkPosition);
 
@@ -102,4 +116,10 @@ private:
     AnimatedTextureMinimal idleAnim;
     AnimatedTextureMinimal walkAnim;
 
+    RandomStream randomStream;
+
+    EntityUpdateSchedule updateSchedule;
+
+    HitboxObjectID hitboxObjectID = HitboxHistory::createObjectID();
+
 };
\ No newline at end of file
@@ -3,13 +3,14 @@
 #include <Vector.hpp>
 #include <Rect.hpp>
 
+#include "Core/MemoryTracker.hpp"
 #include "Player/LocationState.hpp"
 
 class Game;
 class Entity;
 class ChunkManager;
 
-class EntityBehaviour
+class EntityBehaviour : public MemoryTracked<MemoryCategory::Entities>
 {
 public:
     EntityBehaviour() = default;
@@ -9,6 +9,7 @@
 #include <Vector.hpp>
 
 #include "Data/typedefs.hpp"
+#include "Core/Random.hpp"
 
 struct EntityPOD
 {
@@ -16,11 +17,19 @@ struct EntityPOD
     pl::Vector2f chunkRelativePosition;
     pl::Vector2f velocity;
 
+    // Not present in version 1 saves, in which case entity keeps stream created on construction
+    std::optional<RandomStream> randomStream;
+
     template <class Archive>
     void serialize(Archive& ar, const std::uint32_t version)
     {
         ar(entityType, chunkRelativePosition.x, chunkRelativePosition.y, velocity.x, velocity.y);
+
+        if (version >= 2)
+        {
+            ar(randomStream);
+        }
     }
 };
 
-CEREAL_CLASS_VERSION(EntityPOD, 1);
\ No newline at end of file
+CEREAL_CLASS_VERSION(EntityPOD, 2);
\ No newline at end of file
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstdint>
+#include <array>
+#include <vector>
+#include <unordered_map>
+
+#include <Vector.hpp>
+
+#include "Entity/HitRect.hpp"
+
+#include "GameConstants.hpp"
+
+class ChunkManager;
+class BossManager;
+
+// Stable ID of entity or boss in hitbox history, as objects may be deleted and memory reused between snapshots
+using HitboxObjectID = uint32_t;
+
+// Positions of entities and bosses on a planet at a network tick
+struct HitboxSnapshot
+{
+    uint32_t networkTick = 0;
+    std::unordered_map<HitboxObjectID, pl::Vector2f> objectPositions;
+
+    // Offset from object's position at snapshot to current position, or zero if object not in snapshot
+    pl::Vector2f getRewindOffset(HitboxObjectID objectID, pl::Vector2f position, int worldSize) const;
+};
+
+// Host-side history of entity and boss positions on a planet, used for lag compensation
+// Clients see entities and bosses as last sent by host, so hits reported by clients are tested
+// against positions at the network tick of the entity / boss data the client was viewing
+class HitboxHistory
+{
+public:
+    // Hits are not rewound further than this before current tick
+    static constexpr float MAX_REWIND_TIME = 0.3f;
+    static constexpr uint32_t MAX_REWIND_TICKS = static_cast<uint32_t>(MAX_REWIND_TIME / SERVER_UPDATE_TICK);
+
+    HitboxHistory() = default;
+
+    void recordSnapshot(uint32_t networkTick, ChunkManager& chunkManager, BossManager& bossManager);
+
+    // Replaces oldest snapshot with empty snapshot at network tick, for object positions to be added to
+    HitboxSnapshot& beginSnapshot(uint32_t networkTick);
+
+    // Gets latest snapshot at or before view tick, with rewind limited to MAX_REWIND_TIME before current tick
+    // Returns null if no snapshot is available
+    const HitboxSnapshot* getRewindSnapshot(uint32_t viewNetworkTick, uint32_t currentNetworkTick) const;
+
+    void clear();
+
+    // Hit rects moved from rewound positions to current position of object
+    static std::vector<HitRect> rewindHitRects(const std::vector<HitRect>& hitRects, const HitboxSnapshot* snapshot,
+        HitboxObjectID objectID, pl::Vector2f position, int worldSize);
+
+    // IDs are unique for lifetime of game, thread safe as entities are created on worker threads
+    static HitboxObjectID createObjectID();
+
+private:
+    // Ignore rewinds further than this, e.g. if object has teleported
+    static constexpr float MAX_REWIND_DISTANCE = 6 * TILE_SIZE_PIXELS_UNSCALED;
+
+    static constexpr int MAX_SNAPSHOTS = 32;
+
+    std::array<HitboxSnapshot, MAX_SNAPSHOTS> snapshots;
+    int nextSnapshotIndex = 0;
+    int snapshotCount = 0;
+
+};
@@ -17,6 +17,7 @@
 #include "Core/Camera.hpp"
 #include "Core/Helper.hpp"
 #include "Core/CollisionCircle.hpp"
+#include "Core/Random.hpp"
 
 #include "Data/typedefs.hpp"
 #include "Data/ToolData.hpp"
@@ -34,13 +35,18 @@ enum class HitLayer : uint8_t
 
 class Projectile
 {
+    // Projectile manager stores projectiles as structure of arrays
+    friend class ProjectileManager;
+
 public:
     Projectile();
     // Angle in DEGREES
-    Projectile(pl::Vector2f position, float angle, ProjectileType type, float damageMult, float shootPower, HitLayer hitLayer);
-    Projectile(pl::Vector2f position, pl::Vector2f velocity, ProjectileType type, float damageMult, HitLayer hitLayer);
+    // Damage is rolled from random stream, which should be the planet projectile stream so damage is reproducible from planet seed
+    Projectile(pl::Vector2f position, float angle, ProjectileType type, float damageMult, float shootPower, HitLayer hitLayer, RandomStream& randomStream);
+    Projectile(pl::Vector2f position, pl::Vector2f velocity, ProjectileType type, float damageMult, HitLayer hitLayer, RandomStream& randomStream);
 
-    void update(float dt, int worldSize);
+    // Updated through projectile manager
+    static constexpr float MAX_TIME_ALIVE = 3.0f;
 
     void draw(pl::RenderTarget& window, pl::SpriteBatch& spriteBatch, const ChunkManager& chunkManager, const Camera& camera) const;
 
@@ -118,7 +124,7 @@ public:
     }
 
 private:
-    void initialise(pl::Vector2f position, pl::Vector2f velocity, ProjectileType type, float damageMult, HitLayer hitLayer);
+    void initialise(pl::Vector2f position, pl::Vector2f velocity, ProjectileType type, float damageMult, HitLayer hitLayer, RandomStream& randomStream);
 
     ProjectileType projectileType;
     uint8_t damage;
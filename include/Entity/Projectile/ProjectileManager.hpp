@@ -3,6 +3,9 @@
 #include <vector>
 #include <memory>
 #include <cstdint>
+#include <cmath>
+#include <algorithm>
+#include <utility>
 
 #include <Graphics/SpriteBatch.hpp>
 #include <Graphics/Color.hpp>
@@ -17,12 +20,16 @@
 #include "Network/PacketData/PacketDataWorld/PacketDataProjectileCreateRequest.hpp"
 
 #include "Core/Camera.hpp"
+#include "Core/CollisionRect.hpp"
+#include "Core/Helper.hpp"
 
 #include "Projectile.hpp"
 
 class Game;
 class ChunkManager;
 
+// Projectiles are stored as structure of arrays, and removed by swapping with last projectile
+// A world-wrapped uniform grid of projectile positions is rebuilt once per tick, so hit tests only visit projectiles in nearby cells
 class ProjectileManager
 {
 public:
@@ -38,7 +45,19 @@ public:
 
     // void createProjectileWithID(uint16_t id, const Projectile& projectile);
 
-    std::vector<Projectile>& getProjectiles();
+    // Calls function with each projectile which may collide with bounds (including dead projectiles)
+    // Projectile passed is a copy, with only alive state written back after function call
+    template <class Function>
+    void forEachProjectileNear(const CollisionRect& bounds, int worldSize, Function function);
+
+    template <class Function>
+    void forEachProjectile(Function function);
+
+    Projectile getProjectile(int index) const;
+    std::vector<Projectile> getProjectiles() const;
+
+    // Used to replace projectiles with those sent from host
+    void overwriteProjectiles(const ProjectileManager& projectileManager);
 
     uint16_t getProjectileCount() const;
 
@@ -47,17 +66,111 @@ public:
     void clear();
 
     template <class Archive>
-    void serialize(Archive& ar, const std::uint32_t version)
+    void save(Archive& ar, const std::uint32_t version) const
     {
+        std::vector<Projectile> projectiles = getProjectiles();
         ar(projectiles);
     }
 
+    template <class Archive>
+    void load(Archive& ar, const std::uint32_t version)
+    {
+        std::vector<Projectile> projectiles;
+        ar(projectiles);
+
+        clear();
+        for (const Projectile& projectile : projectiles)
+        {
+            pushProjectile(projectile);
+        }
+    }
+
 private:
-    std::vector<Projectile> projectiles;
+    void pushProjectile(const Projectile& projectile);
+    void removeProjectile(int index);
+
+    void rebuildGrid(int worldSize);
+
+    template <class Function>
+    void callWithProjectile(int index, Function& function);
+
+private:
+    std::vector<pl::Vector2f> positions;
+    std::vector<pl::Vector2f> velocities;
+    std::vector<float> timesAlive;
+    std::vector<ProjectileType> types;
+    std::vector<uint8_t> damages;
+    std::vector<HitLayer> hitLayers;
+    std::vector<uint8_t> alive;
+
+    // Grid cells are chunk sized, stored as (cell index, projectile index) sorted by cell index
+    static constexpr float GRID_CELL_SIZE = CHUNK_TILE_SIZE * TILE_SIZE_PIXELS_UNSCALED;
+    std::vector<std::pair<uint32_t, int>> gridCellProjectiles;
+    bool gridDirty = true;
+    int gridWorldSize = 0;
+
+    // Furthest projectile collision circle extends from projectile position, added to query bounds
+    float gridQueryMargin = 0.0f;
 
     Game* game;
     PlanetType planetType;
 
 };
 
+template <class Function>
+inline void ProjectileManager::forEachProjectileNear(const CollisionRect& bounds, int worldSize, Function function)
+{
+    if (positions.size() <= 0 || worldSize <= 0)
+    {
+        return;
+    }
+
+    if (gridDirty || gridWorldSize != worldSize)
+    {
+        rebuildGrid(worldSize);
+    }
+
+    int cellMinX = std::floor((bounds.x - gridQueryMargin) / GRID_CELL_SIZE);
+    int cellMinY = std::floor((bounds.y - gridQueryMargin) / GRID_CELL_SIZE);
+    int cellMaxX = std::floor((bounds.x + bounds.width + gridQueryMargin) / GRID_CELL_SIZE);
+    int cellMaxY = std::floor((bounds.y + bounds.height + gridQueryMargin) / GRID_CELL_SIZE);
+
+    // Prevent visiting wrapped cells twice
+    int cellCountX = std::min(cellMaxX - cellMinX + 1, worldSize);
+    int cellCountY = std::min(cellMaxY - cellMinY + 1, worldSize);
+
+    for (int y = 0; y < cellCountY; y++)
+    {
+        for (int x = 0; x < cellCountX; x++)
+        {
+            uint32_t cellIndex = Helper::wrap(cellMinY + y, worldSize) * worldSize + Helper::wrap(cellMinX + x, worldSize);
+
+            auto cellBegin = std::lower_bound(gridCellProjectiles.begin(), gridCellProjectiles.end(), std::pair<uint32_t, int>(cellIndex, 0));
+
+            for (auto iter = cellBegin; iter != gridCellProjectiles.end() && iter->first == cellIndex; iter++)
+            {
+                callWithProjectile(iter->second, function);
+            }
+        }
+    }
+}
+
+template <class Function>
+inline void ProjectileManager::forEachProjectile(Function function)
+{
+    int projectileCount = positions.size();
+    for (int i = 0; i < projectileCount; i++)
+    {
+        callWithProjectile(i, function);
+    }
+}
+
+template <class Function>
+inline void ProjectileManager::callWithProjectile(int index, Function& function)
+{
+    Projectile projectile = getProjectile(index);
+    function(projectile);
+    alive[index] = projectile.alive;
+}
+
 CEREAL_CLASS_VERSION(ProjectileManager, 1);
\ No newline at end of file
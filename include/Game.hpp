@@ -18,6 +18,7 @@
 #define _USE_MATH_DEFINES
 #include <cmath>
 #include <array>
+#include <limits>
 #include <unordered_map>
 #include <string>
 
@@ -32,6 +33,8 @@
 #include "Core/Camera.hpp"
 #include "Core/Tween.hpp"
 #include "Core/InputManager.hpp"
+#include "Core/WorkerPool.hpp"
+#include "Core/MemoryTracker.hpp"
 
 #include "World/ChunkManager.hpp"
 #include "World/ChestDataPool.hpp"
@@ -63,6 +66,7 @@
 
 #include "Entity/Boss/BossManager.hpp"
 #include "Entity/Projectile/ProjectileManager.hpp"
+#include "Entity/HitboxHistory.hpp"
 
 #include "Data/typedefs.hpp"
 
@@ -80,8 +84,10 @@
 #include "GUI/DemoEndGUI.hpp"
 
 #include "Network/NetworkHandler.hpp"
+#include "Network/CommandConsole.hpp"
 
 #include "IO/GameSaveIO.hpp"
+#include "IO/ReplayRecorder.hpp"
 
 class Game
 {
@@ -92,6 +98,29 @@ public:
 
     void run();
 
+    // Replays recording headlessly from save it was recorded from, checking state each frame against recording
+    // Returns 0 if replay did not diverge
+    int runReplay(const std::string& replayPath);
+
+    // Records sessions from loaded saves to replays directory
+    inline void setReplayRecordingEnabled(bool enabled) {replayRecordingEnabled = enabled;}
+    inline ReplayRecorder& getReplayRecorder() {return replayRecorder;}
+
+    // Loads save headlessly and executes each line of script as an admin command, saving on completion
+    // Returns 0 if all commands succeeded
+    int runCommandScript(const std::string& saveName, const std::string& scriptPath);
+
+    // Generates planet chunks within chunk radius of spawn (or whole planet if no radius) headlessly, writing them into planet save
+    // Planet is generated twice to check generation is deterministic, second time on a single worker
+    // Seed, if given, must match save seed
+    // Returns 0 if generated and written
+    int runPlanetPregeneration(const std::string& saveName, const std::string& planetName, std::optional<int> chunkRadius, std::optional<int> seed);
+
+    // Loads save headlessly, then loads and unloads planet (which must not be the current planet), checking tracked memory
+    // of each category returns to what it was before planet was loaded
+    // Returns 0 if no category leaked
+    int runMemoryTest(const std::string& saveName, const std::string& planetName);
+
 public:
     // Chest
     void openChest(ChestObject& chest, std::optional<LocationState> chestLocationState, bool initiatedClientSide);
@@ -124,12 +153,16 @@ public:
     void landmarkDestroyed(const LandmarkObject& landmark);
 
     // Melee combat
-    void testMeleeCollision(const LocationState& locationState, const std::vector<HitRect>& hitRects, pl::Vector2f hitOrigin);
+    // View network tick is the host network tick the requesting client was viewing, used to rewind hit targets
+    void testMeleeCollision(const LocationState& locationState, const std::vector<HitRect>& hitRects, pl::Vector2f hitOrigin,
+        std::optional<uint32_t> viewNetworkTick = std::nullopt);
 
     // Item pickups created alert
     // void itemPickupsCreated(const std::vector<ItemPickupReference>& itemPickupsCreated, std::optional<LocationState> pickupsLocationState);
 
-    void drawWorld(pl::Framebuffer& renderTexture, float dt, std::vector<WorldObject*>& worldObjects, WorldData& worldData, const Camera& cameraArg);
+    // Particles and weather are only drawn if drawParticles is set
+    void drawWorld(pl::Framebuffer& renderTexture, float dt, std::vector<WorldObject*>& worldObjects, WorldData& worldData, const Camera& cameraArg,
+        bool drawParticles = true);
 
     void joinWorld(const PacketDataJoinInfo& joinInfo);
     void quitWorld();
@@ -147,8 +180,9 @@ public:
     // Networking
     void joinedLobby(bool requiresNameInput);
 
-    void handleChunkRequestsFromClient(const PacketDataChunkRequests& chunkRequests, const SteamNetworkingIdentity& client);
+    void handleChunkRequestsFromClient(const PacketDataChunkRequests& chunkRequests, uint64_t clientID);
     void handleChunkDataFromHost(const PacketDataChunkDatas& chunkDataPacket);
+    void handleChunkEditsFromHost(const PacketDataChunkEdits& chunkEditsPacket);
 
     std::optional<ObjectReference> setupPlanetTravel(PlanetType planetType, const LocationState& currentLocation, ObjectReference rocketObjectUsed, std::optional<uint64_t> clientID);
     bool travelToRoomDestinationForClient(RoomType roomDest, const LocationState& currentLocation, ObjectReference rocketObjectUsed, uint64_t clientID);
@@ -183,6 +217,7 @@ public:
     ProjectileManager& getProjectileManager(std::optional<PlanetType> planetTypeOverride = std::nullopt);
     BossManager& getBossManager(std::optional<PlanetType> planetTypeOverride = std::nullopt);
     LandmarkManager& getLandmarkManager(std::optional<PlanetType> planetTypeOverride = std::nullopt);
+    HitboxHistory& getHitboxHistory(std::optional<PlanetType> planetTypeOverride = std::nullopt);
     RoomPool& getStructureRoomPool(std::optional<PlanetType> planetTypeOverride = std::nullopt);
     Room& getRoomDestination(std::optional<RoomType> roomDestOverride = std::nullopt);
     ChestDataPool& getChestDataPool(std::optional<LocationState> locationState = std::nullopt);
@@ -203,6 +238,20 @@ public:
 
     inline const std::string& getPlayerName() {return currentSaveFileSummary.playerName;}
 
+    // Steam ID of this player, or 0 if Steam is not initialised
+    uint64_t getLocalPlayerID() const;
+
+    // Commands
+    // Executes command on host, replying to issuer in chat
+    void executeChatCommand(uint64_t issuerID, const std::string& message);
+    inline CommandConsole& getCommandConsole() {return commandConsole;}
+
+    // Moves player within their current location, sent to client if network player
+    void teleportPlayer(uint64_t playerID, pl::Vector2f position);
+    void teleportLocalPlayer(pl::Vector2f position);
+
+    bool saveGame();
+
     inline float getGameTime() {return gameTime;}
     inline void setGameTime(float gameTime) {this->gameTime = gameTime;}
 
@@ -212,6 +261,19 @@ public:
     
 private:
 
+    void runFrame(float dt);
+
+    // -- Replay -- //
+
+    // Save is read before load changes any state, and recording begins at end of the frame the save was loaded in
+    void prepareReplayRecording(const std::string& saveName);
+    void beginReplayRecording(float loadFrameDt);
+
+    // Hash of loaded chunks, entities and inventories
+    // Chunks with unchanged content reuse cached hash unless full chunk hash is requested
+    uint64_t getReplayStateHash(bool fullChunkHash);
+
+
     // -- Main Menu -- //
 
     void runMainMenu(float dt);
@@ -231,6 +293,16 @@ private:
     void updateActivePlanets(float dt);
     void updateActiveRoomDests(float dt);
 
+    // Planet update which may run on worker thread
+    struct ActivePlanetUpdate
+    {
+        PlanetType planetType;
+        std::vector<ChunkViewRange> chunkViewRanges;
+        std::vector<BufferedPacket> packetBuffer;
+    };
+
+    void updateActivePlanetChunks(ActivePlanetUpdate& planetUpdate, float dt);
+
     void drawLighting(float dt, std::vector<WorldObject*>& worldObjects);
 
     void testEnterStructure();
@@ -288,6 +360,15 @@ private:
     // Returns spawn chunk
     ChunkPosition initialiseNewPlanet(PlanetType planetType);
 
+    // Loads planet from save and pregenerates chunks, returning all chunks of planet ordered by position
+    std::vector<ChunkPOD> pregeneratePlanet(PlanetType planetType, std::optional<int> chunkRadius, WorkerPool& workerPool);
+
+    // Loads planet and chunks around spawn, then unloads planet
+    void loadAndUnloadPlanet(PlanetType planetType);
+
+    // Measures untagged containers (tile map vertices, chest inventories, room grids) of loaded planets and rooms for memory stats
+    void measureContainerMemory();
+
 
     // -- Game State / Transition -- //
 
@@ -306,7 +387,6 @@ private:
     // -- Save / load -- //
 
     void startNewGame(int seed);
-    bool saveGame();
     bool loadGame(const SaveFileSummary& saveFileSummary);
 
     void initialiseWorldData(PlanetType planetType);
@@ -353,6 +433,10 @@ private:
     pl::SpriteBatch spriteBatch;
     pl::Framebuffer worldTexture;
 
+    // World objects drawn on planet, reused between frames
+    std::vector<WorldObject*> visibleWorldObjects;
+    VisibleObjectStats visibleObjectStats;
+
     bool steamInitialised;
 
     float gameTime;
@@ -373,6 +457,7 @@ private:
     pl::Vector2f mouseScreenPos;
 
     ChatGUI chatGUI;
+    CommandConsole commandConsole;
 
     DemoEndGUI demoEndGUI;
     
@@ -400,6 +485,15 @@ private:
 
     NetworkHandler networkHandler;
 
+    // Used to update active planets in parallel when host
+    WorkerPool planetWorkerPool;
+    bool parallelPlanetUpdates = true;
+    bool updatingPlanetsInParallel = false;
+
+    ReplayRecorder replayRecorder;
+    bool replayRecordingEnabled = false;
+    std::optional<ReplayRecording> pendingReplayRecording;
+
     std::array<pl::Texture, 2> waterNoiseTextures;
 
     GameState gameState;
@@ -428,6 +522,9 @@ private:
     LocationState destinationLocationState;
     bool travelTrigger = false;
 
+    // Rocket landed during parallel planet update, so exit is deferred to main thread
+    bool rocketExitPending = false;
+
     Tween<float> floatTween;
 
 };
\ No newline at end of file
@@ -21,6 +21,8 @@
 
 #include "Core/InputManager.hpp"
 
+#include "IO/ReplayRecording.hpp"
+
 #include "World/ChunkPOD.hpp"
 #include "World/ChestDataPool.hpp"
 #include "World/RoomPool.hpp"
@@ -57,6 +59,9 @@ struct PlayerGameSave
     int day;
 
     int timePlayed = 0;
+
+    // Command console permission levels of network players
+    std::unordered_map<uint64_t, int> permissionLevels;
 };
 
 // Stores current state of item and object types, mapped to their respective names
@@ -234,10 +239,16 @@ class GameSaveIO
 public:
     GameSaveIO() = default;
     GameSaveIO(std::string fileName);
+
+    // Reads / writes save at directory directly, rather than save in data home with file name
+    // Used by offline tools, e.g. savetool
+    void setSaveDirectory(const std::string& directory);
     
     bool loadPlayerSave(PlayerGameSave& playerGameSave);
     // bool load(PlayerGameSave& playerGameSave, PlanetGameSave& planetGameSave);
     bool loadPlanetSave(PlanetType planetType, PlanetGameSave& planetGameSave);
+    // Reads decompressed planet save without deserialising, e.g. for savetool to deserialise chunks individually
+    bool readPlanetSaveData(PlanetType planetType, std::vector<char>& planetSaveData);
     bool loadRoomDestinationSave(RoomType roomDestinationType, RoomDestinationGameSave& roomDestinationGameSave);
 
     // bool writePlayerSave(const PlayerGameSave& playerGameSave, const PlanetGameSave& planetGameSave);
@@ -255,9 +266,27 @@ public:
     bool writeInputBindingsSave(const InputBindingsSave& inputBindingsSave);
     bool loadInputBindingsSave(InputBindingsSave& inputBindingsSave);
 
+    // Reads / writes all files in save directory, paths relative to save directory
+    // Used to store the save a replay was recorded from
+    bool readSaveFiles(std::vector<std::pair<std::string, std::vector<char>>>& saveFiles);
+    bool writeSaveFiles(const std::vector<std::pair<std::string, std::vector<char>>>& saveFiles);
+
+    // Creates replay file in replays directory and writes recording start (frames are not written), outputs path written to
+    bool writeReplayHeader(const ReplayRecording& replayRecording, std::string& path);
+
+    // Appends block of frames to replay file, so frames are streamed to disk during recording
+    static bool appendReplayFrames(const std::string& path, const std::vector<ReplayFrame>& frames);
+
+    // Reads header and all frame blocks
+    bool loadReplay(const std::string& path, ReplayRecording& replayRecording);
+
 private:
     void createSaveDirectoryIfRequired();
 
+    // Closes file written at path with ".tmp" appended and moves it over path
+    // Throws if file could not be written or moved
+    static bool replaceFileWithTemporary(const std::string& path, std::fstream& temporaryOut);
+
     // Used to temporarily switch save file name, to be able to load all save files and create summaries
     bool loadPlayerSaveFromName(std::string fileName, PlayerGameSave& playerGameSave);
 
@@ -267,9 +296,13 @@ private:
     // std::string getPlanetGameDataVersionMappingFileName(PlanetType planetType);
     // std::string getRoomDestinationGameDataVersionMappingFileName(RoomType roomDestinationType);
 
+    // Directory of save files (with trailing slash)
+    std::string getSaveDir();
+
     std::string getRootDir();
 
 private:
     std::string fileName;
+    std::string saveDirectoryOverride;
 
 };
\ No newline at end of file
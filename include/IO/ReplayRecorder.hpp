@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "IO/ReplayRecording.hpp"
+
+// Records frame times, input and received packets from when a save is loaded, so the session can be replayed
+// State hashes are recorded each frame, to find the first frame at which a replay diverges
+// Recording start is written when recording begins, and frames are appended to the replay file in blocks
+class ReplayRecorder
+{
+public:
+    ReplayRecorder() = default;
+
+    void begin(const ReplayRecording& recordingStart);
+
+    // Writes remaining frames to replay file
+    bool end();
+
+    inline bool isRecording() const {return recording;}
+
+    void recordPacket(uint64_t senderID, const char* data, int size);
+    void recordNetworkEvent(ReplayNetworkEventType type, uint64_t id);
+
+    void endFrame(float dt, const InputFrameState& inputState, uint64_t stateHash);
+
+    inline int getFrameCount() const {return frameCount;}
+
+    // State hash of chunks is fully recomputed on these frames, and only for chunks with changed content on other frames
+    // Frames must be counted from start of recording / replay so recording and replay hash the same way
+    static constexpr int FULL_STATE_HASH_INTERVAL = 60;
+    static inline bool isFullStateHashFrame(int frame) {return (frame % FULL_STATE_HASH_INTERVAL) == 0;}
+
+private:
+    bool flushFrames();
+
+private:
+    static constexpr int FRAME_FLUSH_INTERVAL = 300;
+
+    bool recording = false;
+
+    std::string saveName;
+    std::string replayPath;
+
+    std::vector<ReplayFrame> pendingFrames;
+    int frameCount = 0;
+
+    ReplayFrame currentFrame;
+
+};
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <extlib/cereal/archives/binary.hpp>
+#include <extlib/cereal/types/vector.hpp>
+#include <extlib/cereal/types/string.hpp>
+#include <extlib/cereal/types/unordered_map.hpp>
+#include <extlib/cereal/types/utility.hpp>
+
+#include "Core/InputManager.hpp"
+
+// Packet received through NetworkHandler during a recorded frame
+struct ReplayPacket
+{
+    uint64_t senderID = 0;
+    std::vector<char> data;
+
+    template <class Archive>
+    void serialize(Archive& ar)
+    {
+        ar(senderID, data);
+    }
+};
+
+// Network state changes from Steam callbacks, which are not caused by received packets
+enum class ReplayNetworkEventType : uint8_t
+{
+    LobbyCreated,
+    PlayerLeft
+};
+
+struct ReplayNetworkEvent
+{
+    ReplayNetworkEventType type;
+    uint64_t id = 0;
+
+    template <class Archive>
+    void serialize(Archive& ar)
+    {
+        ar(type, id);
+    }
+};
+
+struct ReplayFrame
+{
+    float dt = 0.0f;
+
+    // Applied at start of frame, before input and packets
+    std::vector<ReplayNetworkEvent> networkEvents;
+
+    InputFrameState inputState;
+    std::vector<ReplayPacket> packets;
+
+    // Hash of chunk, entity and inventory state at end of frame
+    uint64_t stateHash = 0;
+
+    template <class Archive>
+    void serialize(Archive& ar)
+    {
+        ar(dt, networkEvents, inputState, packets, stateHash);
+    }
+};
+
+// Recording of a session from a loaded save, replayed through Game::runReplay
+struct ReplayRecording
+{
+    std::string gameDataHash;
+
+    // Save files at start of recording, paths relative to save directory
+    std::string saveName;
+    std::vector<std::pair<std::string, std::vector<char>>> saveFiles;
+
+    // Seed for non-gameplay randomness (Helper::getRandom)
+    uint64_t randomSeed = 0;
+
+    uint64_t localSteamID = 0;
+
+    InputFrameState initialInputState;
+
+    // Hash of state immediately after save was loaded, checked before first frame is replayed
+    uint64_t loadStateHash = 0;
+
+    // Frame time of frame save was loaded in, as state transition is updated after load in that frame
+    float loadFrameDt = 0.0f;
+
+    // Frames start from frame after save was loaded
+    std::vector<ReplayFrame> frames;
+
+    template <class Archive>
+    void serialize(Archive& ar, const std::uint32_t version)
+    {
+        ar(gameDataHash, saveName, saveFiles, randomSeed, localSteamID, initialInputState, frames);
+
+        // Replays before version 2 recorded load frame as first frame, and will diverge on load
+        if (version >= 2)
+        {
+            ar(loadStateHash, loadFrameDt);
+        }
+    }
+};
+
+CEREAL_CLASS_VERSION(ReplayRecording, 2);
@@ -0,0 +1,114 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "Network/PacketData/PacketDataWorld/PacketDataChunkRequests.hpp"
+#include "Network/PacketData/PacketDataWorld/PacketDataChunkDatas.hpp"
+#include "Network/PacketData/PacketDataWorld/PacketDataChunkResyncRequests.hpp"
+
+#include "World/ChunkPosition.hpp"
+#include "World/ChunkViewRange.hpp"
+
+#include "Core/MemoryTracker.hpp"
+
+#include "Data/typedefs.hpp"
+
+class Game;
+class Chunk;
+class NetworkHandler;
+
+// Counters for chunk streaming to clients
+struct ChunkStreamStats
+{
+    int chunksSent = 0;
+    int chunksGenerated = 0;
+    int encodeCacheHits = 0;
+    int encodeCacheMisses = 0;
+    int bytesSent = 0;
+
+    // Modified chunks resynced with object edits only, or already up to date
+    int chunksResyncedByEdits = 0;
+    int objectEditsSent = 0;
+    int chunksUpToDate = 0;
+};
+
+// Host-side streaming of chunks requested by clients
+// Requested chunks are queued per client and sent closest to the client's view centre first,
+// limited by a per-frame chunk generation budget (shared between clients) and a per-client byte budget
+// Encoded chunk datas are cached against chunk content version, so are reused between clients viewing the same area
+// Modified chunks are resynced with only the objects edited since the client's content version where possible
+class ChunkStreamer
+{
+public:
+    ChunkStreamer() = default;
+
+    void queueChunkRequests(uint64_t clientID, const PacketDataChunkRequests& chunkRequests);
+
+    // Sends object edits since client's content version for each chunk, or queues full chunk if edits are not logged
+    void resyncChunks(uint64_t clientID, const PacketDataChunkResyncRequests& resyncRequests, Game& game, NetworkHandler& networkHandler);
+
+    // Sends queued chunks to clients within budgets
+    void update(Game& game, NetworkHandler& networkHandler, float dt);
+
+    void removeClient(uint64_t clientID);
+    void reset();
+
+    using EncodedChunkData = std::vector<char, TrackedAllocator<char, MemoryCategory::Packets>>;
+
+    // Gets encoded chunk data from cache, re-encoding if chunk has changed since cached
+    const EncodedChunkData& getEncodedChunkData(PlanetType planetType, Chunk& chunk);
+
+    int getQueuedChunkCount() const;
+    int getCachedChunkCount() const;
+    inline const ChunkStreamStats& getStats() const {return stats;}
+
+private:
+    struct ClientChunkStream
+    {
+        PlanetType planetType = -1;
+        std::unordered_set<ChunkPosition> queuedChunks;
+
+        // Bytes of chunk data which can be sent, refilled over time
+        float byteAllowance = MAX_CLIENT_BYTE_ALLOWANCE;
+    };
+
+    struct CachedChunkData
+    {
+        uint64_t contentVersion = 0;
+        EncodedChunkData encodedChunkData;
+        float lastUsedTime = 0.0f;
+    };
+
+    void streamChunksToClient(uint64_t clientID, ClientChunkStream& clientStream, Game& game, NetworkHandler& networkHandler, int& generationBudget);
+
+    std::vector<ChunkPosition> getChunksInSendOrder(const ClientChunkStream& clientStream, const ChunkViewRange& clientViewRange, int worldSize);
+
+    void pruneCache();
+
+private:
+    // Chunks generated for clients across all clients per frame
+    static constexpr int MAX_CHUNK_GENERATIONS_PER_FRAME = 4;
+
+    // Uncompressed chunk data bytes per client
+    static constexpr float CLIENT_BYTES_PER_SECOND = 256.0f * 1024.0f;
+    static constexpr float MAX_CLIENT_BYTE_ALLOWANCE = 48.0f * 1024.0f;
+
+    static constexpr float CACHED_CHUNK_DATA_LIFETIME = 30.0f;
+    static constexpr float CACHE_PRUNE_TIME = 5.0f;
+
+    std::unordered_map<uint64_t, ClientChunkStream> clientStreams;
+
+    // Rotated each frame so no client takes priority over generation budget
+    int clientStartIndex = 0;
+
+    std::unordered_map<PlanetType, std::unordered_map<ChunkPosition, CachedChunkData>> chunkDataCache;
+
+    float streamTime = 0.0f;
+    float cachePruneTime = 0.0f;
+
+    ChunkStreamStats stats;
+
+};
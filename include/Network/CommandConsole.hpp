@@ -0,0 +1,136 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <optional>
+#include <functional>
+#include <unordered_map>
+
+#include "Data/typedefs.hpp"
+
+class Game;
+
+enum class PermissionLevel : uint8_t
+{
+    Player,
+    Moderator,
+    Admin
+};
+
+enum class CommandArgType
+{
+    Player,
+    Int,
+    Float,
+    Item,
+    PermissionLevel,
+    Text
+};
+
+struct CommandArg
+{
+    std::string name;
+    CommandArgType type;
+    bool optional = false;
+};
+
+// Argument parsed and validated against its command arg type
+struct CommandArgValue
+{
+    bool present = false;
+
+    uint64_t playerID = 0;
+    int intValue = 0;
+    float floatValue = 0.0f;
+    ItemType itemType = -1;
+    PermissionLevel permissionLevel = PermissionLevel::Player;
+    std::string text;
+};
+
+struct CommandContext
+{
+    uint64_t issuerID;
+    PermissionLevel permissionLevel;
+};
+
+struct CommandResult
+{
+    bool success;
+    std::string reply;
+};
+
+struct Command
+{
+    std::string name;
+    std::string description;
+    PermissionLevel permissionLevel;
+    std::vector<CommandArg> args;
+
+    std::function<CommandResult(Game&, const CommandContext&, const std::vector<CommandArgValue>&)> execute;
+};
+
+// Host-side chat commands, e.g. "/give player wood 10"
+// Commands are parsed from chat messages starting with '/', validated against the command's typed args
+// and the issuing player's permission level, with the reply routed back to the issuing player only
+// Permission levels are stored in the player save, the host player is always an admin
+class CommandConsole
+{
+public:
+    CommandConsole();
+
+    static inline bool isCommand(const std::string& message) {return message.size() > 1 && message[0] == '/';}
+
+    void registerCommand(const Command& command);
+
+    // Registers assertion commands used by command scripts, which are not available in normal games
+    void registerScriptCommands();
+
+    // Parses and executes command as issuer, with the issuer's permission level
+    CommandResult execute(Game& game, uint64_t issuerID, const std::string& message);
+
+    // Executes with admin permission regardless of issuer (used for host player and command scripts)
+    CommandResult executeAsAdmin(Game& game, uint64_t issuerID, const std::string& message);
+
+    // Executes with given permission level regardless of issuer (used for command scripts testing permissions)
+    CommandResult executeAsPermissionLevel(Game& game, uint64_t issuerID, PermissionLevel permissionLevel, const std::string& message);
+
+    PermissionLevel getPermissionLevel(uint64_t playerID) const;
+    void setPermissionLevel(uint64_t playerID, PermissionLevel permissionLevel);
+
+    // Stored in player save
+    std::unordered_map<uint64_t, int> getPermissionLevelsSave() const;
+    void loadPermissionLevelsSave(const std::unordered_map<uint64_t, int>& permissionLevelsSave);
+
+    static const char* getPermissionLevelName(PermissionLevel permissionLevel);
+
+    // Name is matched ignoring case
+    static std::optional<PermissionLevel> getPermissionLevelFromName(const std::string& name);
+
+private:
+    CommandResult executeWithPermission(Game& game, const CommandContext& context, const std::string& message);
+
+    // Splits by whitespace, with quotes used to group words, e.g. "Iron Ore"
+    static std::vector<std::string> tokenise(const std::string& message);
+
+    // Returns error message if argument is not valid for type
+    static std::optional<std::string> parseArg(Game& game, const CommandContext& context, const CommandArg& arg, const std::string& token,
+        CommandArgValue& value);
+
+    static std::optional<uint64_t> findPlayer(Game& game, const CommandContext& context, const std::string& name);
+
+    // Issuer may act on themselves, or on players with a lower permission level than their own
+    // Host is always admin, and can act on every player
+    bool canActOnPlayer(Game& game, const CommandContext& context, uint64_t targetID) const;
+
+    static std::string getUsage(const Command& command);
+
+    void registerDefaultCommands();
+
+private:
+    std::vector<Command> commands;
+    std::unordered_map<std::string, int> commandNameToIndex;
+
+    std::unordered_map<uint64_t, PermissionLevel> permissionLevels;
+
+};
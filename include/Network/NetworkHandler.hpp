@@ -2,6 +2,7 @@
 
 #include <extlib/steam/steam_api.h>
 
+#include <algorithm>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -13,6 +14,10 @@
 #include "Network/Packet.hpp"
 #include "Network/IPacketData.hpp"
 #include "Network/PacketData/PacketDataIncludes.hpp"
+#include "Network/ChunkStreamer.hpp"
+#include "Network/NetworkTelemetry.hpp"
+
+#include "IO/ReplayRecording.hpp"
 
 #include "GUI/InventoryGUI.hpp"
 #include "World/ChunkPosition.hpp"
@@ -25,6 +30,15 @@ class Game;
 class ChatGUI;
 class MainMenuGUI;
 
+// Packet to client held until flushed
+struct BufferedPacket
+{
+    uint64_t steamID;
+    Packet packet;
+    int nSendFlags;
+    int nRemoteChannel;
+};
+
 class NetworkHandler
 {
 public:
@@ -38,6 +52,13 @@ public:
 
     void receiveMessages(ChatGUI& chatGUI, MainMenuGUI& mainMenuGUI);
 
+    // Replay of recorded session
+    // Packets are not sent while replaying, and received packets are taken from the recording
+    inline void setReplaying(bool replaying) {this->replaying = replaying;}
+    inline bool isReplaying() const {return replaying;}
+    void setReplayFrame(const ReplayFrame& replayFrame);
+    void applyReplayNetworkEvents(const ReplayFrame& replayFrame);
+
     void update(float dt);
 
     void updateNetworkPlayers(float dt, const LocationState& locationState);
@@ -48,6 +69,12 @@ public:
 
     void leaveLobby();
 
+    // Executes command if host, otherwise sends to host to execute
+    void sendChatCommand(const PacketDataChatMessage& chatMessagePacket);
+
+    // Host-specific, disconnects client as if host had quit
+    void kickPlayer(uint64_t id);
+
     EResult sendPacketToClientsAtLocation(const Packet& packet, int nSendFlags, int nRemoteChannel, const LocationState& locationState);
 
     EResult sendPacketToClients(const Packet& packet, int nSendFlags, int nRemoteChannel, std::unordered_set<uint64_t> exceptions = {});
@@ -57,8 +84,16 @@ public:
     // Sends packet to host if is client, or sends packet to all clients if is host
     EResult sendPacketToServer(const Packet& packet, int nSendFlags, int nRemoteChannel);
 
+    // Packets sent to clients from calling thread are added to buffer instead of sent, until buffer is reset to null
+    // Used for planet updates on worker threads, with buffer flushed from main thread
+    static void setThreadPacketBuffer(std::vector<BufferedPacket>* packetBuffer);
+    void flushPacketBuffer(std::vector<BufferedPacket>& packetBuffer);
+
     void requestChunksFromHost(PlanetType planetType, std::vector<ChunkPosition>& chunks, bool forceRequest = false);
 
+    // Host-specific
+    inline ChunkStreamer& getChunkStreamer() {return chunkStreamer;}
+
     void queueSendPlayerData();
     void sendPlayerData();
 
@@ -78,7 +113,9 @@ public:
     std::vector<Player*> getPlayersAtLocation(const LocationState& locationState, Player* thisPlayer);
     std::unordered_map<uint64_t, NetworkPlayer*> getNetworkPlayersAtLocation(const LocationState& locationState);
 
-    std::vector<WorldObject*> getNetworkPlayersToDraw(const Camera& camera, const LocationState& locationState, pl::Vector2f playerPosition, float gameTime);
+    // Appends network players at location to world objects
+    void getNetworkPlayersToDraw(const Camera& camera, const LocationState& locationState, pl::Vector2f playerPosition, float gameTime,
+        std::vector<WorldObject*>& worldObjects);
 
     std::vector<ChunkViewRange> getNetworkPlayersChunkViewRanges(PlanetType planetType);
 
@@ -93,15 +130,25 @@ public:
     void setSavedNetworkPlayerData(uint64_t id, const PlayerData& networkPlayerData);
     const std::unordered_map<uint64_t, PlayerData> getSavedNetworkPlayerDataMap();
 
+    // Packets sent / received by peer and packet type
+    inline const NetworkTelemetry& getTelemetry() const {return telemetry;}
+
+    // Host network tick, incremented each update tick
+    inline uint32_t getNetworkTick() const {return networkTick;}
+
+    // Host network tick of entity and boss data currently shown (client only)
+    // Sent in hit requests, as this is the state the client aimed at, which may be older than latest host tick received
+    inline uint32_t getViewNetworkTick() const {return std::min(entityViewNetworkTick, bossViewNetworkTick);}
+
     int getTotalBytesSent() const;
     int getTotalBytesReceived() const;
     float getByteSendRate(float dt) const;
     float getByteReceiveRate(float dt) const;
 
 private:
-    void processMessage(const SteamNetworkingMessage_t& message, const Packet& packet, ChatGUI& chatGUI, MainMenuGUI& mainMenuGUI);
-    void processMessageAsHost(const SteamNetworkingMessage_t& message, const Packet& packet, ChatGUI& chatGUI);
-    void processMessageAsClient(const SteamNetworkingMessage_t& message, const Packet& packet, ChatGUI& chatGUI, MainMenuGUI& mainMenuGUI);
+    void processMessage(uint64_t senderID, const Packet& packet, ChatGUI& chatGUI, MainMenuGUI& mainMenuGUI);
+    void processMessageAsHost(uint64_t senderID, const Packet& packet, ChatGUI& chatGUI);
+    void processMessageAsClient(uint64_t senderID, const Packet& packet, ChatGUI& chatGUI, MainMenuGUI& mainMenuGUI);
     
     void callbackLobbyCreated(LobbyCreated_t* pCallback, bool bIOFailure);
     
@@ -138,6 +185,8 @@ private:
     float byteSendRate;
     float byteReceiveRate;
 
+    NetworkTelemetry telemetry;
+
     static constexpr int MAX_LOBBY_PLAYER_COUNT = 8;
 
     float updateTick;
@@ -145,6 +194,10 @@ private:
     static constexpr int MAX_UPDATE_TICK_COUNT = 2;
     static constexpr int NON_PLAYER_UPDATE_TICK = 1;
 
+    uint32_t networkTick;
+    uint32_t entityViewNetworkTick;
+    uint32_t bossViewNetworkTick;
+
     std::unordered_map<uint64_t, NetworkPlayer> networkPlayers;
     std::unordered_map<uint64_t, PlayerData> networkPlayerDatasSaved;
 
@@ -158,6 +211,14 @@ private:
     static constexpr float STRUCTURE_ENTER_REQUEST_COOLDOWN = 0.5f;
     float structureEnterRequestCooldown;
 
+    // Host-specific
+    ChunkStreamer chunkStreamer;
+
+    bool replaying = false;
+    std::vector<ReplayPacket> replayPackets;
+
+    static thread_local std::vector<BufferedPacket>* threadPacketBuffer;
+
     // Client-specific
     static constexpr float CHUNK_REQUEST_OUTSTANDING_MAX_TIME = 2.0f;
     std::unordered_map<ChunkPosition, float> chunkRequestsOutstanding;
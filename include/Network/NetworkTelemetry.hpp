@@ -0,0 +1,110 @@
+#pragma once
+
+#include <cstdint>
+#include <array>
+#include <map>
+#include <vector>
+#include <string>
+#include <unordered_map>
+
+#include "Network/Packet.hpp"
+#include "Network/PacketType.hpp"
+
+struct PacketTypeCounters
+{
+    int messages = 0;
+
+    // Packet size before / after compression
+    uint64_t rawBytes = 0;
+    uint64_t compressedBytes = 0;
+
+    // Only counted for sent packets
+    int reliableSends = 0;
+    int unreliableSends = 0;
+
+    void add(const PacketTypeCounters& counters);
+};
+
+// Counters for packets sent to / received from a peer, by packet type
+struct PeerPacketCounters
+{
+    std::map<PacketType, PacketTypeCounters> sent;
+    std::map<PacketType, PacketTypeCounters> received;
+};
+
+// Bytes waiting to be sent to peer, sampled from Steam connection status
+struct PeerSendQueueStats
+{
+    static constexpr int SAMPLE_COUNT = 120;
+    static constexpr int HISTOGRAM_BIN_COUNT = 6;
+
+    std::array<float, SAMPLE_COUNT> pendingBytesSamples = {};
+    int sampleIndex = 0;
+    int sampleCount = 0;
+
+    int pendingBytes = 0;
+    int ping = 0;
+    float queueTimeMs = 0.0f;
+
+    // Number of samples within each pending byte range
+    std::array<float, HISTOGRAM_BIN_COUNT> getHistogram() const;
+
+    static const char* getHistogramBinName(int bin);
+};
+
+// Per-peer, per-packet type counters for sent and received packets
+// Counters are kept for a rolling window, made of fixed length time buckets, as well as in total
+class NetworkTelemetry
+{
+public:
+    NetworkTelemetry() = default;
+
+    void reset();
+
+    void recordSent(uint64_t peerID, const Packet& packet, int nSendFlags);
+    // Received packet is already decompressed, so received size is passed separately
+    void recordReceived(uint64_t peerID, const Packet& packet, int receivedSize);
+
+    // Advances rolling window, and samples send queue for peers (requires Steam)
+    void update(float dt, const std::vector<uint64_t>& peerIDs, bool sampleSendQueues);
+
+    // Counters summed over rolling window
+    PeerPacketCounters getWindowCounters(uint64_t peerID) const;
+    PeerPacketCounters getTotalCounters(uint64_t peerID) const;
+
+    const PeerSendQueueStats* getSendQueueStats(uint64_t peerID) const;
+
+    std::vector<uint64_t> getPeerIDs() const;
+
+    // Writes window and total counters for all peers
+    bool exportCSV(const std::string& path) const;
+
+    // Alongside current log file
+    static std::string getDefaultCSVPath();
+
+    inline float getWindowLength() const {return WINDOW_BUCKET_COUNT * WINDOW_BUCKET_TIME;}
+
+private:
+    static constexpr int WINDOW_BUCKET_COUNT = 10;
+    static constexpr float WINDOW_BUCKET_TIME = 1.0f;
+
+    static constexpr float SEND_QUEUE_SAMPLE_TIME = 0.25f;
+
+    struct PeerTelemetry
+    {
+        std::array<PeerPacketCounters, WINDOW_BUCKET_COUNT> windowBuckets;
+        PeerPacketCounters total;
+
+        PeerSendQueueStats sendQueueStats;
+    };
+
+    void sampleSendQueue(uint64_t peerID, PeerSendQueueStats& sendQueueStats);
+
+private:
+    std::unordered_map<uint64_t, PeerTelemetry> peers;
+
+    int currentBucket = 0;
+    float bucketTime = 0.0f;
+    float sendQueueSampleTime = 0.0f;
+
+};
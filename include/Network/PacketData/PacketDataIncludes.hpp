@@ -10,6 +10,7 @@
 #include "Network/PacketData/PacketDataPlayer/PacketDataPlayerData.hpp"
 #include "Network/PacketData/PacketDataPlayer/PacketDataPlayerCharacterInfo.hpp"
 #include "Network/PacketData/PacketDataPlayer/PacketDataInventoryAddItem.hpp"
+#include "Network/PacketData/PacketDataPlayer/PacketDataPlayerTeleport.hpp"
 
 #include "Network/PacketData/PacketDataWorld/PacketDataObjectHit.hpp"
 #include "Network/PacketData/PacketDataWorld/PacketDataObjectBuilt.hpp"
@@ -25,6 +26,8 @@
 #include "Network/PacketData/PacketDataWorld/PacketDataChunkDatas.hpp"
 #include "Network/PacketData/PacketDataWorld/PacketDataChunkRequests.hpp"
 #include "Network/PacketData/PacketDataWorld/PacketDataChunkModifiedAlerts.hpp"
+#include "Network/PacketData/PacketDataWorld/PacketDataChunkResyncRequests.hpp"
+#include "Network/PacketData/PacketDataWorld/PacketDataChunkEdits.hpp"
 #include "Network/PacketData/PacketDataWorld/PacketDataEntities.hpp"
 #include "Network/PacketData/PacketDataWorld/PacketDataProjectiles.hpp"
 #include "Network/PacketData/PacketDataWorld/PacketDataProjectileCreateRequest.hpp"
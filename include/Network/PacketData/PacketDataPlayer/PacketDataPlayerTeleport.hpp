@@ -0,0 +1,25 @@
+#pragma once
+
+#include <extlib/cereal/archives/binary.hpp>
+
+#include "Network/IPacketData.hpp"
+
+// Sent from host to move client player within their current location, e.g. from admin command
+struct PacketDataPlayerTeleport : public IPacketData
+{
+    float positionX;
+    float positionY;
+
+    template <class Archive>
+    void serialize(Archive& ar)
+    {
+        ar(positionX, positionY);
+    }
+
+    PACKET_SERIALISATION();
+    
+    inline virtual PacketType getType() const override
+    {
+        return PacketType::PlayerTeleport;
+    }
+};
@@ -25,6 +25,9 @@ struct PacketDataBosses : public IPacketData, public IPacketTimeDependent
     uint8_t planetType;
     BossManager bossManager;
 
+    // Host network tick bosses were sent at
+    uint32_t networkTick = 0;
+
     inline virtual void applyPingCorrection(float pingTimeSecs) override
     {
         pingTime = pingTimeSecs;
@@ -34,7 +37,7 @@ struct PacketDataBosses : public IPacketData, public IPacketTimeDependent
     void save(Archive& ar) const
     {
         bool hasBosses = (bossManager.getBossCount() > 0);
-        ar(hasBosses, planetType);
+        ar(hasBosses, planetType, networkTick);
 
         if (hasBosses)
         {
@@ -46,7 +49,7 @@ struct PacketDataBosses : public IPacketData, public IPacketTimeDependent
     void load(Archive& ar)
     {
         bool hasBosses;
-        ar(hasBosses, planetType);
+        ar(hasBosses, planetType, networkTick);
 
         if (hasBosses)
         {
@@ -2,6 +2,7 @@
 
 #include <vector>
 #include <array>
+#include <sstream>
 #include <optional>
 #include <unordered_map>
 
@@ -35,10 +36,13 @@ struct PacketDataChunkDatas : public IPacketData
 
         std::unordered_map<uint64_t, ItemPickup> itemPickupsRelative;
 
+        // Host chunk content version, sent back by client to resync with edits only
+        uint64_t contentVersion = 0;
+
         template <class Archive>
         void serialize(Archive& ar)
         {
-            ar(chunkPosition.x, chunkPosition.y, groundTileGrid, objectGrid, structureObject, modified, itemPickupsRelative);
+            ar(chunkPosition.x, chunkPosition.y, groundTileGrid, objectGrid, structureObject, modified, itemPickupsRelative, contentVersion);
         }
 
         void setFromPOD(const ChunkPOD& pod)
@@ -64,12 +68,51 @@ struct PacketDataChunkDatas : public IPacketData
 
     PlanetType planetType;
 
+    // Decoded on receive
     std::vector<ChunkData> chunkDatas;
 
+    // Chunk datas are sent individually encoded, allowing host to reuse encodings across packets / clients
+    std::vector<std::vector<char>> encodedChunkDatas;
+
+    // Encoded into given vector type, so host can encode directly into tracked cache storage
+    template <class EncodedData = std::vector<char>>
+    static inline EncodedData encodeChunkData(const ChunkData& chunkData)
+    {
+        std::stringstream stream;
+        {
+            cereal::BinaryOutputArchive archive(stream);
+            archive(chunkData);
+        }
+        std::string streamStr = stream.str();
+        return EncodedData(streamStr.begin(), streamStr.end());
+    }
+
+    static inline ChunkData decodeChunkData(const std::vector<char>& encodedChunkData)
+    {
+        ChunkData chunkData;
+        std::stringstream stream(std::string(encodedChunkData.begin(), encodedChunkData.end()));
+        cereal::BinaryInputArchive archive(stream);
+        archive(chunkData);
+        return chunkData;
+    }
+
+    template <class Archive>
+    void save(Archive& ar) const
+    {
+        ar(planetType, encodedChunkDatas);
+    }
+
     template <class Archive>
-    void serialize(Archive& ar)
+    void load(Archive& ar)
     {
-        ar(planetType, chunkDatas);
+        ar(planetType, encodedChunkDatas);
+
+        chunkDatas.clear();
+        for (const std::vector<char>& encodedChunkData : encodedChunkDatas)
+        {
+            chunkDatas.push_back(decodeChunkData(encodedChunkData));
+        }
+        encodedChunkDatas.clear();
     }
 
     PACKET_SERIALISATION();
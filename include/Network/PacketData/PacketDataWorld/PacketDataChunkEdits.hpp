@@ -0,0 +1,66 @@
+#pragma once
+
+#include <vector>
+#include <optional>
+
+#include <extlib/cereal/archives/binary.hpp>
+#include <extlib/cereal/types/optional.hpp>
+#include <extlib/cereal/types/vector.hpp>
+
+#include <Vector.hpp>
+
+#include "Network/IPacketData.hpp"
+
+#include "Data/typedefs.hpp"
+#include "World/ChunkPosition.hpp"
+#include "Object/BuildableObjectPOD.hpp"
+
+// Objects edited in chunks since content version known by client, sent in place of full chunk datas
+struct PacketDataChunkEdits : public IPacketData
+{
+    struct ObjectEdit
+    {
+        uint8_t tileIndex;
+        std::optional<BuildableObjectPOD> object;
+
+        inline pl::Vector2<int> getTile() const {return pl::Vector2<int>(tileIndex % 8, tileIndex / 8);}
+
+        template <class Archive>
+        void serialize(Archive& ar)
+        {
+            ar(tileIndex, object);
+        }
+    };
+
+    struct ChunkEdits
+    {
+        ChunkPosition chunkPosition;
+
+        // Host content version after edits applied
+        uint64_t contentVersion;
+
+        std::vector<ObjectEdit> objectEdits;
+
+        template <class Archive>
+        void serialize(Archive& ar)
+        {
+            ar(chunkPosition.x, chunkPosition.y, contentVersion, objectEdits);
+        }
+    };
+
+    PlanetType planetType;
+    std::vector<ChunkEdits> chunkEdits;
+
+    template <class Archive>
+    void serialize(Archive& ar)
+    {
+        ar(planetType, chunkEdits);
+    }
+
+    PACKET_SERIALISATION();
+    
+    inline virtual PacketType getType() const override
+    {
+        return PacketType::ChunkEdits;
+    }
+};
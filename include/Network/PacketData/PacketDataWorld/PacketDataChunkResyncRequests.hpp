@@ -0,0 +1,43 @@
+#pragma once
+
+#include <vector>
+
+#include <extlib/cereal/archives/binary.hpp>
+#include <extlib/cereal/types/vector.hpp>
+
+#include "Network/IPacketData.hpp"
+
+#include "Data/typedefs.hpp"
+#include "World/ChunkPosition.hpp"
+
+// Sent by client for modified chunks, with host content version of chunk data client has
+struct PacketDataChunkResyncRequests : public IPacketData
+{
+    struct ChunkResyncRequest
+    {
+        ChunkPosition chunkPosition;
+        uint64_t contentVersion;
+
+        template <class Archive>
+        void serialize(Archive& ar)
+        {
+            ar(chunkPosition.x, chunkPosition.y, contentVersion);
+        }
+    };
+
+    PlanetType planetType;
+    std::vector<ChunkResyncRequest> resyncRequests;
+
+    template <class Archive>
+    void serialize(Archive& ar)
+    {
+        ar(planetType, resyncRequests);
+    }
+
+    PACKET_SERIALISATION();
+    
+    inline virtual PacketType getType() const override
+    {
+        return PacketType::ChunkResyncRequests;
+    }
+};
@@ -49,6 +49,9 @@ struct PacketDataEntities : public IPacketData, public IPacketTimeDependent
     uint8_t planetType;
     std::vector<EntityPacketData> entities;
 
+    // Host network tick entities were sent at, echoed by client in hit requests so host can rewind to positions client was viewing
+    uint32_t networkTick = 0;
+
     inline virtual void applyPingCorrection(float pingTimeSecs) override
     {
         pingTime = pingTimeSecs;
@@ -58,7 +61,7 @@ struct PacketDataEntities : public IPacketData, public IPacketTimeDependent
     void save(Archive& ar) const
     {
         bool hasEntities = (entities.size() > 0);
-        ar(hasEntities, planetType);
+        ar(hasEntities, planetType, networkTick);
 
         if (hasEntities)
         {
@@ -70,7 +73,7 @@ struct PacketDataEntities : public IPacketData, public IPacketTimeDependent
     void load(Archive& ar)
     {
         bool hasEntities;
-        ar(hasEntities, planetType);
+        ar(hasEntities, planetType, networkTick);
 
         if (hasEntities)
         {
@@ -17,10 +17,13 @@ struct PacketDataMeleeRequest : public IPacketData
     std::vector<HitRect> hitRects;
     pl::Vector2f hitOrigin;
 
+    // Latest host network tick received by client, used to rewind hit targets
+    uint32_t viewNetworkTick = 0;
+
     template <class Archive>
     void serialize(Archive& ar)
     {
-        ar(planetType, hitRects, hitOrigin.x, hitOrigin.y);
+        ar(planetType, hitRects, hitOrigin.x, hitOrigin.y, viewNetworkTick);
     }
 
     PACKET_SERIALISATION();
@@ -30,6 +30,7 @@ enum class PacketType : uint8_t
     ItemPickupCollected,
     ItemPickupsCreateRequest,
     InventoryAddItem,
+    PlayerTeleport,
 
     ObjectInteract,
     ChestOpened,
@@ -41,6 +42,8 @@ enum class PacketType : uint8_t
     ChunkDatas,
     ChunkRequests,
     ChunkModifiedAlerts,
+    ChunkResyncRequests,
+    ChunkEdits,
 
     Entities,
     Projectiles,
@@ -70,4 +73,63 @@ enum class PacketType : uint8_t
     PlanetTravelReply,
     RoomTravelRequest,
     RoomTravelReply,
-};
\ No newline at end of file
+};
+
+inline const char* getPacketTypeName(PacketType packetType)
+{
+    switch (packetType)
+    {
+        case PacketType::JoinQuery: return "JoinQuery";
+        case PacketType::JoinReply: return "JoinReply";
+        case PacketType::JoinInfo: return "JoinInfo";
+        case PacketType::PlayerJoined: return "PlayerJoined";
+        case PacketType::PlayerDisconnected: return "PlayerDisconnected";
+        case PacketType::HostQuit: return "HostQuit";
+        case PacketType::PlayerData: return "PlayerData";
+        case PacketType::PlayerCharacterInfo: return "PlayerCharacterInfo";
+        case PacketType::WorldInfo: return "WorldInfo";
+        case PacketType::RoomDestInfo: return "RoomDestInfo";
+        case PacketType::ServerInfo: return "ServerInfo";
+        case PacketType::ChatMessage: return "ChatMessage";
+        case PacketType::ObjectHit: return "ObjectHit";
+        case PacketType::ObjectBuilt: return "ObjectBuilt";
+        case PacketType::ObjectDestroyed: return "ObjectDestroyed";
+        case PacketType::LandPlaced: return "LandPlaced";
+        case PacketType::ItemPickupsCreated: return "ItemPickupsCreated";
+        case PacketType::ItemPickupCollected: return "ItemPickupCollected";
+        case PacketType::ItemPickupsCreateRequest: return "ItemPickupsCreateRequest";
+        case PacketType::InventoryAddItem: return "InventoryAddItem";
+        case PacketType::PlayerTeleport: return "PlayerTeleport";
+        case PacketType::ObjectInteract: return "ObjectInteract";
+        case PacketType::ChestOpened: return "ChestOpened";
+        case PacketType::ChestClosed: return "ChestClosed";
+        case PacketType::ChestDataModified: return "ChestDataModified";
+        case PacketType::MeleeRequest: return "MeleeRequest";
+        case PacketType::ChunkDatas: return "ChunkDatas";
+        case PacketType::ChunkRequests: return "ChunkRequests";
+        case PacketType::ChunkModifiedAlerts: return "ChunkModifiedAlerts";
+        case PacketType::ChunkResyncRequests: return "ChunkResyncRequests";
+        case PacketType::ChunkEdits: return "ChunkEdits";
+        case PacketType::Entities: return "Entities";
+        case PacketType::Projectiles: return "Projectiles";
+        case PacketType::Bosses: return "Bosses";
+        case PacketType::BossSpawnCheck: return "BossSpawnCheck";
+        case PacketType::BossSpawnCheckReply: return "BossSpawnCheckReply";
+        case PacketType::BossSpawnRequest: return "BossSpawnRequest";
+        case PacketType::Landmarks: return "Landmarks";
+        case PacketType::LandmarkModified: return "LandmarkModified";
+        case PacketType::MapChunkDiscovered: return "MapChunkDiscovered";
+        case PacketType::RocketEnterRequest: return "RocketEnterRequest";
+        case PacketType::RocketEnterReply: return "RocketEnterReply";
+        case PacketType::RocketInteraction: return "RocketInteraction";
+        case PacketType::ProjectileCreateRequest: return "ProjectileCreateRequest";
+        case PacketType::Particle: return "Particle";
+        case PacketType::StructureEnterRequest: return "StructureEnterRequest";
+        case PacketType::StructureEnterReply: return "StructureEnterReply";
+        case PacketType::PlanetTravelRequest: return "PlanetTravelRequest";
+        case PacketType::PlanetTravelReply: return "PlanetTravelReply";
+        case PacketType::RoomTravelRequest: return "RoomTravelRequest";
+        case PacketType::RoomTravelReply: return "RoomTravelReply";
+    }
+    return "Unknown";
+}
@@ -18,6 +18,7 @@
 #include "Core/Sounds.hpp"
 #include "Core/ResolutionHandler.hpp"
 #include "Core/Camera.hpp"
+#include "Core/MemoryTracker.hpp"
 #include "Core/AnimatedTexture.hpp"
 #include "Object/WorldObject.hpp"
 #include "Object/ObjectReference.hpp"
@@ -45,7 +46,7 @@ struct BuildableObjectCreateParameters
     bool randomiseAnimation = true;
 };
 
-class BuildableObject : public WorldObject
+class BuildableObject : public WorldObject, public MemoryTracked<MemoryCategory::Objects>
 {
 public:
     BuildableObject(pl::Vector2f position, ObjectType objectType, const BuildableObjectCreateParameters& parameters);
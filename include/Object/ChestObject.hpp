@@ -46,6 +46,9 @@ public:
 private:
     void removeChestFromPool(Game& game);
 
+    // Bumps version of chunk containing chest when chest ID is lazily assigned
+    void markChestIDModified(Game& game, std::optional<LocationState> locationState);
+
 private:
     uint16_t chestID = 0xFFFF;
 
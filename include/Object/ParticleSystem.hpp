@@ -22,7 +22,7 @@
 #include "Core/TextureManager.hpp"
 #include "Core/Shaders.hpp"
 
-#include "Object/WorldObject.hpp"
+#include "Player/LocationState.hpp"
 
 class Game;
 
@@ -51,21 +51,16 @@ struct ParticleStyle
     }
 };
 
-class Particle : public WorldObject
+// Used to create particles and send over network
+// Particles are simulated and drawn by ParticleSystem
+class Particle
 {
+    friend class ParticleSystem;
+
 public:
     Particle();
     Particle(pl::Vector2f position, pl::Vector2f velocity, pl::Vector2f acceleration, int drawLayer, const ParticleStyle& style);
 
-    void update(float dt);
-
-    void draw(pl::RenderTarget& window, pl::SpriteBatch& spriteBatch, Game& game, const Camera& camera, float dt, float gameTime, int worldSize,
-        const pl::Color& color) const override;
-    
-    void draw(pl::RenderTarget& window, pl::SpriteBatch& spriteBatch, const Camera& camera, int worldSize) const;
-
-    bool isAlive();
-
     template <class Archive>
     void save(Archive& ar) const
     {
@@ -128,17 +123,17 @@ public:
     }
 
 private:
+    pl::Vector2f position;
     pl::Vector2f velocity;
     pl::Vector2f acceleration;
 
-    // std::vector<pl::Rect<uint16_t>> textureRects;
-    // float alpha;
-    int currentFrame;
-    float frameTimer;
-    // float timePerFrame;
+    int drawLayer;
+
     ParticleStyle particleStyle;
 };
 
+// Particles are stored as structure of arrays, and are not drawn as world objects
+// Each draw layer of particles is drawn as a single band, rather than sorted with world objects
 class ParticleSystem
 {
 public:
@@ -151,12 +146,35 @@ public:
 
     void draw(pl::RenderTarget& window, pl::SpriteBatch& spriteBatch, const Camera& camera, int worldSize) const;
 
+    // Draws particles in draw layer only
+    void drawLayer(pl::RenderTarget& window, pl::SpriteBatch& spriteBatch, const Camera& camera, int worldSize, int drawLayer) const;
+
+    // Draw layers of particles, in world object draw order (highest layer first)
+    std::vector<int> getDrawLayers() const;
+
     // void handleWorldWrap(pl::Vector2f positionDelta);
 
     void clear();
 
-    std::vector<WorldObject*> getParticleWorldObjects();
+    inline int getParticleCount() const {return positions.size();}
+
+private:
+    void drawParticle(pl::RenderTarget& window, pl::SpriteBatch& spriteBatch, const Camera& camera, int worldSize, int index) const;
+
+    // Removes finished particles, keeping order
+    void compactParticles();
 
 private:
-    std::vector<Particle> particles;
+    // Updated every frame
+    std::vector<pl::Vector2f> positions;
+    std::vector<pl::Vector2f> velocities;
+    std::vector<pl::Vector2f> accelerations;
+    std::vector<float> frameTimers;
+    std::vector<float> timesPerFrame;
+    std::vector<int> currentFrames;
+    std::vector<int> frameCounts;
+
+    // Used for drawing only
+    std::vector<int> drawLayers;
+    std::vector<ParticleStyle> styles;
 };
\ No newline at end of file
@@ -23,7 +23,7 @@ class ChunkManager;
 class PlantObject : public BuildableObject
 {
 public:
-    PlantObject(pl::Vector2f position, ObjectType objectType, const BuildableObjectCreateParameters& parameters, Game& game, const ChunkManager* chunkManager = nullptr);
+    PlantObject(pl::Vector2f position, ObjectType objectType, const BuildableObjectCreateParameters& parameters, Game& game, ChunkManager* chunkManager = nullptr);
 
     BuildableObject* clone() override;
 
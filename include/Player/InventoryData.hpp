@@ -4,6 +4,8 @@
 #include <array>
 #include <optional>
 #include <unordered_map>
+#include <set>
+#include <iterator>
 #include <fstream>
 
 #include <Core/json.hpp>
@@ -34,7 +36,10 @@ public:
 
     std::unordered_map<ItemType, unsigned int> getTotalItemCount() const;
 
-    std::optional<ItemCount>& getItemSlotData(int index);
+    unsigned int getItemAmount(ItemType item) const;
+
+    // Slots must be modified through add / take functions to keep slot index in sync
+    const std::optional<ItemCount>& getItemSlotData(int index) const;
 
     bool isEmpty() const;
 
@@ -51,8 +56,14 @@ public:
 
     inline int getSize() const {return inventoryData.size();}
 
+    // Measured bytes of slot storage, for memory stats
+    inline size_t getStorageBytes() const {return inventoryData.capacity() * sizeof(std::optional<ItemCount>);}
+
+    // Compares slot index against a scan of all slots, used in tests
+    bool isItemSlotIndexValid() const;
+
     inline const std::vector<std::optional<ItemCount>>& getData() const {return inventoryData;}
-    inline std::vector<std::optional<ItemCount>>& getData() {return inventoryData;}
+    void setData(const std::vector<std::optional<ItemCount>>& inventoryData);
 
     // Save / load
 
@@ -60,6 +71,11 @@ public:
     void serialize(Archive& ar, const std::uint32_t version)
     {
         ar(inventoryData);
+
+        if constexpr (Archive::is_loading::value)
+        {
+            rebuildItemSlotIndex();
+        }
     }
 
     void mapVersions(const std::unordered_map<ItemType, ItemType>& itemVersionMap)
@@ -73,14 +89,33 @@ public:
 
             inventoryData[i]->first = itemVersionMap.at(inventoryData[i]->first);
         }
+
+        rebuildItemSlotIndex();
     }
 
 protected:
+    // Must be called after modifying inventoryData directly
+    void rebuildItemSlotIndex();
+
     std::vector<std::optional<ItemCount>> inventoryData;
 
+private:
+    // All slot modifications go through here to keep slot index in sync
+    void setItemSlot(int index, const std::optional<ItemCount>& itemSlot);
+
+    void addSlotToIndex(int index);
+    void removeSlotFromIndex(int index);
+
 private:
     bool achievementUnlocks;
 
+    // Slot index, so item operations only visit slots containing that item rather than whole inventory
+    // Slots are ordered, as items are added to earliest slots and taken from latest slots
+    std::unordered_map<ItemType, std::set<int>> itemSlots;
+    std::unordered_map<ItemType, std::set<int>> nonFullItemSlots;
+    std::set<int> freeSlots;
+    std::unordered_map<ItemType, unsigned int> itemTotals;
+
 };
 
 // Save / load
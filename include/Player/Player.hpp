@@ -93,7 +93,8 @@ public:
     virtual void draw(pl::RenderTarget& window, pl::SpriteBatch& spriteBatch, Game& game, const Camera& camera, float dt, float gameTime, int worldSize, const pl::Color& color) const override;
     void draw(pl::RenderTarget& window, pl::SpriteBatch& spriteBatch, Game& game, const Camera* camera, float dt, float gameTime, int worldSize, const pl::Color& color) const;
 
-    std::vector<WorldObject*> getDrawWorldObjects(const Camera& camera, int worldSize, float gameTime);
+    // Appends player and fishing rod line parts to world objects
+    void getDrawWorldObjects(const Camera& camera, int worldSize, float gameTime, std::vector<WorldObject*>& worldObjects);
     
     inline void createLightSource(LightingEngine& lightingEngine, pl::Vector2f topLeftChunkPos, pl::Vector2f playerPos, int worldSize) const override {}
 
@@ -170,7 +171,7 @@ protected:
     void updateTimers(float dt, Game& game);
 
 private:
-    void updateFishingRodCatch(float dt);
+    void updateFishingRodCatch(float dt, ChunkManager& chunkManager);
     void castFishingRod();
 
     // void drawFishingRodCast(pl::RenderTarget& window, pl::SpriteBatch& spriteBatch, const Camera& camera, float gameTime, int worldSize, float waterYOffset) const;
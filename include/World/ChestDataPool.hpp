@@ -13,6 +13,7 @@
 // typedef std::vector<std::optional<ItemCount>> ChestData;
 
 // #include "World/ChestData.hpp"
+#include "Core/MemoryTracker.hpp"
 #include "Player/InventoryData.hpp"
 #include "Data/typedefs.hpp"
 
@@ -33,6 +34,19 @@ public:
 
     void overwriteChestData(uint16_t id, const InventoryData& chestContents);
 
+    inline int getChestCount() const {return chestData.size();}
+
+    // Measured bytes of chest inventory storage, as inventories are not allocated through TrackedAllocator
+    inline size_t getInventoryStorageBytes() const
+    {
+        size_t bytes = 0;
+        for (const auto& [chestID, chestContents] : chestData)
+        {
+            bytes += chestContents.getStorageBytes();
+        }
+        return bytes;
+    }
+
     template <class Archive>
     void serialize(Archive& ar, const std::uint32_t version)
     {
@@ -67,7 +81,8 @@ public:
 
 private:
     // 0xFFFF reserved for uninitialised chest / null
-    std::unordered_map<uint16_t, InventoryData> chestData;
+    std::unordered_map<uint16_t, InventoryData, std::hash<uint16_t>, std::equal_to<uint16_t>,
+        TrackedAllocator<std::pair<const uint16_t, InventoryData>, MemoryCategory::ChestData>> chestData;
 
     uint16_t topDataSlot;
 
@@ -10,6 +10,7 @@
 #include <set>
 #include <iostream>
 #include <type_traits>
+#include <atomic>
 
 #include <Graphics/SpriteBatch.hpp>
 #include <Graphics/Color.hpp>
@@ -24,6 +25,7 @@
 #include "Core/CollisionRect.hpp"
 #include "Core/Helper.hpp"
 #include "Core/Random.hpp"
+#include "Core/MemoryTracker.hpp"
 
 #include "Object/WorldObject.hpp"
 #include "Object/BuildableObject.hpp"
@@ -40,6 +42,7 @@
 #include "Entity/HitRect.hpp"
 #include "World/TileMap.hpp"
 #include "World/PathfindingEngine.hpp"
+#include "World/EntityUpdateScheduler.hpp"
 
 #include "Types/TileType.hpp"
 
@@ -52,6 +55,7 @@
 #include "Data/StructureDataLoader.hpp"
 
 #include "Network/PacketData/PacketDataWorld/PacketDataEntities.hpp"
+#include "Network/PacketData/PacketDataWorld/PacketDataChunkEdits.hpp"
 
 #include "World/ChunkPOD.hpp"
 #include "World/WorldMap.hpp"
@@ -64,8 +68,21 @@ class Game;
 class ChunkManager;
 class Entity;
 class ProjectileManager;
+struct HitboxSnapshot;
 
-class Chunk
+// Per frame counters for gathering objects to draw
+struct VisibleObjectStats
+{
+    int objectCount = 0;
+
+    // Chunk drawable lists rebuilt as objects / entities / item pickups in chunk changed
+    int chunkListRebuilds = 0;
+
+    // Lists which had to grow when rebuilt, or frame buffer growing
+    int allocations = 0;
+};
+
+class Chunk : public MemoryTracked<MemoryCategory::Chunks>
 {
 
 public:
@@ -85,11 +102,17 @@ public:
     RandInt generateTilesAndStructure(const FastNoise& heightNoise, const FastNoise& biomeNoise, const FastNoise& riverNoise, PlanetType planetType,
         ChunkManager& chunkManager, bool allowStructureGen = true, std::optional<StructureType> forceStructureType = std::nullopt);
 
+    // Completes generation after generateTilesAndStructure, using random int generator returned
+    // Depends on adjacent chunks and planet random streams, unlike tiles and structure
+    void generateFromTilesAndStructure(const FastNoise& heightNoise, const FastNoise& biomeNoise, const FastNoise& riverNoise, PlanetType planetType,
+        RandInt& randGen, Game& game, ChunkManager& chunkManager, PathfindingEngine& pathfindingEngine, bool spawnEntities = true, bool initialise = true);
+
     // Returns true if any objects modified / placed
     bool generateObjects(const FastNoise& heightNoise, const FastNoise& biomeNoise, const FastNoise& riverNoise, PlanetType planetType, RandInt& randGen,
         Game& game, ChunkManager& chunkManager, PathfindingEngine& pathfindingEngine, bool calledWhileGenerating = true, float probabilityMult = 1.0f);
     
-    void spawnChunkEntities(int worldSize, const FastNoise& heightNoise, const FastNoise& biomeNoise, const FastNoise& riverNoise, PlanetType planetType);
+    void spawnChunkEntities(int worldSize, const FastNoise& heightNoise, const FastNoise& biomeNoise, const FastNoise& riverNoise, PlanetType planetType,
+        RandomStream& randomStream);
 
     // Generates tilemaps and calls functions to generate visual tiles and calculate collision rects
     // Called during chunk generation
@@ -109,6 +132,13 @@ public:
         bool graphicsUpdate = true);
     void setTile(int tileMap, pl::Vector2<int> position, Chunk* upChunk, Chunk* downChunk, Chunk* leftChunk, Chunk* rightChunk, bool graphicsUpdate = true);
 
+    // Sets all tiles of tilemap at once, creating tilemap if required
+    // Used by chunk manager for whole chunk tile setting
+    void setTileMapTiles(int tileMap, const TileMap::TilePresenceGrid& presenceGrid);
+
+    // Reset when all tilemaps are set, so tile variations are the same each time chunk is loaded
+    inline void setTileVariationRandom(const RandomStream& randomStream) {tileVariationRandom = randomStream;}
+
     // Update / refresh tilemap due to changes in another chunk
     // Pass in chunk position difference relative to modified chunk to update correct edge of tile map
     void updateTileMap(int tileMap, int xRel, int yRel, TileMap* upTiles, TileMap* downTiles, TileMap* leftTiles, TileMap* rightTiles);
@@ -118,16 +148,40 @@ public:
 
     TileMap* getTileMap(int tileMap);
 
+    using TileMaps = std::map<int, TileMap, std::less<int>, TrackedAllocator<std::pair<const int, TileMap>, MemoryCategory::TileMaps>>;
+    inline const TileMaps& getTileMaps() const {return tileMaps;}
+
+    inline size_t getTileMapsVertexBytes() const
+    {
+        size_t bytes = 0;
+        for (const auto& [tileMapID, tileMap] : tileMaps)
+        {
+            bytes += tileMap.getVertexBytes();
+        }
+        return bytes;
+    }
+
+    // Latest version of all tilemaps in chunk, changes when any tilemap vertices change
+    uint64_t getTileMapsVersion() const;
+
 
     // Drawing
-    void drawChunkTerrain(pl::RenderTarget& window, const Camera& camera, float time, int worldSize);
+    // Tilemaps and water are drawn for all chunks at once through ChunkTerrainRenderer
+    void drawChunkDebug(pl::RenderTarget& window, const Camera& camera, int worldSize);
     void drawChunkTerrainVisual(pl::RenderTarget& window, pl::SpriteBatch& spriteBatch, const Camera& camera, PlanetType planetType, int worldSize, float time);
-    void drawChunkWater(pl::RenderTarget& window, const Camera& camera, ChunkManager& chunkManager);
 
     // Get vector of chunk object/entities for drawing
     std::vector<WorldObject*> getObjects();
     std::vector<WorldObject*> getEntities();
 
+    // Hashes entity types, positions and velocities, for replay state hashes
+    // Entities move without changing content version, so are hashed every frame
+    uint64_t getEntitiesStateHash(uint64_t hash);
+
+    // Objects, structure, entities and item pickups in chunk for drawing
+    // Cached until chunk content or entities change, so unchanged chunks do not rebuild each frame
+    const std::vector<WorldObject*>& getDrawableObjects(VisibleObjectStats& stats);
+
 
     // -- Object handling -- //
 
@@ -157,9 +211,13 @@ public:
 
 
     // -- Entity handling -- //
-    void updateChunkEntities(float dt, int worldSize, ProjectileManager* projectileManager, ChunkManager& chunkManager, Game* game, bool networkUpdateOnly);
+    // Entity behaviour updates are scheduled by entity update scheduler, if given
+    void updateChunkEntities(float dt, int worldSize, ProjectileManager* projectileManager, ChunkManager& chunkManager, Game* game, bool networkUpdateOnly,
+        EntityUpdateScheduler* entityUpdateScheduler = nullptr);
 
-    void testEntityHitCollision(const std::vector<HitRect>& hitRects, pl::Vector2f hitOrigin, ChunkManager& chunkManager, Game& game, float gameTime);
+    // Hit rects are moved per entity by rewind snapshot, if given
+    void testEntityHitCollision(const std::vector<HitRect>& hitRects, pl::Vector2f hitOrigin, ChunkManager& chunkManager, Game& game, float gameTime,
+        const HitboxSnapshot* rewindSnapshot = nullptr);
 
     bool testEntityPlayerDamageCollision(const CollisionRect& playerCollisionRect, int& damage, int worldSize);
 
@@ -171,6 +229,7 @@ public:
     std::vector<PacketDataEntities::EntityPacketData> getEntityPacketDatas();
     void loadEntityPacketData(const PacketDataEntities::EntityPacketData& packetData);
     void clearEntities();
+    inline int getEntityCount() const {return entities.size();}
 
 
     // -- Item pickups -- //
@@ -237,6 +296,35 @@ public:
     bool getContainsWater();
     bool hasBeenModified();
 
+    // Keeps chunk when saving even if unchanged since generation, e.g. when pregenerated
+    void markModified();
+
+    // Changes whenever chunk data sent to clients (tiles, objects, item pickups) changes
+    // Used to reuse encoded chunk datas when streaming chunks to clients
+    inline uint64_t getContentVersion() const {return contentVersion;}
+
+    // Must be called when modifying object data in chunk externally, e.g. landmark colours
+    void markContentModified();
+
+    // Must be called when modifying item pickups in chunk externally, e.g. item count
+    // Object edit log is kept, as item pickups are replicated to clients by their own packets
+    void markItemPickupsModified();
+
+    // Logs tile of object edit, so clients can be resynced with edited objects only
+    // Must be called when modifying data of single object externally, e.g. chest ID
+    void markObjectModified(pl::Vector2<int> tile);
+
+    // Gets current objects at tiles edited since content version, if all edits since version are logged
+    // Returns false if full chunk data is required
+    bool getObjectEditsSince(uint64_t sinceContentVersion, std::vector<PacketDataChunkEdits::ObjectEdit>& objectEdits);
+
+    // Applies object edits received from host (client only)
+    void loadObjectEdits(const PacketDataChunkEdits::ChunkEdits& chunkEdits, Game& game, ChunkManager& chunkManager, PathfindingEngine& pathfindingEngine);
+
+    // Content version of host chunk data last received (client only)
+    inline uint64_t getHostContentVersion() const {return hostContentVersion;}
+    inline void setHostContentVersion(uint64_t version) {hostContentVersion = version;}
+
     ChunkPosition getChunkPosition();
 
     // bool isPointInChunk(pl::Vector2f position);
@@ -246,8 +334,9 @@ public:
     // May return nullptr
     static const BiomeGenData* getBiomeGenAtWorldTile(pl::Vector2<int> worldTile, int worldSize, const FastNoise& biomeNoise, PlanetType planetType);
 
+    // Biome is also returned through biomeGenDataOut if given, to prevent resolving biome noise again
     static const TileGenData* getTileGenAtWorldTile(pl::Vector2<int> worldTile, int worldSize, const FastNoise& heightNoise, const FastNoise& biomeNoise, const FastNoise& riverNoise,
-        PlanetType planetType);
+        PlanetType planetType, const BiomeGenData** biomeGenDataOut = nullptr);
     
     static ObjectType getRandomObjectToSpawnAtWorldTile(pl::Vector2<int> worldTile, int tileType, int worldSize, const FastNoise& heightNoise,
         const FastNoise& biomeNoise, const FastNoise& riverNoise, RandInt& randGen, PlanetType planetType, float probabilityMult = 1.0f);
@@ -258,21 +347,25 @@ public:
     //     RandInt& randGen, PlanetType planetType, float probabilityMult = 1.0f);
 
     static EntityType getRandomEntityToSpawnAtWorldTile(pl::Vector2<int> worldTile, int worldSize, const FastNoise& heightNoise, const FastNoise& biomeNoise,
-        const FastNoise& riverNoise, PlanetType planetType);
+        const FastNoise& riverNoise, PlanetType planetType, RandomStream& randomStream);
 
 private:
     void generateRandomStructure(int worldSize, const FastNoise& biomeNoise, RandInt& randGen, PlanetType planetType, bool allowStructureGen,
         std::optional<StructureType> forceStructureType);
+
+    // Creates tilemap and recalculates draw order, if tilemap does not exist
+    void createTileMap(int tileMap);
     
     // Includes object references as separate objects
     int getObjectCountInGrid();
-    
+
 private:
     // 0 reserved for water / no tile
     std::array<std::array<uint16_t, 8>, 8> groundTileGrid;
     // sf::VertexArray groundVertexArray;
-    std::map<int, TileMap> tileMaps;
+    TileMaps tileMaps;
     std::vector<int> tileMapDrawOrder;
+    RandomStream tileVariationRandom;
 
     // Stores visual tile types, e.g. cliffs
     std::array<std::array<TileType, 8>, 8> visualTileGrid;
@@ -281,6 +374,9 @@ private:
     std::array<std::array<std::unique_ptr<BuildableObject>, 8>, 8> objectGrid;
     std::vector<std::unique_ptr<Entity>> entities;
 
+    // Incremented whenever entities are added to / removed from chunk
+    uint64_t entitiesVersion = 0;
+
     std::unordered_map<uint64_t, ItemPickup> itemPickups;
     uint64_t itemPickupCounter; // used as ID for pickups
 
@@ -303,6 +399,28 @@ private:
 
     bool modified;
 
+    uint64_t contentVersion = 0;
+    static std::atomic<uint64_t> contentVersionCounter;
+
+    struct ObjectEditLogEntry
+    {
+        uint64_t contentVersion;
+        uint8_t tileIndex;
+    };
+
+    // All object edits after start version are logged, any other content modification (except item pickups) restarts log
+    static constexpr int MAX_OBJECT_EDIT_LOG_SIZE = 32;
+    std::vector<ObjectEditLogEntry> objectEditLog;
+    uint64_t objectEditLogStartVersion = 0;
+
+    uint64_t hostContentVersion = 0;
+
+    // Cached drawable objects, valid while content / entities version matches
+    std::vector<WorldObject*> drawableObjects;
+    uint64_t drawableContentVersion = 0;
+    uint64_t drawableEntitiesVersion = 0;
+    bool drawableObjectsBuilt = false;
+
     // Is true if this chunk was loaded from POD / save file
     // Used to determine whether to generate tilemaps for the chunk when loaded
     bool generatedFromPOD = false;
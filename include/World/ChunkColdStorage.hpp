@@ -0,0 +1,130 @@
+#pragma once
+
+#include <cstdint>
+#include <array>
+#include <vector>
+#include <memory>
+#include <string>
+#include <fstream>
+#include <map>
+#include <unordered_map>
+
+#include <Vector.hpp>
+
+#include "IO/CompressedData.hpp"
+
+#include "World/ChunkPosition.hpp"
+#include "World/ChunkPOD.hpp"
+#include "Player/ItemPickup.hpp"
+
+// Sizes of cold chunk storage
+struct ChunkColdStorageStats
+{
+    int chunkCount = 0;
+    int spilledChunkCount = 0;
+
+    // Compressed bytes held in memory / spill file
+    uint64_t memoryBytes = 0;
+    uint64_t spilledBytes = 0;
+
+    // Size of spill file, including freed ranges not yet reused
+    uint64_t spillFileBytes = 0;
+
+    // Uncompressed bytes of chunks held
+    uint64_t uncompressedBytes = 0;
+
+    int chunksStored = 0;
+    int chunksRehydrated = 0;
+};
+
+// Stores chunks as compressed ChunkPOD blobs, for chunks which have not been visited for a while
+// Chunks are rehydrated through Chunk::loadFromChunkPOD when required
+// When compressed blobs exceed the memory budget, least recently stored blobs are spilled to a temp file (if enabled)
+class ChunkColdStorage
+{
+public:
+    ChunkColdStorage() = default;
+
+    void storeChunk(const ChunkPOD& pod, const std::unordered_map<uint64_t, ItemPickup>& itemPickups);
+
+    // Removes chunk from cold storage, returns false if chunk is not stored or could not be read
+    // Chunk is kept in cold storage if it could not be read
+    bool takeChunk(ChunkPosition chunk, ChunkPOD& pod, std::unordered_map<uint64_t, ItemPickup>& itemPickups);
+
+    inline bool containsChunk(ChunkPosition chunk) const {return coldChunks.contains(chunk);}
+
+    // Ground tiles are kept uncompressed, so adjacent chunks can be tiled without rehydrating
+    int getTileType(ChunkPosition chunk, pl::Vector2<int> tile) const;
+
+    // Decompresses all chunks without removing from cold storage (used for saving)
+    std::vector<ChunkPOD> getChunkPODs();
+
+    // Spills least recently stored chunks to temp file until within memory budget
+    void enforceMemoryBudget();
+
+    void clear();
+
+    inline void setSpillEnabled(bool enabled) {spillEnabled = enabled;}
+    inline bool isSpillEnabled() const {return spillEnabled;}
+
+    inline int getChunkCount() const {return coldChunks.size();}
+
+    ChunkColdStorageStats getStats() const;
+
+private:
+    struct ColdChunk
+    {
+        CompressedData compressedData;
+
+        // Offset into spill file, if spilled
+        bool spilled = false;
+        uint64_t spillOffset = 0;
+        uint32_t spillSize = 0;
+
+        std::array<std::array<uint16_t, 8>, 8> groundTileGrid;
+
+        // Used for LRU ordering
+        uint64_t storeIndex = 0;
+    };
+
+    // Deletes temp file on destruction
+    struct SpillFile
+    {
+        SpillFile();
+        ~SpillFile();
+
+        std::string path;
+        std::fstream stream;
+    };
+
+    bool readChunk(ColdChunk& coldChunk, ChunkPOD& pod, std::unordered_map<uint64_t, ItemPickup>& itemPickups);
+
+    bool spillChunk(ColdChunk& coldChunk);
+
+    // Returns offset of range in spill file, reusing freed range if large enough, otherwise at end of file
+    uint64_t allocateSpillRange(uint64_t size);
+
+    // Merges range with adjacent freed ranges, shrinking used size of file if at end
+    void freeSpillRange(uint64_t offset, uint64_t size);
+
+private:
+    static constexpr uint64_t MAX_MEMORY_BYTES = 16 * 1024 * 1024;
+
+    std::unordered_map<ChunkPosition, ColdChunk> coldChunks;
+    uint64_t nextStoreIndex = 0;
+
+    uint64_t memoryBytes = 0;
+    uint64_t spilledBytes = 0;
+    uint64_t uncompressedBytes = 0;
+
+    int chunksStored = 0;
+    int chunksRehydrated = 0;
+
+    bool spillEnabled = true;
+    std::unique_ptr<SpillFile> spillFile;
+
+    // Used size of spill file, and freed ranges within it (offset to size), reused by later spills
+    uint64_t spillFileSize = 0;
+    std::map<uint64_t, uint64_t> freeSpillRanges;
+
+};
@@ -3,6 +3,7 @@
 #include <map>
 #include <memory>
 #include <vector>
+#include <array>
 #include <optional>
 #include <set>
 #include <chrono>
@@ -30,6 +31,9 @@
 
 #include "World/ChunkPOD.hpp"
 #include "World/ChunkViewRange.hpp"
+#include "World/EntityUpdateScheduler.hpp"
+#include "World/ChunkTerrainRenderer.hpp"
+#include "World/ChunkColdStorage.hpp"
 #include "World/PathfindingEngine.hpp"
 #include "World/WorldMap.hpp"
 
@@ -46,6 +50,7 @@ class Entity;
 class ProjectileManager;
 class NetworkHandler;
 class Player;
+class WorkerPool;
 
 class ChunkManager
 {
@@ -57,6 +62,10 @@ public:
     void setSeed(int seed);
     int getSeed() const;
 
+    // Gameplay random streams for planet, derived from seed
+    inline RandomStream& getRandomStream(RandomStreamType type) {return randomStreams.get(type);}
+    inline const RandomStreams& getRandomStreams() const {return randomStreams;}
+
     void setPlanetType(PlanetType planetType);
 
     // Delete all chunks (used when switching planets)
@@ -69,6 +78,11 @@ public:
     
     bool unloadChunksOutOfView(const std::vector<ChunkViewRange>& chunkViewRanges);
 
+    // Moves long unused stored chunks into compressed cold storage
+    void updateColdStorage(Game& game);
+
+    inline ChunkColdStorage& getColdStorage() {return coldStorage;}
+
     // Forces a reload of chunks, used when wrapping around world
     // void reloadChunks(ChunkViewRange chunkViewRange);
 
@@ -76,10 +90,20 @@ public:
     // E.g. when travelling to a new planet and rocket is placed, rocket may be placed inside structure (if there is one)
     void regenerateChunkWithStructureType(ChunkPosition chunk, Game& game, std::optional<StructureType> structureType);
 
+    // Generates chunks which have not been generated into stored chunks, marked modified so are kept when saved
+    // Tiles and structures are generated in parallel, then remaining generation is in order of chunks given, as in game
+    // Entities are not spawned, as spawning depends on generation order across the planet
+    // Returns number of chunks generated
+    int pregenerateChunks(const std::vector<ChunkPosition>& chunks, Game& game, WorkerPool& workerPool);
+
     // Drawing functions for chunk terrain
     void drawChunkTerrain(pl::RenderTarget& window, pl::SpriteBatch& spriteBatch, const Camera& camera, float time);
     void drawChunkWater(pl::RenderTarget& window, const Camera& camera, float time);
 
+    // Draw counters since last reset, displayed in debug menu
+    inline const ChunkDrawStats& getDrawStats() const {return drawStats;}
+    inline void resetDrawStats() {drawStats = ChunkDrawStats();}
+
     // Returns a pointer to the chunk with ChunkPosition key
     // Chunk can be in loaded chunks or stored chunks
     Chunk* getChunk(ChunkPosition chunk);
@@ -89,6 +113,10 @@ public:
 
     const BiomeGenData* getChunkBiome(ChunkPosition chunk);
 
+    // Biome at top left tile of each world map tile in chunk, used when creating chunk world map sections
+    using ChunkMapBiomeGrid = std::array<std::array<const BiomeGenData*, CHUNK_MAP_TILE_SIZE>, CHUNK_MAP_TILE_SIZE>;
+    const ChunkMapBiomeGrid& getChunkMapBiomes(ChunkPosition chunk);
+
 
     // -- Tilemap -- //
     TileMap* getChunkTileMap(ChunkPosition chunk, int tileMap);
@@ -97,6 +125,11 @@ public:
     // IF GRAPHIC UPDATE IS DISABLED, ENSURE TO CALL performChunkSetTileUpdate AFTER
     std::set<int> setChunkTile(ChunkPosition chunk, int tileMap, pl::Vector2<int> position, bool tileGraphicUpdate = true);
 
+    // Sets all tilemap tiles for chunk from its ground tiles in a single pass, including background tiles
+    // Computes every tilemap once for the whole chunk rather than per tile, used when generating / loading a chunk
+    // Adjacent chunk tilemaps are updated as in setChunkTile
+    void setChunkTilesFromGround(ChunkPosition chunk);
+
     // Sets tilemap tiles for the current tile for background, depending on adjacent tiles
     // Also sets adjacent tilemap tiles to have backing for the current tile
     // Returns set of tilemaps modified
@@ -165,13 +198,21 @@ public:
     // Get all objects in loaded chunks (used for drawing)
     std::vector<WorldObject*> getChunkObjects(ChunkViewRange chunkViewRange);
 
+    // Appends cached drawable objects, entities and item pickups of loaded chunks in view range
+    void getChunkDrawableObjects(ChunkViewRange chunkViewRange, std::vector<WorldObject*>& worldObjects, VisibleObjectStats& stats);
+
 
     // -- Entities -- //
     // Update all entities in loaded chunks
-    void updateChunksEntities(float dt, ProjectileManager& projectileManager, Game& game, bool networkUpdateOnly);
+    // Entities outside of chunk view ranges' screen area update behaviour at reduced rates (see EntityUpdateScheduler)
+    void updateChunksEntities(float dt, ProjectileManager& projectileManager, Game& game, bool networkUpdateOnly,
+        const std::vector<ChunkViewRange>& chunkViewRanges = {});
+
+    inline const EntityUpdateStats& getEntityUpdateStats() const {return entityUpdateScheduler.getStats();}
 
     // Damages any entities hit by any hit rect
-    void testChunkEntityHitCollision(const std::vector<HitRect>& hitRects, pl::Vector2f hitOrigin, Game& game, float gameTime);
+    void testChunkEntityHitCollision(const std::vector<HitRect>& hitRects, pl::Vector2f hitOrigin, Game& game, float gameTime,
+        const HitboxSnapshot* rewindSnapshot = nullptr);
 
     // Tests whether a collision is occuring between player and entity with damage - if so, return damage through parameter
     bool testChunkEntityPlayerDamageCollision(const CollisionRect& playerCollisionRect, int& damage);
@@ -184,6 +225,10 @@ public:
 
     // Get all entities in loaded chunks (used for drawing)
     std::vector<WorldObject*> getChunkEntities(ChunkViewRange chunkViewRange);
+    std::vector<WorldObject*> getLoadedChunkEntities();
+
+    // Removes all entities in loaded chunks, returning number removed
+    int clearLoadedChunksEntities();
 
     int getChunkEntitySpawnCooldown(ChunkPosition chunk);
 
@@ -246,19 +291,34 @@ public:
     std::vector<ChunkPOD> getChunkPODs();
     void loadFromChunkPODs(const std::vector<ChunkPOD>& pods, Game& game);
 
+    // Hash of loaded chunk tiles, objects and entities, used to find where a replay diverges
+    // Tile / object state is only rehashed for chunks where content version has changed, unless full hash is requested,
+    // as object state not sent to clients (e.g. plant growth) does not change content version
+    uint64_t getLoadedChunksStateHash(bool fullHash);
+
 
     // -- Networking --
 
-    // Get chunk data to send over network
     // Generates chunk minimally (as if loaded from POD and out of view) if does not exist
-    PacketDataChunkDatas::ChunkData getChunkDataAndGenerate(ChunkPosition chunk, Game& game);
+    Chunk* getChunkAndGenerate(ChunkPosition chunk, Game& game);
+
+    // Get chunk data to send over network
+    static PacketDataChunkDatas::ChunkData getChunkData(Chunk& chunk);
 
     void setChunkData(const PacketDataChunkDatas::ChunkData& chunkData, Game& game);
+
+    // Applies object edits from host, if newer than chunk data held
+    // Returns false if chunk is not held
+    bool setChunkEdits(const PacketDataChunkEdits::ChunkEdits& chunkEdits, Game& game);
     
 
     // Misc
     inline int getLoadedChunkCount() const {return loadedChunks.size();}
-    inline int getGeneratedChunkCount() const {return loadedChunks.size() + storedChunks.size();}
+    inline int getGeneratedChunkCount() const {return loadedChunks.size() + storedChunks.size() + coldStorage.getChunkCount();}
+    inline int getStoredChunkCount() const {return storedChunks.size();}
+
+    // Tile map vertex bytes of loaded and stored chunks
+    size_t getChunkTileMapsVertexBytes() const;
     inline int getWorldSize() const {return worldSize;}
     inline const FastNoise& getBiomeNoise() const {return biomeNoise;}
     inline const FastNoise& getHeightNoise() const {return heightNoise;}
@@ -301,15 +361,42 @@ private:
 
     void clearUnmodifiedStoredChunks();
 
+    // Compresses stored chunk into cold storage, or deletes if unmodified
+    void storeChunkCold(ChunkPosition chunk);
+
+    // Moves chunk from cold storage into stored chunks
+    Chunk* rehydrateColdChunk(ChunkPosition chunk);
+
 private:
     std::unordered_map<ChunkPosition, std::unique_ptr<Chunk>> storedChunks;
     std::unordered_map<ChunkPosition, std::unique_ptr<Chunk>> loadedChunks;
 
+    // Stored chunks not used for STORED_CHUNK_COLD_TIME, or least recently used stored chunks over MAX_STORED_CHUNKS,
+    // are moved into cold storage
+    ChunkColdStorage coldStorage;
+    std::unordered_map<ChunkPosition, uint64_t> storedChunkLastUsedTime;
+
+    // Content version and hash of chunk state excluding entities, for replay state hashes
+    std::unordered_map<ChunkPosition, std::pair<uint64_t, uint64_t>> chunkStateHashes;
+    uint64_t lastColdStorageUpdateTime = 0;
+
+    static constexpr uint64_t STORED_CHUNK_COLD_TIME = 60000;
+    static constexpr int MAX_STORED_CHUNKS = 256;
+    static constexpr int MAX_COLD_STORED_CHUNKS_PER_UPDATE = 16;
+    static constexpr uint64_t COLD_STORAGE_UPDATE_TIME = 1000;
+
+    // Required to rehydrate cold chunks, set in updateColdStorage
+    Game* game = nullptr;
+
     std::unordered_map<ChunkPosition, const BiomeGenData*> chunkBiomeCache;
+    std::unordered_map<ChunkPosition, ChunkMapBiomeGrid> chunkMapBiomeCache;
 
     static constexpr int MAX_CHUNK_ENTITY_SPAWN_COOLDOWN = 60000;
     std::unordered_map<ChunkPosition, uint64_t> chunkLastEntitySpawnTime;
 
+    // Game time in milliseconds, rather than system time, so timed chunk behaviour is the same when replayed
+    uint64_t currentTime = 0;
+
     FastNoise heightNoise;
     FastNoise biomeNoise;
     FastNoise riverNoise;
@@ -319,10 +406,20 @@ private:
 
     int seed = 0;
 
+    RandomStreams randomStreams;
+
     PathfindingEngine pathfindingEngine;
 
+    EntityUpdateScheduler entityUpdateScheduler;
+
+    // Loaded chunks in entity update order, reused each frame
+    std::vector<Chunk*> entityUpdateChunks;
+
     WorldMap worldMap;
 
+    ChunkTerrainRenderer terrainRenderer;
+    ChunkDrawStats drawStats;
+
 };
 
 template <class T>
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <vector>
+#include <map>
+#include <utility>
+#include <optional>
+#include <functional>
+#include <cstdint>
+
+#include <Graphics/RenderTarget.hpp>
+#include <Graphics/VertexArray.hpp>
+#include <Graphics/Texture.hpp>
+#include <Graphics/Color.hpp>
+#include <Vector.hpp>
+#include <Rect.hpp>
+
+#include "Core/Camera.hpp"
+#include "World/ChunkViewRange.hpp"
+#include "World/TileMap.hpp"
+
+#include "GameConstants.hpp"
+
+class Chunk;
+
+// Counters for chunk drawing, reset each frame
+struct ChunkDrawStats
+{
+    int terrainDrawCalls = 0;
+    int terrainVertices = 0;
+    int waterDrawCalls = 0;
+
+    // Full merged terrain vertex array rebuilds (view range changed), and single chunk vertex range rebuilds (tiles changed)
+    int terrainRebuilds = 0;
+    int terrainChunkRebuilds = 0;
+    int terrainVerticesRebuilt = 0;
+
+    int waterRebuilds = 0;
+};
+
+// Merges tilemaps of all chunks in view into a single vertex array per tilemap type,
+// so terrain takes one draw call per tilemap type rather than one per tilemap per chunk
+// Each chunk has a fixed vertex range in each vertex array, so when tiles in a chunk change only that chunk's range is rebuilt
+// Water of all chunks in view is drawn in a single draw call, with chunk water colours read from a colour grid texture
+class ChunkTerrainRenderer
+{
+public:
+    ChunkTerrainRenderer() = default;
+
+    // Chunks must be in view range iteration order, nullptr where chunk is not loaded
+    void drawTerrain(pl::RenderTarget& window, const Camera& camera, const ChunkViewRange& chunkViewRange, const std::vector<Chunk*>& chunksInView,
+        ChunkDrawStats& drawStats);
+
+    // Rebuilds vertex arrays for view range / changed chunks
+    void updateTerrainVertices(const ChunkViewRange& chunkViewRange, const std::vector<Chunk*>& chunksInView, ChunkDrawStats& drawStats);
+
+    inline const std::vector<std::pair<int, pl::VertexArray>>& getTerrainVertexArrays() const {return tileMapVertexArrays;}
+
+    // Water colour callback returns nullopt if water colour of chunk is not known, in which case water is not drawn in or next to chunk
+    void drawWater(pl::RenderTarget& window, const Camera& camera, const ChunkViewRange& chunkViewRange, const std::vector<Chunk*>& chunksInView,
+        const pl::Rect<float>& waterTextureRect, std::function<std::optional<pl::Color>(ChunkPosition)> getWaterColor, ChunkDrawStats& drawStats);
+
+    // Forces rebuild on next draw
+    void reset();
+
+    // Builds merged vertex arrays for chunks, in tilemap draw order
+    // Vertices are in unscaled pixels relative to top left chunk of view range
+    static std::vector<std::pair<int, pl::VertexArray>> buildTerrainVertices(const ChunkViewRange& chunkViewRange, const std::vector<Chunk*>& chunksInView);
+
+    // Builds a quad for each chunk with water colours known for chunk and surrounding chunks
+    // Colour of each vertex holds chunk index in view range, used by water shader to look up colour grid
+    static pl::VertexArray buildWaterVertices(const ChunkViewRange& chunkViewRange, const std::vector<Chunk*>& chunksInView,
+        const pl::Rect<float>& waterTextureRect, const std::vector<std::optional<pl::Color>>& waterColorGrid);
+
+    // Water colours of chunks in view range, plus surrounding border of 1 chunk, row by row
+    static std::vector<std::optional<pl::Color>> buildWaterColorGrid(const ChunkViewRange& chunkViewRange,
+        std::function<std::optional<pl::Color>(ChunkPosition)> getWaterColor);
+
+private:
+    void rebuildChunkVertices(int chunkIndex, const ChunkViewRange& chunkViewRange, Chunk* chunk);
+
+    static pl::Vector2f getChunkVertexOffset(const ChunkViewRange& chunkViewRange, ChunkPosition unwrappedChunkPos);
+
+    static void sortTileMapVertexArrays(std::vector<std::pair<int, pl::VertexArray>>& tileMapVertexArrays);
+
+    void uploadWaterColorGrid(const ChunkViewRange& chunkViewRange, const std::vector<std::optional<pl::Color>>& waterColorGrid);
+
+private:
+    std::vector<std::pair<int, pl::VertexArray>> tileMapVertexArrays;
+
+    // State at last rebuild
+    ChunkViewRange builtChunkViewRange;
+    std::vector<uint64_t> builtChunkTileMapVersions;
+    bool built = false;
+
+    pl::VertexArray waterVertexArray;
+    pl::Texture waterColorGridTexture;
+
+    ChunkViewRange builtWaterChunkViewRange;
+    std::vector<bool> builtWaterChunksLoaded;
+    bool waterBuilt = false;
+
+};
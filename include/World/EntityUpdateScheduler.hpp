@@ -0,0 +1,102 @@
+#pragma once
+
+#include <cstdint>
+#include <array>
+#include <vector>
+#include <optional>
+
+#include "World/ChunkPosition.hpp"
+#include "World/ChunkViewRange.hpp"
+
+// Rate entity behaviour is updated at, by chunk distance from screen of nearest player
+enum class EntityUpdateTier : uint8_t
+{
+    Full,
+    Reduced,
+    Distant,
+    Count
+};
+
+constexpr int ENTITY_UPDATE_TIER_COUNT = static_cast<int>(EntityUpdateTier::Count);
+
+// Per entity scheduling state, held by entity
+struct EntityUpdateSchedule
+{
+    bool assigned = false;
+
+    // Phase of reduced rate updates within tier update interval
+    int bucket = 0;
+    EntityUpdateTier tier = EntityUpdateTier::Full;
+    int framesWaited = 0;
+
+    // Time since behaviour was last updated
+    float behaviourTime = 0.0f;
+
+    // Behaviour steps taken in current update
+    int behaviourSteps = 0;
+};
+
+// Counts from last frame
+struct EntityUpdateStats
+{
+    std::array<int, ENTITY_UPDATE_TIER_COUNT> entityCounts = {};
+    std::array<int, ENTITY_UPDATE_TIER_COUNT> behaviourUpdates = {};
+
+    // Entities due to update which were delayed to next frame by budget
+    int behaviourUpdatesDeferred = 0;
+};
+
+// Decides which entities update their behaviour (movement, AI, pathfinding) each frame on host / solo
+// Entities in chunks on screen for any player update every frame, others update every few frames in staggered buckets,
+// with time since last update given to behaviour
+// Reduced rate updates are limited per frame by budget, with entities over budget updated on following frames
+class EntityUpdateScheduler
+{
+public:
+    EntityUpdateScheduler() = default;
+
+    // Chunk view ranges are load ranges of players (including CHUNK_VIEW_LOAD_BORDER)
+    // If no view ranges are given, all entities update every frame
+    void beginFrame(const std::vector<ChunkViewRange>& chunkViewRanges, int worldSize);
+
+    EntityUpdateTier getChunkTier(ChunkPosition chunk) const;
+
+    // Returns whether entity behaviour should update this frame
+    bool scheduleBehaviourUpdate(EntityUpdateTier tier, EntityUpdateSchedule& schedule);
+
+    // Removes next behaviour update step from behaviour time and returns it, or nullopt if no steps remain in this update
+    // Behaviour is updated in steps of at most MAX_BEHAVIOUR_DT, up to MAX_BEHAVIOUR_STEPS per update,
+    // with remaining time carried to next update so time is not lost and cost per frame is bounded after a hitch
+    static std::optional<float> takeBehaviourStep(EntityUpdateSchedule& schedule);
+
+    inline uint32_t getFrame() const {return frame;}
+
+    inline const EntityUpdateStats& getStats() const {return stats;}
+
+    static constexpr std::array<int, ENTITY_UPDATE_TIER_COUNT> TIER_UPDATE_INTERVALS = {1, 4, 8};
+
+    // Maximum reduced / distant tier behaviour updates per frame
+    static constexpr int REDUCED_RATE_UPDATE_BUDGET = 48;
+
+    // Largest time given to behaviour in one update step, so movement does not pass through collision
+    static constexpr float MAX_BEHAVIOUR_DT = 0.25f;
+
+    static constexpr int MAX_BEHAVIOUR_STEPS = 4;
+
+private:
+    int getChunkDistanceFromRange(ChunkPosition chunk, const ChunkViewRange& chunkViewRange) const;
+
+private:
+    // Chunks on screen of each player
+    std::vector<ChunkViewRange> screenChunkRanges;
+    int worldSize = 0;
+
+    uint32_t frame = 0;
+    int budgetRemaining = 0;
+
+    // Staggers bucket of newly scheduled entities
+    int bucketCounter = 0;
+
+    EntityUpdateStats stats;
+
+};
@@ -23,6 +23,7 @@
 #include "Core/Shaders.hpp"
 #include "Core/Camera.hpp"
 #include "Core/ResolutionHandler.hpp"
+#include "Core/Random.hpp"
 
 #include "Object/WorldObject.hpp"
 #include "Object/BuildableObject.hpp"
@@ -46,7 +47,7 @@ class Room
 {
 public:
     Room();
-    Room(RoomType roomType, ChestDataPool* chestDataPool);
+    Room(RoomType roomType, ChestDataPool* chestDataPool, RandomStream* randomStream = nullptr);
 
     // Copying
     Room(const Room& room);
@@ -59,10 +60,20 @@ public:
 
     std::optional<pl::Vector2f> getEntrancePosition() const;
 
-    std::vector<const WorldObject*> getObjects() const;
+    // Objects to draw, excluding object references
+    // Cached, so only rebuilt when objects in room change
+    inline const std::vector<WorldObject*>& getDrawableObjects() const {return drawableObjects;}
 
+    // rebuildObjectIndex must be called after changing objects in grid
     std::vector<std::vector<std::unique_ptr<BuildableObject>>>& getObjectGrid() {return objectGrid;}
 
+    // Rebuilds drawable objects and object type index from object grid
+    void rebuildObjectIndex();
+
+    // Measured bytes of object and collision grids, for memory stats
+    // Objects in grid are counted separately, as BuildableObject is MemoryTracked
+    size_t getGridBytes() const;
+
     void updateObjects(Game& game, const LocationState& locationState, float dt);
 
     template <class T = BuildableObject>
@@ -99,7 +110,7 @@ public:
 
             archive(roomType, podMetadatas);
 
-            createObjects(nullptr);
+            createObjects(nullptr, nullptr);
 
             for (int y = 0; y < objectGrid.size(); y++)
             {
@@ -131,7 +142,7 @@ public:
                 }
             }
 
-            createCollisionRects();
+            createCollisionGrid();
         }
 
         // loadObjectPODs();
@@ -180,10 +191,16 @@ public:
     }
 
 private:
-    void createObjects(ChestDataPool* chestDataPool);
-    void setObjectFromBitmask(pl::Vector2<int> tile, uint8_t bitmaskValue, ChestDataPool* chestDataPool);
+    void createObjects(ChestDataPool* chestDataPool, RandomStream* randomStream);
+    void setObjectFromBitmask(pl::Vector2<int> tile, uint8_t bitmaskValue, ChestDataPool* chestDataPool, RandomStream* randomStream);
+
+    void createCollisionGrid();
 
-    void createCollisionRects();
+    // Range of tiles which rect could collide with, including one tile either side,
+    // as resolving a collision can move rect into adjacent tile
+    void getCollisionTileRange(const CollisionRect& collisionRect, pl::Vector2<int>& tileMin, pl::Vector2<int>& tileMax) const;
+
+    static CollisionRect createTileCollisionRect(int x, int y);
     
     std::vector<std::vector<std::optional<BuildableObjectPOD>>> getObjectPODs() const;
     void loadObjectPODs();
@@ -191,12 +208,18 @@ private:
 private:
     RoomType roomType = -1;
 
-    std::vector<CollisionRect> collisionRects;
+    // Whether each tile has collision, indexed [y][x]
+    std::vector<std::vector<bool>> collisionGrid;
     std::optional<CollisionRect> warpExitRect;
 
     // Objects in room
     std::vector<std::vector<std::unique_ptr<BuildableObject>>> objectGrid;
 
+    std::vector<WorldObject*> drawableObjects;
+
+    // Tiles of objects (not object references) of each type, in row order
+    std::unordered_map<ObjectType, std::vector<pl::Vector2<int>>> objectTypeTiles;
+
     std::unique_ptr<std::vector<std::vector<std::optional<BuildableObjectPOD>>>> loadingObjectPodsTemp = nullptr;
     std::unique_ptr<std::vector<uint16_t>> unusedMetadataChestIDs = nullptr;
 
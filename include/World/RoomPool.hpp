@@ -6,6 +6,7 @@
 #include <extlib/cereal/archives/binary.hpp>
 #include <extlib/cereal/types/unordered_map.hpp>
 
+#include "Core/MemoryTracker.hpp"
 #include "World/Room.hpp"
 #include "World/ChestDataPool.hpp"
 
@@ -17,7 +18,7 @@ class RoomPool
 public:
     RoomPool() = default;
 
-    uint32_t createRoom(RoomType roomType, ChestDataPool& chestDataPool);
+    uint32_t createRoom(RoomType roomType, ChestDataPool& chestDataPool, RandomStream& randomStream);
 
     void overwriteRoomData(uint32_t id, const Room& room);
 
@@ -25,6 +26,18 @@ public:
 
     bool isIDValid(uint32_t structureID);
 
+    inline int getRoomCount() const {return rooms.size();}
+
+    inline size_t getRoomGridBytes() const
+    {
+        size_t bytes = 0;
+        for (const auto& [roomID, room] : rooms)
+        {
+            bytes += room.getGridBytes();
+        }
+        return bytes;
+    }
+
 
     // Save / load
     template<class Archive>
@@ -46,7 +59,8 @@ public:
 
 private:
     // 0xFFFFFFFF reserved for uninitialised room
-    std::unordered_map<uint32_t, Room> rooms;
+    std::unordered_map<uint32_t, Room, std::hash<uint32_t>, std::equal_to<uint32_t>,
+        TrackedAllocator<std::pair<const uint32_t, Room>, MemoryCategory::Rooms>> rooms;
     uint32_t topDataSlot = 0;
 
 };
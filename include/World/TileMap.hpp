@@ -3,6 +3,8 @@
 
 #include <array>
 #include <vector>
+#include <cstdint>
+#include <atomic>
 
 #include <Graphics/RenderTarget.hpp>
 #include <Graphics/Color.hpp>
@@ -13,11 +15,16 @@
 
 #include "Core/TextureManager.hpp"
 #include "Core/Shaders.hpp"
+#include "Core/Random.hpp"
 
 #include "GameConstants.hpp"
 
 class TileMap
 {
+public:
+    // Tile presence for whole chunk plus one tile border from adjacent chunks, indexed [y + 1][x + 1]
+    using TilePresenceGrid = std::array<std::array<bool, static_cast<int>(CHUNK_TILE_SIZE) + 2>, static_cast<int>(CHUNK_TILE_SIZE) + 2>;
+
 public:
     TileMap();
     TileMap(pl::Vector2<int> offset, int variation = 1);
@@ -25,14 +32,38 @@ public:
     void setTilesetOffset(pl::Vector2<int> offset);
     void setTilesetVariation(int variation);
 
-    void setTile(int x, int y, TileMap* upTiles = nullptr, TileMap* downTiles = nullptr, TileMap* leftTiles = nullptr, TileMap* rightTiles = nullptr);
+    // Tile variation is chosen from random stream
+    void setTile(int x, int y, RandomStream& randomStream, TileMap* upTiles = nullptr, TileMap* downTiles = nullptr, TileMap* leftTiles = nullptr, TileMap* rightTiles = nullptr);
     void removeTile(int x, int y, TileMap* upTiles = nullptr, TileMap* downTiles = nullptr, TileMap* leftTiles = nullptr, TileMap* rightTiles = nullptr);
 
     // Ensure buildVertexArray is called at the end of tile modification
-    void setTileWithoutGraphicsUpdate(int x, int y, TileMap* upTiles = nullptr, TileMap* downTiles = nullptr, TileMap* leftTiles = nullptr, TileMap* rightTiles = nullptr);
+    void setTileWithoutGraphicsUpdate(int x, int y, RandomStream& randomStream, TileMap* upTiles = nullptr, TileMap* downTiles = nullptr, TileMap* leftTiles = nullptr, TileMap* rightTiles = nullptr);
+
+    // Sets all tiles present in grid (keeping existing tiles) and calculates adjacent values for every tile in a single pass
+    // Vertex array is built once, so used when generating / loading whole chunk rather than setting each tile
+    void setTilesFromPresenceGrid(const TilePresenceGrid& presenceGrid, RandomStream& randomStream);
 
     void draw(pl::RenderTarget& window, pl::Vector2f position, pl::Vector2f scale);
 
+    // Draws vertex array with tilemap shader, vertices in unscaled pixels relative to position
+    static void drawVertexArray(pl::RenderTarget& window, const pl::VertexArray& vertexArray, pl::Vector2f position, pl::Vector2f scale);
+
+    // Appends a quad for every tile, offset in unscaled pixels, so each tilemap always adds CHUNK_VERTEX_COUNT vertices
+    // Tiles not present are zero size quads, so are not drawn
+    // Used to merge tilemaps from multiple chunks into a single vertex array, with a fixed vertex range per chunk
+    void addTileQuads(pl::VertexArray& vertexArray, pl::Vector2f offset) const;
+
+    // Appends CHUNK_VERTEX_COUNT zero size vertices, for chunks without tilemap in merged vertex array
+    static void addEmptyTileQuads(pl::VertexArray& vertexArray);
+
+    static constexpr int CHUNK_VERTEX_COUNT = static_cast<int>(CHUNK_TILE_SIZE) * static_cast<int>(CHUNK_TILE_SIZE) * 6;
+
+    // Changes whenever tile vertices change, unique across all tilemaps
+    inline uint64_t getVersion() const {return version;}
+
+    // Measured, as vertex array is not allocated through TrackedAllocator
+    inline size_t getVertexBytes() const {return tileVertexArray.size() * sizeof(pl::Vertex);}
+
     void refreshTile(int x, int y, TileMap* upTiles, TileMap* downTiles, TileMap* leftTiles, TileMap* rightTiles);
     void refreshTopEdge(TileMap* upTiles, TileMap* downTiles, TileMap* leftTiles, TileMap* rightTiles);
     void refreshBottomEdge(TileMap* upTiles, TileMap* downTiles, TileMap* leftTiles, TileMap* rightTiles);
@@ -46,24 +77,34 @@ public:
     pl::Vector2<int> getTextureOffset();
     int getVariation();
 
+    bool isTilePresent(int x, int y);
+
 private:
     void updateTiles(int xModified, int yModified, TileMap* upTiles, TileMap* downTiles, TileMap* leftTiles, TileMap* rightTiles, bool rebuildVertices = true);
     void updateTileFromAdjacent(int x, int y, TileMap* upTiles, TileMap* downTiles, TileMap* leftTiles, TileMap* rightTiles);
 
     void refreshVerticiesForTile(int x, int y);
 
-    pl::Vector2<int> getTextureOffsetForTile(int x, int y);
+    pl::Vector2<int> getTextureOffsetForTile(int x, int y) const;
 
-    bool isTilePresent(int x, int y);
-    bool isTilePresent(uint8_t tileValue);
+    bool isTilePresent(uint8_t tileValue) const;
+
+    void incrementVersion();
 
 private:
+    // Texture offset in tileset for each combination of adjacent tiles (4 LSB of tile)
+    static const std::array<pl::Vector2<int>, 16> ADJACENT_TILES_TEXTURE_OFFSETS;
+
+    static std::atomic<uint64_t> versionCounter;
+
     pl::VertexArray tileVertexArray;
 
     pl::Vector2<int> tilesetOffset;
 
     int variation;
 
+    uint64_t version = 0;
+
     // y, x
     // MSB stores whether tile is present, 4 LSB stores tile type/neighbours
     // Bits between store random variation in chosen tileset (up to 8 variations)
@@ -21,7 +21,7 @@
 #include "Core/Camera.hpp"
 #include "Core/ResolutionHandler.hpp"
 
-#include "Object/WorldObject.hpp"
+#include "Core/Helper.hpp"
 
 class Game;
 class ChunkManager;
@@ -39,32 +39,8 @@ struct WeatherTypeData
     float fallAngle, fallSpeedMin, fallSpeedMax;
 };
 
-class WeatherParticle : public WorldObject
-{    
-public:
-    WeatherParticle(pl::Vector2f position, const WeatherTypeData& weatherTypeData);
-
-    // Returns false if should be destroyed
-    bool update(float dt, const Camera& camera, ChunkManager& chunkManager);
-
-    // Returns target position
-    pl::Vector2f getPosition() const override;
-
-    // void handleWorldWrap(pl::Vector2f positionDelta);
-    
-    void draw(pl::RenderTarget& window, pl::SpriteBatch& spriteBatch, Game& game, const Camera& camera, float dt, float gameTime, int worldSize,
-       const pl::Color& color) const override;
-    
-private:
-    pl::Vector2f velocity;
-
-    float fallTime;
-    float targetFallTime;
-    
-    AnimatedTexture animatedTexture;
-
-};
-    
+// Weather particles are stored as structure of arrays, and are drawn as a single band at WEATHER_DRAW_LAYER
+// rather than sorted with world objects
 class WeatherSystem
 {
 public:
@@ -75,7 +51,9 @@ public:
 
     // void handleWorldWrap(pl::Vector2f positionDelta);
 
-    std::vector<WorldObject*> getWeatherParticles();
+    void draw(pl::RenderTarget& window, pl::SpriteBatch& spriteBatch, const Camera& camera, int worldSize) const;
+
+    inline int getParticleCount() const {return particlePositions.size();}
 
     const WeatherTypeData& getWeatherTypeData() const;
 
@@ -90,6 +68,10 @@ public:
     inline void setWeather(WeatherType type) {currentWeatherType = type;}
 
 private:
+    void spawnParticle(pl::Vector2f position, const WeatherTypeData& weatherTypeData);
+
+    void updateParticles(float dt);
+
     void updateCurrentWeather(float gameTime, bool initialise);
 public:
     float getDestinationTransitionProgress() const;
@@ -97,10 +79,17 @@ public:
 public:
     static constexpr int PRESIMULATION_TICKS = 200;
 
+    // Drawn on top of world objects in this layer
+    static constexpr int WEATHER_DRAW_LAYER = 0;
+
 private:
     static const std::unordered_map<WeatherType, WeatherTypeData> weatherTypeDatas;
     
-    std::vector<WeatherParticle> weatherParticles;
+    std::vector<pl::Vector2f> particlePositions;
+    std::vector<pl::Vector2f> particleVelocities;
+    std::vector<float> particleFallTimes;
+    std::vector<float> particleTargetFallTimes;
+    std::vector<AnimatedTexture> particleAnimatedTextures;
 
     WeatherType currentWeatherType = WeatherType::None;
     WeatherType destinationWeatherType = WeatherType::None;
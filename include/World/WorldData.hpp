@@ -3,6 +3,7 @@
 #include "World/ChunkManager.hpp"
 #include "Entity/Projectile/ProjectileManager.hpp"
 #include "Entity/Boss/BossManager.hpp"
+#include "Entity/HitboxHistory.hpp"
 #include "World/LandmarkManager.hpp"
 #include "World/ChestDataPool.hpp"
 #include "World/RoomPool.hpp"
@@ -17,6 +18,7 @@ struct WorldData
     LandmarkManager landmarkManager;
     ChestDataPool chestDataPool;
     RoomPool structureRoomPool;
+    HitboxHistory hitboxHistory;
 
     inline void initialise(Game* game, PlanetType planetType, int seed)
     {
@@ -38,10 +38,16 @@ class WorldMap
 public:
     WorldMap() = default;
 
+    // Map texture is fully uploaded on next uploadDirtyRegions call
     void setSize(int worldSize);
 
+    // Sets map data on CPU only, texture is updated on next uploadDirtyRegions call
     void setChunkMapSection(const ChunkWorldMapSection& chunkMapSection);
 
+    // Uploads all map regions modified since last upload, coalesced into as few uploads as possible
+    // Should be called once per frame before drawing map
+    void uploadDirtyRegions();
+
     const pl::Texture& getTexture() const;
 
     inline int getWorldSize() const {return worldSize;}
@@ -78,9 +84,18 @@ public:
 private:
     void initTexture();
 
+    void addDirtyRegion(pl::Rect<int> region);
+
     std::vector<uint8_t> mapTextureData;
     pl::Texture mapTexture;
 
+    // Regions of map texture (in map tiles) modified on CPU but not yet uploaded
+    std::vector<pl::Rect<int>> dirtyRegions;
+    bool fullUploadRequired = false;
+
+    // Past this many separate regions, a single full texture upload is cheaper
+    static constexpr int MAX_DIRTY_REGIONS = 64;
+
     std::unordered_set<ChunkPosition> chunksDiscovered;
 
     int worldSize;
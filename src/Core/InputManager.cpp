@@ -22,6 +22,8 @@ std::unordered_map<InputAction, SDL_GameControllerButton> InputManager::controll
 std::unordered_map<InputAction, float> InputManager::inputActivation;
 std::unordered_map<InputAction, float> InputManager::inputActivationLastFrame;
 
+std::optional<InputFrameState> InputManager::replayInputFrameState;
+
 void InputManager::initialise(SDL_Window* window)
 {
     sdlKeyboardState = SDL_GetKeyboardState(NULL);
@@ -108,6 +110,13 @@ void InputManager::update(SDL_Window* window, float dt, pl::Vector2f playerScree
 
     inputActivation.clear();
 
+    if (replayInputFrameState.has_value())
+    {
+        inputActivation = replayInputFrameState->inputActivation;
+        controllerIsActive = replayInputFrameState->controllerActive;
+        return;
+    }
+
     // Check key bindings
     for (auto iter = keyBindings.begin(); iter != keyBindings.end(); iter++)
     {
@@ -216,6 +225,12 @@ void InputManager::update(SDL_Window* window, float dt, pl::Vector2f playerScree
 
 void InputManager::processEvent(const SDL_Event& event)
 {
+    // Replay input already contains input from events
+    if (replayInputFrameState.has_value())
+    {
+        return;
+    }
+
     if (event.type == SDL_EventType::SDL_KEYDOWN || event.type == SDL_EventType::SDL_KEYUP ||
         event.type == SDL_EventType::SDL_MOUSEBUTTONDOWN || event.type == SDL_EventType::SDL_MOUSEBUTTONUP ||
         event.type == SDL_EventType::SDL_MOUSEWHEEL || event.type == SDL_EventType::SDL_MOUSEMOTION)
@@ -323,6 +338,11 @@ void InputManager::consumeInput(InputAction action, std::unordered_map<InputActi
 
 pl::Vector2f InputManager::getMousePosition(SDL_Window* window)
 {
+    if (replayInputFrameState.has_value())
+    {
+        return replayInputFrameState->mousePosition;
+    }
+
     if (InputManager::isControllerActive())
     {
         return pl::Vector2f(controllerMousePosX, controllerMousePosY);
@@ -444,4 +464,32 @@ float InputManager::getControllerRelativeCursorAlpha()
     controllerDirection.x = getActionAxisActivation(InputAction::DIRECT_LEFT, InputAction::DIRECT_RIGHT);
     controllerDirection.y = getActionAxisActivation(InputAction::DIRECT_UP, InputAction::DIRECT_DOWN);
     return controllerDirection.getLength();
+}
+
+InputFrameState InputManager::getInputFrameState(SDL_Window* window)
+{
+    InputFrameState inputFrameState;
+
+    for (const auto& activation : inputActivation)
+    {
+        if (activation.second != 0.0f)
+        {
+            inputFrameState.inputActivation[activation.first] = activation.second;
+        }
+    }
+
+    inputFrameState.mousePosition = getMousePosition(window);
+    inputFrameState.controllerActive = controllerIsActive;
+
+    return inputFrameState;
+}
+
+void InputManager::setReplayInputFrameState(const InputFrameState& inputFrameState)
+{
+    replayInputFrameState = inputFrameState;
+}
+
+void InputManager::clearReplayInputFrameState()
+{
+    replayInputFrameState = std::nullopt;
 }
\ No newline at end of file
@@ -0,0 +1,113 @@
+#include "Core/MemoryTracker.hpp"
+
+#include "IO/Log.hpp"
+
+std::array<MemoryTracker::CategoryCounters, MEMORY_CATEGORY_COUNT> MemoryTracker::counters;
+
+float MemoryTracker::logTime = 0.0f;
+
+std::function<void()> MemoryTracker::measureCallback;
+
+const char* getMemoryCategoryName(MemoryCategory category)
+{
+    switch (category)
+    {
+        case MemoryCategory::Chunks: return "Chunks";
+        case MemoryCategory::TileMaps: return "TileMaps";
+        case MemoryCategory::Objects: return "Objects";
+        case MemoryCategory::Entities: return "Entities";
+        case MemoryCategory::ChestData: return "ChestData";
+        case MemoryCategory::Rooms: return "Rooms";
+        case MemoryCategory::Packets: return "Packets";
+        case MemoryCategory::Textures: return "Textures";
+        default: return "Unknown";
+    }
+}
+
+void MemoryTracker::recordAllocation(MemoryCategory category, size_t bytes)
+{
+    CategoryCounters& categoryCounters = counters[static_cast<int>(category)];
+
+    int64_t liveBytes = categoryCounters.liveBytes.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+    categoryCounters.liveCount.fetch_add(1, std::memory_order_relaxed);
+
+    int64_t highWaterBytes = categoryCounters.highWaterBytes.load(std::memory_order_relaxed);
+    while (liveBytes > highWaterBytes && !categoryCounters.highWaterBytes.compare_exchange_weak(highWaterBytes, liveBytes, std::memory_order_relaxed)) {}
+}
+
+void MemoryTracker::recordFree(MemoryCategory category, size_t bytes)
+{
+    CategoryCounters& categoryCounters = counters[static_cast<int>(category)];
+
+    categoryCounters.liveBytes.fetch_sub(bytes, std::memory_order_relaxed);
+    categoryCounters.liveCount.fetch_sub(1, std::memory_order_relaxed);
+}
+
+void MemoryTracker::setMeasuredBytes(MemoryCategory category, size_t bytes)
+{
+    counters[static_cast<int>(category)].measuredBytes.store(bytes, std::memory_order_relaxed);
+}
+
+void MemoryTracker::setMeasureCallback(std::function<void()> callback)
+{
+    measureCallback = callback;
+}
+
+MemoryCategoryStats MemoryTracker::getStats(MemoryCategory category)
+{
+    const CategoryCounters& categoryCounters = counters[static_cast<int>(category)];
+
+    MemoryCategoryStats stats;
+    stats.liveBytes = categoryCounters.liveBytes.load(std::memory_order_relaxed);
+    stats.liveCount = categoryCounters.liveCount.load(std::memory_order_relaxed);
+    stats.highWaterBytes = categoryCounters.highWaterBytes.load(std::memory_order_relaxed);
+    stats.measuredBytes = categoryCounters.measuredBytes.load(std::memory_order_relaxed);
+    return stats;
+}
+
+MemorySnapshot MemoryTracker::getSnapshot()
+{
+    MemorySnapshot snapshot;
+    for (int i = 0; i < MEMORY_CATEGORY_COUNT; i++)
+    {
+        snapshot[i] = getStats(static_cast<MemoryCategory>(i));
+    }
+    return snapshot;
+}
+
+void MemoryTracker::resetHighWaterMarks()
+{
+    for (CategoryCounters& categoryCounters : counters)
+    {
+        categoryCounters.highWaterBytes.store(categoryCounters.liveBytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+}
+
+void MemoryTracker::update(float dt)
+{
+    logTime += dt;
+    if (logTime < LOG_INTERVAL)
+    {
+        return;
+    }
+
+    logTime = 0.0f;
+    logStats();
+}
+
+void MemoryTracker::logStats()
+{
+    if (measureCallback)
+    {
+        measureCallback();
+    }
+
+    Log::push("MEMORY: {:<10} {:>12} {:>10} {:>12} {:>12}\n", "Category", "Live KB", "Count", "Peak KB", "Measured KB");
+
+    for (int i = 0; i < MEMORY_CATEGORY_COUNT; i++)
+    {
+        MemoryCategoryStats stats = getStats(static_cast<MemoryCategory>(i));
+        Log::push("MEMORY: {:<10} {:>12.1f} {:>10} {:>12.1f} {:>12.1f}\n", getMemoryCategoryName(static_cast<MemoryCategory>(i)),
+            stats.liveBytes / 1024.0f, stats.liveCount, stats.highWaterBytes / 1024.0f, stats.measuredBytes / 1024.0f);
+    }
+}
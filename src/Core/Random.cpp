@@ -9,3 +9,75 @@ int RandInt::generate(int low, int high)
     next = next * 1102515245 + 12345;
     return ((unsigned int)(next / 65536) % 32768) % (high + 1 - low) + low;
 }
+
+// Used to spread similar seeds (e.g. adjacent chunks) over whole seed range
+static uint64_t mixSeed(uint64_t value)
+{
+    value += 0x9e3779b97f4a7c15;
+    value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9;
+    value = (value ^ (value >> 27)) * 0x94d049bb133111eb;
+    return value ^ (value >> 31);
+}
+
+RandomStream::RandomStream(uint64_t seed, uint64_t streamID)
+{
+    // Increment must be odd
+    increment = (streamID << 1) | 1;
+    state = 0;
+    next();
+    state += seed;
+    next();
+}
+
+uint32_t RandomStream::next()
+{
+    uint64_t oldState = state;
+    state = oldState * 6364136223846793005ULL + increment;
+
+    uint32_t xorShifted = ((oldState >> 18) ^ oldState) >> 27;
+    uint32_t rotation = oldState >> 59;
+    return (xorShifted >> rotation) | (xorShifted << ((-rotation) & 31));
+}
+
+int RandomStream::randInt(int low, int high)
+{
+    if (high <= low)
+    {
+        return low;
+    }
+
+    // Multiply shift to map into range without modulo
+    uint64_t range = static_cast<uint64_t>(static_cast<int64_t>(high) - low) + 1;
+    return low + static_cast<int64_t>((static_cast<uint64_t>(next()) * range) >> 32);
+}
+
+float RandomStream::randFloat(float low, float high)
+{
+    float t = next() / 4294967295.0f;
+    return (high - low) * t + low;
+}
+
+void RandomStreams::seed(uint64_t seed, uint64_t locationID)
+{
+    locationSeed = mixSeed(seed ^ mixSeed(locationID));
+
+    for (int i = 0; i < streams.size(); i++)
+    {
+        streams[i] = RandomStream(locationSeed, i);
+    }
+}
+
+RandomStream& RandomStreams::get(RandomStreamType type)
+{
+    return streams[static_cast<int>(type)];
+}
+
+RandomStream RandomStreams::createStream(RandomStreamType type, uint64_t key) const
+{
+    return createStream(locationSeed, type, key);
+}
+
+RandomStream RandomStreams::createStream(uint64_t seed, RandomStreamType type, uint64_t key)
+{
+    return RandomStream(mixSeed(seed ^ mixSeed(key)), static_cast<uint64_t>(type));
+}
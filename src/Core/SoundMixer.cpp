@@ -0,0 +1,171 @@
+#include "Core/SoundMixer.hpp"
+#include "Core/Sounds.hpp"
+#include "Core/Camera.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+SoundMixer::SoundMixer()
+{
+    backend = &nullBackend;
+}
+
+void SoundMixer::setBackend(ISoundBackend* backend)
+{
+    stopAllVoices();
+    this->backend = backend ? backend : &nullBackend;
+}
+
+void SoundMixer::setListener(pl::Vector2f position, int worldSize)
+{
+    listenerPosition = position;
+    listenerWorldSize = worldSize;
+}
+
+void SoundMixer::update(float dt)
+{
+    mixerTime += dt;
+
+    for (auto iter = activeVoices.begin(); iter != activeVoices.end();)
+    {
+        iter->timeRemaining -= dt;
+        if (iter->timeRemaining <= 0.0f)
+        {
+            iter = activeVoices.erase(iter);
+            continue;
+        }
+        iter++;
+    }
+}
+
+std::optional<uint64_t> SoundMixer::playSound(SoundType type, float volume)
+{
+    return playVoice(type, volume, 0.0f);
+}
+
+std::optional<uint64_t> SoundMixer::playSoundAt(SoundType type, pl::Vector2f worldPosition, float volume)
+{
+    // Position relative to listener across world wrap, e.g. sound just over wrap edge to the left is to the left
+    pl::Vector2f relativePosition = Camera::translateWorldPos(worldPosition, listenerPosition, listenerWorldSize) - listenerPosition;
+    float distance = relativePosition.getLength();
+
+    float attenuation = 1.0f;
+    if (distance > ATTENUATION_INNER_DISTANCE)
+    {
+        attenuation = 1.0f - (distance - ATTENUATION_INNER_DISTANCE) / (ATTENUATION_MAX_DISTANCE - ATTENUATION_INNER_DISTANCE);
+        attenuation = std::max(attenuation, 0.0f);
+    }
+
+    float attenuatedVolume = volume * attenuation;
+    if (attenuatedVolume < MIN_AUDIBLE_VOLUME)
+    {
+        stats.voicesCulled++;
+        return std::nullopt;
+    }
+
+    float pan = std::clamp(relativePosition.x / ATTENUATION_MAX_DISTANCE, -1.0f, 1.0f);
+
+    return playVoice(type, attenuatedVolume, pan);
+}
+
+std::optional<uint64_t> SoundMixer::playVoice(SoundType type, float volume, float pan)
+{
+    // Merge with identical sound started very recently, keeping the loudest
+    auto lastStartIter = lastStartTimes.find(type);
+    if (lastStartIter != lastStartTimes.end() && mixerTime - lastStartIter->second < MERGE_COOLDOWN)
+    {
+        auto mergeVoiceIter = std::find_if(activeVoices.rbegin(), activeVoices.rend(), [type](const SoundVoice& voice) {return voice.type == type;});
+        // Recent voice is kept if backend cannot stop it, as replacing would play both
+        if (mergeVoiceIter == activeVoices.rend() || mergeVoiceIter->volume >= volume || !backend->canStopVoices())
+        {
+            stats.voicesMerged++;
+            return std::nullopt;
+        }
+
+        // New sound is louder, so replaces recent voice
+        backend->stopVoice(*mergeVoiceIter);
+        activeVoices.erase(std::next(mergeVoiceIter).base());
+        stats.voicesMerged++;
+    }
+
+    auto voiceLimitIter = voiceLimits.find(type);
+    int voiceLimit = (voiceLimitIter != voiceLimits.end()) ? voiceLimitIter->second : DEFAULT_VOICE_LIMIT;
+
+    if (getActiveVoiceCount(type) >= voiceLimit && !stealVoice(type, volume))
+    {
+        stats.voicesRejected++;
+        return std::nullopt;
+    }
+
+    if (activeVoices.size() >= globalVoiceLimit && !stealVoice(std::nullopt, volume))
+    {
+        stats.voicesRejected++;
+        return std::nullopt;
+    }
+
+    SoundVoice voice;
+    voice.id = ++voiceCounter;
+    voice.type = type;
+    voice.volume = volume;
+    voice.pan = pan;
+    voice.timeRemaining = VOICE_DURATION;
+
+    activeVoices.push_back(voice);
+    lastStartTimes[type] = mixerTime;
+
+    backend->playVoice(voice);
+    stats.voicesPlayed++;
+
+    return voice.id;
+}
+
+bool SoundMixer::stealVoice(std::optional<SoundType> type, float volume)
+{
+    auto quietestIter = activeVoices.end();
+
+    for (auto iter = activeVoices.begin(); iter != activeVoices.end(); iter++)
+    {
+        if (type.has_value() && iter->type != type.value())
+        {
+            continue;
+        }
+
+        if (quietestIter == activeVoices.end() || iter->volume < quietestIter->volume)
+        {
+            quietestIter = iter;
+        }
+    }
+
+    if (quietestIter == activeVoices.end() || quietestIter->volume >= volume)
+    {
+        return false;
+    }
+
+    backend->stopVoice(*quietestIter);
+    activeVoices.erase(quietestIter);
+    stats.voicesStolen++;
+    if (!backend->canStopVoices())
+    {
+        stats.voicesStolenStillPlaying++;
+    }
+    return true;
+}
+
+void SoundMixer::setVoiceLimit(SoundType type, int limit)
+{
+    voiceLimits[type] = limit;
+}
+
+void SoundMixer::stopAllVoices()
+{
+    for (const SoundVoice& voice : activeVoices)
+    {
+        backend->stopVoice(voice);
+    }
+    activeVoices.clear();
+}
+
+int SoundMixer::getActiveVoiceCount(SoundType type) const
+{
+    return std::count_if(activeVoices.begin(), activeVoices.end(), [type](const SoundVoice& voice) {return voice.type == type;});
+}
@@ -1,7 +1,35 @@
 #include "Core/Sounds.hpp"
 
+// Plays mixer voices through loaded sound objects
+// pl::Sound has no panning, so only attenuated volume is applied
+class FrameworkSoundBackend : public ISoundBackend
+{
+public:
+    FrameworkSoundBackend(std::unordered_map<SoundType, std::unique_ptr<pl::Sound>>& soundMap, const int& soundVolume)
+        : soundMap(soundMap), soundVolume(soundVolume) {}
+
+    void playVoice(const SoundVoice& voice) override
+    {
+        pl::Sound& sound = *soundMap.at(voice.type).get();
+        sound.setVolume(voice.volume / 100.0f * soundVolume / 100.0f);
+        sound.play();
+    }
+
+    // Voices of the same type share a sound object, so stolen voice is left to finish
+    // rather than stopping other voices of its type
+    void stopVoice(const SoundVoice& voice) override {}
+    bool canStopVoices() const override {return false;}
+
+private:
+    std::unordered_map<SoundType, std::unique_ptr<pl::Sound>>& soundMap;
+    const int& soundVolume;
+};
+
 std::unordered_map<SoundType, std::unique_ptr<pl::Sound>> Sounds::soundMap;
 
+SoundMixer Sounds::mixer;
+std::unique_ptr<ISoundBackend> Sounds::soundBackend;
+
 const std::unordered_map<SoundType, std::string> Sounds::soundPaths = {
     {SoundType::HitObject, "Data/Sounds/hit_object.ogg"},
     {SoundType::HitObject2, "Data/Sounds/hit_object_2.ogg"},
@@ -117,6 +145,10 @@ bool Sounds::loadSounds()
     // If loaded sounds is false (unsuccessful load), return false
     if (!loadedSounds)
         return false;
+
+    // Play mixer voices through loaded sounds
+    soundBackend = std::make_unique<FrameworkSoundBackend>(soundMap, soundVolume);
+    mixer.setBackend(soundBackend.get());
     
     // Return true by default
     return true;
@@ -128,6 +160,10 @@ void Sounds::unloadSounds()
     // Set loaded sounds to false, as they are about to be unloaded
     loadedSounds = false;
 
+    // Mixer records voices without playing once sounds are unloaded
+    mixer.setBackend(nullptr);
+    soundBackend.reset();
+
     // Delete all sound objects
     soundMap.clear();
     // Delete all sound buffers (must be deleted after sound objects)
@@ -141,6 +177,8 @@ void Sounds::update(float dt)
 {
     fadeOutTween.update(dt);
 
+    mixer.update(dt);
+
     // Test music has finished fading out if required
     if (fadingOutMusic.has_value())
     {
@@ -158,16 +196,18 @@ void Sounds::update(float dt)
 // Play sound effect
 void Sounds::playSound(SoundType type, float volume)
 {
-    // If sounds have not been loaded, return by default
-    if (!loadedSounds)
-        return;
-
-    pl::Sound& sound = *soundMap.at(type).get();
+    // Mixer decides whether sound plays (through null backend if sounds not loaded)
+    mixer.playSound(type, volume);
+}
 
-    sound.setVolume(volume / 100.0f * soundVolume / 100.0f);
+void Sounds::playSoundAt(SoundType type, pl::Vector2f worldPosition, float volume)
+{
+    mixer.playSoundAt(type, worldPosition, volume);
+}
 
-    // Play sound from sound map
-    sound.play();
+void Sounds::setListener(pl::Vector2f position, int worldSize)
+{
+    mixer.setListener(position, worldSize);
 }
 
 // Play music track
@@ -1,4 +1,5 @@
 #include "Core/TextureManager.hpp"
+#include "Core/MemoryTracker.hpp"
 #include <extlib/hashpp.h>
 
 // Initialise member variables, as is static class
@@ -70,6 +71,9 @@ bool TextureManager::loadTextures()
         texture->setTextureRepeat(true);
         texture->setLinearFilter(false);
 
+        // Texture memory is held by GPU, so estimate from size
+        MemoryTracker::recordAllocation(MemoryCategory::Textures, texture->getWidth() * texture->getHeight() * 4);
+
         // Store texture object in texture map
         textureMap[textureType] = std::move(texture);
 
@@ -114,6 +118,7 @@ void TextureManager::unloadTextures()
 {
     for (auto iter = textureMap.begin(); iter != textureMap.end();)
     {
+        MemoryTracker::recordFree(MemoryCategory::Textures, iter->second->getWidth() * iter->second->getHeight() * 4);
         iter = textureMap.erase(iter);
     }
 
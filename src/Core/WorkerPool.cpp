@@ -0,0 +1,113 @@
+#include "Core/WorkerPool.hpp"
+
+#include <algorithm>
+#include <exception>
+
+#include "IO/Log.hpp"
+
+WorkerPool::WorkerPool(int workerCount)
+{
+    if (workerCount <= 0)
+    {
+        workerCount = static_cast<int>(std::thread::hardware_concurrency()) - 1;
+    }
+
+    this->workerCount = std::max(workerCount, 0);
+}
+
+WorkerPool::~WorkerPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+
+    jobAvailable.notify_all();
+
+    for (std::thread& worker : workers)
+    {
+        worker.join();
+    }
+}
+
+void WorkerPool::dispatch(std::function<void()> job)
+{
+    if (workerCount <= 0)
+    {
+        job();
+        return;
+    }
+
+    if (workers.empty())
+    {
+        startWorkers();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        jobs.push_back(std::move(job));
+        activeJobCount++;
+    }
+
+    jobAvailable.notify_one();
+}
+
+void WorkerPool::wait()
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    jobsFinished.wait(lock, [this]() {return activeJobCount <= 0;});
+}
+
+void WorkerPool::startWorkers()
+{
+    workers.reserve(workerCount);
+    for (int i = 0; i < workerCount; i++)
+    {
+        workers.emplace_back(&WorkerPool::workerLoop, this);
+    }
+
+    Log::push("Started {} worker threads\n", workerCount);
+}
+
+void WorkerPool::workerLoop()
+{
+    while (true)
+    {
+        std::function<void()> job;
+
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            jobAvailable.wait(lock, [this]() {return stopping || !jobs.empty();});
+
+            if (jobs.empty())
+            {
+                return;
+            }
+
+            job = std::move(jobs.front());
+            jobs.pop_front();
+        }
+
+        try
+        {
+            job();
+        }
+        catch (const std::exception& e)
+        {
+            Log::push("ERROR: Worker job failed: {}\n", e.what());
+        }
+
+        bool finished = false;
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            activeJobCount--;
+            finished = (activeJobCount <= 0);
+        }
+
+        if (finished)
+        {
+            jobsFinished.notify_all();
+        }
+    }
+}
@@ -1,15 +1,19 @@
 #include "Data/ArmourDataLoader.hpp"
 #include <extlib/hashpp.h>
+#include <extlib/cereal/types/string.hpp>
+#include <extlib/cereal/types/vector.hpp>
 
 std::vector<ArmourData> ArmourDataLoader::loaded_armourData;
 std::unordered_map<std::string, ToolType> ArmourDataLoader::armourNameToTypeMap;
 
 std::string ArmourDataLoader::dataHash;
 
-bool ArmourDataLoader::loadData(std::string armourDataPath)
+bool ArmourDataLoader::loadData(const std::string& armourDataJson)
 {
-    std::ifstream file(armourDataPath);
-    nlohmann::json data = nlohmann::json::parse(file);
+    nlohmann::json data = nlohmann::json::parse(armourDataJson);
+
+    loaded_armourData.clear();
+    armourNameToTypeMap.clear();
 
     // Load tool data
     for (nlohmann::json::iterator iter = data.begin(); iter != data.end(); ++iter)
@@ -62,7 +66,7 @@ bool ArmourDataLoader::loadData(std::string armourDataPath)
         loaded_armourData.push_back(armourData);
     }
 
-    dataHash = hashpp::get::getFileHash(hashpp::ALGORITHMS::MD5, armourDataPath);
+    dataHash = hashpp::get::getHash(hashpp::ALGORITHMS::MD5, armourDataJson).getString();
 
     return true;
 }
@@ -92,4 +96,22 @@ ArmourWearType ArmourDataLoader::getArmourWearTypeFromStr(const std::string& arm
 
     // Default case - armour wear type string not found
     return ArmourWearType::Head;
+}
+
+void ArmourDataLoader::saveCache(cereal::BinaryOutputArchive& archive)
+{
+    archive(loaded_armourData, dataHash);
+}
+
+void ArmourDataLoader::loadCache(cereal::BinaryInputArchive& archive)
+{
+    armourNameToTypeMap.clear();
+
+    archive(loaded_armourData, dataHash);
+
+    // Rebuild lookup
+    for (int i = 0; i < loaded_armourData.size(); i++)
+    {
+        armourNameToTypeMap[loaded_armourData[i].name] = i;
+    }
 }
\ No newline at end of file
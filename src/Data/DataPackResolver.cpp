@@ -0,0 +1,255 @@
+#include "Data/DataPackResolver.hpp"
+
+#include <fstream>
+#include <filesystem>
+#include <unordered_set>
+
+#include "IO/Log.hpp"
+
+DataPackResolver::DataPackResolver(const std::string& baseDirectory, const std::vector<std::string>& dataPackDirectories)
+    : baseDirectory(baseDirectory), dataPackDirectories(dataPackDirectories)
+{
+}
+
+std::optional<std::string> DataPackResolver::loadMergedData(const std::string& fileName)
+{
+    std::optional<nlohmann::ordered_json> data = readJson(baseDirectory + fileName);
+    if (!data.has_value())
+    {
+        return std::nullopt;
+    }
+
+    for (const std::string& dataPackDirectory : dataPackDirectories)
+    {
+        std::string dataPackFilePath = (std::filesystem::path(dataPackDirectory) / fileName).string();
+        if (!std::filesystem::exists(dataPackFilePath))
+        {
+            continue;
+        }
+
+        std::optional<nlohmann::ordered_json> dataPackData = readJson(dataPackFilePath);
+        if (!dataPackData.has_value())
+        {
+            return std::nullopt;
+        }
+
+        std::string dataPackName = getDataPackName(dataPackDirectory);
+
+        if (dataPackData->type() != data->type())
+        {
+            Log::push("ERROR: Data pack \"{}\" {} does not match structure of base data\n", dataPackName, fileName);
+            return std::nullopt;
+        }
+
+        if (!mergeJson(data.value(), dataPackData.value(), fileName, dataPackName))
+        {
+            return std::nullopt;
+        }
+
+        Log::push("Applied data pack \"{}\" to {}\n", dataPackName, fileName);
+    }
+
+    return data->dump();
+}
+
+bool DataPackResolver::mergeJson(nlohmann::ordered_json& base, const nlohmann::ordered_json& patch, const std::string& path,
+    const std::string& dataPackName)
+{
+    if (base.is_array() && patch.is_array())
+    {
+        return mergeEntryArray(base, patch, path, dataPackName);
+    }
+
+    if (!base.is_object() || !patch.is_object())
+    {
+        setField(base, patch, path, dataPackName);
+        return true;
+    }
+
+    // Merge keyed objects, e.g. planets, by key
+    for (auto iter = patch.begin(); iter != patch.end(); ++iter)
+    {
+        std::string fieldPath = path + "/" + iter.key();
+
+        // Null removes key, e.g. to replace recipe ingredient
+        if (iter.value().is_null())
+        {
+            if (base.contains(iter.key()))
+            {
+                logConflict(fieldPath, dataPackName);
+                fieldDataPacks[fieldPath] = dataPackName;
+                base.erase(iter.key());
+            }
+            continue;
+        }
+
+        if (!base.contains(iter.key()))
+        {
+            setField(base[iter.key()], iter.value(), fieldPath, dataPackName);
+            continue;
+        }
+
+        if (!mergeJson(base.at(iter.key()), iter.value(), fieldPath, dataPackName))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool DataPackResolver::mergeEntryArray(nlohmann::ordered_json& base, const nlohmann::ordered_json& patch, const std::string& path,
+    const std::string& dataPackName)
+{
+    // Only arrays of named entries are merged, others (e.g. texture rects, drop lists) are replaced
+    bool isEntryArray = !patch.empty();
+    for (const auto& entry : patch)
+    {
+        if (!getEntryName(entry).has_value())
+        {
+            isEntryArray = false;
+            break;
+        }
+    }
+
+    if (!isEntryArray)
+    {
+        setField(base, patch, path, dataPackName);
+        return true;
+    }
+
+    std::unordered_map<std::string, int> entryNameToIndex;
+    std::unordered_set<std::string> ambiguousEntryNames;
+    for (int i = 0; i < base.size(); i++)
+    {
+        std::optional<std::string> entryName = getEntryName(base[i]);
+        if (!entryName.has_value())
+        {
+            continue;
+        }
+
+        if (entryNameToIndex.contains(entryName.value()))
+        {
+            // Entry cannot be overridden, as it is not known which entry with name is meant
+            ambiguousEntryNames.insert(entryName.value());
+            continue;
+        }
+
+        entryNameToIndex[entryName.value()] = i;
+    }
+
+    for (const auto& entry : patch)
+    {
+        std::string entryName = getEntryName(entry).value();
+        std::string entryPath = path + "/" + entryName;
+
+        if (ambiguousEntryNames.contains(entryName))
+        {
+            Log::push("ERROR: Data pack \"{}\" entry {} matches more than one base entry\n", dataPackName, entryPath);
+            return false;
+        }
+
+        auto entryIter = entryNameToIndex.find(entryName);
+        if (entryIter == entryNameToIndex.end())
+        {
+            entryNameToIndex[entryName] = base.size();
+            base.push_back(nlohmann::ordered_json::object());
+            setField(base.back(), entry, entryPath, dataPackName);
+            continue;
+        }
+
+        if (!mergeJson(base[entryIter->second], entry, entryPath, dataPackName))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void DataPackResolver::setField(nlohmann::ordered_json& field, const nlohmann::ordered_json& value, const std::string& path,
+    const std::string& dataPackName)
+{
+    if (field != value)
+    {
+        logConflict(path, dataPackName);
+    }
+
+    fieldDataPacks[path] = dataPackName;
+    field = value;
+}
+
+void DataPackResolver::logConflict(const std::string& path, const std::string& dataPackName)
+{
+    // Field conflicts if it, or an entry containing it, was set by a different data pack
+    std::string conflictPath = path;
+    while (!conflictPath.empty())
+    {
+        auto fieldIter = fieldDataPacks.find(conflictPath);
+        if (fieldIter != fieldDataPacks.end() && fieldIter->second != dataPackName)
+        {
+            conflicts.push_back(path + " set by \"" + fieldIter->second + "\" is overridden by \"" + dataPackName + "\"");
+            break;
+        }
+
+        size_t separator = conflictPath.find_last_of('/');
+        conflictPath = (separator == std::string::npos) ? "" : conflictPath.substr(0, separator);
+    }
+}
+
+std::optional<std::string> DataPackResolver::getEntryName(const nlohmann::ordered_json& entry)
+{
+    if (!entry.is_object())
+    {
+        return std::nullopt;
+    }
+
+    if (entry.contains("name") && entry.at("name").is_string())
+    {
+        return entry.at("name").get<std::string>();
+    }
+
+    // Recipes of same product can be made at different crafting stations, so are matched by both
+    if (entry.contains("product") && entry.at("product").is_string())
+    {
+        std::string entryName = entry.at("product").get<std::string>();
+        if (entry.contains("crafting-station") && entry.at("crafting-station").is_string())
+        {
+            entryName += "@" + entry.at("crafting-station").get<std::string>();
+        }
+        return entryName;
+    }
+
+    return std::nullopt;
+}
+
+std::string DataPackResolver::getDataPackName(const std::string& dataPackDirectory)
+{
+    std::filesystem::path path(dataPackDirectory);
+    if (!path.has_filename())
+    {
+        path = path.parent_path();
+    }
+    return path.filename().string();
+}
+
+std::optional<nlohmann::ordered_json> DataPackResolver::readJson(const std::string& filePath)
+{
+    std::ifstream file(filePath);
+    if (!file)
+    {
+        Log::push("ERROR: Could not open data file \"{}\"\n", filePath);
+        return std::nullopt;
+    }
+
+    try
+    {
+        return nlohmann::ordered_json::parse(file);
+    }
+    catch (const std::exception& e)
+    {
+        Log::push("ERROR: Could not parse data file \"{}\": {}\n", filePath, e.what());
+    }
+
+    return std::nullopt;
+}
@@ -1,15 +1,19 @@
 #include "Data/EntityDataLoader.hpp"
 #include <extlib/hashpp.h>
+#include <extlib/cereal/types/string.hpp>
+#include <extlib/cereal/types/vector.hpp>
 
 std::vector<EntityData> EntityDataLoader::loaded_entityData;
 std::unordered_map<std::string, EntityType> EntityDataLoader::entityNameToTypeMap;
 
 std::string EntityDataLoader::dataHash;
 
-bool EntityDataLoader::loadData(std::string objectDataPath)
+bool EntityDataLoader::loadData(const std::string& entityDataJson)
 {
-    std::ifstream file(objectDataPath);
-    nlohmann::json data = nlohmann::json::parse(file);
+    nlohmann::json data = nlohmann::json::parse(entityDataJson);
+
+    loaded_entityData.clear();
+    entityNameToTypeMap.clear();
 
     int entityIdx = 0;
 
@@ -93,7 +97,7 @@ bool EntityDataLoader::loadData(std::string objectDataPath)
         entityIdx++;
     }
 
-    dataHash = hashpp::get::getFileHash(hashpp::ALGORITHMS::MD5, objectDataPath);
+    dataHash = hashpp::get::getHash(hashpp::ALGORITHMS::MD5, entityDataJson).getString();
 
     return true;
 }
@@ -106,4 +110,22 @@ const EntityData& EntityDataLoader::getEntityData(EntityType entity)
 EntityType EntityDataLoader::getEntityTypeFromName(const std::string& entityName)
 {
     return entityNameToTypeMap[entityName];
+}
+
+void EntityDataLoader::saveCache(cereal::BinaryOutputArchive& archive)
+{
+    archive(loaded_entityData, dataHash);
+}
+
+void EntityDataLoader::loadCache(cereal::BinaryInputArchive& archive)
+{
+    entityNameToTypeMap.clear();
+
+    archive(loaded_entityData, dataHash);
+
+    // Rebuild lookup
+    for (int i = 0; i < loaded_entityData.size(); i++)
+    {
+        entityNameToTypeMap[loaded_entityData[i].name] = i;
+    }
 }
\ No newline at end of file
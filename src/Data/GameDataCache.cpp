@@ -0,0 +1,321 @@
+#include "Data/GameDataCache.hpp"
+
+#include <array>
+#include <fstream>
+#include <sstream>
+#include <filesystem>
+
+#include <extlib/hashpp.h>
+#include <extlib/cereal/types/string.hpp>
+#include <extlib/cereal/types/vector.hpp>
+
+#include <platform_folders.h>
+
+#include "Data/ItemDataLoader.hpp"
+#include "Data/ToolDataLoader.hpp"
+#include "Data/ArmourDataLoader.hpp"
+#include "Data/EntityDataLoader.hpp"
+#include "Data/ObjectDataLoader.hpp"
+#include "Data/RecipeDataLoader.hpp"
+#include "Data/StructureDataLoader.hpp"
+#include "Data/PlanetGenDataLoader.hpp"
+#include "Data/DataPackResolver.hpp"
+
+#include "GameConstants.hpp"
+
+#include "IO/Log.hpp"
+
+std::string GameDataCache::dataHash;
+
+std::vector<std::string> GameDataCache::dataPackDirectories;
+
+std::vector<std::string> GameDataCache::stringTable;
+std::unordered_map<std::string, uint32_t> GameDataCache::stringTableIndexMap;
+
+// Order of data files is order of loading
+static const std::array<std::string, 8> GAME_DATA_FILES = {
+    "items.data",
+    "tools.data",
+    "armour.data",
+    "entities.data",
+    "objects.data",
+    "item_recipes.data",
+    "structures.data",
+    "planet_generation.data"
+};
+
+bool GameDataCache::loadGameData(const std::string& dataDirectory, const std::string& cachePath)
+{
+    dataHash = createSourceHash(dataDirectory);
+
+    if (readCache(cachePath))
+    {
+        return true;
+    }
+
+    if (!loadGameDataFromSource(dataDirectory))
+    {
+        return false;
+    }
+
+    if (!writeCache(cachePath))
+    {
+        Log::push("WARNING: Could not write game data cache to \"{}\"\n", cachePath);
+    }
+
+    return true;
+}
+
+bool GameDataCache::compileGameData(const std::string& dataDirectory, const std::string& cachePath)
+{
+    dataHash = createSourceHash(dataDirectory);
+
+    if (!loadGameDataFromSource(dataDirectory))
+    {
+        Log::push("ERROR: Could not load game data from \"{}\"\n", dataDirectory);
+        return false;
+    }
+
+    if (!writeCache(cachePath))
+    {
+        Log::push("ERROR: Could not write game data cache to \"{}\"\n", cachePath);
+        return false;
+    }
+
+    Log::push("Compiled game data cache to \"{}\"\n", cachePath);
+
+    return true;
+}
+
+std::string GameDataCache::getDefaultCachePath()
+{
+    return sago::getDataHome() + "/Planeturem/game_data.cache";
+}
+
+bool GameDataCache::loadGameDataFromSource(const std::string& dataDirectory)
+{
+    // All data files are merged before loading, so references between files (e.g. recipes to items)
+    // are resolved against data pack entries
+    DataPackResolver dataPackResolver(dataDirectory, dataPackDirectories);
+
+    std::array<std::string, GAME_DATA_FILES.size()> mergedData;
+    for (int i = 0; i < GAME_DATA_FILES.size(); i++)
+    {
+        std::optional<std::string> mergedFileData = dataPackResolver.loadMergedData(GAME_DATA_FILES[i]);
+        if (!mergedFileData.has_value())
+        {
+            return false;
+        }
+        mergedData[i] = std::move(mergedFileData.value());
+    }
+
+    for (const std::string& conflict : dataPackResolver.getConflicts())
+    {
+        Log::push("WARNING: Data pack conflict: {}\n", conflict);
+    }
+
+    if(!ItemDataLoader::loadData(mergedData[0])) return false;
+    if(!ToolDataLoader::loadData(mergedData[1])) return false;
+    if(!ArmourDataLoader::loadData(mergedData[2])) return false;
+    if(!EntityDataLoader::loadData(mergedData[3])) return false;
+    if(!ObjectDataLoader::loadData(mergedData[4])) return false;
+    if(!RecipeDataLoader::loadData(mergedData[5])) return false;
+    if(!StructureDataLoader::loadData(mergedData[6])) return false;
+    if(!PlanetGenDataLoader::loadData(mergedData[7])) return false;
+
+    // Must be done once all other data is loaded to avoid circular dependency
+    if (!ObjectDataLoader::loadRocketPlanetDestinations(PlanetGenDataLoader::getPlanetStringToTypeMap(),
+        StructureDataLoader::getRoomTravelLocationNameToTypeMap()))
+    {
+        return false;
+    }
+
+    return true;
+}
+
+bool GameDataCache::readCache(const std::string& cachePath)
+{
+    std::fstream in(cachePath, std::ios::in | std::ios::binary);
+
+    if (!in)
+    {
+        return false;
+    }
+
+    try
+    {
+        uint32_t magic = 0;
+        uint32_t version = 0;
+        std::string cacheSourceHash;
+        std::string blobHash;
+        std::vector<char> blob;
+
+        {
+            cereal::BinaryInputArchive archive(in);
+            archive(magic, version);
+
+            if (magic != CACHE_MAGIC || version != CACHE_VERSION)
+            {
+                Log::push("Game data cache version mismatch, rebuilding\n");
+                return false;
+            }
+
+            archive(cacheSourceHash);
+
+            if (cacheSourceHash != dataHash)
+            {
+                Log::push("Game data cache out of date, rebuilding\n");
+                return false;
+            }
+
+            archive(blobHash, blob);
+        }
+
+        std::string blobString(blob.begin(), blob.end());
+
+        // Catch truncated / corrupted cache files before deserialising
+        if (hashpp::get::getHash(hashpp::ALGORITHMS::MD5, blobString).getString() != blobHash)
+        {
+            Log::push("WARNING: Game data cache failed hash validation, rebuilding\n");
+            return false;
+        }
+
+        std::stringstream stream(blobString);
+        {
+            cereal::BinaryInputArchive archive(stream);
+            archive(stringTable);
+
+            ItemDataLoader::loadCache(archive);
+            ToolDataLoader::loadCache(archive);
+            ArmourDataLoader::loadCache(archive);
+            EntityDataLoader::loadCache(archive);
+            ObjectDataLoader::loadCache(archive);
+            RecipeDataLoader::loadCache(archive);
+            StructureDataLoader::loadCache(archive);
+            PlanetGenDataLoader::loadCache(archive);
+        }
+    }
+    catch (const std::exception& e)
+    {
+        Log::push("WARNING: Could not read game data cache: {}\n", e.what());
+        stringTable.clear();
+        return false;
+    }
+
+    // String table only required while reading
+    stringTable.clear();
+
+    return true;
+}
+
+bool GameDataCache::writeCache(const std::string& cachePath)
+{
+    stringTable.clear();
+    stringTableIndexMap.clear();
+
+    try
+    {
+        // Serialise data first, interning strings into table
+        std::stringstream dataStream;
+        {
+            cereal::BinaryOutputArchive archive(dataStream);
+            ItemDataLoader::saveCache(archive);
+            ToolDataLoader::saveCache(archive);
+            ArmourDataLoader::saveCache(archive);
+            EntityDataLoader::saveCache(archive);
+            ObjectDataLoader::saveCache(archive);
+            RecipeDataLoader::saveCache(archive);
+            StructureDataLoader::saveCache(archive);
+            PlanetGenDataLoader::saveCache(archive);
+        }
+
+        // String table is placed ahead of data so it is available while data is read
+        std::stringstream blobStream;
+        {
+            cereal::BinaryOutputArchive archive(blobStream);
+            archive(stringTable);
+        }
+        blobStream << dataStream.rdbuf();
+
+        std::string blobString = blobStream.str();
+        std::vector<char> blob(blobString.begin(), blobString.end());
+        std::string blobHash = hashpp::get::getHash(hashpp::ALGORITHMS::MD5, blobString).getString();
+
+        std::filesystem::path cacheDirectory = std::filesystem::path(cachePath).parent_path();
+        if (!cacheDirectory.empty() && !std::filesystem::exists(cacheDirectory))
+        {
+            std::filesystem::create_directories(cacheDirectory);
+        }
+
+        std::fstream out(cachePath, std::ios::out | std::ios::binary);
+
+        if (!out)
+        {
+            throw std::invalid_argument("Could not open game data cache file \"" + cachePath + "\"");
+        }
+
+        cereal::BinaryOutputArchive archive(out);
+        archive(CACHE_MAGIC, CACHE_VERSION, dataHash, blobHash, blob);
+    }
+    catch (const std::exception& e)
+    {
+        Log::push("ERROR: {}\n", e.what());
+        stringTable.clear();
+        stringTableIndexMap.clear();
+        return false;
+    }
+
+    stringTable.clear();
+    stringTableIndexMap.clear();
+
+    return true;
+}
+
+std::string GameDataCache::createSourceHash(const std::string& dataDirectory)
+{
+    std::string sourceHashes = GAME_VERSION + std::to_string(CACHE_VERSION);
+
+    for (const std::string& dataFile : GAME_DATA_FILES)
+    {
+        if (!std::filesystem::exists(dataDirectory + dataFile))
+        {
+            continue;
+        }
+
+        sourceHashes += hashpp::get::getFileHash(hashpp::ALGORITHMS::MD5, dataDirectory + dataFile).getString();
+    }
+
+    // Data packs in order of application, hashed by contents only so directory location does not affect hash
+    for (int i = 0; i < dataPackDirectories.size(); i++)
+    {
+        sourceHashes += "pack" + std::to_string(i);
+
+        for (const std::string& dataFile : GAME_DATA_FILES)
+        {
+            std::filesystem::path dataPackFilePath = std::filesystem::path(dataPackDirectories[i]) / dataFile;
+            if (!std::filesystem::exists(dataPackFilePath))
+            {
+                continue;
+            }
+
+            sourceHashes += dataFile + hashpp::get::getFileHash(hashpp::ALGORITHMS::MD5, dataPackFilePath.string()).getString();
+        }
+    }
+
+    return hashpp::get::getHash(hashpp::ALGORITHMS::MD5, sourceHashes).getString();
+}
+
+uint32_t GameDataCache::internString(const std::string& string)
+{
+    auto iter = stringTableIndexMap.find(string);
+    if (iter != stringTableIndexMap.end())
+    {
+        return iter->second;
+    }
+
+    uint32_t stringIndex = stringTable.size();
+    stringTable.push_back(string);
+    stringTableIndexMap[string] = stringIndex;
+
+    return stringIndex;
+}
@@ -1,5 +1,10 @@
 #include "Data/ItemDataLoader.hpp"
 #include <extlib/hashpp.h>
+#include <extlib/cereal/types/string.hpp>
+#include <extlib/cereal/types/vector.hpp>
+#include <extlib/cereal/types/unordered_map.hpp>
+
+#include "IO/Log.hpp"
 
 std::vector<ItemData> ItemDataLoader::loaded_itemData;
 std::unordered_map<std::string, ItemType> ItemDataLoader::itemNameToTypeMap;
@@ -8,10 +13,13 @@ std::unordered_map<std::string, std::unordered_map<int, std::vector<ItemType>>>
 
 std::string ItemDataLoader::dataHash;
 
-bool ItemDataLoader::loadData(std::string itemDataPath)
+bool ItemDataLoader::loadData(const std::string& itemDataJson)
 {
-    std::ifstream file(itemDataPath);
-    nlohmann::json data = nlohmann::json::parse(file);
+    nlohmann::json data = nlohmann::json::parse(itemDataJson);
+
+    loaded_itemData.clear();
+    itemNameToTypeMap.clear();
+    craftingStationItemMap.clear();
 
     int itemIndex = 0;
 
@@ -84,7 +92,7 @@ bool ItemDataLoader::loadData(std::string itemDataPath)
 
     createCurrencyItemOrderVector();
 
-    dataHash = hashpp::get::getFileHash(hashpp::ALGORITHMS::MD5, itemDataPath);
+    dataHash = hashpp::get::getHash(hashpp::ALGORITHMS::MD5, itemDataJson).getString();
 
     return true;
 }
@@ -119,6 +127,8 @@ ItemType ItemDataLoader::getItemTypeFromName(const std::string& itemName)
 {
     if (!itemNameToTypeMap.contains(itemName))
     {
+        // Unresolved reference, e.g. data pack entry referring to item which does not exist
+        Log::push("WARNING: Unknown item name \"{}\"\n", itemName);
         return 0;
     }
 
@@ -223,4 +233,49 @@ const std::vector<ItemType>& ItemDataLoader::getCraftingStationLevelItems(const
     assert(craftingStationItemMap.at(craftingStationName).contains(craftingStationLevel));
 
     return (craftingStationItemMap.at(craftingStationName).at(craftingStationLevel));
+}
+
+void ItemDataLoader::saveCache(cereal::BinaryOutputArchive& archive)
+{
+    archive(loaded_itemData);
+
+    uint32_t craftingStationCount = craftingStationItemMap.size();
+    archive(craftingStationCount);
+
+    for (auto iter = craftingStationItemMap.begin(); iter != craftingStationItemMap.end(); iter++)
+    {
+        std::string craftingStationName = iter->first;
+        GameDataCache::serialiseString(archive, craftingStationName);
+        archive(iter->second);
+    }
+
+    archive(dataHash);
+}
+
+void ItemDataLoader::loadCache(cereal::BinaryInputArchive& archive)
+{
+    itemNameToTypeMap.clear();
+    craftingStationItemMap.clear();
+
+    archive(loaded_itemData);
+
+    uint32_t craftingStationCount = 0;
+    archive(craftingStationCount);
+
+    for (int i = 0; i < craftingStationCount; i++)
+    {
+        std::string craftingStationName;
+        GameDataCache::serialiseString(archive, craftingStationName);
+        archive(craftingStationItemMap[craftingStationName]);
+    }
+
+    archive(dataHash);
+
+    // Rebuild lookups
+    for (int i = 0; i < loaded_itemData.size(); i++)
+    {
+        itemNameToTypeMap[loaded_itemData[i].name] = i;
+    }
+
+    createCurrencyItemOrderVector();
 }
\ No newline at end of file
@@ -1,16 +1,22 @@
 #include "Data/ObjectDataLoader.hpp"
 #include "Player/ShopInventoryData.hpp"
 #include <extlib/hashpp.h>
+#include <extlib/cereal/types/string.hpp>
+#include <extlib/cereal/types/vector.hpp>
+
+#include "IO/Log.hpp"
 
 std::vector<ObjectData> ObjectDataLoader::loaded_objectData;
 std::unordered_map<std::string, ObjectType> ObjectDataLoader::objectNameToTypeMap;
 
 std::string ObjectDataLoader::dataHash;
 
-bool ObjectDataLoader::loadData(std::string objectDataPath)
+bool ObjectDataLoader::loadData(const std::string& objectDataJson)
 {
-    std::ifstream file(objectDataPath);
-    nlohmann::ordered_json data = nlohmann::ordered_json::parse(file);
+    nlohmann::ordered_json data = nlohmann::ordered_json::parse(objectDataJson);
+
+    loaded_objectData.clear();
+    objectNameToTypeMap.clear();
 
     int objectIdx = 0;
 
@@ -262,7 +268,7 @@ bool ObjectDataLoader::loadData(std::string objectDataPath)
         loaded_objectData.push_back(objectData);
     }
 
-    dataHash = hashpp::get::getFileHash(hashpp::ALGORITHMS::MD5, objectDataPath);
+    dataHash = hashpp::get::getHash(hashpp::ALGORITHMS::MD5, objectDataJson).getString();
 
     return true;
 }
@@ -313,8 +319,28 @@ ObjectType ObjectDataLoader::getObjectTypeFromName(const std::string& objectName
 {
     if (!objectNameToTypeMap.contains(objectName))
     {
+        // Unresolved reference, e.g. data pack entry referring to object which does not exist
+        Log::push("WARNING: Unknown object name \"{}\"\n", objectName);
         return 0;
     }
 
     return objectNameToTypeMap[objectName];
+}
+
+void ObjectDataLoader::saveCache(cereal::BinaryOutputArchive& archive)
+{
+    archive(loaded_objectData, dataHash);
+}
+
+void ObjectDataLoader::loadCache(cereal::BinaryInputArchive& archive)
+{
+    objectNameToTypeMap.clear();
+
+    archive(loaded_objectData, dataHash);
+
+    // Rebuild lookup
+    for (int i = 0; i < loaded_objectData.size(); i++)
+    {
+        objectNameToTypeMap[loaded_objectData[i].name] = i;
+    }
 }
\ No newline at end of file
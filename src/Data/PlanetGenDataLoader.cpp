@@ -1,5 +1,7 @@
 #include "Data/PlanetGenDataLoader.hpp"
 #include <extlib/hashpp.h>
+#include <extlib/cereal/types/string.hpp>
+#include <extlib/cereal/types/vector.hpp>
 
 std::vector<PlanetGenData> PlanetGenDataLoader::loaded_planetGenData;
 
@@ -10,14 +12,18 @@ std::unordered_map<std::string, int> PlanetGenDataLoader::tileMapNameToId;
 
 std::string PlanetGenDataLoader::dataHash;
 
-bool PlanetGenDataLoader::loadData(std::string planetGenDataPath)
+bool PlanetGenDataLoader::loadData(const std::string& planetGenDataJson)
 {
-    std::ifstream file(planetGenDataPath);
-    nlohmann::ordered_json data = nlohmann::ordered_json::parse(file);
+    nlohmann::ordered_json data = nlohmann::ordered_json::parse(planetGenDataJson);
 
     if (!data.contains("tilemaps"))
         return false;
 
+    loaded_planetGenData.clear();
+    planetStringToTypeMap.clear();
+    tileMapDatas.clear();
+    tileMapNameToId.clear();
+
     // Load tilemaps
     auto tileMaps = data.at("tilemaps");
     for (nlohmann::ordered_json::iterator tileMapIter = tileMaps.begin(); tileMapIter != tileMaps.end(); ++tileMapIter)
@@ -50,7 +56,7 @@ bool PlanetGenDataLoader::loadData(std::string planetGenDataPath)
             return false;
     }
 
-    dataHash = hashpp::get::getFileHash(hashpp::ALGORITHMS::MD5, planetGenDataPath);
+    dataHash = hashpp::get::getHash(hashpp::ALGORITHMS::MD5, planetGenDataJson).getString();
 
     return true;
 }
@@ -253,6 +259,8 @@ bool PlanetGenDataLoader::loadPlanet(nlohmann::ordered_json::iterator& planetDat
             biomeGenData.bossesSpawnAllowedNames = biomeIter->at("bosses-spawn-allowed");
         }
 
+        biomeGenData.compileSpawnTables();
+
         planetGenData.biomeGenDatas.push_back(biomeGenData);
     }
 
@@ -284,4 +292,37 @@ const TileMapData& PlanetGenDataLoader::getTileMapDataFromID(int tileID)
 const std::unordered_map<std::string, int>& PlanetGenDataLoader::getTileMapNameToIdMap()
 {
     return tileMapNameToId;
+}
+
+void PlanetGenDataLoader::saveCache(cereal::BinaryOutputArchive& archive)
+{
+    archive(tileMapDatas, loaded_planetGenData, dataHash);
+}
+
+void PlanetGenDataLoader::loadCache(cereal::BinaryInputArchive& archive)
+{
+    planetStringToTypeMap.clear();
+    tileMapNameToId.clear();
+
+    archive(tileMapDatas, loaded_planetGenData, dataHash);
+
+    // Rebuild lookups
+    for (const TileMapData& tileMapData : tileMapDatas)
+    {
+        tileMapNameToId[tileMapData.name] = tileMapData.tileID;
+
+        #if (!RELEASE_BUILD)
+        DebugOptions::tileMapsVisible[tileMapData.tileID] = true;
+        #endif
+    }
+
+    for (int i = 0; i < loaded_planetGenData.size(); i++)
+    {
+        planetStringToTypeMap[loaded_planetGenData[i].name] = i;
+
+        for (BiomeGenData& biomeGenData : loaded_planetGenData[i].biomeGenDatas)
+        {
+            biomeGenData.compileSpawnTables();
+        }
+    }
 }
\ No newline at end of file
@@ -1,14 +1,17 @@
 #include "Data/RecipeDataLoader.hpp"
 #include <extlib/hashpp.h>
+#include <extlib/cereal/types/string.hpp>
+#include <extlib/cereal/types/vector.hpp>
 
 std::unordered_map<uint64_t, RecipeData> RecipeDataLoader::loaded_recipeData;
 
 std::string RecipeDataLoader::dataHash;
 
-bool RecipeDataLoader::loadData(std::string recipeDataPath)
+bool RecipeDataLoader::loadData(const std::string& recipeDataJson)
 {
-    std::ifstream file(recipeDataPath);
-    nlohmann::ordered_json data = nlohmann::ordered_json::parse(file);
+    nlohmann::ordered_json data = nlohmann::ordered_json::parse(recipeDataJson);
+
+    loaded_recipeData.clear();
 
     // Load data
     for (nlohmann::ordered_json::iterator iter = data.begin(); iter != data.end(); ++iter)
@@ -50,7 +53,7 @@ bool RecipeDataLoader::loadData(std::string recipeDataPath)
         loaded_recipeData[recipeData.getHash()] = recipeData;
     }
     
-    dataHash = hashpp::get::getFileHash(hashpp::ALGORITHMS::MD5, recipeDataPath);
+    dataHash = hashpp::get::getHash(hashpp::ALGORITHMS::MD5, recipeDataJson).getString();
 
     return true;
 }
@@ -73,4 +76,29 @@ const std::unordered_map<uint64_t, RecipeData>& RecipeDataLoader::getRecipeDataM
 uint64_t RecipeDataLoader::getRecipeCount()
 {
     return loaded_recipeData.size();
+}
+
+void RecipeDataLoader::saveCache(cereal::BinaryOutputArchive& archive)
+{
+    // Recipe hashes depend on item names so are recalculated on load
+    std::vector<RecipeData> recipeDatas;
+    for (auto iter = loaded_recipeData.begin(); iter != loaded_recipeData.end(); iter++)
+    {
+        recipeDatas.push_back(iter->second);
+    }
+
+    archive(recipeDatas, dataHash);
+}
+
+void RecipeDataLoader::loadCache(cereal::BinaryInputArchive& archive)
+{
+    loaded_recipeData.clear();
+
+    std::vector<RecipeData> recipeDatas;
+    archive(recipeDatas, dataHash);
+
+    for (const RecipeData& recipeData : recipeDatas)
+    {
+        loaded_recipeData[recipeData.getHash()] = recipeData;
+    }
 }
\ No newline at end of file
@@ -1,5 +1,7 @@
 #include "Data/StructureDataLoader.hpp"
 #include <extlib/hashpp.h>
+#include <extlib/cereal/types/string.hpp>
+#include <extlib/cereal/types/vector.hpp>
 
 std::vector<StructureData> StructureDataLoader::loaded_structureData;
 std::vector<RoomData> StructureDataLoader::loaded_roomData;
@@ -9,10 +11,14 @@ std::unordered_map<std::string, RoomType> StructureDataLoader::roomTypeTravelLoc
 
 std::string StructureDataLoader::dataHash;
 
-bool StructureDataLoader::loadData(std::string structureDataPath)
+bool StructureDataLoader::loadData(const std::string& structureDataJson)
 {
-    std::ifstream file(structureDataPath);
-    nlohmann::ordered_json data = nlohmann::ordered_json::parse(file);
+    nlohmann::ordered_json data = nlohmann::ordered_json::parse(structureDataJson);
+
+    loaded_structureData.clear();
+    loaded_roomData.clear();
+    structureNameToTypeMap.clear();
+    roomTypeTravelLocationsMap.clear();
 
     // Load rooms
     std::unordered_map<std::string, RoomType> roomNameToTypeMap;
@@ -118,7 +124,7 @@ bool StructureDataLoader::loadData(std::string structureDataPath)
         structureIdx++;
     }
 
-    dataHash = hashpp::get::getFileHash(hashpp::ALGORITHMS::MD5, structureDataPath);
+    dataHash = hashpp::get::getHash(hashpp::ALGORITHMS::MD5, structureDataJson).getString();
     
     return true;
 }
@@ -163,4 +169,31 @@ ObjectType StructureDataLoader::getStructureTypeFromName(const std::string& stru
 RoomType StructureDataLoader::getRoomTypeTravelLocationFromName(const std::string& roomLocationName)
 {
     return roomTypeTravelLocationsMap[roomLocationName];
+}
+
+void StructureDataLoader::saveCache(cereal::BinaryOutputArchive& archive)
+{
+    archive(loaded_roomData, loaded_structureData, dataHash);
+}
+
+void StructureDataLoader::loadCache(cereal::BinaryInputArchive& archive)
+{
+    structureNameToTypeMap.clear();
+    roomTypeTravelLocationsMap.clear();
+
+    archive(loaded_roomData, loaded_structureData, dataHash);
+
+    // Rebuild lookups
+    for (int i = 0; i < loaded_roomData.size(); i++)
+    {
+        if (loaded_roomData[i].isTravelLocation)
+        {
+            roomTypeTravelLocationsMap[loaded_roomData[i].name] = i;
+        }
+    }
+
+    for (int i = 0; i < loaded_structureData.size(); i++)
+    {
+        structureNameToTypeMap[loaded_structureData[i].name] = i;
+    }
 }
\ No newline at end of file
@@ -1,5 +1,7 @@
 #include "Data/ToolDataLoader.hpp"
 #include <extlib/hashpp.h>
+#include <extlib/cereal/types/string.hpp>
+#include <extlib/cereal/types/vector.hpp>
 
 std::vector<ToolData> ToolDataLoader::loaded_toolData;
 std::unordered_map<std::string, ToolType> ToolDataLoader::toolNameToTypeMap;
@@ -8,10 +10,14 @@ std::unordered_map<std::string, ProjectileType> ToolDataLoader::projectileNameTo
 
 std::string ToolDataLoader::dataHash;
 
-bool ToolDataLoader::loadData(std::string toolDataPath)
+bool ToolDataLoader::loadData(const std::string& toolDataJson)
 {
-    std::ifstream file(toolDataPath);
-    nlohmann::json data = nlohmann::json::parse(file);
+    nlohmann::json data = nlohmann::json::parse(toolDataJson);
+
+    loaded_toolData.clear();
+    toolNameToTypeMap.clear();
+    loaded_projectileData.clear();
+    projectileNameToTypeMap.clear();
 
     // Load projectiles
     auto projectiles = data.at("projectiles");
@@ -144,7 +150,7 @@ bool ToolDataLoader::loadData(std::string toolDataPath)
         toolIdx++;
     }
 
-    dataHash = hashpp::get::getFileHash(hashpp::ALGORITHMS::MD5, toolDataPath);
+    dataHash = hashpp::get::getHash(hashpp::ALGORITHMS::MD5, toolDataJson).getString();
 
     return true;
 }
@@ -188,4 +194,28 @@ ToolBehaviourType ToolDataLoader::getToolBehaviourTypeFromStr(const std::string&
 
     // Default case - tool behaviour type string not found
     return ToolBehaviourType::Pickaxe;
+}
+
+void ToolDataLoader::saveCache(cereal::BinaryOutputArchive& archive)
+{
+    archive(loaded_projectileData, loaded_toolData, dataHash);
+}
+
+void ToolDataLoader::loadCache(cereal::BinaryInputArchive& archive)
+{
+    toolNameToTypeMap.clear();
+    projectileNameToTypeMap.clear();
+
+    archive(loaded_projectileData, loaded_toolData, dataHash);
+
+    // Rebuild lookups
+    for (int i = 0; i < loaded_projectileData.size(); i++)
+    {
+        projectileNameToTypeMap[loaded_projectileData[i].name] = i;
+    }
+
+    for (int i = 0; i < loaded_toolData.size(); i++)
+    {
+        toolNameToTypeMap[loaded_toolData[i].name] = i;
+    }
 }
\ No newline at end of file
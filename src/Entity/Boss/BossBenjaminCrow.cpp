@@ -472,6 +472,11 @@ void BossBenjaminCrow::testProjectileCollision(Projectile& projectile, int world
     }
 }
 
+std::optional<CollisionRect> BossBenjaminCrow::getProjectileHitBounds() const
+{
+    return CollisionRect(collision.x - collision.radius, collision.y - collision.radius, collision.radius * 2, collision.radius * 2);
+}
+
 void BossBenjaminCrow::getWorldObjects(std::vector<WorldObject*>& worldObjects)
 {
     worldObjects.push_back(this);
@@ -24,21 +24,23 @@ void BossEntity::createItemPickups(NetworkHandler& networkHandler, ChunkManager&
         return;
     }
 
+    RandomStream& randomStream = chunkManager.getRandomStream(RandomStreamType::ItemDrop);
+
     for (const auto& itemDropChance : itemDrops)
     {
-        float randChance = (rand() % 10000) / 10000.0f;
+        float randChance = randomStream.randInt(0, 9999) / 10000.0f;
         if (randChance > itemDropChance.second)
         {
             continue;
         }
 
-        int itemAmount = Helper::randInt(itemDropChance.first.minAmount, itemDropChance.first.maxAmount);
+        int itemAmount = randomStream.randInt(itemDropChance.first.minAmount, itemDropChance.first.maxAmount);
 
         for (int i = 0; i < itemAmount; i++)
         {
             pl::Vector2f spawnPos = position - pl::Vector2f(0.5f, 0.5f) * TILE_SIZE_PIXELS_UNSCALED;
-            spawnPos.x += Helper::randFloat(-itemPickupDropRadius, itemPickupDropRadius);
-            spawnPos.y += Helper::randFloat(-itemPickupDropRadius, itemPickupDropRadius);
+            spawnPos.x += randomStream.randFloat(-itemPickupDropRadius, itemPickupDropRadius);
+            spawnPos.y += randomStream.randFloat(-itemPickupDropRadius, itemPickupDropRadius);
 
             chunkManager.addItemPickup(ItemPickup(spawnPos, itemDropChance.first.itemType, gameTime, 1), &networkHandler);
         }
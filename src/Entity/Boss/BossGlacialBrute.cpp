@@ -79,7 +79,7 @@ void BossGlacialBrute::update(Game& game, ChunkManager& chunkManager, Projectile
                         <= SNOWBALL_THROW_DISTANCE_THRESHOLD && throwSnowballCooldown <= 0.0f)
                     {
                         throwSnowballCooldown = MAX_SNOWBALL_THROW_COOLDOWN;
-                        throwSnowballTimer = Helper::randFloat(MIN_SNOWBALL_CHARGE_TIME, MAX_SNOWBALL_CHARGE_TIME);
+                        throwSnowballTimer = chunkManager.getRandomStream(RandomStreamType::Boss).randFloat(MIN_SNOWBALL_CHARGE_TIME, MAX_SNOWBALL_CHARGE_TIME);
                         behaviourState = BossGlacialBruteState::ThrowSnowball;
                         break;
                     }
@@ -91,7 +91,7 @@ void BossGlacialBrute::update(Game& game, ChunkManager& chunkManager, Projectile
                     if (throwSnowballCooldown <= 0.0f)
                     {
                         throwSnowballCooldown = MAX_SHOOT_SNOWBALL_COOLDOWN;
-                        shootSnowball(projectileManager, *closestPlayer, worldSize);
+                        shootSnowball(projectileManager, chunkManager, *closestPlayer, worldSize);
                     }
                 }
 
@@ -160,7 +160,7 @@ void BossGlacialBrute::update(Game& game, ChunkManager& chunkManager, Projectile
     
                 if (throwSnowballTimer <= 0)
                 {
-                    throwSnowball(projectileManager, *closestPlayer, worldSize);
+                    throwSnowball(projectileManager, chunkManager, *closestPlayer, worldSize);
                     behaviourState = BossGlacialBruteState::WalkingToPlayer;
                 }
                 break;
@@ -186,17 +186,18 @@ void BossGlacialBrute::updateNetwork(Player& player, float dt, int worldSize)
     updateCollision();
 }
 
-void BossGlacialBrute::throwSnowball(ProjectileManager& projectileManager, Player& player, int worldSize)
+void BossGlacialBrute::throwSnowball(ProjectileManager& projectileManager, ChunkManager& chunkManager, Player& player, int worldSize)
 {
     pl::Vector2f playerRelativePos = Camera::translateWorldPos(player.getPosition(), position, worldSize);
 
     float angle = std::atan2(playerRelativePos.y - 4 - (position.y - 50), playerRelativePos.x - position.x) * 180.0f / M_PI;
     
     projectileManager.addProjectile(Projectile(position - pl::Vector2f(0, 50), angle,
-        ToolDataLoader::getProjectileTypeFromName("Large Snowball"), 1.0f, 1.0f, HitLayer::Player));
+        ToolDataLoader::getProjectileTypeFromName("Large Snowball"), 1.0f, 1.0f, HitLayer::Player,
+        chunkManager.getRandomStream(RandomStreamType::Projectile)));
 }
 
-void BossGlacialBrute::shootSnowball(ProjectileManager& projectileManager, Player& player, int worldSize)
+void BossGlacialBrute::shootSnowball(ProjectileManager& projectileManager, ChunkManager& chunkManager, Player& player, int worldSize)
 {
     int xScale = (direction.x < 0) ? -1 : 1;
     pl::Vector2f cannonEndPos = position + pl::Vector2f(29 * xScale, -24);
@@ -206,7 +207,7 @@ void BossGlacialBrute::shootSnowball(ProjectileManager& projectileManager, Playe
     float angle = std::atan2(playerRelativePos.y - 4 - (cannonEndPos.y - 50), playerRelativePos.x - cannonEndPos.x) * 180.0f / M_PI;
 
     static constexpr float SHOOT_ANGLE_VARIATION = 10.0f;
-    angle += Helper::randFloat(-SHOOT_ANGLE_VARIATION, SHOOT_ANGLE_VARIATION);
+    angle += chunkManager.getRandomStream(RandomStreamType::Boss).randFloat(-SHOOT_ANGLE_VARIATION, SHOOT_ANGLE_VARIATION);
 
     float SPREAD_ANGLE_DELTA = 20.0f;
 
@@ -220,7 +221,8 @@ void BossGlacialBrute::shootSnowball(ProjectileManager& projectileManager, Playe
     for (int i = -projectileMax; i <= projectileMax; i++)
     {
         projectileManager.addProjectile(Projectile(cannonEndPos, angle + SPREAD_ANGLE_DELTA * i,
-            ToolDataLoader::getProjectileTypeFromName("Snowball"), 1.0f, 1.0f, HitLayer::Player));
+            ToolDataLoader::getProjectileTypeFromName("Snowball"), 1.0f, 1.0f, HitLayer::Player,
+            chunkManager.getRandomStream(RandomStreamType::Projectile)));
     }
 }
 
@@ -323,6 +325,11 @@ void BossGlacialBrute::testProjectileCollision(Projectile& projectile, int world
     }
 }
 
+std::optional<CollisionRect> BossGlacialBrute::getProjectileHitBounds() const
+{
+    return hitCollision;
+}
+
 void BossGlacialBrute::testHitRectCollision(const std::vector<HitRect>& hitRects, int worldSize)
 {
     for (const HitRect& hitRect : hitRects)
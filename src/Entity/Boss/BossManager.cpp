@@ -1,5 +1,6 @@
 #include "Entity/Boss/BossManager.hpp"
 #include "World/ChunkManager.hpp"
+#include "Entity/HitboxHistory.hpp"
 #include "Game.hpp"
 
 BossManager::BossManager(const BossManager& bossManager)
@@ -57,14 +58,24 @@ void BossManager::update(Game& game, ProjectileManager& projectileManager, Chunk
         BossEntity* boss = iter->get();
         if (boss->isAlive() && boss->inPlayerRange(players, chunkManager.getWorldSize()))
         {
-            for (auto& projectile : projectileManager.getProjectiles())
+            auto testProjectileCollision = [boss, &chunkManager](Projectile& projectile)
             {
                 if (!projectile.isAlive())
                 {
-                    continue;
+                    return;
                 }
 
                 boss->testProjectileCollision(projectile, chunkManager.getWorldSize());
+            };
+
+            std::optional<CollisionRect> projectileHitBounds = boss->getProjectileHitBounds();
+            if (projectileHitBounds.has_value())
+            {
+                projectileManager.forEachProjectileNear(projectileHitBounds.value(), chunkManager.getWorldSize(), testProjectileCollision);
+            }
+            else
+            {
+                projectileManager.forEachProjectile(testProjectileCollision);
             }
             
             if (game.getNetworkHandler().isClient() && players.size() > 0)
@@ -101,10 +112,16 @@ void BossManager::update(Game& game, ProjectileManager& projectileManager, Chunk
     }
 }
 
-void BossManager::testHitRectCollision(const std::vector<HitRect>& hitRects, int worldSize)
+void BossManager::testHitRectCollision(const std::vector<HitRect>& hitRects, int worldSize, const HitboxSnapshot* rewindSnapshot)
 {
     for (auto& boss : bosses)
     {
+        if (rewindSnapshot)
+        {
+            boss->testHitRectCollision(HitboxHistory::rewindHitRects(hitRects, rewindSnapshot, boss->getHitboxObjectID(), boss->getPosition(), worldSize), worldSize);
+            continue;
+        }
+
         boss->testHitRectCollision(hitRects, worldSize);
     }
 }
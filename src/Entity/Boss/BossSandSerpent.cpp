@@ -162,10 +162,11 @@ void BossSandSerpent::update(Game& game, ChunkManager& chunkManager, ProjectileM
 
                 // Angle randomisation
                 static constexpr float SHOOT_ANGLE_DEVIATION = 15.0f;
-                angle += Helper::randFloat(-SHOOT_ANGLE_DEVIATION, SHOOT_ANGLE_DEVIATION);
+                angle += chunkManager.getRandomStream(RandomStreamType::Boss).randFloat(-SHOOT_ANGLE_DEVIATION, SHOOT_ANGLE_DEVIATION);
 
                 projectileManager.addProjectile(Projectile(position - pl::Vector2f(0, 50), angle,
-                    ToolDataLoader::getProjectileTypeFromName("Serpent Venom BOSS"), 1.0f, 1.0f, HitLayer::Player));
+                    ToolDataLoader::getProjectileTypeFromName("Serpent Venom BOSS"), 1.0f, 1.0f, HitLayer::Player,
+                    chunkManager.getRandomStream(RandomStreamType::Projectile)));
             }
             break;
         }
@@ -246,10 +247,11 @@ void BossSandSerpent::update(Game& game, ChunkManager& chunkManager, ProjectileM
 
                 // Angle randomisation
                 static constexpr float SHOOT_ANGLE_DEVIATION = 35.0f;
-                angle += Helper::randFloat(-SHOOT_ANGLE_DEVIATION, SHOOT_ANGLE_DEVIATION);
+                angle += chunkManager.getRandomStream(RandomStreamType::Boss).randFloat(-SHOOT_ANGLE_DEVIATION, SHOOT_ANGLE_DEVIATION);
 
                 projectileManager.addProjectile(Projectile(position - pl::Vector2f(0, 50), angle,
-                    ToolDataLoader::getProjectileTypeFromName("Serpent Venom BOSS"), 1.0f, 1.0f, HitLayer::Player));
+                    ToolDataLoader::getProjectileTypeFromName("Serpent Venom BOSS"), 1.0f, 1.0f, HitLayer::Player,
+                    chunkManager.getRandomStream(RandomStreamType::Projectile)));
             }
             break;
         }
@@ -561,6 +563,17 @@ void BossSandSerpent::testProjectileCollision(Projectile& projectile, int worldS
     }
 }
 
+std::optional<CollisionRect> BossSandSerpent::getProjectileHitBounds() const
+{
+    // Bounds of both head and body collision
+    float left = std::min(headCollision.x - headCollision.radius, bodyCollision.x);
+    float top = std::min(headCollision.y - headCollision.radius, bodyCollision.y);
+    float right = std::max(headCollision.x + headCollision.radius, bodyCollision.x + bodyCollision.width);
+    float bottom = std::max(headCollision.y + headCollision.radius, bodyCollision.y + bodyCollision.height);
+
+    return CollisionRect(left, top, right - left, bottom - top);
+}
+
 void BossSandSerpent::testHitRectCollision(const std::vector<HitRect>& hitRects, int worldSize)
 {
     if (headHealth > 0)
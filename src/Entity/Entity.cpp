@@ -7,10 +7,11 @@
 #include "Entity/EntityBehaviour/EntityFollowAttackBehaviour.hpp"
 #include "Entity/EntityBehaviour/EntityRabbitBehaviour.hpp"
 
-Entity::Entity(pl::Vector2f position, EntityType entityType)
+Entity::Entity(pl::Vector2f position, EntityType entityType, const RandomStream& randomStream)
     : WorldObject(position)
 {
     this->entityType = entityType;
+    this->randomStream = randomStream;
 
     const EntityData& entityData = EntityDataLoader::getEntityData(entityType);
 
@@ -30,8 +31,8 @@ Entity::Entity(pl::Vector2f position, EntityType entityType)
 
     animationSpeed = 1.0f;
     
-    idleAnim.setFrame(rand() % entityData.idleTextureRects.size());
-    walkAnim.setFrame(rand() % entityData.walkTextureRects.size());
+    idleAnim.setFrame(Helper::randInt(0, entityData.idleTextureRects.size() - 1));
+    walkAnim.setFrame(Helper::randInt(0, entityData.walkTextureRects.size() - 1));
 }
 
 void Entity::initialiseBehaviour(const std::string& behaviour)
@@ -50,12 +51,21 @@ void Entity::initialiseBehaviour(const std::string& behaviour)
     }
 }
 
-void Entity::update(float dt, ProjectileManager& projectileManager, ChunkManager& chunkManager, Game& game, bool onWater, float gameTime, bool networkUpdateOnly)
+void Entity::update(float dt, ProjectileManager& projectileManager, ChunkManager& chunkManager, Game& game, bool onWater, float gameTime, bool networkUpdateOnly,
+    bool updateBehaviour)
 {
     // Host / solo update (controls behaviour)
     if (behaviour && !networkUpdateOnly)
     {
-        behaviour->update(*this, chunkManager, game, dt);
+        updateSchedule.behaviourTime += dt;
+
+        if (updateBehaviour)
+        {
+            while (std::optional<float> behaviourStep = EntityUpdateScheduler::takeBehaviourStep(updateSchedule))
+            {
+                behaviour->update(*this, chunkManager, game, behaviourStep.value());
+            }
+        }
     }
 
     // Update as client (apply velocity)
@@ -86,7 +96,7 @@ void Entity::update(float dt, ProjectileManager& projectileManager, ChunkManager
     hitCollision.y += position.y;
 
     // Test collision with projectiles
-    for (auto& projectile : projectileManager.getProjectiles())
+    projectileManager.forEachProjectileNear(hitCollision, chunkManager.getWorldSize(), [&](Projectile& projectile)
     {
         if (isProjectileColliding(projectile) && projectile.isAlive())
         {
@@ -99,7 +109,7 @@ void Entity::update(float dt, ProjectileManager& projectileManager, ChunkManager
                 behaviour->onHit(*this, game, LocationState::createFromPlanetType(chunkManager.getPlanetType()), projectile.getPosition());
             }
         }
-    }
+    });
 
     // Update animations
     flashAmount = std::max(flashAmount - dt * 3.0f, 0.0f);
@@ -224,14 +234,19 @@ void Entity::damage(int amount, Game& game, const LocationState& locationState,
 
     const EntityData& entityData = EntityDataLoader::getEntityData(entityType);
 
-    HitMarkers::addHitMarker(position, amount);
+    // Only give feedback for entities at this player's location
+    // Entities on other planets may be damaged while updating on worker thread
+    if (locationState == game.getLocationState())
+    {
+        HitMarkers::addHitMarker(position, amount);
 
-    SoundType hitSound = SoundType::HitAnimal;
-    int soundChance = rand() % 3;
-    if (soundChance == 1) hitSound = SoundType::HitAnimal2;
-    else if (soundChance == 2) hitSound = SoundType::HitAnimal3;
+        SoundType hitSound = SoundType::HitAnimal;
+        int soundChance = Helper::randInt(0, 2);
+        if (soundChance == 1) hitSound = SoundType::HitAnimal2;
+        else if (soundChance == 2) hitSound = SoundType::HitAnimal3;
 
-    Sounds::playSound(hitSound, 30.0f);
+        Sounds::playSoundAt(hitSound, position, 30.0f);
+    }
 
     if (!isAlive() && game.getNetworkHandler().isLobbyHostOrSolo())
     {
@@ -244,15 +259,17 @@ void Entity::damage(int amount, Game& game, const LocationState& locationState,
 
         ChunkManager& chunkManager = game.getChunkManager(locationState.getPlanetType());
 
+        RandomStream& randomStream = chunkManager.getRandomStream(RandomStreamType::ItemDrop);
+
         // Give item drops
         const EntityData& entityData = EntityDataLoader::getEntityData(entityType);
         for (const ItemDrop& itemDrop : entityData.itemDrops)
         {
-            float dropChance = Helper::randFloat(0.0f, 1.0f);
+            float dropChance = randomStream.randFloat(0.0f, 1.0f);
             if (dropChance < itemDrop.chance)
             {
                 // Give items
-                unsigned int itemAmount = rand() % std::max(itemDrop.maxAmount - itemDrop.minAmount + 1, 1U) + itemDrop.minAmount;
+                unsigned int itemAmount = randomStream.randInt(itemDrop.minAmount, std::max(itemDrop.maxAmount, itemDrop.minAmount));
 
                 if (itemAmount <= 0)
                 {
@@ -260,8 +277,8 @@ void Entity::damage(int amount, Game& game, const LocationState& locationState,
                 }
 
                 pl::Vector2f spawnPos = position - pl::Vector2f(0.5f, 0.5f) * TILE_SIZE_PIXELS_UNSCALED;
-                spawnPos.x += Helper::randFloat(0.0f, entityData.size.x * TILE_SIZE_PIXELS_UNSCALED);
-                spawnPos.y += Helper::randFloat(0.0f, entityData.size.y * TILE_SIZE_PIXELS_UNSCALED);
+                spawnPos.x += randomStream.randFloat(0.0f, entityData.size.x * TILE_SIZE_PIXELS_UNSCALED);
+                spawnPos.y += randomStream.randFloat(0.0f, entityData.size.y * TILE_SIZE_PIXELS_UNSCALED);
 
                 chunkManager.addItemPickup(ItemPickup(spawnPos, itemDrop.item, gameTime, itemAmount), &game.getNetworkHandler());
 
@@ -349,6 +366,7 @@ EntityPOD Entity::getPOD(pl::Vector2f chunkPosition)
     pod.entityType = entityType;
     pod.chunkRelativePosition = position - chunkPosition;
     pod.velocity = velocity;
+    pod.randomStream = randomStream;
     return pod;
 }
 
@@ -360,6 +378,11 @@ void Entity::loadFromPOD(const EntityPOD& pod, pl::Vector2f chunkPosition)
     collisionRect.y = position.y - collisionRect.height / 2.0f;
     velocity = pod.velocity;
 
+    if (pod.randomStream.has_value())
+    {
+        randomStream = pod.randomStream.value();
+    }
+
     const EntityData& entityData = EntityDataLoader::getEntityData(entityType);
     health = entityData.health;
 }
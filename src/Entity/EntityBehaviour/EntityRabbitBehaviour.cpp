@@ -4,7 +4,7 @@
 
 EntityRabbitBehaviour::EntityRabbitBehaviour(Entity& entity)
 {
-    float velocityAngle = rand() % 360;
+    float velocityAngle = entity.getRandomStream().randInt(0, 359);
     pl::Vector2f velocity;
     velocity.x = std::cos(velocityAngle * 2 * 3.14 / 180) * 23.0f;
     velocity.y = std::sin(velocityAngle * 2 * 3.14 / 180) * 23.0f;
@@ -30,7 +30,7 @@ EntityRabbitBehaviour::EntityRabbitBehaviour(Entity& entity)
         maxIdleWaitTime = entityData.behaviourParameters.at("max-idle-wait-time");
     }
 
-    idleWaitTime = Helper::randFloat(0.05f, maxIdleWaitTime);
+    idleWaitTime = entity.getRandomStream().randFloat(0.05f, maxIdleWaitTime);
 }
 
 void EntityRabbitBehaviour::update(Entity& entity, ChunkManager& chunkManager, Game& game, float dt)
@@ -49,7 +49,7 @@ void EntityRabbitBehaviour::update(Entity& entity, ChunkManager& chunkManager, G
         // Wait time over - walk to new location
         if (idleWaitTimeWasAboveZero)
         {
-            targetPosition = entity.getPosition() + pl::Vector2f(Helper::randFloat(MIN_TARGET_RANGE, MAX_TARGET_RANGE), 0).rotate(Helper::randFloat(0, 2 * M_PI));
+            targetPosition = entity.getPosition() + pl::Vector2f(entity.getRandomStream().randFloat(MIN_TARGET_RANGE, MAX_TARGET_RANGE), 0).rotate(entity.getRandomStream().randFloat(0, 2 * M_PI));
             entity.setVelocity((Camera::translateWorldPos(targetPosition, entity.getPosition(), chunkManager.getWorldSize()) - entity.getPosition()).normalise() * walkSpeed);
             entity.setIdleAnimationFrame(0);
             entity.setWalkAnimationFrame(0);
@@ -84,7 +84,7 @@ void EntityRabbitBehaviour::update(Entity& entity, ChunkManager& chunkManager, G
     if (stopWalking)
     {
         velocity = pl::Vector2f(0, 0);
-        idleWaitTime = Helper::randFloat(minIdleWaitTime, maxIdleWaitTime);
+        idleWaitTime = entity.getRandomStream().randFloat(minIdleWaitTime, maxIdleWaitTime);
     }
     
     velocityMult = Helper::lerp(velocityMult, 1.0f, VELOCITY_MULT_LERP_WEIGHT * dt);
@@ -99,7 +99,7 @@ void EntityRabbitBehaviour::onHit(Entity& entity, Game& game, const LocationStat
     // Start walking to new location
     idleWaitTime = 0.0f;
 
-    targetPosition = entity.getPosition() + pl::Vector2f(Helper::randFloat(MIN_TARGET_RANGE, MAX_TARGET_RANGE), 0).rotate(Helper::randFloat(0, 2 * M_PI));
+    targetPosition = entity.getPosition() + pl::Vector2f(entity.getRandomStream().randFloat(MIN_TARGET_RANGE, MAX_TARGET_RANGE), 0).rotate(entity.getRandomStream().randFloat(0, 2 * M_PI));
     entity.setVelocity((Camera::translateWorldPos(targetPosition, entity.getPosition(),
         game.getChunkManager(locationState.getPlanetType()).getWorldSize()) - entity.getPosition()).normalise() * walkSpeed);
     entity.setIdleAnimationFrame(0);
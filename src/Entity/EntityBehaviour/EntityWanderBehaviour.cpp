@@ -4,7 +4,7 @@
 
 EntityWanderBehaviour::EntityWanderBehaviour(Entity& entity)
 {
-    float velocityAngle = rand() % 360;
+    float velocityAngle = entity.getRandomStream().randInt(0, 359);
     pl::Vector2f velocity;
     velocity.x = std::cos(velocityAngle * 2 * 3.14 / 180) * 23.0f;
     velocity.y = std::sin(velocityAngle * 2 * 3.14 / 180) * 23.0f;
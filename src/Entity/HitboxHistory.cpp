@@ -0,0 +1,122 @@
+#include "Entity/HitboxHistory.hpp"
+#include "Entity/Boss/BossManager.hpp"
+#include "Entity/Entity.hpp"
+#include "World/ChunkManager.hpp"
+#include "Core/Camera.hpp"
+
+#include <algorithm>
+#include <atomic>
+
+pl::Vector2f HitboxSnapshot::getRewindOffset(HitboxObjectID objectID, pl::Vector2f position, int worldSize) const
+{
+    auto iter = objectPositions.find(objectID);
+    if (iter == objectPositions.end())
+    {
+        return pl::Vector2f(0, 0);
+    }
+
+    // Snapshot position may be on other side of world wrap
+    pl::Vector2f rewoundPosition = Camera::translateWorldPos(iter->second, position, worldSize);
+
+    return position - rewoundPosition;
+}
+
+void HitboxHistory::recordSnapshot(uint32_t networkTick, ChunkManager& chunkManager, BossManager& bossManager)
+{
+    HitboxSnapshot& snapshot = beginSnapshot(networkTick);
+
+    // Loaded chunk entities are all entities
+    for (WorldObject* entity : chunkManager.getLoadedChunkEntities())
+    {
+        snapshot.objectPositions[static_cast<Entity*>(entity)->getHitboxObjectID()] = entity->getPosition();
+    }
+
+    for (const auto& boss : bossManager.getBosses())
+    {
+        snapshot.objectPositions[boss->getHitboxObjectID()] = boss->getPosition();
+    }
+}
+
+HitboxSnapshot& HitboxHistory::beginSnapshot(uint32_t networkTick)
+{
+    HitboxSnapshot& snapshot = snapshots[nextSnapshotIndex];
+    snapshot.networkTick = networkTick;
+    snapshot.objectPositions.clear();
+
+    nextSnapshotIndex = (nextSnapshotIndex + 1) % MAX_SNAPSHOTS;
+    snapshotCount = std::min(snapshotCount + 1, MAX_SNAPSHOTS);
+
+    return snapshot;
+}
+
+const HitboxSnapshot* HitboxHistory::getRewindSnapshot(uint32_t viewNetworkTick, uint32_t currentNetworkTick) const
+{
+    // Client cannot be viewing ahead of host
+    uint32_t rewindTick = std::min(viewNetworkTick, currentNetworkTick);
+
+    if (currentNetworkTick - rewindTick > MAX_REWIND_TICKS)
+    {
+        rewindTick = currentNetworkTick - MAX_REWIND_TICKS;
+    }
+
+    const HitboxSnapshot* rewindSnapshot = nullptr;
+
+    for (int i = 0; i < snapshotCount; i++)
+    {
+        const HitboxSnapshot& snapshot = snapshots[i];
+
+        if (snapshot.networkTick > rewindTick)
+        {
+            continue;
+        }
+
+        if (!rewindSnapshot || snapshot.networkTick > rewindSnapshot->networkTick)
+        {
+            rewindSnapshot = &snapshot;
+        }
+    }
+
+    return rewindSnapshot;
+}
+
+void HitboxHistory::clear()
+{
+    for (HitboxSnapshot& snapshot : snapshots)
+    {
+        snapshot = HitboxSnapshot();
+    }
+
+    nextSnapshotIndex = 0;
+    snapshotCount = 0;
+}
+
+std::vector<HitRect> HitboxHistory::rewindHitRects(const std::vector<HitRect>& hitRects, const HitboxSnapshot* snapshot,
+    HitboxObjectID objectID, pl::Vector2f position, int worldSize)
+{
+    if (!snapshot)
+    {
+        return hitRects;
+    }
+
+    pl::Vector2f offset = snapshot->getRewindOffset(objectID, position, worldSize);
+
+    if (offset.getLength() > MAX_REWIND_DISTANCE)
+    {
+        return hitRects;
+    }
+
+    std::vector<HitRect> rewoundHitRects = hitRects;
+    for (HitRect& hitRect : rewoundHitRects)
+    {
+        hitRect.x += offset.x;
+        hitRect.y += offset.y;
+    }
+
+    return rewoundHitRects;
+}
+
+HitboxObjectID HitboxHistory::createObjectID()
+{
+    static std::atomic<HitboxObjectID> nextObjectID = 0;
+    return nextObjectID++;
+}
@@ -7,7 +7,8 @@ Projectile::Projectile()
     timeAlive = 0.0f;
 }
 
-Projectile::Projectile(pl::Vector2f position, float angle, ProjectileType type, float damageMult, float shootPower, HitLayer hitLayer)
+Projectile::Projectile(pl::Vector2f position, float angle, ProjectileType type, float damageMult, float shootPower, HitLayer hitLayer,
+    RandomStream& randomStream)
 {
     const ProjectileData& projectileData = ToolDataLoader::getProjectileData(type);
     
@@ -18,15 +19,16 @@ Projectile::Projectile(pl::Vector2f position, float angle, ProjectileType type,
     velocity.x = std::cos(angleRadians) * speed;
     velocity.y = std::sin(angleRadians) * speed;
     
-    initialise(position, velocity, type, damageMult, hitLayer);
+    initialise(position, velocity, type, damageMult, hitLayer, randomStream);
 }
 
-Projectile::Projectile(pl::Vector2f position, pl::Vector2f velocity, ProjectileType type, float damageMult, HitLayer hitLayer)
+Projectile::Projectile(pl::Vector2f position, pl::Vector2f velocity, ProjectileType type, float damageMult, HitLayer hitLayer, RandomStream& randomStream)
 {
-    initialise(position, velocity, type, damageMult, hitLayer);
+    initialise(position, velocity, type, damageMult, hitLayer, randomStream);
 }
 
-void Projectile::initialise(pl::Vector2f position, pl::Vector2f velocity, ProjectileType type, float damageMult, HitLayer hitLayer)
+void Projectile::initialise(pl::Vector2f position, pl::Vector2f velocity, ProjectileType type, float damageMult, HitLayer hitLayer,
+    RandomStream& randomStream)
 {   
     this->position = position;
     this->velocity = velocity;
@@ -36,7 +38,7 @@ void Projectile::initialise(pl::Vector2f position, pl::Vector2f velocity, Projec
     const ProjectileData& projectileData = ToolDataLoader::getProjectileData(type);
     
     // Randomise damage
-    int damageBaseValue = Helper::randInt(projectileData.damageLow, projectileData.damageHigh);
+    int damageBaseValue = randomStream.randInt(projectileData.damageLow, projectileData.damageHigh);
     this->damage = std::round(damageBaseValue * damageMult);
 
     this->hitLayer = hitLayer;
@@ -45,20 +47,6 @@ void Projectile::initialise(pl::Vector2f position, pl::Vector2f velocity, Projec
     timeAlive = 0.0f;
 }
 
-void Projectile::update(float dt, int worldSize)
-{
-    position += velocity * dt;
-    position = Helper::wrapPosition(position, worldSize);
-
-    timeAlive += dt;
-
-    // TODO: Change later
-    if (timeAlive > 3.0f)
-    {
-        alive = false;
-    }
-}
-
 void Projectile::draw(pl::RenderTarget& window, pl::SpriteBatch& spriteBatch, const ChunkManager& chunkManager, const Camera& camera) const
 {
     const ProjectileData& projectileData = ToolDataLoader::getProjectileData(projectileType);
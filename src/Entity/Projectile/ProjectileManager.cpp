@@ -11,30 +11,36 @@ void ProjectileManager::initialise(Game* game, PlanetType planetType)
 
 void ProjectileManager::update(float dt, int worldSize)
 {
-    for (auto iter = projectiles.begin(); iter != projectiles.end();)
+    for (int i = 0; i < positions.size();)
     {
-        Projectile& projectile = *iter;
-        
-        if (projectile.isAlive())
+        if (!alive[i])
         {
-            projectile.update(dt, worldSize);
+            removeProjectile(i);
+            continue;
         }
-        else
+
+        positions[i] = Helper::wrapPosition(positions[i] + velocities[i] * dt, worldSize);
+
+        timesAlive[i] += dt;
+
+        // TODO: Change later
+        if (timesAlive[i] > Projectile::MAX_TIME_ALIVE)
         {
-            iter = projectiles.erase(iter);
-            continue;
+            alive[i] = false;
         }
 
-        iter++;
+        i++;
     }
+
+    rebuildGrid(worldSize);
 }
 
 void ProjectileManager::drawProjectiles(pl::RenderTarget& window, pl::SpriteBatch& spriteBatch, const ChunkManager& chunkManager,
     pl::Vector2f playerPos, const Camera& camera)
 {
-    for (const Projectile& projectile : projectiles)
+    for (int i = 0; i < positions.size(); i++)
     {
-        projectile.draw(window, spriteBatch, chunkManager, camera);
+        getProjectile(i).draw(window, spriteBatch, chunkManager, camera);
     }
 }
 
@@ -67,7 +73,7 @@ void ProjectileManager::addProjectile(const Projectile& projectile, ToolType wea
         return;
     }
 
-    projectiles.push_back(projectile);
+    pushProjectile(projectile);
 }
 
 // void ProjectileManager::createProjectileWithID(uint16_t id, const Projectile& projectile)
@@ -75,14 +81,110 @@ void ProjectileManager::addProjectile(const Projectile& projectile, ToolType wea
 //     projectiles[id] = projectile;
 // }
 
-std::vector<Projectile>& ProjectileManager::getProjectiles()
+Projectile ProjectileManager::getProjectile(int index) const
+{
+    Projectile projectile;
+    projectile.position = positions[index];
+    projectile.velocity = velocities[index];
+    projectile.timeAlive = timesAlive[index];
+    projectile.projectileType = types[index];
+    projectile.damage = damages[index];
+    projectile.hitLayer = hitLayers[index];
+    projectile.alive = alive[index];
+    return projectile;
+}
+
+std::vector<Projectile> ProjectileManager::getProjectiles() const
 {
+    std::vector<Projectile> projectiles;
+    projectiles.reserve(positions.size());
+
+    for (int i = 0; i < positions.size(); i++)
+    {
+        projectiles.push_back(getProjectile(i));
+    }
+
     return projectiles;
 }
 
+void ProjectileManager::overwriteProjectiles(const ProjectileManager& projectileManager)
+{
+    positions = projectileManager.positions;
+    velocities = projectileManager.velocities;
+    timesAlive = projectileManager.timesAlive;
+    types = projectileManager.types;
+    damages = projectileManager.damages;
+    hitLayers = projectileManager.hitLayers;
+    alive = projectileManager.alive;
+    gridDirty = true;
+}
+
 uint16_t ProjectileManager::getProjectileCount() const
 {
-    return projectiles.size();
+    return positions.size();
+}
+
+void ProjectileManager::pushProjectile(const Projectile& projectile)
+{
+    positions.push_back(projectile.position);
+    velocities.push_back(projectile.velocity);
+    timesAlive.push_back(projectile.timeAlive);
+    types.push_back(projectile.projectileType);
+    damages.push_back(projectile.damage);
+    hitLayers.push_back(projectile.hitLayer);
+    alive.push_back(projectile.alive);
+    gridDirty = true;
+}
+
+void ProjectileManager::removeProjectile(int index)
+{
+    int last = positions.size() - 1;
+
+    if (index != last)
+    {
+        positions[index] = positions[last];
+        velocities[index] = velocities[last];
+        timesAlive[index] = timesAlive[last];
+        types[index] = types[last];
+        damages[index] = damages[last];
+        hitLayers[index] = hitLayers[last];
+        alive[index] = alive[last];
+    }
+
+    positions.pop_back();
+    velocities.pop_back();
+    timesAlive.pop_back();
+    types.pop_back();
+    damages.pop_back();
+    hitLayers.pop_back();
+    alive.pop_back();
+
+    gridDirty = true;
+}
+
+void ProjectileManager::rebuildGrid(int worldSize)
+{
+    gridCellProjectiles.clear();
+    gridQueryMargin = 0.0f;
+    gridWorldSize = worldSize;
+    gridDirty = false;
+
+    if (worldSize <= 0)
+    {
+        return;
+    }
+
+    for (int i = 0; i < positions.size(); i++)
+    {
+        int cellX = Helper::wrap(std::floor(positions[i].x / GRID_CELL_SIZE), worldSize);
+        int cellY = Helper::wrap(std::floor(positions[i].y / GRID_CELL_SIZE), worldSize);
+        gridCellProjectiles.push_back({static_cast<uint32_t>(cellY * worldSize + cellX), i});
+
+        const ProjectileData& projectileData = ToolDataLoader::getProjectileData(types[i]);
+        gridQueryMargin = std::max(gridQueryMargin, projectileData.collisionOffset.getLength() + projectileData.collisionRadius);
+    }
+
+    std::sort(gridCellProjectiles.begin(), gridCellProjectiles.end());
 }
 
 // void ProjectileManager::handleWorldWrap(pl::Vector2f positionDelta)
@@ -95,5 +197,13 @@ uint16_t ProjectileManager::getProjectileCount() const
 
 void ProjectileManager::clear()
 {
-    projectiles.clear();
+    positions.clear();
+    velocities.clear();
+    timesAlive.clear();
+    types.clear();
+    damages.clear();
+    hitLayers.clear();
+    alive.clear();
+    gridCellProjectiles.clear();
+    gridDirty = true;
 }
\ No newline at end of file
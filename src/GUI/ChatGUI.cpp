@@ -1,5 +1,6 @@
 #include "GUI/ChatGUI.hpp"
 #include "Network/NetworkHandler.hpp"
+#include "Network/CommandConsole.hpp"
 #include "IO/Log.hpp"
 
 #include "Core/Shaders.hpp"
@@ -140,6 +141,15 @@ void ChatGUI::attemptSendMessage(NetworkHandler& networkHandler)
     packetData.userId = SteamUser()->GetSteamID().ConvertToUint64();
     packetData.message = messageBuffer;
 
+    // Commands are shown to this player only, and executed by host
+    if (CommandConsole::isCommand(messageBuffer))
+    {
+        addChatMessage(networkHandler, packetData, false);
+        networkHandler.sendChatCommand(packetData);
+        messageBuffer.clear();
+        return;
+    }
+
     sendMessageData(networkHandler, packetData);
 
     messageBuffer.clear();
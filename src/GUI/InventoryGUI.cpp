@@ -282,7 +282,7 @@ void InventoryGUI::handleLeftClick(Game& game, pl::Vector2f mouseScreenPos, bool
         int shopHoveredIndex = getHoveredItemSlotIndex(chestItemSlots, mouseScreenPos);
         if (openShopData.has_value() && shopHoveredIndex >= 0)
         {
-            std::optional<ItemCount>& itemSlotData = openShopData->getItemSlotData(shopHoveredIndex);
+            const std::optional<ItemCount>& itemSlotData = openShopData->getItemSlotData(shopHoveredIndex);
 
             if (itemSlotData.has_value())
             {
@@ -446,7 +446,7 @@ bool InventoryGUI::pickUpItem(Game& game, pl::Vector2f mouseScreenPos, unsigned
         }
     }
     
-    std::optional<ItemCount>& itemSlotData = hoveredInventory->getItemSlotData(itemIndex);
+    const std::optional<ItemCount>& itemSlotData = hoveredInventory->getItemSlotData(itemIndex);
 
     // If no item, do not pick up
     if (!itemSlotData.has_value())
@@ -492,7 +492,7 @@ bool InventoryGUI::pickUpItem(Game& game, pl::Vector2f mouseScreenPos, unsigned
 
     // Play sound
     SoundType clickSound = SoundType::InventoryClick1;
-    int soundChance = rand() % 3;
+    int soundChance = Helper::randInt(0, 2);
     if (soundChance == 1) clickSound = SoundType::InventoryClick2;
     else if (soundChance == 2) clickSound = SoundType::InventoryClick3;
     Sounds::playSound(clickSound, 30.0f);
@@ -560,7 +560,7 @@ void InventoryGUI::putDownItem(Game& game, pl::Vector2f mouseScreenPos, Inventor
         itemIndex = chestHoveredItemIndex;
     }
 
-    std::optional<ItemCount>& itemSlotData = hoveredInventory->getItemSlotData(itemIndex);
+    const std::optional<ItemCount>& itemSlotData = hoveredInventory->getItemSlotData(itemIndex);
 
     // If item at selected position, attempt to add to stack
     if (itemSlotData.has_value())
@@ -618,7 +618,7 @@ void InventoryGUI::putDownItem(Game& game, pl::Vector2f mouseScreenPos, Inventor
 
     // Play sound
     SoundType clickSound = SoundType::InventoryStack1;
-    int soundChance = rand() % 2;
+    int soundChance = Helper::randInt(0, 1);
     if (soundChance == 1) clickSound = SoundType::InventoryStack2;
     Sounds::playSound(clickSound, 30.0f);
 
@@ -714,7 +714,7 @@ void InventoryGUI::craftRecipe(InventoryData& inventory, int selectedRecipe)
     }
 
     // Play craft sound
-    int soundChance = rand() % 2;
+    int soundChance = Helper::randInt(0, 1);
     SoundType craftSound = SoundType::CraftBuild1;
     if (soundChance == 1) craftSound = SoundType::CraftBuild2;
 
@@ -899,7 +899,7 @@ ItemType InventoryGUI::getHeldItemType(InventoryData& inventory)
         return pickedUpItem;
     }
 
-    std::optional<ItemCount>& selectedItemSlot = inventory.getItemSlotData(selectedHotbarIndex);
+    const std::optional<ItemCount>& selectedItemSlot = inventory.getItemSlotData(selectedHotbarIndex);
 
     if (selectedItemSlot.has_value())
     {
@@ -2028,14 +2028,14 @@ void InventoryGUI::inventoryChestItemQuickTransfer(Game& game, pl::Vector2f mous
     }
     
     // Get item data from source inventory
-    std::optional<ItemCount>& itemSlotData = hoveredInventory->getItemSlotData(itemHovered);
+    const std::optional<ItemCount>& itemSlotData = hoveredInventory->getItemSlotData(itemHovered);
 
     if (!itemSlotData.has_value())
     {
         return;
     }
     
-    ItemCount& itemCount = itemSlotData.value();
+    const ItemCount& itemCount = itemSlotData.value();
 
     // Attempt to add amount of item to destination inventory
     int amountTransfered = destinationInventory->addItem(itemCount.first, std::min(itemCount.second, amount));
@@ -2071,7 +2071,7 @@ void InventoryGUI::quickBin(pl::Vector2f mouseScreenPos, InventoryData& inventor
         hoveredInventory = chestData;
     }
 
-    std::optional<ItemCount>& itemSlotData = hoveredInventory->getItemSlotData(itemHovered);
+    const std::optional<ItemCount>& itemSlotData = hoveredInventory->getItemSlotData(itemHovered);
 
     if (!itemSlotData.has_value())
     {
@@ -2512,7 +2512,7 @@ bool InventoryGUI::canQuickTransfer(pl::Vector2f mouseScreenPos, bool shiftMode,
         return false;
     }
 
-    std::optional<ItemCount>& itemSlotData = hoveredInventory->getItemSlotData(itemHovered);
+    const std::optional<ItemCount>& itemSlotData = hoveredInventory->getItemSlotData(itemHovered);
 
     // No item in hovered slot
     if (!itemSlotData.has_value())
@@ -2560,7 +2560,7 @@ bool InventoryGUI::canQuickBin(pl::Vector2f mouseScreenPos, bool ctrlMode, Inven
         inventoryHovered = chestData;
     }
 
-    std::optional<ItemCount>& itemSlotData = inventoryHovered->getItemSlotData(itemHovered);
+    const std::optional<ItemCount>& itemSlotData = inventoryHovered->getItemSlotData(itemHovered);
 
     return itemSlotData.has_value();
 }
\ No newline at end of file
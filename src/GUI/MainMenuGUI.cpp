@@ -15,7 +15,7 @@ void MainMenuGUI::initialise()
     deferHoverRectReset = false;
 
     // static const std::string backgroundWorldSeed = "Planeturem";
-    menuWorldData.chunkManager.setSeed(rand());
+    menuWorldData.chunkManager.setSeed(Helper::getRandom().next() >> 1);
     menuWorldData.chunkManager.setPlanetType(0);
 
     int worldSize = menuWorldData.chunkManager.getWorldSize();
@@ -75,7 +75,7 @@ std::optional<MainMenuEvent> MainMenuGUI::createAndDraw(pl::RenderTarget& window
     worldObjects.insert(worldObjects.end(), entities.begin(), entities.end());
 
     pl::Framebuffer worldTexture;
-    game.drawWorld(worldTexture, dt, worldObjects, menuWorldData, menuCamera);
+    game.drawWorld(worldTexture, dt, worldObjects, menuWorldData, menuCamera, false);
 
     pl::VertexArray worldRect;
     worldRect.addQuad(pl::Rect<float>(0, 0, worldTexture.getWidth(), worldTexture.getHeight()), pl::Color(),
@@ -913,7 +913,7 @@ int MainMenuGUI::getWorldSeedFromString(std::string string)
     int seed = 0;
     if (string.empty())
     {
-        seed = rand();
+        seed = Helper::getRandom().next() >> 1;
     }
     else
     {
@@ -13,6 +13,7 @@
 #include "Data/StructureData.hpp"
 #include "Data/StructureDataLoader.hpp"
 #include "Data/ArmourDataLoader.hpp"
+#include "Data/GameDataCache.hpp"
 
 #include "GUI/HitMarkers.hpp"
 
@@ -80,24 +81,17 @@ bool Game::initialise()
     // Set resolution handler values
     ResolutionHandler::setResolution({static_cast<uint32_t>(window.getWidth()), static_cast<uint32_t>(window.getHeight())});
 
+    // Initialise logging
+    Log::init();
+
     // Load assets
     if(!TextureManager::loadTextures()) return false;
     if(!Shaders::loadShaders()) return false;
     if(!TextDraw::loadFont("Data/Fonts/upheavtt.ttf", "Data/Shaders/default.vert", "Data/Shaders/font.frag")) return false;
     if(!Sounds::loadSounds()) return false;
 
-    // Load data
-    if(!ItemDataLoader::loadData("Data/Info/items.data")) return false;
-    if(!ToolDataLoader::loadData("Data/Info/tools.data")) return false;
-    if(!ArmourDataLoader::loadData("Data/Info/armour.data")) return false;
-    if(!EntityDataLoader::loadData("Data/Info/entities.data")) return false;
-    if(!ObjectDataLoader::loadData("Data/Info/objects.data")) return false;
-    if(!RecipeDataLoader::loadData("Data/Info/item_recipes.data")) return false;
-    if(!StructureDataLoader::loadData("Data/Info/structures.data")) return false;
-    if(!PlanetGenDataLoader::loadData("Data/Info/planet_generation.data")) return false;
-
-    // Must be done once all other data is loaded to avoid circular dependency
-    ObjectDataLoader::loadRocketPlanetDestinations(PlanetGenDataLoader::getPlanetStringToTypeMap(), StructureDataLoader::getRoomTravelLocationNameToTypeMap());
+    // Load data (from compiled cache if up to date)
+    if(!GameDataCache::loadGameData("Data/Info/", GameDataCache::getDefaultCachePath())) return false;
 
     // Load icon
     if(!icon.loadFromFile("Data/Textures/icon.png")) return false;
@@ -124,11 +118,7 @@ bool Game::initialise()
     // Initialise network handler
     networkHandler.reset(this);
 
-    // Initialise logging
-    Log::init();
-
-    // Randomise
-    srand(time(NULL));
+    MemoryTracker::setMeasureCallback([this]() {measureContainerMemory();});
 
     loadOptions();
     loadInputBindings();
@@ -197,6 +187,8 @@ void Game::deinit()
     ImGui::DestroyContext();
     #endif
 
+    MemoryTracker::setMeasureCallback(nullptr);
+
     worldDatas.clear();
     lightingEngine.~LightingEngine();
 
@@ -226,54 +218,660 @@ void Game::run()
         dt *= DebugOptions::gameTimeMult;
         #endif
 
-        applicationTime += dt;
+        runFrame(dt);
 
+        // window.display();
+        window.swapBuffers();
+        window.showWindow();
+        window.setVSync(ResolutionHandler::getVSync());
+    }
+
+    replayRecorder.end();
+
+    SDL_Quit();
+}
+
+void Game::runFrame(float dt)
+{
+    applicationTime += dt;
+
+    // Steam callback network events are taken from recording when replaying
+    if (!networkHandler.isReplaying())
+    {
         SteamAPI_RunCallbacks();
+    }
 
-        Sounds::update(dt);
+    Sounds::update(dt);
+    MemoryTracker::update(dt);
+    Sounds::setListener(player.getPosition(), locationState.isOnPlanet() ? getChunkManager().getWorldSize() : 0);
+    
+    InputManager::update(window.getSDLWindow(), dt, camera.worldToScreenTransform(player.getPosition(),
+        locationState.isOnPlanet() ? getChunkManager().getWorldSize() : 0));
+    mouseScreenPos = InputManager::getMousePosition(window.getSDLWindow());
+
+    if (networkHandler.isMultiplayerGame())
+    {
+        networkHandler.receiveMessages(chatGUI, mainMenuGUI);
+    }
+
+    switch (gameState)
+    {
+        case GameState::MainMenu:
+            runMainMenu(dt);
+            break;
         
-        InputManager::update(window.getSDLWindow(), dt, camera.worldToScreenTransform(player.getPosition(),
-            locationState.isOnPlanet() ? getChunkManager().getWorldSize() : 0));
-        mouseScreenPos = InputManager::getMousePosition(window.getSDLWindow());
+        case GameState::OnPlanet: // fallthrough
+        case GameState::InStructure: // fallthrough
+        case GameState::InRoomDestination:
+            runInGame(dt);
+            break;
+    }
+
+    if (isStateTransitioning())
+    {
+        updateStateTransition(dt);
+        drawScreenFade(1.0f - transitionGameStateTimer / TRANSITION_STATE_FADE_TIME);
+    }
+
+    #if (!RELEASE_BUILD)
+    drawDebugMenu(dt);
+    ImGui::SetMouseCursor(ImGuiMouseCursor_None);
+    #endif
+    
+    drawMouseCursor();
+
+    // Frame save was loaded in is not recorded, as replay loads save before first frame
+    if (pendingReplayRecording.has_value())
+    {
+        beginReplayRecording(dt);
+    }
+    else if (replayRecorder.isRecording())
+    {
+        bool fullStateHash = ReplayRecorder::isFullStateHashFrame(replayRecorder.getFrameCount());
+        replayRecorder.endFrame(dt, InputManager::getInputFrameState(window.getSDLWindow()), getReplayStateHash(fullStateHash));
+    }
+}
+
+// -- Replay -- //
+
+int Game::runReplay(const std::string& replayPath)
+{
+    ReplayRecording replayRecording;
+
+    if (!GameSaveIO().loadReplay(replayPath, replayRecording))
+    {
+        Log::push("ERROR: Could not load replay \"{}\"\n", replayPath);
+        return -1;
+    }
+
+    if (replayRecording.gameDataHash != getGameDataHash())
+    {
+        Log::push("WARNING: Replay was recorded with different game data, replay will likely diverge\n");
+    }
+
+    if (replayRecording.localSteamID != 0 && (!steamInitialised || SteamUser()->GetSteamID().ConvertToUint64() != replayRecording.localSteamID))
+    {
+        Log::push("WARNING: Replay was recorded by a different Steam user, multiplayer replays will likely diverge\n");
+    }
+
+    // Restore save replay was recorded from into separate save
+    SaveFileSummary replaySaveFileSummary;
+    replaySaveFileSummary.name = "Replay - " + replayRecording.saveName;
+
+    GameSaveIO replaySaveIO(replaySaveFileSummary.name);
+    if (!replaySaveIO.writeSaveFiles(replayRecording.saveFiles))
+    {
+        Log::push("ERROR: Could not restore save for replay \"{}\"\n", replayPath);
+        return -1;
+    }
+
+    // Replay must not unlock achievements
+    Achievements::steamInitialised = false;
+
+    // Input state of frame save was loaded in
+    InputManager::setReplayInputFrameState(replayRecording.initialInputState);
+    InputManager::update(window.getSDLWindow(), 0.0f, mouseScreenPos);
+
+    int divergedFrame = -1;
 
-        if (networkHandler.isMultiplayerGame())
+    bool loaded = loadGame(replaySaveFileSummary);
+    uint64_t loadStateHash = loaded ? getReplayStateHash(true) : 0;
+
+    if (!loaded)
+    {
+        Log::push("ERROR: Could not load save for replay \"{}\"\n", replayPath);
+        divergedFrame = 0;
+    }
+    else if (loadStateHash != replayRecording.loadStateHash)
+    {
+        Log::push("REPLAY: Diverged on load, expected state hash {}, got {}\n", replayRecording.loadStateHash, loadStateHash);
+        divergedFrame = 0;
+    }
+    else
+    {
+        // Continue frame save was loaded in from main menu, as when recorded
+        mainMenuGUI.setCanInteract(false);
+        if (isStateTransitioning())
         {
-            networkHandler.receiveMessages(chatGUI, mainMenuGUI);
+            updateStateTransition(replayRecording.loadFrameDt);
         }
 
-        switch (gameState)
+        Helper::getRandom() = RandomStream(replayRecording.randomSeed);
+
+        networkHandler.setReplaying(true);
+
+        // Chunks with unchanged content version are only hashed on full state hash frames, so divergence
+        // is known to be after last matching full state hash frame
+        int lastFullHashMatchFrame = -1;
+
+        Log::push("REPLAY: Replaying {} frames from \"{}\"\n", replayRecording.frames.size(), replayPath);
+
+        for (int i = 0; i < replayRecording.frames.size(); i++)
         {
-            case GameState::MainMenu:
-                runMainMenu(dt);
-                break;
-            
-            case GameState::OnPlanet: // fallthrough
-            case GameState::InStructure: // fallthrough
-            case GameState::InRoomDestination:
-                runInGame(dt);
+            const ReplayFrame& replayFrame = replayRecording.frames[i];
+
+            networkHandler.applyReplayNetworkEvents(replayFrame);
+            networkHandler.setReplayFrame(replayFrame);
+
+            InputManager::setReplayInputFrameState(replayFrame.inputState);
+
+            // Keep window responsive, events are not used as input
+            SDL_Event event;
+            while (SDL_PollEvent(&event)) {}
+
+            runFrame(replayFrame.dt);
+
+            bool fullStateHash = ReplayRecorder::isFullStateHashFrame(i);
+            uint64_t stateHash = getReplayStateHash(fullStateHash);
+            if (stateHash != replayFrame.stateHash)
+            {
+                divergedFrame = i;
+                Log::push("REPLAY: Diverged between frames {} and {} (game time {}), expected state hash {}, got {}\n",
+                    lastFullHashMatchFrame + 1, i, gameTime, replayFrame.stateHash, stateHash);
                 break;
+            }
+
+            if (fullStateHash)
+            {
+                lastFullHashMatchFrame = i;
+            }
         }
+    }
 
-        if (isStateTransitioning())
+    if (divergedFrame < 0)
+    {
+        Log::push("REPLAY: Replayed {} frames without divergence\n", replayRecording.frames.size());
+    }
+
+    networkHandler.setReplaying(false);
+    InputManager::clearReplayInputFrameState();
+    Achievements::steamInitialised = steamInitialised;
+
+    replaySaveIO.attemptDeleteSave();
+
+    return (divergedFrame < 0) ? 0 : 1;
+}
+
+int Game::runCommandScript(const std::string& saveName, const std::string& scriptPath)
+{
+    std::ifstream in(scriptPath);
+    if (!in)
+    {
+        Log::push("ERROR: Could not open command script \"{}\"\n", scriptPath);
+        return -1;
+    }
+
+    std::optional<SaveFileSummary> saveFileSummary;
+    for (const SaveFileSummary& summary : GameSaveIO().getSaveFiles())
+    {
+        if (summary.name == saveName)
         {
-            updateStateTransition(dt);
-            drawScreenFade(1.0f - transitionGameStateTimer / TRANSITION_STATE_FADE_TIME);
+            saveFileSummary = summary;
+            break;
         }
+    }
 
-        #if (!RELEASE_BUILD)
-        drawDebugMenu(dt);
-        ImGui::SetMouseCursor(ImGuiMouseCursor_None);
-        #endif
-        
-        drawMouseCursor();
+    if (!saveFileSummary.has_value())
+    {
+        Log::push("ERROR: Could not find save \"{}\" for command script\n", saveName);
+        return -1;
+    }
 
-        // window.display();
-        window.swapBuffers();
-        window.showWindow();
-        window.setVSync(ResolutionHandler::getVSync());
+    // Commands are run against a copy of save, so original save is never modified by a script
+    std::vector<std::pair<std::string, std::vector<char>>> saveFiles;
+    SaveFileSummary scriptSaveFileSummary = saveFileSummary.value();
+    scriptSaveFileSummary.name = saveName + " - Commands";
+
+    if (!GameSaveIO(saveName).readSaveFiles(saveFiles) || !GameSaveIO(scriptSaveFileSummary.name).writeSaveFiles(saveFiles))
+    {
+        Log::push("ERROR: Could not copy save \"{}\" for command script\n", saveName);
+        return -1;
     }
 
-    SDL_Quit();
+    if (!loadGame(scriptSaveFileSummary))
+    {
+        Log::push("ERROR: Could not load save \"{}\" for command script\n", scriptSaveFileSummary.name);
+        return -1;
+    }
+
+    // Commands must not unlock achievements
+    Achievements::steamInitialised = false;
+
+    commandConsole.registerScriptCommands();
+
+    int failedCommands = 0;
+    int lineNumber = 0;
+
+    // Set by "@permission <level>" lines, so scripts can check commands are denied to lower levels
+    PermissionLevel permissionLevel = PermissionLevel::Admin;
+
+    std::string line;
+    while (std::getline(in, line))
+    {
+        lineNumber++;
+
+        if (!line.empty() && line.back() == '\r')
+        {
+            line.pop_back();
+        }
+
+        if (line.empty() || line[0] == '#')
+        {
+            continue;
+        }
+
+        static const std::string PERMISSION_DIRECTIVE = "@permission ";
+        if (line.starts_with(PERMISSION_DIRECTIVE))
+        {
+            std::optional<PermissionLevel> scriptPermissionLevel = CommandConsole::getPermissionLevelFromName(line.substr(PERMISSION_DIRECTIVE.size()));
+            if (!scriptPermissionLevel.has_value())
+            {
+                Log::push("COMMAND SCRIPT: Line {} failed: unknown permission level \"{}\"\n", lineNumber, line.substr(PERMISSION_DIRECTIVE.size()));
+                failedCommands++;
+                continue;
+            }
+
+            permissionLevel = scriptPermissionLevel.value();
+            continue;
+        }
+
+        // Commands starting with '!' are expected to fail, e.g. "!/give me wood" as a player
+        bool expectFailure = (line[0] == '!');
+        if (expectFailure)
+        {
+            line.erase(0, 1);
+        }
+
+        CommandResult result = commandConsole.executeAsPermissionLevel(*this, getLocalPlayerID(), permissionLevel, line);
+        if (result.success == expectFailure)
+        {
+            Log::push("COMMAND SCRIPT: Line {} {}: {}\n", lineNumber, expectFailure ? "succeeded but was expected to fail" : "failed", result.reply);
+            failedCommands++;
+        }
+
+        // Apply command effects before next command
+        SDL_Event event;
+        while (SDL_PollEvent(&event)) {}
+
+        runFrame(1.0f / 60.0f);
+    }
+
+    if (!saveGame())
+    {
+        Log::push("ERROR: Could not save \"{}\" after command script\n", scriptSaveFileSummary.name);
+        failedCommands++;
+    }
+
+    Achievements::steamInitialised = steamInitialised;
+
+    Log::push("COMMAND SCRIPT: Completed \"{}\" with {} failed commands, written to save \"{}\"\n", scriptPath, failedCommands,
+        scriptSaveFileSummary.name);
+
+    return (failedCommands == 0) ? 0 : 1;
+}
+
+// -- Planet pregeneration -- //
+
+int Game::runPlanetPregeneration(const std::string& saveName, const std::string& planetName, std::optional<int> chunkRadius, std::optional<int> seed)
+{
+    std::optional<SaveFileSummary> saveFileSummary;
+    for (const SaveFileSummary& summary : GameSaveIO().getSaveFiles())
+    {
+        if (summary.name == saveName)
+        {
+            saveFileSummary = summary;
+            break;
+        }
+    }
+
+    GameSaveIO io(saveName);
+    PlayerGameSave playerGameSave;
+
+    if (!saveFileSummary.has_value() || !io.loadPlayerSave(playerGameSave))
+    {
+        Log::push("ERROR: Could not load save \"{}\" for planet pregeneration\n", saveName);
+        return -1;
+    }
+
+    if (seed.has_value() && seed.value() != playerGameSave.seed)
+    {
+        Log::push("ERROR: Save \"{}\" has seed {}, not {}\n", saveName, playerGameSave.seed, seed.value());
+        return -1;
+    }
+
+    auto planetTypeIter = PlanetGenDataLoader::getPlanetStringToTypeMap().find(planetName);
+    if (planetTypeIter == PlanetGenDataLoader::getPlanetStringToTypeMap().end())
+    {
+        Log::push("ERROR: Unknown planet \"{}\"\n", planetName);
+        return -1;
+    }
+
+    PlanetType planetType = planetTypeIter->second;
+
+    currentSaveFileSummary = saveFileSummary.value();
+    planetSeed = playerGameSave.seed;
+
+    // Generation must not unlock achievements
+    Achievements::steamInitialised = false;
+
+    auto serialiseChunks = [](const std::vector<ChunkPOD>& chunkPODs) -> std::string
+    {
+        std::stringstream outputStream;
+        {
+            cereal::BinaryOutputArchive archive(outputStream);
+            archive(chunkPODs);
+        }
+        return outputStream.str();
+    };
+
+    std::string serialisedChunks = serialiseChunks(pregeneratePlanet(planetType, chunkRadius, planetWorkerPool));
+
+    // Regenerate from save on a single worker, which must give the same chunks
+    WorkerPool verifyWorkerPool(1);
+    std::vector<ChunkPOD> chunkPODs = pregeneratePlanet(planetType, chunkRadius, verifyWorkerPool);
+
+    Achievements::steamInitialised = steamInitialised;
+
+    if (serialiseChunks(chunkPODs) != serialisedChunks)
+    {
+        Log::push("ERROR: Pregenerated planet \"{}\" differs between runs, planet save not written\n", planetName);
+        return 1;
+    }
+
+    Log::push("PREGENERATE: Runs gave identical chunks ({} bytes)\n", serialisedChunks.size());
+
+    ChunkManager& chunkManager = getChunkManager(planetType);
+
+    PlanetGameSave planetGameSave;
+    planetGameSave.chunks = chunkPODs;
+    planetGameSave.worldMap.setMapTextureData(chunkManager.getWorldMap().getMapTextureData());
+    planetGameSave.chestDataPool = getChestDataPool(LocationState::createFromPlanetType(planetType));
+    planetGameSave.structureRoomPool = getStructureRoomPool(planetType);
+
+    if (!io.writePlanetSave(planetType, planetGameSave))
+    {
+        Log::push("ERROR: Could not write planet \"{}\" for \"{}\"\n", planetName, saveName);
+        return -1;
+    }
+
+    // Store spawn so it is not searched for when first travelling to planet
+    if (!playerGameSave.playerData.planetSpawnLocations.contains(planetType))
+    {
+        ObjectReference spawnLocation;
+        spawnLocation.chunk = chunkManager.findValidSpawnChunk(2);
+        spawnLocation.tile.x = CHUNK_TILE_SIZE / 2;
+        spawnLocation.tile.y = CHUNK_TILE_SIZE / 2;
+
+        playerGameSave.playerData.planetSpawnLocations[planetType] = spawnLocation;
+        io.writePlayerSave(playerGameSave);
+    }
+
+    worldDatas.clear();
+
+    return 0;
+}
+
+std::vector<ChunkPOD> Game::pregeneratePlanet(PlanetType planetType, std::optional<int> chunkRadius, WorkerPool& workerPool)
+{
+    // Reload planet from save, so every run starts from the same chunks
+    worldDatas.erase(planetType);
+    loadPlanet(planetType);
+
+    ChunkManager& chunkManager = getChunkManager(planetType);
+    int worldSize = chunkManager.getWorldSize();
+
+    std::vector<ChunkPosition> chunks;
+
+    if (chunkRadius.has_value() && chunkRadius.value() * 2 + 1 < worldSize)
+    {
+        ChunkPosition spawnChunk = chunkManager.findValidSpawnChunk(2);
+
+        for (int y = -chunkRadius.value(); y <= chunkRadius.value(); y++)
+        {
+            for (int x = -chunkRadius.value(); x <= chunkRadius.value(); x++)
+            {
+                chunks.push_back(ChunkPosition(((spawnChunk.x + x) % worldSize + worldSize) % worldSize,
+                    ((spawnChunk.y + y) % worldSize + worldSize) % worldSize));
+            }
+        }
+    }
+    else
+    {
+        for (int y = 0; y < worldSize; y++)
+        {
+            for (int x = 0; x < worldSize; x++)
+            {
+                chunks.push_back(ChunkPosition(x, y));
+            }
+        }
+    }
+
+    std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+
+    int chunksGenerated = chunkManager.pregenerateChunks(chunks, *this, workerPool);
+
+    float seconds = std::chrono::duration<float>(std::chrono::steady_clock::now() - startTime).count();
+
+    Log::push("PREGENERATE: Generated {} of {} chunks in {:.2f}s ({:.0f} chunks/s) with {} workers\n", chunksGenerated, chunks.size(), seconds,
+        chunksGenerated / std::max(seconds, 0.001f), workerPool.getWorkerCount());
+
+    // Chunks in consistent order, as stored chunk order depends on generation order, so saved planet is the same each run
+    std::vector<ChunkPOD> chunkPODs = chunkManager.getChunkPODs();
+    std::sort(chunkPODs.begin(), chunkPODs.end(), [](const ChunkPOD& a, const ChunkPOD& b)
+    {
+        return (a.chunkPosition.y != b.chunkPosition.y) ? (a.chunkPosition.y < b.chunkPosition.y) : (a.chunkPosition.x < b.chunkPosition.x);
+    });
+
+    return chunkPODs;
+}
+
+// -- Memory test -- //
+
+int Game::runMemoryTest(const std::string& saveName, const std::string& planetName)
+{
+    std::optional<SaveFileSummary> saveFileSummary;
+    for (const SaveFileSummary& summary : GameSaveIO().getSaveFiles())
+    {
+        if (summary.name == saveName)
+        {
+            saveFileSummary = summary;
+            break;
+        }
+    }
+
+    if (!saveFileSummary.has_value() || !loadGame(saveFileSummary.value()))
+    {
+        Log::push("ERROR: Could not load save \"{}\" for memory test\n", saveName);
+        return -1;
+    }
+
+    auto planetTypeIter = PlanetGenDataLoader::getPlanetStringToTypeMap().find(planetName);
+    if (planetTypeIter == PlanetGenDataLoader::getPlanetStringToTypeMap().end())
+    {
+        Log::push("ERROR: Unknown planet \"{}\"\n", planetName);
+        return -1;
+    }
+
+    PlanetType planetType = planetTypeIter->second;
+
+    if (worldDatas.contains(planetType))
+    {
+        Log::push("ERROR: Planet \"{}\" is already loaded in \"{}\", choose a different planet\n", planetName, saveName);
+        return -1;
+    }
+
+    // Test must not unlock achievements
+    Achievements::steamInitialised = false;
+
+    // Let save finish loading before taking baseline
+    for (int i = 0; i < 10; i++)
+    {
+        SDL_Event event;
+        while (SDL_PollEvent(&event)) {}
+
+        runFrame(1.0f / 60.0f);
+    }
+
+    // Load once before baseline, so allocations which are only made once (e.g. caches) are not counted as leaks
+    loadAndUnloadPlanet(planetType);
+
+    measureContainerMemory();
+    MemorySnapshot baseline = MemoryTracker::getSnapshot();
+
+    loadAndUnloadPlanet(planetType);
+
+    measureContainerMemory();
+    MemorySnapshot afterUnload = MemoryTracker::getSnapshot();
+
+    Achievements::steamInitialised = steamInitialised;
+
+    int leakedCategories = 0;
+    for (int i = 0; i < MEMORY_CATEGORY_COUNT; i++)
+    {
+        const MemoryCategoryStats& before = baseline[i];
+        const MemoryCategoryStats& after = afterUnload[i];
+
+        if (before.liveBytes == after.liveBytes && before.liveCount == after.liveCount && before.measuredBytes == after.measuredBytes)
+        {
+            continue;
+        }
+
+        Log::push("MEMORY TEST: {} leaked {} bytes in {} allocations, {} measured bytes\n", getMemoryCategoryName(static_cast<MemoryCategory>(i)),
+            after.liveBytes - before.liveBytes, after.liveCount - before.liveCount, after.measuredBytes - before.measuredBytes);
+        leakedCategories++;
+    }
+
+    Log::push("MEMORY TEST: Loaded and unloaded \"{}\" with {} leaking categories\n", planetName, leakedCategories);
+
+    return (leakedCategories == 0) ? 0 : 1;
+}
+
+void Game::measureContainerMemory()
+{
+    size_t tileMapBytes = 0;
+    size_t chestDataBytes = 0;
+    size_t roomBytes = 0;
+
+    for (const auto& [planetType, worldData] : worldDatas)
+    {
+        tileMapBytes += worldData.chunkManager.getChunkTileMapsVertexBytes();
+        chestDataBytes += worldData.chestDataPool.getInventoryStorageBytes();
+        roomBytes += worldData.structureRoomPool.getRoomGridBytes();
+    }
+
+    for (const auto& [roomType, roomDestinationData] : roomDestDatas)
+    {
+        chestDataBytes += roomDestinationData.chestDataPool.getInventoryStorageBytes();
+        roomBytes += roomDestinationData.roomDestination.getGridBytes();
+    }
+
+    MemoryTracker::setMeasuredBytes(MemoryCategory::TileMaps, tileMapBytes);
+    MemoryTracker::setMeasuredBytes(MemoryCategory::ChestData, chestDataBytes);
+    MemoryTracker::setMeasuredBytes(MemoryCategory::Rooms, roomBytes);
+}
+
+void Game::loadAndUnloadPlanet(PlanetType planetType)
+{
+    loadPlanet(planetType);
+
+    ChunkManager& chunkManager = getChunkManager(planetType);
+    ChunkViewRange chunkViewRange = camera.getChunkViewRange().copyAndCentre(chunkManager.findValidSpawnChunk(2));
+
+    for (int i = 0; i < 10; i++)
+    {
+        chunkManager.updateChunks(*this, gameTime, {chunkViewRange}, &networkHandler);
+    }
+
+    MemoryTracker::logStats();
+
+    worldDatas.erase(planetType);
+}
+
+void Game::prepareReplayRecording(const std::string& saveName)
+{
+    pendingReplayRecording = ReplayRecording();
+    pendingReplayRecording->gameDataHash = getGameDataHash();
+    pendingReplayRecording->saveName = saveName;
+
+    GameSaveIO io(saveName);
+    if (!io.readSaveFiles(pendingReplayRecording->saveFiles))
+    {
+        Log::push("ERROR: Could not read save \"{}\" for replay recording\n", saveName);
+        pendingReplayRecording = std::nullopt;
+        return;
+    }
+
+    pendingReplayRecording->localSteamID = steamInitialised ? SteamUser()->GetSteamID().ConvertToUint64() : 0;
+}
+
+void Game::beginReplayRecording(float loadFrameDt)
+{
+    ReplayRecording& recordingStart = pendingReplayRecording.value();
+
+    recordingStart.loadFrameDt = loadFrameDt;
+    recordingStart.initialInputState = InputManager::getInputFrameState(window.getSDLWindow());
+
+    // Reseed non-gameplay randomness so it can be reproduced in replay
+    recordingStart.randomSeed = Helper::getRandom().next();
+    Helper::getRandom() = RandomStream(recordingStart.randomSeed);
+
+    replayRecorder.begin(recordingStart);
+
+    pendingReplayRecording = std::nullopt;
+}
+
+uint64_t Game::getReplayStateHash(bool fullChunkHash)
+{
+    std::vector<PlanetType> planetTypes;
+    for (const auto& worldData : worldDatas)
+    {
+        planetTypes.push_back(worldData.first);
+    }
+
+    std::sort(planetTypes.begin(), planetTypes.end());
+
+    uint64_t hash = Helper::hashBytes(&gameTime, sizeof(gameTime));
+
+    for (PlanetType planetType : planetTypes)
+    {
+        uint64_t chunksHash = worldDatas.at(planetType).chunkManager.getLoadedChunksStateHash(fullChunkHash);
+        hash = Helper::hashBytes(&chunksHash, sizeof(chunksHash), hash);
+    }
+
+    std::stringstream stream;
+    {
+        cereal::BinaryOutputArchive archive(stream);
+        archive(inventory, armourInventory);
+    }
+
+    std::string inventoryData = stream.str();
+    hash = Helper::hashBytes(inventoryData.data(), inventoryData.size(), hash);
+
+    pl::Vector2f playerPosition = player.getPosition();
+    hash = Helper::hashBytes(&playerPosition.x, sizeof(playerPosition.x), hash);
+    hash = Helper::hashBytes(&playerPosition.y, sizeof(playerPosition.y), hash);
+
+    return hash;
 }
 
 // -- Main Menu -- //
@@ -767,6 +1365,12 @@ void Game::runInGame(float dt)
             updateActiveRoomDests(dt);
         }
 
+        // Compress long unused stored chunks on all planets
+        for (auto& worldData : worldDatas)
+        {
+            worldData.second.chunkManager.updateColdStorage(*this);
+        }
+
         // If chunk view range has changed, force lighting recalculation
         if (lastChunkViewRange != camera.getChunkViewRange())
         {
@@ -839,6 +1443,9 @@ void Game::runInGame(float dt)
     {
         if (gameState == GameState::OnPlanet)
         {
+            // Upload all map sections discovered this frame at once
+            getChunkManager().getWorldMap().uploadDirtyRegions();
+
             worldMapGUI.drawMiniMap(window, spriteBatch, gameTime, getChunkManager().getWorldMap(), player.getPosition(),
                 getSpawnLocation(), getLandmarkManager().getLandmarkSummaryDatas(camera, getChunkManager(), networkHandler),
                 networkHandler.getNetworkPlayersAtLocation(locationState));
@@ -969,6 +1576,11 @@ void Game::runInGame(float dt)
                         if (networkHandler.isLobbyHostOrSolo())
                         {
                             landmarkObjectPtr->setLandmarkColour(landmarkSetGUI.getColorA(), landmarkSetGUI.getColorB());
+
+                            if (Chunk* chunkPtr = getChunkManager().getChunk(landmarkSetGUI.getLandmarkObjectReference().chunk))
+                            {
+                                chunkPtr->markContentModified();
+                            }
                         }
                     }
                 }
@@ -1132,7 +1744,7 @@ void Game::updateOnPlanet(float dt)
         }
     
         getChunkManager().updateChunksObjects(*this, dt, networkHandler.isLobbyHostOrSolo() ? gameTime : 0.0f);
-        getChunkManager().updateChunksEntities(dt, getProjectileManager(), *this, networkHandler.isClient());
+        getChunkManager().updateChunksEntities(dt, getProjectileManager(), *this, networkHandler.isClient(), {camera.getChunkViewRange()});
     
         // If modified chunks, force a lighting recalculation
         // if (hasLoadedChunks || hasUnloadedChunks)
@@ -1221,47 +1833,75 @@ void Game::updateActivePlanets(float dt)
 
     std::unordered_set<PlanetType> planetTypeSet = networkHandler.getPlayersPlanetTypeSet(locationState.getPlanetType());
 
-    for (PlanetType planetType : planetTypeSet)
+    // Sorted so packets are flushed in same order each frame
+    std::vector<PlanetType> planetTypes(planetTypeSet.begin(), planetTypeSet.end());
+    std::sort(planetTypes.begin(), planetTypes.end());
+
+    std::vector<ActivePlanetUpdate> planetUpdates(planetTypes.size());
+
+    for (int i = 0; i < planetTypes.size(); i++)
+    {
+        PlanetType planetType = planetTypes[i];
+
+        planetUpdates[i].planetType = planetType;
+        planetUpdates[i].chunkViewRanges = networkHandler.getNetworkPlayersChunkViewRanges(planetType);
+
+        // Add this player (host) chunk view range and set player position, if also on this planet
+        if (locationState.getPlanetType() == planetType)
+        {
+            planetUpdates[i].chunkViewRanges.push_back(camera.getChunkViewRange());
+        }
+    }
+
+    // Planets share no chunk state, so chunks of each planet are updated as independent jobs
+    // Game-wide state must only be read until all jobs are complete
+    // This player's (host) planet is updated on main thread, as may give audio / visual feedback
+    updatingPlanetsInParallel = parallelPlanetUpdates && planetUpdates.size() > 1;
+
+    for (ActivePlanetUpdate& planetUpdate : planetUpdates)
+    {
+        if (planetUpdate.planetType == locationState.getPlanetType())
+        {
+            continue;
+        }
+
+        if (updatingPlanetsInParallel)
+        {
+            planetWorkerPool.dispatch([this, &planetUpdate, dt]() {updateActivePlanetChunks(planetUpdate, dt);});
+        }
+        else
+        {
+            updateActivePlanetChunks(planetUpdate, dt);
+        }
+    }
+
+    for (ActivePlanetUpdate& planetUpdate : planetUpdates)
     {
-        std::vector<ChunkViewRange> chunkViewRanges = networkHandler.getNetworkPlayersChunkViewRanges(planetType);
-
-        // Add this player (host) chunk view range and set player position, if also on this planet
-        if (locationState.getPlanetType() == planetType)
+        if (planetUpdate.planetType == locationState.getPlanetType())
         {
-            chunkViewRanges.push_back(camera.getChunkViewRange());
+            updateActivePlanetChunks(planetUpdate, dt);
         }
+    }
 
-        ChunkManager& chunkManager = getChunkManager(planetType);
-
-        chunkManager.updateChunks(*this, gameTime, chunkViewRanges, &networkHandler);
-        chunkManager.unloadChunksOutOfView(chunkViewRanges);
-    
-        std::vector<ChunkPosition> chunksModified = chunkManager.updateChunksObjects(*this, dt, gameTime);
-
-        // If any chunks modified while updating objects (resources regenerated), alert clients of update
-        if (chunksModified.size() > 0)
-        {
-            std::unordered_map<uint64_t, NetworkPlayer*> networkPlayers = networkHandler.getNetworkPlayersAtLocation(LocationState::createFromPlanetType(planetType));
+    if (updatingPlanetsInParallel)
+    {
+        planetWorkerPool.wait();
+        updatingPlanetsInParallel = false;
+    }
 
-            PacketDataChunkModifiedAlerts packetData;
-            packetData.planetType = planetType;
-            packetData.chunkRequests = chunksModified;
-            Packet packet;
-            packet.set(packetData);
+    if (rocketExitPending)
+    {
+        rocketExitPending = false;
+        exitRocket(locationState, nullptr);
+    }
 
-            for (auto client : networkPlayers)
-            {
-                networkHandler.sendPacketToClient(client.first, packet, k_nSteamNetworkingSend_Reliable, 0);
-            }
-        }
+    for (ActivePlanetUpdate& planetUpdate : planetUpdates)
+    {
+        PlanetType planetType = planetUpdate.planetType;
 
-        chunkManager.updateChunksEntities(dt, getProjectileManager(planetType), *this, false);
+        networkHandler.flushPacketBuffer(planetUpdate.packetBuffer);
 
-        // If chunks loaded / unloaded (and this player (host) is on this planet), force a lighting recalculation
-        // if (locationState.getPlanetType() == planetType && (hasLoadedChunks || hasUnloadedChunks))
-        // {
-        //     lightingTickTime = LIGHTING_TICK_TIME;
-        // }
+        ChunkManager& chunkManager = getChunkManager(planetType);
 
         // Get players on planet, including us if in same location
         Player* thisPlayer = (locationState == LocationState::createFromPlanetType(planetType)) ? &player : nullptr;
@@ -1275,6 +1915,42 @@ void Game::updateActivePlanets(float dt)
     }
 }
 
+void Game::updateActivePlanetChunks(ActivePlanetUpdate& planetUpdate, float dt)
+{
+    // Packets are flushed from main thread after all planets updated
+    NetworkHandler::setThreadPacketBuffer(&planetUpdate.packetBuffer);
+
+    PlanetType planetType = planetUpdate.planetType;
+
+    ChunkManager& chunkManager = getChunkManager(planetType);
+
+    chunkManager.updateChunks(*this, gameTime, planetUpdate.chunkViewRanges, &networkHandler);
+    chunkManager.unloadChunksOutOfView(planetUpdate.chunkViewRanges);
+
+    std::vector<ChunkPosition> chunksModified = chunkManager.updateChunksObjects(*this, dt, gameTime);
+
+    // If any chunks modified while updating objects (resources regenerated), alert clients of update
+    if (chunksModified.size() > 0)
+    {
+        std::unordered_map<uint64_t, NetworkPlayer*> networkPlayers = networkHandler.getNetworkPlayersAtLocation(LocationState::createFromPlanetType(planetType));
+
+        PacketDataChunkModifiedAlerts packetData;
+        packetData.planetType = planetType;
+        packetData.chunkRequests = chunksModified;
+        Packet packet;
+        packet.set(packetData);
+
+        for (auto client : networkPlayers)
+        {
+            networkHandler.sendPacketToClient(client.first, packet, k_nSteamNetworkingSend_Reliable, 0);
+        }
+    }
+
+    chunkManager.updateChunksEntities(dt, getProjectileManager(planetType), *this, false, planetUpdate.chunkViewRanges);
+
+    NetworkHandler::setThreadPacketBuffer(nullptr);
+}
+
 void Game::updateActiveRoomDests(float dt)
 {
     std::unordered_set<RoomType> roomDestSet = networkHandler.getPlayersRoomDestTypeSet(locationState.getRoomDestType());
@@ -1290,28 +1966,29 @@ void Game::drawOnPlanet(float dt)
     // Get world objects
     ChunkViewRange chunkViewRange = camera.getChunkViewRange();
 
-    std::vector<WorldObject*> worldObjects = getChunkManager().getChunkObjects(chunkViewRange);
-    std::vector<WorldObject*> entities = getChunkManager().getChunkEntities(chunkViewRange);
-    std::vector<WorldObject*> itemPickups = getChunkManager().getItemPickups(chunkViewRange);
-    std::vector<WorldObject*> weatherParticles = weatherSystem.getWeatherParticles();
-    std::vector<WorldObject*> particles = particleSystem.getParticleWorldObjects();
-    std::vector<WorldObject*> playerWorldObjects = player.getDrawWorldObjects(camera, getChunkManager().getWorldSize(), gameTime);
-    worldObjects.insert(worldObjects.end(), entities.begin(), entities.end());
-    worldObjects.insert(worldObjects.end(), itemPickups.begin(), itemPickups.end());
-    worldObjects.insert(worldObjects.end(), weatherParticles.begin(), weatherParticles.end());
-    worldObjects.insert(worldObjects.end(), particles.begin(), particles.end());
-    worldObjects.insert(worldObjects.end(), playerWorldObjects.begin(), playerWorldObjects.end());
-    getBossManager().getBossWorldObjects(worldObjects);
+    // Buffer is kept between frames so capacity from previous frame is reused
+    visibleObjectStats = VisibleObjectStats();
+    size_t visibleObjectsCapacity = visibleWorldObjects.capacity();
+    visibleWorldObjects.clear();
+
+    getChunkManager().getChunkDrawableObjects(chunkViewRange, visibleWorldObjects, visibleObjectStats);
+    player.getDrawWorldObjects(camera, getChunkManager().getWorldSize(), gameTime, visibleWorldObjects);
+    getBossManager().getBossWorldObjects(visibleWorldObjects);
 
     // Add network players
     if (networkHandler.isMultiplayerGame())
     {
-        std::vector<WorldObject*> networkPlayerObjects = networkHandler.getNetworkPlayersToDraw(camera, locationState, player.getPosition(), gameTime);
-        worldObjects.insert(worldObjects.end(), networkPlayerObjects.begin(), networkPlayerObjects.end());
+        networkHandler.getNetworkPlayersToDraw(camera, locationState, player.getPosition(), gameTime, visibleWorldObjects);
+    }
+
+    if (visibleWorldObjects.capacity() != visibleObjectsCapacity)
+    {
+        visibleObjectStats.allocations++;
     }
+    visibleObjectStats.objectCount = visibleWorldObjects.size();
     
-    drawWorld(worldTexture, dt, worldObjects, worldDatas.at(locationState.getPlanetType()), camera);
-    drawLighting(dt, worldObjects);
+    drawWorld(worldTexture, dt, visibleWorldObjects, worldDatas.at(locationState.getPlanetType()), camera);
+    drawLighting(dt, visibleWorldObjects);
 
     // UI
     // pl::Vector2f mouseScreenPos = static_cast<pl::Vector2f>(sf::Mouse::getPosition(window));
@@ -1374,12 +2051,16 @@ void Game::drawOnPlanet(float dt)
     }
 }
 
-void Game::drawWorld(pl::Framebuffer& renderTexture, float dt, std::vector<WorldObject*>& worldObjects, WorldData& worldData, const Camera& cameraArg)
+void Game::drawWorld(pl::Framebuffer& renderTexture, float dt, std::vector<WorldObject*>& worldObjects, WorldData& worldData, const Camera& cameraArg,
+    bool drawParticles)
 {
     // Draw all world onto texture for lighting
     renderTexture.create(window.getWidth(), window.getHeight());
     renderTexture.clear(pl::Color(0, 0, 0));
 
+    // Draw counters are per frame
+    worldData.chunkManager.resetDrawStats();
+
     // Draw water
     worldData.chunkManager.drawChunkWater(renderTexture, cameraArg, gameTime);
 
@@ -1399,15 +2080,53 @@ void Game::drawWorld(pl::Framebuffer& renderTexture, float dt, std::vector<World
     // Draw terrain
     worldData.chunkManager.drawChunkTerrain(renderTexture, spriteBatch, cameraArg, gameTime);
 
-    // Draw particles
-    // particleSystem.draw(renderTexture, spriteBatch, cameraArg, worldData.chunkManager.getWorldSize());
+    // Particles and weather are not sorted with objects, and are instead drawn as a band per draw layer,
+    // on top of objects in the same draw layer
+    std::vector<int> particleDrawLayers;
+    if (drawParticles)
+    {
+        particleDrawLayers = particleSystem.getDrawLayers();
+    }
+
+    int particleDrawLayerIndex = 0;
+    bool weatherDrawn = !drawParticles;
+
+    auto drawParticleLayersAbove = [&](int drawLayer)
+    {
+        while (true)
+        {
+            bool drawParticleLayer = (particleDrawLayerIndex < particleDrawLayers.size() && particleDrawLayers[particleDrawLayerIndex] > drawLayer);
+            bool drawWeather = (!weatherDrawn && WeatherSystem::WEATHER_DRAW_LAYER > drawLayer);
+
+            if (!drawParticleLayer && !drawWeather)
+            {
+                break;
+            }
+
+            // Draw highest layer first
+            if (drawParticleLayer && (!drawWeather || particleDrawLayers[particleDrawLayerIndex] >= WeatherSystem::WEATHER_DRAW_LAYER))
+            {
+                particleSystem.drawLayer(renderTexture, spriteBatch, cameraArg, worldData.chunkManager.getWorldSize(), particleDrawLayers[particleDrawLayerIndex]);
+                particleDrawLayerIndex++;
+            }
+            else
+            {
+                weatherSystem.draw(renderTexture, spriteBatch, cameraArg, worldData.chunkManager.getWorldSize());
+                weatherDrawn = true;
+            }
+        }
+    };
 
     // Draw objects
     for (WorldObject* worldObject : worldObjects)
     {
+        drawParticleLayersAbove(worldObject->getDrawLayer());
+
         worldObject->draw(renderTexture, spriteBatch, *this, cameraArg, dt, gameTime, worldData.chunkManager.getWorldSize(), {255, 255, 255, 255});
     }
 
+    drawParticleLayersAbove(std::numeric_limits<int>::min());
+
     // Draw projectiles
     worldData.projectileManager.drawProjectiles(renderTexture, spriteBatch, worldData.chunkManager, player.getPosition(), cameraArg);
     // enemyProjectileManager.drawProjectiles(renderTexture, spriteBatch, cameraArg);
@@ -1512,7 +2231,8 @@ std::optional<uint32_t> Game::initialiseStructureOrGet(PlanetType planetType, Ch
     // Initialise
     if (structureID == 0xFFFFFFFF)
     {
-        structureID = getStructureRoomPool(planetType).createRoom(structureData.roomType, getChestDataPool(LocationState::createFromPlanetType(planetType)));
+        structureID = getStructureRoomPool(planetType).createRoom(structureData.roomType, getChestDataPool(LocationState::createFromPlanetType(planetType)),
+            getChunkManager(planetType).getRandomStream(RandomStreamType::Room));
         enteredStructure->setStructureID(structureID);
     }
 
@@ -1803,6 +2523,13 @@ void Game::rocketFinishedDown(const LocationState& locationState, RocketObject&
         return;
     }
 
+    // Other planets may be reading player while updating
+    if (updatingPlanetsInParallel)
+    {
+        rocketExitPending = true;
+        return;
+    }
+
     exitRocket(locationState, &rocket);
 }
 
@@ -1955,7 +2682,7 @@ void Game::updateInRoom(float dt, Room& room, bool inStructure)
         if (!networkHandler.getIsLobbyHost())
         {
             getChunkManager().updateChunksObjects(*this, dt, networkHandler.isLobbyHostOrSolo() ? gameTime : 0);
-            getChunkManager().updateChunksEntities(dt, getProjectileManager(), *this, networkHandler.isClient());
+            getChunkManager().updateChunksEntities(dt, getProjectileManager(), *this, networkHandler.isClient(), {camera.getChunkViewRange()});
         }
             
         weatherSystem.update(dt, gameTime, camera, getChunkManager());
@@ -1972,16 +2699,20 @@ void Game::drawInRoom(float dt, const Room& room)
     // const Room& structureRoom = structureRoomPool.getRoom(structureEnteredID);
     room.draw(window, camera);
 
-    std::vector<const WorldObject*> worldObjects = room.getObjects();
-    std::vector<WorldObject*> playerWorldObjects = player.getDrawWorldObjects(camera, 0, gameTime);
-    worldObjects.push_back(&player);
-    worldObjects.insert(worldObjects.end(), playerWorldObjects.begin(), playerWorldObjects.end());
+    // Reuse visible object buffer, as room objects are cached in room
+    std::vector<WorldObject*>& worldObjects = visibleWorldObjects;
+    worldObjects.clear();
+
+    const std::vector<WorldObject*>& roomObjects = room.getDrawableObjects();
+    worldObjects.insert(worldObjects.end(), roomObjects.begin(), roomObjects.end());
+
+    // Includes player
+    player.getDrawWorldObjects(camera, 0, gameTime, worldObjects);
 
     // Add network players
     if (networkHandler.isMultiplayerGame())
     {
-        std::vector<WorldObject*> networkPlayerObjects = networkHandler.getNetworkPlayersToDraw(camera, locationState, player.getPosition(), gameTime);
-        worldObjects.insert(worldObjects.end(), networkPlayerObjects.begin(), networkPlayerObjects.end());
+        networkHandler.getNetworkPlayersToDraw(camera, locationState, player.getPosition(), gameTime, worldObjects);
     }
 
     std::sort(worldObjects.begin(), worldObjects.end(), [](const WorldObject* a, const WorldObject* b)
@@ -2335,14 +3066,11 @@ void Game::buildObject(ChunkPosition chunk, pl::Vector2<int> tile, ObjectType ob
     
     placedObject->createHitParticles(particleSystem, LocationState::createFromPlanetType(planetType.value()));
     
-    // Play build sound if object in view
-    if (camera.isInView(placedObject->getPosition(), getChunkManager().getWorldSize()))
-    {
-        int soundChance = rand() % 2;
-        SoundType buildSound = SoundType::CraftBuild1;
-        if (soundChance == 1) buildSound = SoundType::CraftBuild2;
-        Sounds::playSound(buildSound, 60.0f);
-    }
+    // Play build sound, attenuated by distance from player
+    int soundChance = Helper::randInt(0, 1);
+    SoundType buildSound = SoundType::CraftBuild1;
+    if (soundChance == 1) buildSound = SoundType::CraftBuild2;
+    Sounds::playSoundAt(buildSound, placedObject->getPosition(), 60.0f);
 }
 
 void Game::destroyObjectFromHost(ChunkPosition chunk, pl::Vector2<int> tile, std::optional<PlanetType> planetType)
@@ -2355,7 +3083,8 @@ void Game::destroyObjectFromHost(ChunkPosition chunk, pl::Vector2<int> tile, std
     getChunkManager(planetType).deleteObject(chunk, tile, *this);
 }
 
-void Game::testMeleeCollision(const LocationState& locationState, const std::vector<HitRect>& hitRects, pl::Vector2f hitOrigin)
+void Game::testMeleeCollision(const LocationState& locationState, const std::vector<HitRect>& hitRects, pl::Vector2f hitOrigin,
+    std::optional<uint32_t> viewNetworkTick)
 {
     if (!isLocationStateInitialised(locationState) || !locationState.isOnPlanet())
     {
@@ -2369,14 +3098,22 @@ void Game::testMeleeCollision(const LocationState& locationState, const std::vec
         packetData.planetType = locationState.getPlanetType();
         packetData.hitRects = hitRects;
         packetData.hitOrigin = hitOrigin;
+        packetData.viewNetworkTick = networkHandler.getViewNetworkTick();
 
         Packet packet(packetData);
         networkHandler.sendPacketToHost(packet, k_nSteamNetworkingSend_Reliable, 0);
         return;
     }
     
-    getChunkManager(locationState.getPlanetType()).testChunkEntityHitCollision(hitRects, hitOrigin, *this, gameTime);
-    getBossManager(locationState.getPlanetType()).testHitRectCollision(hitRects, getChunkManager(locationState.getPlanetType()).getWorldSize());
+    // Test against positions client was viewing if requested from client
+    const HitboxSnapshot* rewindSnapshot = nullptr;
+    if (viewNetworkTick.has_value())
+    {
+        rewindSnapshot = getHitboxHistory(locationState.getPlanetType()).getRewindSnapshot(viewNetworkTick.value(), networkHandler.getNetworkTick());
+    }
+    
+    getChunkManager(locationState.getPlanetType()).testChunkEntityHitCollision(hitRects, hitOrigin, *this, gameTime, rewindSnapshot);
+    getBossManager(locationState.getPlanetType()).testHitRectCollision(hitRects, getChunkManager(locationState.getPlanetType()).getWorldSize(), rewindSnapshot);
 }
 
 void Game::catchRandomFish(pl::Vector2<int> fishedTile)
@@ -2388,24 +3125,23 @@ void Game::catchRandomFish(pl::Vector2<int> fishedTile)
         return;
     
     // Randomise catch
-    float randomChance = Helper::randInt(0, 10000) / 10000.0f;
-    float cumulativeChance = 0.0f;
-    for (const FishCatchData& fishCatchData : biomeGenData->fishCatchDatas)
-    {
-        cumulativeChance += fishCatchData.chance;
-        
-        if (cumulativeChance >= randomChance)
-        {
-            // Create fish item pickup
-            pl::Vector2f spawnPos = player.getPosition() + pl::Vector2f(
-                Helper::randFloat(-TILE_SIZE_PIXELS_UNSCALED / 2.0f, TILE_SIZE_PIXELS_UNSCALED / 2.0f),
-                Helper::randFloat(-TILE_SIZE_PIXELS_UNSCALED / 2.0f, TILE_SIZE_PIXELS_UNSCALED / 2.0f)
-            );
+    RandomStream& randomStream = getChunkManager().getRandomStream(RandomStreamType::Fishing);
 
-            getChunkManager().addItemPickup(ItemPickup(spawnPos, fishCatchData.itemCatch, gameTime, fishCatchData.count), &networkHandler);
-            break;
-        }
-    }
+    float randomChance = randomStream.randInt(0, 10000) / 10000.0f;
+    std::optional<int> fishCatchIndex = biomeGenData->fishCatchSpawnTable.sample(randomChance);
+
+    if (!fishCatchIndex.has_value())
+        return;
+
+    const FishCatchData& fishCatchData = biomeGenData->fishCatchDatas[fishCatchIndex.value()];
+
+    // Create fish item pickup
+    pl::Vector2f spawnPos = player.getPosition() + pl::Vector2f(
+        randomStream.randFloat(-TILE_SIZE_PIXELS_UNSCALED / 2.0f, TILE_SIZE_PIXELS_UNSCALED / 2.0f),
+        randomStream.randFloat(-TILE_SIZE_PIXELS_UNSCALED / 2.0f, TILE_SIZE_PIXELS_UNSCALED / 2.0f)
+    );
+
+    getChunkManager().addItemPickup(ItemPickup(spawnPos, fishCatchData.itemCatch, gameTime, fishCatchData.count), &networkHandler);
 }
 
 void Game::attemptObjectInteract()
@@ -2497,7 +3233,7 @@ void Game::attemptPlaceLand()
     getChunkManager().placeLand(Cursor::getSelectedChunk(getChunkManager().getWorldSize()), Cursor::getSelectedChunkTile(), &networkHandler);
 
     // Play build sound
-    int soundChance = rand() % 2;
+    int soundChance = Helper::randInt(0, 1);
     SoundType buildSound = SoundType::CraftBuild1;
     if (soundChance == 1) buildSound = SoundType::CraftBuild2;
 
@@ -3302,7 +4038,9 @@ std::optional<ObjectReference> Game::setupPlanetTravel(PlanetType planetType, co
         for (auto iter = playerChunkViewRange.begin(); iter != playerChunkViewRange.end(); iter++)
         {
             ChunkPosition chunkPos = iter.get(getChunkManager(planetType).getWorldSize());
-            packetData.chunkDatas.chunkDatas.push_back(getChunkManager(planetType).getChunkDataAndGenerate(chunkPos, *this));
+            Chunk* chunkPtr = getChunkManager(planetType).getChunkAndGenerate(chunkPos, *this);
+            const ChunkStreamer::EncodedChunkData& encodedChunkData = networkHandler.getChunkStreamer().getEncodedChunkData(planetType, *chunkPtr);
+            packetData.chunkDatas.encodedChunkDatas.emplace_back(encodedChunkData.begin(), encodedChunkData.end());
         }
 
         Log::push("PLANET TRAVEL: Sending planet travel data to client for planet type " + std::to_string(planetType) + "\n");
@@ -3712,6 +4450,8 @@ void Game::startNewGame(int seed)
     dayCycleManager.setCurrentTime(dayCycleManager.getDayLength() * 0.5f);
     dayCycleManager.setCurrentDay(1);
 
+    commandConsole.loadPermissionLevelsSave({});
+
     gameTime = 0.0f;
     screenFadeProgress = 0.0f;
     awaitingRespawn = false;
@@ -3762,6 +4502,8 @@ bool Game::saveGame()
 
     playerGameSave.networkPlayerDatas = networkHandler.getSavedNetworkPlayerDataMap();
 
+    playerGameSave.permissionLevels = commandConsole.getPermissionLevelsSave();
+
     // Keep track of which planets / room dests require saving
     std::unordered_set<PlanetType> activePlanets = networkHandler.getPlayersPlanetTypeSet(locationState.getPlanetType());
     std::unordered_set<RoomType> activeRoomDests = networkHandler.getPlayersRoomDestTypeSet(locationState.getRoomDestType());
@@ -3817,6 +4559,12 @@ bool Game::saveGame()
 
 bool Game::loadGame(const SaveFileSummary& saveFileSummary)
 {
+    // Record from save as loaded, before any state is changed
+    if (replayRecordingEnabled)
+    {
+        prepareReplayRecording(saveFileSummary.name);
+    }
+
     GameSaveIO io(saveFileSummary.name);
 
     PlayerGameSave playerGameSave;
@@ -3824,6 +4572,7 @@ bool Game::loadGame(const SaveFileSummary& saveFileSummary)
     if (!io.loadPlayerSave(playerGameSave))
     {
         Log::push("Failed to load player " + saveFileSummary.name + "\n");
+        pendingReplayRecording = std::nullopt;
         return false;
     }
 
@@ -3877,6 +4626,8 @@ bool Game::loadGame(const SaveFileSummary& saveFileSummary)
         networkHandler.setSavedNetworkPlayerData(iter->first, iter->second);
     }
 
+    commandConsole.loadPermissionLevelsSave(playerGameSave.permissionLevels);
+
     currentSaveFileSummary = saveFileSummary;
     currentSaveFileSummary.playerName = playerGameSave.playerData.name;
 
@@ -3937,6 +4688,11 @@ bool Game::loadGame(const SaveFileSummary& saveFileSummary)
     // Fade out previous music
     Sounds::stopMusic(0.3f);
 
+    if (pendingReplayRecording.has_value())
+    {
+        pendingReplayRecording->loadStateHash = getReplayStateHash(true);
+    }
+
     return true;
 }
 
@@ -3991,7 +4747,8 @@ bool Game::loadRoomDest(RoomType roomType)
     else
     {
         getChestDataPool(LocationState::createFromRoomDestType(roomType)) = ChestDataPool();
-        getRoomDestination(roomType) = Room(roomType, &getChestDataPool(LocationState::createFromRoomDestType(roomType)));
+        RandomStream roomRandomStream = RandomStreams::createStream(planetSeed, RandomStreamType::Room, roomType);
+        getRoomDestination(roomType) = Room(roomType, &getChestDataPool(LocationState::createFromRoomDestType(roomType)), &roomRandomStream);
     }
 
     return true;
@@ -4184,6 +4941,8 @@ void Game::quitWorld()
         saveGame();
     }
 
+    replayRecorder.end();
+
     if (networkHandler.isMultiplayerGame())
     {
         clientEnsureSafeQuit();
@@ -4286,17 +5045,8 @@ void Game::joinWorld(const PacketDataJoinInfo& joinInfo)
     startChangeStateTransition(nextGameState);
 }
 
-void Game::handleChunkRequestsFromClient(const PacketDataChunkRequests& chunkRequests, const SteamNetworkingIdentity& client)
+void Game::handleChunkRequestsFromClient(const PacketDataChunkRequests& chunkRequests, uint64_t clientID)
 {
-    PacketDataChunkDatas packetChunkDatas;
-
-    const char* steamName = SteamFriends()->GetFriendPersonaName(client.GetSteamID());
-    
-    int minChunkX = 9999999;
-    int minChunkY = 9999999;
-    int maxChunkX = -9999999;
-    int maxChunkY = -9999999;
-
     // Get planet type for client
     if (chunkRequests.planetType < 0)
     {
@@ -4309,27 +5059,8 @@ void Game::handleChunkRequestsFromClient(const PacketDataChunkRequests& chunkReq
         return;
     }
 
-    packetChunkDatas.planetType = chunkRequests.planetType;
-
-    for (ChunkPosition chunk : chunkRequests.chunkRequests)
-    {
-        packetChunkDatas.chunkDatas.push_back(getChunkManager(chunkRequests.planetType).getChunkDataAndGenerate(chunk, *this));
-        minChunkX = std::min((int)chunk.x, minChunkX);
-        minChunkY = std::min((int)chunk.y, minChunkY);
-        maxChunkX = std::max((int)chunk.x, maxChunkX);
-        maxChunkY = std::max((int)chunk.y, maxChunkY);
-    }
-
-    const PlanetGenData& planetData = PlanetGenDataLoader::getPlanetGenData(chunkRequests.planetType);
-
-    Packet packet;
-    packet.set(packetChunkDatas, true);
-    
-    Log::push("NETWORK: (\"" + planetData.name + "\") Sending " + std::to_string(chunkRequests.chunkRequests.size()) + " chunks in range (" + std::to_string(minChunkX) +
-        ", " + std::to_string(minChunkY) + ") to (" + std::to_string(maxChunkX) + ", " + std::to_string(maxChunkY) + ") to " + steamName + " " + packet.getSizeStr() +
-        "\n");
-
-    networkHandler.sendPacketToClient(client.GetSteamID64(), packet, k_nSteamNetworkingSend_Reliable, 0);
+    // Chunks are generated and sent over following frames, closest to client first
+    networkHandler.getChunkStreamer().queueChunkRequests(clientID, chunkRequests);
 }
 
 void Game::handleChunkDataFromHost(const PacketDataChunkDatas& chunkDataPacket)
@@ -4351,6 +5082,23 @@ void Game::handleChunkDataFromHost(const PacketDataChunkDatas& chunkDataPacket)
     lightingTickTime = LIGHTING_TICK_TIME;
 }
 
+void Game::handleChunkEditsFromHost(const PacketDataChunkEdits& chunkEditsPacket)
+{
+    for (const auto& chunkEdits : chunkEditsPacket.chunkEdits)
+    {
+        // Chunk no longer held, request full chunk when next in view
+        if (!getChunkManager().setChunkEdits(chunkEdits, *this))
+        {
+            continue;
+        }
+
+        Log::push("NETWORK: Received {} object edits for chunk ({}, {}) from host\n", chunkEdits.objectEdits.size(),
+            chunkEdits.chunkPosition.x, chunkEdits.chunkPosition.y);
+    }
+
+    lightingTickTime = LIGHTING_TICK_TIME;
+}
+
 void Game::joinedLobby(bool requiresNameInput)
 {
     if (gameState != GameState::MainMenu)
@@ -4369,6 +5117,59 @@ void Game::joinedLobby(bool requiresNameInput)
     }
 }
 
+uint64_t Game::getLocalPlayerID() const
+{
+    return steamInitialised ? SteamUser()->GetSteamID().ConvertToUint64() : 0;
+}
+
+void Game::executeChatCommand(uint64_t issuerID, const std::string& message)
+{
+    if (!networkHandler.isLobbyHostOrSolo())
+    {
+        return;
+    }
+
+    PacketDataChatMessage reply;
+    reply.userId = std::nullopt;
+
+    if (issuerID == getLocalPlayerID())
+    {
+        reply.message = commandConsole.executeAsAdmin(*this, issuerID, message).reply;
+        chatGUI.addChatMessage(networkHandler, reply);
+        return;
+    }
+
+    reply.message = commandConsole.execute(*this, issuerID, message).reply;
+
+    Packet packet;
+    packet.set(reply);
+    networkHandler.sendPacketToClient(issuerID, packet, k_nSteamNetworkingSend_Reliable, 0);
+}
+
+void Game::teleportPlayer(uint64_t playerID, pl::Vector2f position)
+{
+    if (playerID == getLocalPlayerID())
+    {
+        teleportLocalPlayer(position);
+        return;
+    }
+
+    PacketDataPlayerTeleport packetData;
+    packetData.positionX = position.x;
+    packetData.positionY = position.y;
+
+    Packet packet;
+    packet.set(packetData);
+    networkHandler.sendPacketToClient(playerID, packet, k_nSteamNetworkingSend_Reliable, 0);
+}
+
+void Game::teleportLocalPlayer(pl::Vector2f position)
+{
+    int worldSize = locationState.isOnPlanet() ? getChunkManager().getWorldSize() : 0;
+    player.setPosition(position, worldSize);
+    camera.instantUpdate(player.getPosition());
+}
+
 
 // -- Window -- //
 
@@ -4544,6 +5345,18 @@ BossManager& Game::getBossManager(std::optional<PlanetType> planetTypeOverride)
     return worldDatas.at(locationState.getPlanetType()).bossManager;
 }
 
+HitboxHistory& Game::getHitboxHistory(std::optional<PlanetType> planetTypeOverride)
+{
+    if (planetTypeOverride.has_value())
+    {
+        if (planetTypeOverride.value() >= 0)
+        {
+            return worldDatas.at(planetTypeOverride.value()).hitboxHistory;
+        }
+    }
+    return worldDatas.at(locationState.getPlanetType()).hitboxHistory;
+}
+
 LandmarkManager& Game::getLandmarkManager(std::optional<PlanetType> planetTypeOverride)
 {
     if (planetTypeOverride.has_value())
@@ -4630,8 +5443,8 @@ bool Game::isLocationStateInitialised(const LocationState& locationState)
 void Game::generateWaterNoiseTexture()
 {
     // Create noise generators for water texture
-    FastNoise waterNoise(rand());
-    FastNoise waterNoiseTwo(rand());
+    FastNoise waterNoise(Helper::getRandom().next() >> 1);
+    FastNoise waterNoiseTwo(Helper::getRandom().next() >> 1);
 
     // Initialise noise values
     waterNoise.SetNoiseType(FastNoise::NoiseType::SimplexFractal);
@@ -4704,12 +5517,12 @@ void Game::updateMusic(float dt)
     
     // Play new music as music gap has ended
     static constexpr std::array<MusicType, 2> musicTypes = {MusicType::WorldTheme, MusicType::WorldTheme2};
-    int musicTypeChance = rand() % musicTypes.size();
+    int musicTypeChance = Helper::randInt(0, musicTypes.size() - 1);
 
     Sounds::playMusic(musicTypes[musicTypeChance], 70.0f);
 
     musicGapTimer = 0.0f;
-    musicGap = MUSIC_GAP_MIN + rand() % 5;
+    musicGap = MUSIC_GAP_MIN + Helper::randInt(0, 4);
 }
 
 void Game::drawMouseCursor()
@@ -4873,10 +5686,8 @@ void Game::drawControllerGlyphs(const std::vector<std::pair<InputAction, std::st
 
 std::string Game::getGameDataHash() const
 {
-    return (hashpp::get::getHash(hashpp::ALGORITHMS::MD5, GAME_VERSION).getString() + TextureManager::getTextureHash() +
-        ItemDataLoader::getDataHash() + ToolDataLoader::getDataHash() + ArmourDataLoader::getDataHash() +
-        EntityDataLoader::getDataHash() + ObjectDataLoader::getDataHash() + RecipeDataLoader::getDataHash() +
-        StructureDataLoader::getDataHash() + PlanetGenDataLoader::getDataHash());
+    // Game data hash already includes game version
+    return (GameDataCache::getDataHash() + TextureManager::getTextureHash());
 }
 
 #if (!RELEASE_BUILD)
@@ -4933,6 +5744,270 @@ void Game::drawDebugMenu(float dt)
 
     ImGui::Spacing();
 
+    if (gameState == GameState::OnPlanet)
+    {
+        const ChunkDrawStats& chunkDrawStats = getChunkManager().getDrawStats();
+
+        ImGui::Text("Chunk Drawing");
+        ImGui::Text(("Terrain: " + std::to_string(chunkDrawStats.terrainDrawCalls) + " draw calls, " +
+            std::to_string(chunkDrawStats.terrainVertices) + " vertices").c_str());
+        ImGui::Text(("Terrain rebuilds: " + std::to_string(chunkDrawStats.terrainRebuilds) + " full, " +
+            std::to_string(chunkDrawStats.terrainChunkRebuilds) + " chunk (" + std::to_string(chunkDrawStats.terrainVerticesRebuilt) + " vertices)").c_str());
+        ImGui::Text(("Water: " + std::to_string(chunkDrawStats.waterDrawCalls) + " draw calls, " +
+            std::to_string(chunkDrawStats.waterRebuilds) + " rebuilds").c_str());
+        ImGui::Text(("Visible objects: " + std::to_string(visibleObjectStats.objectCount) + " (" +
+            std::to_string(visibleObjectStats.chunkListRebuilds) + " chunk list rebuilds, " +
+            std::to_string(visibleObjectStats.allocations) + " allocations)").c_str());
+
+        ImGui::Spacing();
+
+        const EntityUpdateStats& entityUpdateStats = getChunkManager().getEntityUpdateStats();
+
+        ImGui::Text("Entity Updates");
+        if (ImGui::BeginTable("Entity Updates", 3, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingFixedFit))
+        {
+            static constexpr std::array<const char*, ENTITY_UPDATE_TIER_COUNT> tierNames = {"Full", "Reduced", "Distant"};
+
+            ImGui::TableSetupColumn("Tier");
+            ImGui::TableSetupColumn("Entities");
+            ImGui::TableSetupColumn("Behaviour Updates");
+            ImGui::TableHeadersRow();
+
+            for (int i = 0; i < ENTITY_UPDATE_TIER_COUNT; i++)
+            {
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                ImGui::Text(tierNames[i]);
+                ImGui::TableNextColumn();
+                ImGui::Text(std::to_string(entityUpdateStats.entityCounts[i]).c_str());
+                ImGui::TableNextColumn();
+                ImGui::Text(std::to_string(entityUpdateStats.behaviourUpdates[i]).c_str());
+            }
+
+            ImGui::EndTable();
+        }
+        ImGui::Text(("Deferred by budget: " + std::to_string(entityUpdateStats.behaviourUpdatesDeferred)).c_str());
+
+        ImGui::Spacing();
+
+        ChunkColdStorage& coldStorage = getChunkManager().getColdStorage();
+        ChunkColdStorageStats coldStorageStats = coldStorage.getStats();
+
+        ImGui::Text("Chunk Storage");
+        ImGui::Text(("Loaded: " + std::to_string(getChunkManager().getLoadedChunkCount()) + ", stored: " +
+            std::to_string(getChunkManager().getStoredChunkCount())).c_str());
+        ImGui::Text(("Cold: " + std::to_string(coldStorageStats.chunkCount - coldStorageStats.spilledChunkCount) + " (" +
+            Helper::floatToString(coldStorageStats.memoryBytes / 1000.0f, 1) + "kb, " +
+            Helper::floatToString(coldStorageStats.uncompressedBytes / 1000.0f, 1) + "kb uncompressed)").c_str());
+        ImGui::Text(("Spilled: " + std::to_string(coldStorageStats.spilledChunkCount) + " (" +
+            Helper::floatToString(coldStorageStats.spilledBytes / 1000.0f, 1) + "kb, " +
+            Helper::floatToString(coldStorageStats.spillFileBytes / 1000.0f, 1) + "kb file)").c_str());
+        ImGui::Text((std::to_string(coldStorageStats.chunksStored) + " chunks compressed, " +
+            std::to_string(coldStorageStats.chunksRehydrated) + " rehydrated").c_str());
+
+        bool spillEnabled = coldStorage.isSpillEnabled();
+        if (ImGui::Checkbox("Spill Cold Chunks To File", &spillEnabled))
+        {
+            coldStorage.setSpillEnabled(spillEnabled);
+        }
+
+        ImGui::Spacing();
+    }
+
+    ImGui::Text(("Particles: " + std::to_string(particleSystem.getParticleCount()) + ", weather particles: " +
+        std::to_string(weatherSystem.getParticleCount())).c_str());
+
+    ImGui::Spacing();
+
+    const SoundMixerStats& soundMixerStats = Sounds::getMixer().getStats();
+
+    ImGui::Text("Sound Mixer");
+    ImGui::Text(("Active voices: " + std::to_string(Sounds::getMixer().getActiveVoices().size())).c_str());
+    ImGui::Text((std::to_string(soundMixerStats.voicesPlayed) + " played, " + std::to_string(soundMixerStats.voicesMerged) + " merged, " +
+        std::to_string(soundMixerStats.voicesCulled) + " culled, " + std::to_string(soundMixerStats.voicesStolen) + " stolen, " +
+        std::to_string(soundMixerStats.voicesRejected) + " rejected").c_str());
+    ImGui::Text((std::to_string(soundMixerStats.voicesStolenStillPlaying) + " stolen voices still playing").c_str());
+
+    if (ImGui::Button("Reset Sound Stats"))
+    {
+        Sounds::getMixer().resetStats();
+    }
+
+    ImGui::Spacing();
+
+    ImGui::Text("Memory");
+    measureContainerMemory();
+    if (ImGui::BeginTable("Memory", 5, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingFixedFit))
+    {
+        ImGui::TableSetupColumn("Category");
+        ImGui::TableSetupColumn("Live KB");
+        ImGui::TableSetupColumn("Count");
+        ImGui::TableSetupColumn("Peak KB");
+        ImGui::TableSetupColumn("Measured KB");
+        ImGui::TableHeadersRow();
+
+        for (int i = 0; i < MEMORY_CATEGORY_COUNT; i++)
+        {
+            MemoryCategoryStats memoryStats = MemoryTracker::getStats(static_cast<MemoryCategory>(i));
+
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            ImGui::Text(getMemoryCategoryName(static_cast<MemoryCategory>(i)));
+            ImGui::TableNextColumn();
+            ImGui::Text(Helper::floatToString(memoryStats.liveBytes / 1024.0f, 1).c_str());
+            ImGui::TableNextColumn();
+            ImGui::Text(std::to_string(memoryStats.liveCount).c_str());
+            ImGui::TableNextColumn();
+            ImGui::Text(Helper::floatToString(memoryStats.highWaterBytes / 1024.0f, 1).c_str());
+            ImGui::TableNextColumn();
+            ImGui::Text(Helper::floatToString(memoryStats.measuredBytes / 1024.0f, 1).c_str());
+        }
+
+        ImGui::EndTable();
+    }
+
+    if (ImGui::Button("Reset Memory Peaks"))
+    {
+        MemoryTracker::resetHighWaterMarks();
+    }
+
+    ImGui::SameLine();
+
+    if (ImGui::Button("Log Memory"))
+    {
+        MemoryTracker::logStats();
+    }
+
+    ImGui::Spacing();
+
+    if (networkHandler.getIsLobbyHost())
+    {
+        const ChunkStreamer& chunkStreamer = networkHandler.getChunkStreamer();
+        const ChunkStreamStats& chunkStreamStats = chunkStreamer.getStats();
+
+        ImGui::Text("Chunk Streaming");
+        ImGui::Text((std::to_string(chunkStreamer.getQueuedChunkCount()) + " chunks queued, " +
+            std::to_string(chunkStreamer.getCachedChunkCount()) + " encoded chunks cached").c_str());
+        ImGui::Text((std::to_string(chunkStreamStats.chunksSent) + " chunks sent (" + Helper::floatToString(chunkStreamStats.bytesSent / 1000.0f, 1) + "kb), " +
+            std::to_string(chunkStreamStats.chunksGenerated) + " generated").c_str());
+        ImGui::Text(("Encode cache: " + std::to_string(chunkStreamStats.encodeCacheHits) + " hits, " +
+            std::to_string(chunkStreamStats.encodeCacheMisses) + " misses").c_str());
+        ImGui::Text(("Resyncs: " + std::to_string(chunkStreamStats.chunksResyncedByEdits) + " by edits (" +
+            std::to_string(chunkStreamStats.objectEditsSent) + " objects), " + std::to_string(chunkStreamStats.chunksUpToDate) + " up to date").c_str());
+
+        ImGui::Checkbox("Parallel Planet Updates", &parallelPlanetUpdates);
+        ImGui::Text((std::to_string(planetWorkerPool.getWorkerCount()) + " planet update workers").c_str());
+
+        ImGui::Spacing();
+    }
+
+    if (networkHandler.isMultiplayerGame() && ImGui::CollapsingHeader("Network Telemetry"))
+    {
+        const NetworkTelemetry& telemetry = networkHandler.getTelemetry();
+
+        if (ImGui::Button("Export CSV"))
+        {
+            telemetry.exportCSV(NetworkTelemetry::getDefaultCSVPath());
+        }
+
+        ImGui::Text(("Counts over last " + Helper::floatToString(telemetry.getWindowLength(), 0) + "s").c_str());
+
+        for (uint64_t peerID : telemetry.getPeerIDs())
+        {
+            std::string peerName = networkHandler.getPlayerName(peerID);
+            ImGui::Text((peerName.empty() ? std::to_string(peerID) : peerName).c_str());
+
+            PeerPacketCounters windowCounters = telemetry.getWindowCounters(peerID);
+
+            // Packet types sorted by most bytes sent
+            std::vector<std::pair<uint64_t, PacketType>> packetTypes;
+            for (const auto& [packetType, counters] : windowCounters.sent)
+            {
+                packetTypes.push_back({counters.compressedBytes, packetType});
+            }
+            for (const auto& [packetType, counters] : windowCounters.received)
+            {
+                if (!windowCounters.sent.contains(packetType))
+                {
+                    packetTypes.push_back({0, packetType});
+                }
+            }
+
+            std::sort(packetTypes.begin(), packetTypes.end(), std::greater<>());
+
+            if (ImGui::BeginTable(("Telemetry##" + std::to_string(peerID)).c_str(), 7, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingFixedFit))
+            {
+                ImGui::TableSetupColumn("Packet Type");
+                ImGui::TableSetupColumn("Sent");
+                ImGui::TableSetupColumn("Sent KB");
+                ImGui::TableSetupColumn("Compression");
+                ImGui::TableSetupColumn("Reliable / Unreliable");
+                ImGui::TableSetupColumn("Received");
+                ImGui::TableSetupColumn("Received KB");
+                ImGui::TableHeadersRow();
+
+                for (const auto& packetTypePair : packetTypes)
+                {
+                    PacketType packetType = packetTypePair.second;
+                    PacketTypeCounters sent = windowCounters.sent.contains(packetType) ? windowCounters.sent.at(packetType) : PacketTypeCounters();
+                    PacketTypeCounters received = windowCounters.received.contains(packetType) ? windowCounters.received.at(packetType) : PacketTypeCounters();
+
+                    float compression = (sent.rawBytes > 0) ? static_cast<float>(sent.compressedBytes) / sent.rawBytes : 1.0f;
+
+                    ImGui::TableNextRow();
+                    ImGui::TableNextColumn();
+                    ImGui::Text(getPacketTypeName(packetType));
+                    ImGui::TableNextColumn();
+                    ImGui::Text(std::to_string(sent.messages).c_str());
+                    ImGui::TableNextColumn();
+                    ImGui::Text(Helper::floatToString(sent.compressedBytes / 1000.0f, 1).c_str());
+                    ImGui::TableNextColumn();
+                    ImGui::Text((Helper::floatToString(compression * 100.0f, 0) + "%").c_str());
+                    ImGui::TableNextColumn();
+                    ImGui::Text((std::to_string(sent.reliableSends) + " / " + std::to_string(sent.unreliableSends)).c_str());
+                    ImGui::TableNextColumn();
+                    ImGui::Text(std::to_string(received.messages).c_str());
+                    ImGui::TableNextColumn();
+                    ImGui::Text(Helper::floatToString(received.compressedBytes / 1000.0f, 1).c_str());
+                }
+
+                ImGui::EndTable();
+            }
+
+            const PeerSendQueueStats* sendQueueStats = telemetry.getSendQueueStats(peerID);
+            if (sendQueueStats && sendQueueStats->sampleCount > 0)
+            {
+                ImGui::Text(("Send queue: " + std::to_string(sendQueueStats->pendingBytes) + " bytes, " +
+                    Helper::floatToString(sendQueueStats->queueTimeMs, 1) + "ms queued, " + std::to_string(sendQueueStats->ping) + "ms ping").c_str());
+
+                std::string binNames;
+                for (int i = 0; i < PeerSendQueueStats::HISTOGRAM_BIN_COUNT; i++)
+                {
+                    binNames += std::string(i > 0 ? " | " : "") + PeerSendQueueStats::getHistogramBinName(i);
+                }
+
+                std::array<float, PeerSendQueueStats::HISTOGRAM_BIN_COUNT> histogram = sendQueueStats->getHistogram();
+                ImGui::PlotHistogram(("Send Queue Depth##" + std::to_string(peerID)).c_str(), histogram.data(), histogram.size(), 0, binNames.c_str(),
+                    0.0f, PeerSendQueueStats::SAMPLE_COUNT, ImVec2(0, 60));
+            }
+
+            ImGui::Spacing();
+        }
+    }
+
+    ImGui::Text("Replay");
+    ImGui::Checkbox("Record Replay On Load", &replayRecordingEnabled);
+    if (replayRecorder.isRecording())
+    {
+        ImGui::Text(("Recording, " + std::to_string(replayRecorder.getFrameCount()) + " frames").c_str());
+        if (ImGui::Button("Stop Recording"))
+        {
+            replayRecorder.end();
+        }
+    }
+
+    ImGui::Spacing();
+
     ImGui::Text("Visible Tiles");
 
     for (auto iter = DebugOptions::tileMapsVisible.begin(); iter != DebugOptions::tileMapsVisible.end(); iter++)
@@ -1,6 +1,9 @@
 #include "IO/GameSaveIO.hpp"
 #include "IO/Log.hpp"
 
+#include <chrono>
+#include <iterator>
+
 GameSaveIO::GameSaveIO(std::string fileName)
 {
     this->fileName = fileName;
@@ -8,16 +11,20 @@ GameSaveIO::GameSaveIO(std::string fileName)
 
 bool GameSaveIO::loadPlayerSave(PlayerGameSave& playerGameSave)
 {
-    createSaveDirectoryIfRequired();
+    // Save directory set directly is only read from, e.g. by savetool list / stats / verify, so is left untouched
+    if (saveDirectoryOverride.empty())
+    {
+        createSaveDirectoryIfRequired();
+    }
 
-    std::filesystem::path dir(getRootDir() + "Saves/" + fileName + "/");
+    std::filesystem::path dir(getSaveDir());
 
     if (!std::filesystem::exists(dir))
     {
         return false;
     }
 
-    std::fstream in(getRootDir() + "Saves/" + fileName + "/Player.dat", std::ios::in);
+    std::fstream in(getSaveDir() + "Player.dat", std::ios::in);
 
     if (!in)
     {
@@ -38,6 +45,11 @@ bool GameSaveIO::loadPlayerSave(PlayerGameSave& playerGameSave)
         {
             playerGameSave.timePlayed = json.at("time-played");
         }
+
+        if (json.contains("permission-levels"))
+        {
+            playerGameSave.permissionLevels = json.at("permission-levels");
+        }
     }
     catch(const std::exception& e)
     {
@@ -48,27 +60,48 @@ bool GameSaveIO::loadPlayerSave(PlayerGameSave& playerGameSave)
     return true;   
 }
 
-bool GameSaveIO::loadPlanetSave(PlanetType planetType, PlanetGameSave& planetGameSave)
+bool GameSaveIO::readPlanetSaveData(PlanetType planetType, std::vector<char>& planetSaveData)
 {
     try
     {
         const std::string& planetName = PlanetGenDataLoader::getPlanetGenData(planetType).name;
 
-        std::fstream in(getRootDir() + "Saves/" + fileName + "/Planets/" + planetName + ".dat", std::ios::in | std::ios::binary);
+        std::fstream in(getSaveDir() + "Planets/" + planetName + ".dat", std::ios::in | std::ios::binary);
         
         if (!in)
         {
             return false;
         }
 
-        // Read and decompress
         CompressedData compressedData;
         {
             cereal::BinaryInputArchive archive(in);
             archive(compressedData);
         }
 
-        std::vector<char> decompressedData = compressedData.decompress();
+        planetSaveData = compressedData.decompress();
+
+        return true;
+    }
+    catch(const std::exception& e)
+    {
+        std::cerr << e.what() << '\n';
+        return false;
+    }
+
+    return false;
+}
+
+bool GameSaveIO::loadPlanetSave(PlanetType planetType, PlanetGameSave& planetGameSave)
+{
+    try
+    {
+        // Read and decompress
+        std::vector<char> decompressedData;
+        if (!readPlanetSaveData(planetType, decompressedData))
+        {
+            return false;
+        }
 
         // Deserialise decompressed data
         std::stringstream stream(std::string(decompressedData.begin(), decompressedData.end()));
@@ -94,7 +127,7 @@ bool GameSaveIO::loadRoomDestinationSave(RoomType roomDestinationType, RoomDesti
     {
         const std::string& roomDestinationName = StructureDataLoader::getRoomData(roomDestinationType).name;
 
-        std::fstream in(getRootDir() + "Saves/" + fileName + "/Rooms/" + roomDestinationName + ".dat", std::ios::in | std::ios::binary);
+        std::fstream in(getSaveDir() + "Rooms/" + roomDestinationName + ".dat", std::ios::in | std::ios::binary);
         
         if (!in)
         {
@@ -120,7 +153,7 @@ bool GameSaveIO::writePlayerSave(const PlayerGameSave& playerGameSave)
 {
     createSaveDirectoryIfRequired();
 
-    std::fstream out(getRootDir() + "Saves/" + fileName + "/Player.dat", std::ios::out);
+    std::fstream out(getSaveDir() + "Player.dat", std::ios::out);
 
     if (!out)
     {
@@ -137,6 +170,7 @@ bool GameSaveIO::writePlayerSave(const PlayerGameSave& playerGameSave)
         json["time"] = playerGameSave.time;
         json["day"] = playerGameSave.day;
         json["time-played"] = playerGameSave.timePlayed;
+        json["permission-levels"] = playerGameSave.permissionLevels;
 
         out << json;
         out.close();
@@ -159,8 +193,10 @@ bool GameSaveIO::writePlanetSave(PlanetType planetType, const PlanetGameSave& pl
     try
     {
         const std::string& planetName = PlanetGenDataLoader::getPlanetGenData(planetType).name;
+        std::string path = getSaveDir() + "Planets/" + planetName + ".dat";
 
-        std::fstream out(getRootDir() + "Saves/" + fileName + "/Planets/" + planetName + ".dat", std::ios::out | std::ios::binary);
+        // Written to temporary file and moved over save, so save is not lost if writing fails part way
+        std::fstream out(path + ".tmp", std::ios::out | std::ios::binary);
 
         // if (!out || !createAndWriteGameDataVersionMapping(getPlanetGameDataVersionMappingFileName(planetType)))
         if (!out)
@@ -180,10 +216,12 @@ bool GameSaveIO::writePlanetSave(PlanetType planetType, const PlanetGameSave& pl
         
         CompressedData compressedData(serialisedData);
 
-        cereal::BinaryOutputArchive archive(out);
-        archive(compressedData);
+        {
+            cereal::BinaryOutputArchive archive(out);
+            archive(compressedData);
+        }
 
-        return true;
+        return replaceFileWithTemporary(path, out);
     }
     catch(const std::exception& e)
     {
@@ -203,8 +241,9 @@ bool GameSaveIO::writeRoomDestinationSave(const RoomDestinationGameSave& roomDes
         RoomType roomDestinationType = roomDestinationGameSave.roomDestination.getRoomType();
 
         const std::string& roomDestinationName = StructureDataLoader::getRoomData(roomDestinationType).name;
+        std::string path = getSaveDir() + "Rooms/" + roomDestinationName + ".dat";
 
-        std::fstream out(getRootDir() + "Saves/" + fileName + "/Rooms/" + roomDestinationName + ".dat", std::ios::out | std::ios::binary);
+        std::fstream out(path + ".tmp", std::ios::out | std::ios::binary);
 
         // if (!out || !createAndWriteGameDataVersionMapping(getRoomDestinationGameDataVersionMappingFileName(roomDestinationType)))
         if (!out)
@@ -212,11 +251,12 @@ bool GameSaveIO::writeRoomDestinationSave(const RoomDestinationGameSave& roomDes
             throw std::invalid_argument("Could not open room \"" + roomDestinationName + "\" file for \"" + fileName + "\"");
         }
 
-        cereal::BinaryOutputArchive archive(out);
-
-        archive(roomDestinationGameSave);
+        {
+            cereal::BinaryOutputArchive archive(out);
+            archive(roomDestinationGameSave);
+        }
 
-        return true;
+        return replaceFileWithTemporary(path, out);
     }
     catch(const std::exception& e)
     {
@@ -243,7 +283,7 @@ bool GameSaveIO::attemptDeleteSave()
     try
     {
         std::error_code ec;
-        std::filesystem::permissions(getRootDir() + "Saves/" + fileName + "/",
+        std::filesystem::permissions(getSaveDir(),
             std::filesystem::perms::owner_all,
             std::filesystem::perm_options::add,
             ec);
@@ -251,12 +291,12 @@ bool GameSaveIO::attemptDeleteSave()
         {
             std::cerr << "Failed to modify permissions: " << ec.message() << '\n';
         }
-        std::filesystem::remove_all(getRootDir() + "Saves/" + fileName + "/", ec);
+        std::filesystem::remove_all(getSaveDir(), ec);
         if (ec)
         {
             std::cerr << ec.message() << '\n';
         }
-        std::filesystem::remove(getRootDir() + "Saves/" + fileName + "/");
+        std::filesystem::remove(getSaveDir());
         return true;
     }
     catch(const std::exception& e)
@@ -475,8 +515,274 @@ bool GameSaveIO::loadInputBindingsSave(InputBindingsSave& inputBindingsSave)
     return true;   
 }
 
+bool GameSaveIO::readSaveFiles(std::vector<std::pair<std::string, std::vector<char>>>& saveFiles)
+{
+    try
+    {
+        std::filesystem::path dir(getSaveDir());
+
+        if (!std::filesystem::exists(dir))
+        {
+            return false;
+        }
+
+        for (const auto& entry : std::filesystem::recursive_directory_iterator(dir))
+        {
+            if (!entry.is_regular_file())
+            {
+                continue;
+            }
+
+            std::fstream in(entry.path(), std::ios::in | std::ios::binary);
+
+            if (!in)
+            {
+                throw std::invalid_argument("Could not open save file \"" + entry.path().string() + "\"");
+            }
+
+            std::vector<char> data((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+            saveFiles.push_back({std::filesystem::relative(entry.path(), dir).generic_string(), std::move(data)});
+        }
+    }
+    catch(const std::exception& e)
+    {
+        std::cerr << e.what() << '\n';
+        return false;
+    }
+
+    return true;
+}
+
+bool GameSaveIO::writeSaveFiles(const std::vector<std::pair<std::string, std::vector<char>>>& saveFiles)
+{
+    attemptDeleteSave();
+    createSaveDirectoryIfRequired();
+
+    try
+    {
+        for (const auto& [relativePath, data] : saveFiles)
+        {
+            std::filesystem::path path(getSaveDir() + relativePath);
+            std::filesystem::create_directories(path.parent_path());
+
+            std::fstream out(path, std::ios::out | std::ios::binary);
+
+            if (!out)
+            {
+                throw std::invalid_argument("Could not write save file \"" + path.string() + "\"");
+            }
+
+            out.write(data.data(), data.size());
+        }
+    }
+    catch(const std::exception& e)
+    {
+        std::cerr << e.what() << '\n';
+        return false;
+    }
+
+    return true;
+}
+
+bool GameSaveIO::writeReplayHeader(const ReplayRecording& replayRecording, std::string& path)
+{
+    createSaveDirectoryIfRequired();
+
+    try
+    {
+        std::filesystem::path dir(getRootDir() + "Replays/");
+        if (!std::filesystem::exists(dir))
+        {
+            std::filesystem::create_directory(dir);
+        }
+
+        uint64_t time = std::chrono::system_clock::now().time_since_epoch() / std::chrono::seconds(1);
+        path = getRootDir() + "Replays/" + fileName + "_" + std::to_string(time) + ".replay";
+
+        std::fstream out(path, std::ios::out | std::ios::binary);
+
+        if (!out)
+        {
+            throw std::invalid_argument("Could not open replay file \"" + path + "\"");
+        }
+
+        // Frames are appended in blocks during recording
+        ReplayRecording replayRecordingHeader = replayRecording;
+        replayRecordingHeader.frames.clear();
+
+        // Serialise and compress
+        std::stringstream outputStream;
+        {
+            cereal::BinaryOutputArchive archive(outputStream);
+            archive(replayRecordingHeader);
+        }
+
+        std::string outputStreamStr = outputStream.str();
+        std::vector<char> serialisedData(outputStreamStr.begin(), outputStreamStr.end());
+        
+        CompressedData compressedData(serialisedData);
+
+        cereal::BinaryOutputArchive archive(out);
+        archive(compressedData);
+
+        return true;
+    }
+    catch(const std::exception& e)
+    {
+        std::cerr << e.what() << '\n';
+        return false;
+    }
+
+    return false;
+}
+
+bool GameSaveIO::appendReplayFrames(const std::string& path, const std::vector<ReplayFrame>& frames)
+{
+    try
+    {
+        std::fstream out(path, std::ios::out | std::ios::binary | std::ios::app);
+
+        if (!out)
+        {
+            throw std::invalid_argument("Could not open replay file \"" + path + "\"");
+        }
+
+        std::stringstream outputStream;
+        {
+            cereal::BinaryOutputArchive archive(outputStream);
+            archive(frames);
+        }
+
+        std::string outputStreamStr = outputStream.str();
+        std::vector<char> serialisedData(outputStreamStr.begin(), outputStreamStr.end());
+
+        CompressedData compressedData(serialisedData);
+
+        cereal::BinaryOutputArchive archive(out);
+        archive(compressedData);
+
+        out.flush();
+
+        return static_cast<bool>(out);
+    }
+    catch(const std::exception& e)
+    {
+        std::cerr << e.what() << '\n';
+        return false;
+    }
+
+    return false;
+}
+
+bool GameSaveIO::loadReplay(const std::string& path, ReplayRecording& replayRecording)
+{
+    try
+    {
+        std::fstream in(path, std::ios::in | std::ios::binary);
+
+        if (!in)
+        {
+            throw std::invalid_argument("Could not open replay file \"" + path + "\"");
+        }
+
+        CompressedData compressedData;
+        {
+            cereal::BinaryInputArchive archive(in);
+            archive(compressedData);
+        }
+
+        std::vector<char> serialisedData = compressedData.decompress();
+
+        {
+            std::stringstream inputStream(std::string(serialisedData.begin(), serialisedData.end()));
+            cereal::BinaryInputArchive archive(inputStream);
+            archive(replayRecording);
+        }
+
+        // Frame blocks follow header, replays written in one block have frames in header instead
+        while (in.peek() != std::char_traits<char>::eof())
+        {
+            std::vector<ReplayFrame> frames;
+
+            // Last block may be incomplete if game closed while recording, so keep frames read so far
+            try
+            {
+                CompressedData compressedFrames;
+                {
+                    cereal::BinaryInputArchive archive(in);
+                    archive(compressedFrames);
+                }
+
+                std::vector<char> serialisedFrames = compressedFrames.decompress();
+
+                std::stringstream inputStream(std::string(serialisedFrames.begin(), serialisedFrames.end()));
+                cereal::BinaryInputArchive archive(inputStream);
+                archive(frames);
+            }
+            catch(const std::exception& e)
+            {
+                Log::push("REPLAY: Replay \"{}\" ends with incomplete frame block, loaded {} frames\n", path, replayRecording.frames.size());
+                break;
+            }
+
+            replayRecording.frames.insert(replayRecording.frames.end(), std::make_move_iterator(frames.begin()), std::make_move_iterator(frames.end()));
+        }
+
+        return true;
+    }
+    catch(const std::exception& e)
+    {
+        std::cerr << e.what() << '\n';
+        return false;
+    }
+
+    return false;
+}
+
+void GameSaveIO::setSaveDirectory(const std::string& directory)
+{
+    saveDirectoryOverride = directory;
+
+    if (!saveDirectoryOverride.empty() && saveDirectoryOverride.back() != '/' && saveDirectoryOverride.back() != '\\')
+    {
+        saveDirectoryOverride += "/";
+    }
+}
+
+bool GameSaveIO::replaceFileWithTemporary(const std::string& path, std::fstream& temporaryOut)
+{
+    temporaryOut.close();
+
+    std::error_code error;
+
+    if (temporaryOut.fail())
+    {
+        std::filesystem::remove(path + ".tmp", error);
+        throw std::runtime_error("Could not write \"" + path + "\"");
+    }
+
+    std::filesystem::rename(path + ".tmp", path, error);
+    if (error)
+    {
+        std::filesystem::remove(path + ".tmp", error);
+        throw std::runtime_error("Could not replace \"" + path + "\"");
+    }
+
+    return true;
+}
+
 void GameSaveIO::createSaveDirectoryIfRequired()
 {
+    // Save directory set directly, so save directory in data home is not used
+    if (!saveDirectoryOverride.empty())
+    {
+        // Failure is reported when files are opened
+        std::error_code error;
+        std::filesystem::create_directories(saveDirectoryOverride + "Planets/", error);
+        std::filesystem::create_directories(saveDirectoryOverride + "Rooms/", error);
+        return;
+    }
+
     std::filesystem::path dir(sago::getDataHome() + "/Planeturem");
     if (!std::filesystem::exists(dir))
     {
@@ -494,25 +800,35 @@ void GameSaveIO::createSaveDirectoryIfRequired()
         return;
     }
 
-    dir = std::filesystem::path(getRootDir() + "Saves/" + fileName + "/");
+    dir = std::filesystem::path(getSaveDir());
     if (!std::filesystem::exists(dir))
     {
         std::filesystem::create_directory(dir);
     }
 
-    dir = std::filesystem::path(getRootDir() + "Saves/" + fileName + "/Planets/");
+    dir = std::filesystem::path(getSaveDir() + "Planets/");
     if (!std::filesystem::exists(dir))
     {
         std::filesystem::create_directory(dir);
     }
 
-    dir = std::filesystem::path(getRootDir() + "Saves/" + fileName + "/Rooms/");
+    dir = std::filesystem::path(getSaveDir() + "Rooms/");
     if (!std::filesystem::exists(dir))
     {
         std::filesystem::create_directory(dir);
     }
 }
 
+std::string GameSaveIO::getSaveDir()
+{
+    if (!saveDirectoryOverride.empty())
+    {
+        return saveDirectoryOverride;
+    }
+
+    return (getRootDir() + "Saves/" + fileName + "/");
+}
+
 std::string GameSaveIO::getRootDir()
 {
     return (sago::getDataHome() + "/Planeturem/");
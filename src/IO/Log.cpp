@@ -1,8 +1,13 @@
 #include "IO/Log.hpp"
 
+#include <mutex>
+
 // std::stringstream Log::stream;
 std::string Log::filename;
 
+// Log may be pushed to from worker threads
+static std::mutex logMutex;
+
 void Log::init()
 {
     time_t timestamp = time(&timestamp);
@@ -13,6 +18,8 @@ void Log::init()
 
 void Log::push(const std::string& string)
 {
+    std::lock_guard<std::mutex> lock(logMutex);
+
     time_t timestamp = time(&timestamp);
     struct tm datetime = *localtime(&timestamp);
     std::string timeString = "[" + padTimeString(std::to_string(datetime.tm_hour)) + ":" + padTimeString(std::to_string(datetime.tm_min)) +
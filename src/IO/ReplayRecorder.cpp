@@ -0,0 +1,115 @@
+#include "IO/ReplayRecorder.hpp"
+#include "IO/GameSaveIO.hpp"
+#include "IO/Log.hpp"
+
+void ReplayRecorder::begin(const ReplayRecording& recordingStart)
+{
+    if (recording)
+    {
+        end();
+    }
+
+    // Header written immediately, frames are then appended in blocks
+    GameSaveIO io(recordingStart.saveName);
+    if (!io.writeReplayHeader(recordingStart, replayPath))
+    {
+        Log::push("ERROR: Could not create replay for save \"{}\"\n", recordingStart.saveName);
+        return;
+    }
+
+    saveName = recordingStart.saveName;
+    pendingFrames.clear();
+    frameCount = 0;
+    currentFrame = ReplayFrame();
+
+    recording = true;
+
+    Log::push("REPLAY: Started recording from save \"{}\" to \"{}\"\n", saveName, replayPath);
+}
+
+bool ReplayRecorder::end()
+{
+    if (!recording)
+    {
+        return false;
+    }
+
+    recording = false;
+
+    bool success = flushFrames();
+
+    if (success)
+    {
+        Log::push("REPLAY: Wrote {} frames to \"{}\"\n", frameCount, replayPath);
+    }
+    else
+    {
+        Log::push("ERROR: Could not write replay for save \"{}\"\n", saveName);
+    }
+
+    pendingFrames.clear();
+    currentFrame = ReplayFrame();
+
+    return success;
+}
+
+void ReplayRecorder::recordPacket(uint64_t senderID, const char* data, int size)
+{
+    if (!recording)
+    {
+        return;
+    }
+
+    ReplayPacket& packet = currentFrame.packets.emplace_back();
+    packet.senderID = senderID;
+    packet.data.assign(data, data + size);
+}
+
+void ReplayRecorder::recordNetworkEvent(ReplayNetworkEventType type, uint64_t id)
+{
+    if (!recording)
+    {
+        return;
+    }
+
+    currentFrame.networkEvents.push_back({type, id});
+}
+
+void ReplayRecorder::endFrame(float dt, const InputFrameState& inputState, uint64_t stateHash)
+{
+    if (!recording)
+    {
+        return;
+    }
+
+    currentFrame.dt = dt;
+    currentFrame.inputState = inputState;
+    currentFrame.stateHash = stateHash;
+
+    pendingFrames.push_back(std::move(currentFrame));
+    currentFrame = ReplayFrame();
+    frameCount++;
+
+    if (pendingFrames.size() >= FRAME_FLUSH_INTERVAL)
+    {
+        if (!flushFrames())
+        {
+            Log::push("ERROR: Could not write replay frames to \"{}\", stopping recording\n", replayPath);
+            recording = false;
+            pendingFrames.clear();
+        }
+    }
+}
+
+bool ReplayRecorder::flushFrames()
+{
+    if (pendingFrames.empty())
+    {
+        return true;
+    }
+
+    bool success = GameSaveIO::appendReplayFrames(replayPath, pendingFrames);
+    pendingFrames.clear();
+
+    return success;
+}
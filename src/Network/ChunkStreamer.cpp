@@ -0,0 +1,309 @@
+#include "Network/ChunkStreamer.hpp"
+#include "Network/NetworkHandler.hpp"
+#include "World/ChunkManager.hpp"
+#include "World/Chunk.hpp"
+#include "Game.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+
+#include "IO/Log.hpp"
+
+void ChunkStreamer::queueChunkRequests(uint64_t clientID, const PacketDataChunkRequests& chunkRequests)
+{
+    ClientChunkStream& clientStream = clientStreams[clientID];
+
+    // Client has changed planet - previously queued chunks are no longer required
+    if (clientStream.planetType != chunkRequests.planetType)
+    {
+        clientStream.planetType = chunkRequests.planetType;
+        clientStream.queuedChunks.clear();
+    }
+
+    clientStream.queuedChunks.insert(chunkRequests.chunkRequests.begin(), chunkRequests.chunkRequests.end());
+}
+
+void ChunkStreamer::resyncChunks(uint64_t clientID, const PacketDataChunkResyncRequests& resyncRequests, Game& game, NetworkHandler& networkHandler)
+{
+    if (!game.isLocationStateInitialised(LocationState::createFromPlanetType(resyncRequests.planetType)))
+    {
+        return;
+    }
+
+    ChunkManager& chunkManager = game.getChunkManager(resyncRequests.planetType);
+
+    PacketDataChunkEdits packetChunkEdits;
+    packetChunkEdits.planetType = resyncRequests.planetType;
+
+    PacketDataChunkRequests fullChunkRequests;
+    fullChunkRequests.planetType = resyncRequests.planetType;
+
+    for (const auto& resyncRequest : resyncRequests.resyncRequests)
+    {
+        Chunk* chunkPtr = chunkManager.getChunk(resyncRequest.chunkPosition);
+        if (!chunkPtr)
+        {
+            continue;
+        }
+
+        if (chunkPtr->getContentVersion() == resyncRequest.contentVersion)
+        {
+            stats.chunksUpToDate++;
+            continue;
+        }
+
+        PacketDataChunkEdits::ChunkEdits chunkEdits;
+        chunkEdits.chunkPosition = resyncRequest.chunkPosition;
+        chunkEdits.contentVersion = chunkPtr->getContentVersion();
+
+        if (!chunkPtr->getObjectEditsSince(resyncRequest.contentVersion, chunkEdits.objectEdits))
+        {
+            fullChunkRequests.chunkRequests.push_back(resyncRequest.chunkPosition);
+            continue;
+        }
+
+        stats.chunksResyncedByEdits++;
+        stats.objectEditsSent += chunkEdits.objectEdits.size();
+
+        packetChunkEdits.chunkEdits.push_back(chunkEdits);
+    }
+
+    // Edits since client's version not logged, send full chunk
+    if (fullChunkRequests.chunkRequests.size() > 0)
+    {
+        queueChunkRequests(clientID, fullChunkRequests);
+    }
+
+    if (packetChunkEdits.chunkEdits.size() <= 0)
+    {
+        return;
+    }
+
+    Packet packet;
+    packet.set(packetChunkEdits, true);
+
+    Log::push("NETWORK: (\"{}\") Sending edits of {} chunks to {} {}\n", PlanetGenDataLoader::getPlanetGenData(resyncRequests.planetType).name,
+        packetChunkEdits.chunkEdits.size(), networkHandler.getPlayerName(clientID), packet.getSizeStr());
+
+    networkHandler.sendPacketToClient(clientID, packet, k_nSteamNetworkingSend_Reliable, 0);
+}
+
+void ChunkStreamer::update(Game& game, NetworkHandler& networkHandler, float dt)
+{
+    streamTime += dt;
+
+    int generationBudget = MAX_CHUNK_GENERATIONS_PER_FRAME;
+
+    std::vector<uint64_t> clientIDs;
+    for (auto& [clientID, clientStream] : clientStreams)
+    {
+        clientStream.byteAllowance = std::min(clientStream.byteAllowance + CLIENT_BYTES_PER_SECOND * dt, MAX_CLIENT_BYTE_ALLOWANCE);
+
+        if (clientStream.queuedChunks.size() > 0)
+        {
+            clientIDs.push_back(clientID);
+        }
+    }
+
+    if (clientIDs.size() > 0)
+    {
+        std::sort(clientIDs.begin(), clientIDs.end());
+        clientStartIndex = (clientStartIndex + 1) % clientIDs.size();
+
+        for (int i = 0; i < clientIDs.size(); i++)
+        {
+            uint64_t clientID = clientIDs[(clientStartIndex + i) % clientIDs.size()];
+            streamChunksToClient(clientID, clientStreams[clientID], game, networkHandler, generationBudget);
+        }
+    }
+
+    cachePruneTime += dt;
+    if (cachePruneTime >= CACHE_PRUNE_TIME)
+    {
+        cachePruneTime = 0.0f;
+        pruneCache();
+    }
+}
+
+void ChunkStreamer::streamChunksToClient(uint64_t clientID, ClientChunkStream& clientStream, Game& game, NetworkHandler& networkHandler, int& generationBudget)
+{
+    if (clientStream.byteAllowance <= 0.0f)
+    {
+        return;
+    }
+
+    NetworkPlayer* networkPlayer = networkHandler.getNetworkPlayer(clientID);
+    LocationState planetLocationState = LocationState::createFromPlanetType(clientStream.planetType);
+
+    // Client has left planet, or planet is no longer active
+    if (!networkPlayer || networkPlayer->getPlayerData().locationState != planetLocationState || !game.isLocationStateInitialised(planetLocationState))
+    {
+        clientStream.queuedChunks.clear();
+        return;
+    }
+
+    ChunkManager& chunkManager = game.getChunkManager(clientStream.planetType);
+
+    PacketDataChunkDatas packetChunkDatas;
+    packetChunkDatas.planetType = clientStream.planetType;
+
+    int packetBytes = 0;
+
+    for (ChunkPosition chunkPosition : getChunksInSendOrder(clientStream, networkPlayer->getChunkViewRange(), chunkManager.getWorldSize()))
+    {
+        // Always send at least one chunk once allowance is available, so chunks larger than allowance are still sent
+        if (clientStream.byteAllowance <= 0.0f)
+        {
+            break;
+        }
+
+        Chunk* chunkPtr = chunkManager.getChunk(chunkPosition);
+
+        if (!chunkPtr)
+        {
+            // Already generated chunks further away can still be sent
+            if (generationBudget <= 0)
+            {
+                continue;
+            }
+
+            chunkPtr = chunkManager.getChunkAndGenerate(chunkPosition, game);
+            generationBudget--;
+            stats.chunksGenerated++;
+        }
+
+        const EncodedChunkData& encodedChunkData = getEncodedChunkData(clientStream.planetType, *chunkPtr);
+
+        packetChunkDatas.encodedChunkDatas.emplace_back(encodedChunkData.begin(), encodedChunkData.end());
+        clientStream.queuedChunks.erase(chunkPosition);
+
+        clientStream.byteAllowance -= encodedChunkData.size();
+        packetBytes += encodedChunkData.size();
+    }
+
+    if (packetChunkDatas.encodedChunkDatas.size() <= 0)
+    {
+        return;
+    }
+
+    Packet packet;
+    packet.set(packetChunkDatas, true);
+
+    Log::push("NETWORK: (\"{}\") Sending {} chunks to {} ({} queued) {}\n", PlanetGenDataLoader::getPlanetGenData(clientStream.planetType).name,
+        packetChunkDatas.encodedChunkDatas.size(), networkHandler.getPlayerName(clientID), clientStream.queuedChunks.size(), packet.getSizeStr());
+
+    networkHandler.sendPacketToClient(clientID, packet, k_nSteamNetworkingSend_Reliable, 0);
+
+    stats.chunksSent += packetChunkDatas.encodedChunkDatas.size();
+    stats.bytesSent += packetBytes;
+}
+
+std::vector<ChunkPosition> ChunkStreamer::getChunksInSendOrder(const ClientChunkStream& clientStream, const ChunkViewRange& clientViewRange, int worldSize)
+{
+    ChunkPosition viewCentre((clientViewRange.topLeft.x + clientViewRange.bottomRight.x) / 2, (clientViewRange.topLeft.y + clientViewRange.bottomRight.y) / 2);
+    viewCentre.x = Helper::wrap(viewCentre.x, worldSize);
+    viewCentre.y = Helper::wrap(viewCentre.y, worldSize);
+
+    // Squared chunk distance to view centre, taking world wrapping into account
+    auto getDistanceSq = [viewCentre, worldSize](ChunkPosition chunk) -> int
+    {
+        int xDist = std::abs(Helper::wrap(chunk.x, worldSize) - viewCentre.x);
+        int yDist = std::abs(Helper::wrap(chunk.y, worldSize) - viewCentre.y);
+        xDist = std::min(xDist, worldSize - xDist);
+        yDist = std::min(yDist, worldSize - yDist);
+        return xDist * xDist + yDist * yDist;
+    };
+
+    std::vector<std::pair<int, ChunkPosition>> chunkDistances;
+    chunkDistances.reserve(clientStream.queuedChunks.size());
+
+    for (ChunkPosition chunkPosition : clientStream.queuedChunks)
+    {
+        chunkDistances.push_back({getDistanceSq(chunkPosition), chunkPosition});
+    }
+
+    std::sort(chunkDistances.begin(), chunkDistances.end());
+
+    std::vector<ChunkPosition> chunks;
+    chunks.reserve(chunkDistances.size());
+
+    for (const auto& chunkDistance : chunkDistances)
+    {
+        chunks.push_back(chunkDistance.second);
+    }
+
+    return chunks;
+}
+
+const ChunkStreamer::EncodedChunkData& ChunkStreamer::getEncodedChunkData(PlanetType planetType, Chunk& chunk)
+{
+    CachedChunkData& cachedChunkData = chunkDataCache[planetType][chunk.getChunkPosition()];
+    cachedChunkData.lastUsedTime = streamTime;
+
+    if (cachedChunkData.contentVersion == chunk.getContentVersion() && cachedChunkData.encodedChunkData.size() > 0)
+    {
+        stats.encodeCacheHits++;
+        return cachedChunkData.encodedChunkData;
+    }
+
+    cachedChunkData.contentVersion = chunk.getContentVersion();
+    cachedChunkData.encodedChunkData = PacketDataChunkDatas::encodeChunkData<EncodedChunkData>(ChunkManager::getChunkData(chunk));
+
+    stats.encodeCacheMisses++;
+
+    return cachedChunkData.encodedChunkData;
+}
+
+void ChunkStreamer::pruneCache()
+{
+    for (auto planetIter = chunkDataCache.begin(); planetIter != chunkDataCache.end();)
+    {
+        std::erase_if(planetIter->second, [this](const auto& cachedChunkData)
+        {
+            return (streamTime - cachedChunkData.second.lastUsedTime >= CACHED_CHUNK_DATA_LIFETIME);
+        });
+
+        if (planetIter->second.empty())
+        {
+            planetIter = chunkDataCache.erase(planetIter);
+            continue;
+        }
+
+        planetIter++;
+    }
+}
+
+void ChunkStreamer::removeClient(uint64_t clientID)
+{
+    clientStreams.erase(clientID);
+}
+
+void ChunkStreamer::reset()
+{
+    clientStreams.clear();
+    chunkDataCache.clear();
+    clientStartIndex = 0;
+    streamTime = 0.0f;
+    cachePruneTime = 0.0f;
+    stats = ChunkStreamStats();
+}
+
+int ChunkStreamer::getQueuedChunkCount() const
+{
+    int queuedChunkCount = 0;
+    for (const auto& clientStream : clientStreams)
+    {
+        queuedChunkCount += clientStream.second.queuedChunks.size();
+    }
+    return queuedChunkCount;
+}
+
+int ChunkStreamer::getCachedChunkCount() const
+{
+    int cachedChunkCount = 0;
+    for (const auto& planetCache : chunkDataCache)
+    {
+        cachedChunkCount += planetCache.second.size();
+    }
+    return cachedChunkCount;
+}
@@ -0,0 +1,667 @@
+#include "Network/CommandConsole.hpp"
+#include "Network/NetworkHandler.hpp"
+#include "Game.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+
+#include "Data/ItemDataLoader.hpp"
+#include "IO/Log.hpp"
+
+static std::string toLowerString(std::string string)
+{
+    std::transform(string.begin(), string.end(), string.begin(), [](unsigned char c) {return std::tolower(c);});
+    return string;
+}
+
+// Position and location of host or network player
+static bool getPlayerLocation(Game& game, uint64_t playerID, pl::Vector2f& position, LocationState& locationState)
+{
+    if (playerID == game.getLocalPlayerID())
+    {
+        position = game.getPlayer().getPosition();
+        locationState = game.getLocationState();
+        return true;
+    }
+
+    NetworkPlayer* networkPlayer = game.getNetworkHandler().getNetworkPlayer(playerID);
+    if (!networkPlayer)
+    {
+        return false;
+    }
+
+    position = networkPlayer->getPosition();
+    locationState = networkPlayer->getPlayerData().locationState;
+    return true;
+}
+
+// Inventory of host or network player, network player inventories are as last synced to host
+static const InventoryData* getPlayerInventory(Game& game, uint64_t playerID)
+{
+    if (playerID == game.getLocalPlayerID())
+    {
+        return &game.getInventory();
+    }
+
+    NetworkPlayer* networkPlayer = game.getNetworkHandler().getNetworkPlayer(playerID);
+    if (!networkPlayer)
+    {
+        return nullptr;
+    }
+
+    return &networkPlayer->getPlayerData().inventory;
+}
+
+static std::string getPlayerNameFromID(Game& game, uint64_t playerID)
+{
+    if (playerID == game.getLocalPlayerID())
+    {
+        return game.getPlayerName();
+    }
+
+    return game.getNetworkHandler().getPlayerName(playerID);
+}
+
+// Adds items to player inventory, or removes if amount is negative
+// Network players apply change on receiving packet
+static void modifyPlayerInventory(Game& game, uint64_t playerID, ItemType itemType, int amount)
+{
+    if (playerID == game.getLocalPlayerID())
+    {
+        if (amount > 0)
+        {
+            game.getInventory().addItem(itemType, amount, true);
+        }
+        else
+        {
+            game.getInventory().takeItem(itemType, -amount);
+        }
+        return;
+    }
+
+    PacketDataInventoryAddItem packetData;
+    packetData.itemType = itemType;
+    packetData.amount = amount;
+
+    Packet packet;
+    packet.set(packetData);
+    game.getNetworkHandler().sendPacketToClient(playerID, packet, k_nSteamNetworkingSend_Reliable, 0);
+}
+
+CommandConsole::CommandConsole()
+{
+    registerDefaultCommands();
+}
+
+void CommandConsole::registerCommand(const Command& command)
+{
+    auto iter = commandNameToIndex.find(command.name);
+    if (iter != commandNameToIndex.end())
+    {
+        commands[iter->second] = command;
+        return;
+    }
+
+    commandNameToIndex[command.name] = commands.size();
+    commands.push_back(command);
+}
+
+CommandResult CommandConsole::execute(Game& game, uint64_t issuerID, const std::string& message)
+{
+    CommandContext context;
+    context.issuerID = issuerID;
+    context.permissionLevel = getPermissionLevel(issuerID);
+    return executeWithPermission(game, context, message);
+}
+
+CommandResult CommandConsole::executeAsAdmin(Game& game, uint64_t issuerID, const std::string& message)
+{
+    return executeAsPermissionLevel(game, issuerID, PermissionLevel::Admin, message);
+}
+
+CommandResult CommandConsole::executeAsPermissionLevel(Game& game, uint64_t issuerID, PermissionLevel permissionLevel, const std::string& message)
+{
+    CommandContext context;
+    context.issuerID = issuerID;
+    context.permissionLevel = permissionLevel;
+    return executeWithPermission(game, context, message);
+}
+
+CommandResult CommandConsole::executeWithPermission(Game& game, const CommandContext& context, const std::string& message)
+{
+    if (!isCommand(message))
+    {
+        return {false, "Commands must start with '/'"};
+    }
+
+    std::vector<std::string> tokens = tokenise(message.substr(1));
+    if (tokens.empty())
+    {
+        return {false, "No command given, use /help"};
+    }
+
+    auto commandIter = commandNameToIndex.find(toLowerString(tokens[0]));
+    if (commandIter == commandNameToIndex.end())
+    {
+        return {false, "Unknown command \"" + tokens[0] + "\", use /help"};
+    }
+
+    const Command& command = commands[commandIter->second];
+
+    if (context.permissionLevel < command.permissionLevel)
+    {
+        return {false, "/" + command.name + " requires " + getPermissionLevelName(command.permissionLevel) + " permission"};
+    }
+
+    // Validate args against command
+    int argTokenCount = tokens.size() - 1;
+    int requiredArgCount = std::count_if(command.args.begin(), command.args.end(), [](const CommandArg& arg) {return !arg.optional;});
+
+    if (argTokenCount < requiredArgCount || argTokenCount > command.args.size())
+    {
+        return {false, "Usage: " + getUsage(command)};
+    }
+
+    std::vector<CommandArgValue> argValues(command.args.size());
+
+    for (int i = 0; i < argTokenCount; i++)
+    {
+        std::optional<std::string> error = parseArg(game, context, command.args[i], tokens[i + 1], argValues[i]);
+        if (error.has_value())
+        {
+            return {false, error.value() + ", usage: " + getUsage(command)};
+        }
+    }
+
+    CommandResult result = command.execute(game, context, argValues);
+
+    Log::push("COMMAND: \"{}\" from {} ({}): {}\n", message, getPlayerNameFromID(game, context.issuerID), result.success ? "success" : "failed",
+        result.reply);
+
+    return result;
+}
+
+std::vector<std::string> CommandConsole::tokenise(const std::string& message)
+{
+    std::vector<std::string> tokens;
+    std::string token;
+    bool inQuotes = false;
+    bool tokenStarted = false;
+
+    for (char c : message)
+    {
+        if (c == '"')
+        {
+            inQuotes = !inQuotes;
+            tokenStarted = true;
+            continue;
+        }
+
+        if (std::isspace(static_cast<unsigned char>(c)) && !inQuotes)
+        {
+            if (tokenStarted)
+            {
+                tokens.push_back(token);
+                token.clear();
+                tokenStarted = false;
+            }
+            continue;
+        }
+
+        token += c;
+        tokenStarted = true;
+    }
+
+    if (tokenStarted)
+    {
+        tokens.push_back(token);
+    }
+
+    return tokens;
+}
+
+std::optional<std::string> CommandConsole::parseArg(Game& game, const CommandContext& context, const CommandArg& arg, const std::string& token,
+    CommandArgValue& value)
+{
+    value.present = true;
+    value.text = token;
+
+    switch (arg.type)
+    {
+        case CommandArgType::Player:
+        {
+            std::optional<uint64_t> playerID = findPlayer(game, context, token);
+            if (!playerID.has_value())
+            {
+                return "No player named \"" + token + "\"";
+            }
+            value.playerID = playerID.value();
+            return std::nullopt;
+        }
+        case CommandArgType::Int:
+        {
+            try
+            {
+                size_t length = 0;
+                value.intValue = std::stoi(token, &length);
+                if (length == token.size())
+                {
+                    return std::nullopt;
+                }
+            }
+            catch (const std::exception& e) {}
+            return "\"" + token + "\" is not a whole number for " + arg.name;
+        }
+        case CommandArgType::Float:
+        {
+            try
+            {
+                size_t length = 0;
+                value.floatValue = std::stof(token, &length);
+                if (length == token.size())
+                {
+                    return std::nullopt;
+                }
+            }
+            catch (const std::exception& e) {}
+            return "\"" + token + "\" is not a number for " + arg.name;
+        }
+        case CommandArgType::Item:
+        {
+            // Item names are matched ignoring case, with underscores allowed in place of spaces
+            std::string itemName = toLowerString(token);
+            std::replace(itemName.begin(), itemName.end(), '_', ' ');
+
+            for (const auto& [name, itemType] : ItemDataLoader::getItemNameToTypeMap())
+            {
+                if (toLowerString(name) == itemName)
+                {
+                    value.itemType = itemType;
+                    return std::nullopt;
+                }
+            }
+            return "No item named \"" + token + "\"";
+        }
+        case CommandArgType::PermissionLevel:
+        {
+            std::optional<PermissionLevel> permissionLevel = getPermissionLevelFromName(token);
+            if (!permissionLevel.has_value())
+            {
+                return "\"" + token + "\" is not a permission level (player, moderator, admin)";
+            }
+            value.permissionLevel = permissionLevel.value();
+            return std::nullopt;
+        }
+        case CommandArgType::Text:
+        {
+            return std::nullopt;
+        }
+    }
+
+    return "Unknown argument type for " + arg.name;
+}
+
+std::optional<uint64_t> CommandConsole::findPlayer(Game& game, const CommandContext& context, const std::string& name)
+{
+    std::string lowerName = toLowerString(name);
+
+    if (lowerName == "me")
+    {
+        return context.issuerID;
+    }
+
+    if (toLowerString(game.getPlayerName()) == lowerName)
+    {
+        return game.getLocalPlayerID();
+    }
+
+    for (auto& [id, networkPlayer] : game.getNetworkHandler().getNetworkPlayers())
+    {
+        if (toLowerString(networkPlayer.getPlayerData().name) == lowerName)
+        {
+            return id;
+        }
+    }
+
+    return std::nullopt;
+}
+
+bool CommandConsole::canActOnPlayer(Game& game, const CommandContext& context, uint64_t targetID) const
+{
+    if (context.issuerID == targetID || context.issuerID == game.getLocalPlayerID())
+    {
+        return true;
+    }
+
+    if (targetID == game.getLocalPlayerID())
+    {
+        return false;
+    }
+
+    return context.permissionLevel > getPermissionLevel(targetID);
+}
+
+std::string CommandConsole::getUsage(const Command& command)
+{
+    std::string usage = "/" + command.name;
+    for (const CommandArg& arg : command.args)
+    {
+        usage += arg.optional ? " [" + arg.name + "]" : " <" + arg.name + ">";
+    }
+    return usage;
+}
+
+PermissionLevel CommandConsole::getPermissionLevel(uint64_t playerID) const
+{
+    auto iter = permissionLevels.find(playerID);
+    if (iter == permissionLevels.end())
+    {
+        return PermissionLevel::Player;
+    }
+    return iter->second;
+}
+
+void CommandConsole::setPermissionLevel(uint64_t playerID, PermissionLevel permissionLevel)
+{
+    if (permissionLevel == PermissionLevel::Player)
+    {
+        permissionLevels.erase(playerID);
+        return;
+    }
+
+    permissionLevels[playerID] = permissionLevel;
+}
+
+std::unordered_map<uint64_t, int> CommandConsole::getPermissionLevelsSave() const
+{
+    std::unordered_map<uint64_t, int> permissionLevelsSave;
+    for (const auto& [playerID, permissionLevel] : permissionLevels)
+    {
+        permissionLevelsSave[playerID] = static_cast<int>(permissionLevel);
+    }
+    return permissionLevelsSave;
+}
+
+void CommandConsole::loadPermissionLevelsSave(const std::unordered_map<uint64_t, int>& permissionLevelsSave)
+{
+    permissionLevels.clear();
+    for (const auto& [playerID, permissionLevel] : permissionLevelsSave)
+    {
+        setPermissionLevel(playerID, static_cast<PermissionLevel>(std::clamp(permissionLevel, 0, static_cast<int>(PermissionLevel::Admin))));
+    }
+}
+
+const char* CommandConsole::getPermissionLevelName(PermissionLevel permissionLevel)
+{
+    switch (permissionLevel)
+    {
+        case PermissionLevel::Player: return "player";
+        case PermissionLevel::Moderator: return "moderator";
+        case PermissionLevel::Admin: return "admin";
+    }
+    return "unknown";
+}
+
+std::optional<PermissionLevel> CommandConsole::getPermissionLevelFromName(const std::string& name)
+{
+    std::string levelName = toLowerString(name);
+    for (PermissionLevel permissionLevel : {PermissionLevel::Player, PermissionLevel::Moderator, PermissionLevel::Admin})
+    {
+        if (levelName == getPermissionLevelName(permissionLevel))
+        {
+            return permissionLevel;
+        }
+    }
+    return std::nullopt;
+}
+
+void CommandConsole::registerDefaultCommands()
+{
+    registerCommand({"help", "Lists commands available to you", PermissionLevel::Player, {},
+        [this](Game& game, const CommandContext& context, const std::vector<CommandArgValue>& args) -> CommandResult
+        {
+            std::string reply = "Commands:";
+            for (const Command& command : commands)
+            {
+                if (context.permissionLevel >= command.permissionLevel)
+                {
+                    reply += "\n" + getUsage(command) + " - " + command.description;
+                }
+            }
+            return {true, reply};
+        }});
+
+    registerCommand({"players", "Lists players and their permission levels", PermissionLevel::Player, {},
+        [this](Game& game, const CommandContext& context, const std::vector<CommandArgValue>& args) -> CommandResult
+        {
+            std::string reply = game.getPlayerName() + " (host)";
+            for (auto& [id, networkPlayer] : game.getNetworkHandler().getNetworkPlayers())
+            {
+                reply += ", " + networkPlayer.getPlayerData().name + " (" + getPermissionLevelName(getPermissionLevel(id)) + ")";
+            }
+            return {true, reply};
+        }});
+
+    registerCommand({"tp", "Teleports player to another player in the same location", PermissionLevel::Moderator,
+        {{"player", CommandArgType::Player}, {"target", CommandArgType::Player}},
+        [this](Game& game, const CommandContext& context, const std::vector<CommandArgValue>& args) -> CommandResult
+        {
+            if (!canActOnPlayer(game, context, args[0].playerID))
+            {
+                return {false, "Cannot teleport " + args[0].text + ", they do not have a lower permission level than you"};
+            }
+
+            pl::Vector2f position, targetPosition;
+            LocationState locationState, targetLocationState;
+            getPlayerLocation(game, args[0].playerID, position, locationState);
+            getPlayerLocation(game, args[1].playerID, targetPosition, targetLocationState);
+
+            if (!(locationState == targetLocationState))
+            {
+                return {false, args[0].text + " is not in the same location as " + args[1].text};
+            }
+
+            game.teleportPlayer(args[0].playerID, targetPosition);
+            return {true, "Teleported " + args[0].text + " to " + args[1].text};
+        }});
+
+    registerCommand({"tptile", "Teleports player to tile in their current planet", PermissionLevel::Moderator,
+        {{"player", CommandArgType::Player}, {"x", CommandArgType::Int}, {"y", CommandArgType::Int}},
+        [this](Game& game, const CommandContext& context, const std::vector<CommandArgValue>& args) -> CommandResult
+        {
+            if (!canActOnPlayer(game, context, args[0].playerID))
+            {
+                return {false, "Cannot teleport " + args[0].text + ", they do not have a lower permission level than you"};
+            }
+
+            pl::Vector2f position;
+            LocationState locationState;
+            getPlayerLocation(game, args[0].playerID, position, locationState);
+
+            if (!locationState.isOnPlanet() || locationState.isInStructure() || !game.isLocationStateInitialised(locationState))
+            {
+                return {false, args[0].text + " is not on a planet"};
+            }
+
+            int worldTileSize = game.getChunkManager(locationState.getPlanetType()).getWorldSize() * static_cast<int>(CHUNK_TILE_SIZE);
+            if (args[1].intValue < 0 || args[1].intValue >= worldTileSize || args[2].intValue < 0 || args[2].intValue >= worldTileSize)
+            {
+                return {false, "Tile must be between 0 and " + std::to_string(worldTileSize - 1)};
+            }
+
+            pl::Vector2f tilePosition = (pl::Vector2f(args[1].intValue, args[2].intValue) + pl::Vector2f(0.5f, 0.5f)) * TILE_SIZE_PIXELS_UNSCALED;
+            game.teleportPlayer(args[0].playerID, tilePosition);
+            return {true, "Teleported " + args[0].text + " to tile " + std::to_string(args[1].intValue) + ", " + std::to_string(args[2].intValue)};
+        }});
+
+    registerCommand({"give", "Gives items to player", PermissionLevel::Admin,
+        {{"player", CommandArgType::Player}, {"item", CommandArgType::Item}, {"amount", CommandArgType::Int, true}},
+        [](Game& game, const CommandContext& context, const std::vector<CommandArgValue>& args) -> CommandResult
+        {
+            int amount = args[2].present ? args[2].intValue : 1;
+            if (amount <= 0)
+            {
+                return {false, "Amount must be greater than 0"};
+            }
+
+            modifyPlayerInventory(game, args[0].playerID, args[1].itemType, amount);
+            return {true, "Gave " + std::to_string(amount) + " " + ItemDataLoader::getItemData(args[1].itemType).name + " to " + args[0].text};
+        }});
+
+    registerCommand({"take", "Removes items from player", PermissionLevel::Admin,
+        {{"player", CommandArgType::Player}, {"item", CommandArgType::Item}, {"amount", CommandArgType::Int, true}},
+        [](Game& game, const CommandContext& context, const std::vector<CommandArgValue>& args) -> CommandResult
+        {
+            int amount = args[2].present ? args[2].intValue : 1;
+            if (amount <= 0)
+            {
+                return {false, "Amount must be greater than 0"};
+            }
+
+            modifyPlayerInventory(game, args[0].playerID, args[1].itemType, -amount);
+            return {true, "Took " + std::to_string(amount) + " " + ItemDataLoader::getItemData(args[1].itemType).name + " from " + args[0].text};
+        }});
+
+    registerCommand({"save", "Saves the game", PermissionLevel::Moderator, {},
+        [](Game& game, const CommandContext& context, const std::vector<CommandArgValue>& args) -> CommandResult
+        {
+            if (!game.saveGame())
+            {
+                return {false, "Could not save game"};
+            }
+            return {true, "Game saved"};
+        }});
+
+    registerCommand({"time", "Sets time of day, from 0 (start of day) to 1 (end of day)", PermissionLevel::Moderator,
+        {{"time", CommandArgType::Float}, {"day", CommandArgType::Int, true}},
+        [](Game& game, const CommandContext& context, const std::vector<CommandArgValue>& args) -> CommandResult
+        {
+            // All args validated before any are applied, so failed command does not partly change time
+            if (args[0].floatValue < 0.0f || args[0].floatValue > 1.0f)
+            {
+                return {false, "Time must be between 0 and 1"};
+            }
+
+            if (args[1].present && args[1].intValue < 1)
+            {
+                return {false, "Day must be at least 1"};
+            }
+
+            DayCycleManager& dayCycleManager = game.getDayCycleManager(true);
+            dayCycleManager.setCurrentTime(args[0].floatValue * dayCycleManager.getDayLength());
+
+            if (args[1].present)
+            {
+                dayCycleManager.setCurrentDay(args[1].intValue);
+            }
+
+            // Clients are synced through server info
+            return {true, "Time set to " + dayCycleManager.getTimeString() + ", " + dayCycleManager.getDayString()};
+        }});
+
+    registerCommand({"clearentities", "Removes entities from loaded chunks on all active planets", PermissionLevel::Admin, {},
+        [](Game& game, const CommandContext& context, const std::vector<CommandArgValue>& args) -> CommandResult
+        {
+            std::optional<PlanetType> hostPlanetType;
+            if (game.getLocationState().isOnPlanet())
+            {
+                hostPlanetType = game.getLocationState().getPlanetType();
+            }
+
+            int entitiesCleared = 0;
+            for (PlanetType planetType : game.getNetworkHandler().getPlayersPlanetTypeSet(hostPlanetType))
+            {
+                if (!game.isLocationStateInitialised(LocationState::createFromPlanetType(planetType)))
+                {
+                    continue;
+                }
+
+                entitiesCleared += game.getChunkManager(planetType).clearLoadedChunksEntities();
+            }
+
+            return {true, "Cleared " + std::to_string(entitiesCleared) + " entities"};
+        }});
+
+    registerCommand({"kick", "Disconnects player from the game", PermissionLevel::Moderator, {{"player", CommandArgType::Player}},
+        [this](Game& game, const CommandContext& context, const std::vector<CommandArgValue>& args) -> CommandResult
+        {
+            if (args[0].playerID == game.getLocalPlayerID())
+            {
+                return {false, "Cannot kick host"};
+            }
+
+            if (!canActOnPlayer(game, context, args[0].playerID))
+            {
+                return {false, "Cannot kick " + args[0].text + ", they do not have a lower permission level than you"};
+            }
+
+            game.getNetworkHandler().kickPlayer(args[0].playerID);
+            return {true, "Kicked " + args[0].text};
+        }});
+
+    registerCommand({"permission", "Sets permission level of player (player, moderator, admin)", PermissionLevel::Admin,
+        {{"player", CommandArgType::Player}, {"level", CommandArgType::PermissionLevel}},
+        [this](Game& game, const CommandContext& context, const std::vector<CommandArgValue>& args) -> CommandResult
+        {
+            if (args[0].playerID == game.getLocalPlayerID())
+            {
+                return {false, "Host is always admin"};
+            }
+
+            // Admins can only be demoted by host
+            if (!canActOnPlayer(game, context, args[0].playerID))
+            {
+                return {false, "Cannot change permission level of " + args[0].text + ", they do not have a lower permission level than you"};
+            }
+
+            setPermissionLevel(args[0].playerID, args[1].permissionLevel);
+            return {true, args[0].text + " is now " + getPermissionLevelName(args[1].permissionLevel)};
+        }});
+}
+
+void CommandConsole::registerScriptCommands()
+{
+    // Assertions fail if state does not match, used by command scripts to check effects of previous commands
+    registerCommand({"assertitems", "Fails unless player has exactly amount of item", PermissionLevel::Admin,
+        {{"player", CommandArgType::Player}, {"item", CommandArgType::Item}, {"amount", CommandArgType::Int}},
+        [](Game& game, const CommandContext& context, const std::vector<CommandArgValue>& args) -> CommandResult
+        {
+            const InventoryData* inventory = getPlayerInventory(game, args[0].playerID);
+            if (!inventory)
+            {
+                return {false, "No inventory for " + args[0].text};
+            }
+
+            int amount = inventory->getItemAmount(args[1].itemType);
+            const std::string& itemName = ItemDataLoader::getItemData(args[1].itemType).name;
+
+            if (amount != args[2].intValue)
+            {
+                return {false, args[0].text + " has " + std::to_string(amount) + " " + itemName + ", expected " + std::to_string(args[2].intValue)};
+            }
+            return {true, args[0].text + " has " + std::to_string(amount) + " " + itemName};
+        }});
+
+    registerCommand({"assertpos", "Fails unless player is on tile", PermissionLevel::Admin,
+        {{"player", CommandArgType::Player}, {"x", CommandArgType::Int}, {"y", CommandArgType::Int}},
+        [](Game& game, const CommandContext& context, const std::vector<CommandArgValue>& args) -> CommandResult
+        {
+            pl::Vector2f position;
+            LocationState locationState;
+            if (!getPlayerLocation(game, args[0].playerID, position, locationState))
+            {
+                return {false, "No position for " + args[0].text};
+            }
+
+            pl::Vector2<int> tile(std::floor(position.x / TILE_SIZE_PIXELS_UNSCALED), std::floor(position.y / TILE_SIZE_PIXELS_UNSCALED));
+            std::string tileString = std::to_string(tile.x) + ", " + std::to_string(tile.y);
+
+            if (tile.x != args[1].intValue || tile.y != args[2].intValue)
+            {
+                return {false, args[0].text + " is on tile " + tileString + ", expected " + std::to_string(args[1].intValue) + ", " +
+                    std::to_string(args[2].intValue)};
+            }
+            return {true, args[0].text + " is on tile " + tileString};
+        }});
+}
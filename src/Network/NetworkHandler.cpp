@@ -5,6 +5,8 @@
 #include "IO/Log.hpp"
 #include "steam/steamclientpublic.h"
 
+thread_local std::vector<BufferedPacket>* NetworkHandler::threadPacketBuffer = nullptr;
+
 NetworkHandler::NetworkHandler(Game* game)
 {
     if (game == nullptr)
@@ -25,6 +27,8 @@ void NetworkHandler::reset(Game* game)
     networkPlayers.clear();
     networkPlayerDatasSaved.clear();
 
+    chunkStreamer.reset();
+
     totalBytesSent = 0;
     totalBytesReceived = 0;
     totalBytesSentLast = 0;
@@ -32,9 +36,13 @@ void NetworkHandler::reset(Game* game)
     byteRateSampleTime = 0.0f;
     byteSendRate = 0.0f;
     byteReceiveRate = 0.0f;
+    telemetry.reset();
     
     updateTick = 0.0f;
     updateTickCount = 0;
+    networkTick = 0;
+    entityViewNetworkTick = 0;
+    bossViewNetworkTick = 0;
 
     sendPlayerDataQueued = false;
     sendPlayerDataQueueTime = 0.0f;
@@ -44,7 +52,8 @@ void NetworkHandler::reset(Game* game)
 
 void NetworkHandler::startHostServer()
 {
-    if (multiplayerGame)
+    // Lobby creation is replayed from recorded network events
+    if (multiplayerGame || replaying)
     {
         return;
     }
@@ -66,6 +75,8 @@ void NetworkHandler::callbackLobbyCreated(LobbyCreated_t* pCallback, bool bIOFai
     isLobbyHost = true;
     lobbyHost = SteamUser()->GetSteamID().ConvertToUint64();
     multiplayerGame = true;
+
+    game->getReplayRecorder().recordNetworkEvent(ReplayNetworkEventType::LobbyCreated, lobbyHost);
 }
 
 void NetworkHandler::leaveLobby()
@@ -75,6 +86,13 @@ void NetworkHandler::leaveLobby()
         return;
     }
 
+    if (replaying)
+    {
+        isLobbyHost = false;
+        multiplayerGame = false;
+        return;
+    }
+
     CSteamID steamLobbyIDSteam;
     steamLobbyIDSteam.SetFromUint64(steamLobbyId);
 
@@ -106,6 +124,37 @@ void NetworkHandler::leaveLobby()
     multiplayerGame = false;
 }
 
+void NetworkHandler::sendChatCommand(const PacketDataChatMessage& chatMessagePacket)
+{
+    if (isLobbyHostOrSolo())
+    {
+        game->executeChatCommand(game->getLocalPlayerID(), chatMessagePacket.message);
+        return;
+    }
+
+    Packet packet;
+    packet.set(chatMessagePacket);
+    sendPacketToHost(packet, k_nSteamNetworkingSend_Reliable, 0);
+}
+
+void NetworkHandler::kickPlayer(uint64_t id)
+{
+    if (!isLobbyHost || !networkPlayers.contains(id))
+    {
+        return;
+    }
+
+    Packet packet;
+    packet.type = PacketType::HostQuit;
+    sendPacketToClient(id, packet, k_nSteamNetworkingSend_Reliable, 0);
+
+    SteamNetworkingIdentity identity;
+    identity.SetSteamID64(id);
+    SteamNetworkingMessages()->CloseSessionWithUser(identity);
+
+    deleteNetworkPlayer(id, &game->getChatGUI());
+}
+
 void NetworkHandler::sendWorldJoinReply(std::string playerName, pl::Color bodyColor, pl::Color skinColor)
 {
     CSteamID lobbyHostSteam;
@@ -222,10 +271,9 @@ std::unordered_map<uint64_t, NetworkPlayer*> NetworkHandler::getNetworkPlayersAt
     return networkPlayersAtLocation;
 }
 
-std::vector<WorldObject*> NetworkHandler::getNetworkPlayersToDraw(const Camera& camera, const LocationState& locationState, pl::Vector2f playerPosition, float gameTime)
+void NetworkHandler::getNetworkPlayersToDraw(const Camera& camera, const LocationState& locationState, pl::Vector2f playerPosition, float gameTime,
+    std::vector<WorldObject*>& worldObjects)
 {
-    std::vector<WorldObject*> networkPlayerObjects;
-
     for (auto iter = networkPlayers.begin(); iter != networkPlayers.end(); iter++)
     {
         // Not in same location as player
@@ -244,12 +292,8 @@ std::vector<WorldObject*> NetworkHandler::getNetworkPlayersToDraw(const Camera&
             worldSize = planetGenData.worldSize;
         }
 
-        std::vector<WorldObject*> playerWorldObjects = iter->second.getDrawWorldObjects(camera, worldSize, gameTime);
-
-        networkPlayerObjects.insert(networkPlayerObjects.end(), playerWorldObjects.begin(), playerWorldObjects.end());
+        iter->second.getDrawWorldObjects(camera, worldSize, gameTime, worldObjects);
     }
-
-    return networkPlayerObjects;
 }
 
 std::vector<ChunkViewRange> NetworkHandler::getNetworkPlayersChunkViewRanges(PlanetType planetType)
@@ -420,6 +464,8 @@ void NetworkHandler::deleteNetworkPlayer(uint64_t id, ChatGUI* chatGUI)
     {
         networkPlayerDatasSaved[id] = networkPlayers[id].getPlayerData();
 
+        chunkStreamer.removeClient(id);
+
         Packet packet;
         packet.type = PacketType::PlayerDisconnected;
         packet.data.resize(sizeof(id));
@@ -484,6 +530,7 @@ void NetworkHandler::callbackLobbyUpdated(LobbyChatUpdate_t* pCallback)
         }
         else
         {
+            game->getReplayRecorder().recordNetworkEvent(ReplayNetworkEventType::PlayerLeft, pCallback->m_ulSteamIDUserChanged);
             deleteNetworkPlayer(pCallback->m_ulSteamIDUserChanged, &game->getChatGUI());
         }
     }
@@ -529,6 +576,11 @@ void NetworkHandler::update(float dt)
 
     structureEnterRequestCooldown = std::max(structureEnterRequestCooldown - dt, 0.0f);
 
+    if (isLobbyHost)
+    {
+        chunkStreamer.update(*game, *this, dt);
+    }
+
     byteRateSampleTime += dt;
     if (byteRateSampleTime >= BYTE_RATE_SAMPLE_RATE)
     {
@@ -538,6 +590,21 @@ void NetworkHandler::update(float dt)
         totalBytesSentLast = totalBytesSent;
         totalBytesReceivedLast = totalBytesReceived;
     }
+
+    std::vector<uint64_t> peerIDs;
+    if (isLobbyHost)
+    {
+        for (const auto& networkPlayerPair : networkPlayers)
+        {
+            peerIDs.push_back(networkPlayerPair.first);
+        }
+    }
+    else if (multiplayerGame)
+    {
+        peerIDs.push_back(lobbyHost);
+    }
+
+    telemetry.update(dt, peerIDs, multiplayerGame && !replaying);
 }
 
 void NetworkHandler::updateNetworkPlayers(float dt, const LocationState& locationState)
@@ -555,6 +622,23 @@ void NetworkHandler::updateNetworkPlayers(float dt, const LocationState& locatio
 
 void NetworkHandler::receiveMessages(ChatGUI& chatGUI, MainMenuGUI& mainMenuGUI)
 {
+    if (replaying)
+    {
+        for (const ReplayPacket& replayPacket : replayPackets)
+        {
+            Packet packet;
+            packet.deserialise(replayPacket.data.data(), replayPacket.data.size());
+
+            processMessage(replayPacket.senderID, packet, chatGUI, mainMenuGUI);
+
+            totalBytesReceived += replayPacket.data.size();
+            telemetry.recordReceived(replayPacket.senderID, packet, replayPacket.data.size());
+        }
+
+        replayPackets.clear();
+        return;
+    }
+
     static constexpr int MAX_MESSAGES = 10;
 
     SteamNetworkingMessage_t* messages[MAX_MESSAGES];
@@ -572,10 +656,13 @@ void NetworkHandler::receiveMessages(ChatGUI& chatGUI, MainMenuGUI& mainMenuGUI)
         {
             Packet packet;
             packet.deserialise((char*)messages[i]->GetData(), messages[i]->GetSize());
+
+            game->getReplayRecorder().recordPacket(messages[i]->m_identityPeer.GetSteamID64(), (char*)messages[i]->GetData(), messages[i]->GetSize());
     
-            processMessage(*messages[i], packet, chatGUI, mainMenuGUI);
+            processMessage(messages[i]->m_identityPeer.GetSteamID64(), packet, chatGUI, mainMenuGUI);
 
             totalBytesReceived += messages[i]->GetSize();
+            telemetry.recordReceived(messages[i]->m_identityPeer.GetSteamID64(), packet, messages[i]->GetSize());
             // Log::push("___DEBUG___: Received packet of size {} bytes, type {}\n", messages[i]->GetSize(), packet.type);
     
             messages[i]->Release();
@@ -583,16 +670,43 @@ void NetworkHandler::receiveMessages(ChatGUI& chatGUI, MainMenuGUI& mainMenuGUI)
     }
 }
 
-void NetworkHandler::processMessage(const SteamNetworkingMessage_t& message, const Packet& packet, ChatGUI& chatGUI, MainMenuGUI& mainMenuGUI)
+void NetworkHandler::setReplayFrame(const ReplayFrame& replayFrame)
+{
+    replayPackets = replayFrame.packets;
+}
+
+void NetworkHandler::applyReplayNetworkEvents(const ReplayFrame& replayFrame)
+{
+    for (const ReplayNetworkEvent& networkEvent : replayFrame.networkEvents)
+    {
+        switch (networkEvent.type)
+        {
+            case ReplayNetworkEventType::LobbyCreated:
+            {
+                isLobbyHost = true;
+                lobbyHost = networkEvent.id;
+                multiplayerGame = true;
+                break;
+            }
+            case ReplayNetworkEventType::PlayerLeft:
+            {
+                deleteNetworkPlayer(networkEvent.id, &game->getChatGUI());
+                break;
+            }
+        }
+    }
+}
+
+void NetworkHandler::processMessage(uint64_t senderID, const Packet& packet, ChatGUI& chatGUI, MainMenuGUI& mainMenuGUI)
 {
     // Process packet
     if (isLobbyHost)
     {
-        processMessageAsHost(message, packet, chatGUI);
+        processMessageAsHost(senderID, packet, chatGUI);
     }
     else
     {
-        processMessageAsClient(message, packet, chatGUI, mainMenuGUI);
+        processMessageAsClient(senderID, packet, chatGUI, mainMenuGUI);
     }
     
     switch (packet.type)
@@ -601,16 +715,16 @@ void NetworkHandler::processMessage(const SteamNetworkingMessage_t& message, con
         {
             if (isLobbyHost)
             {
-                if (!networkPlayers.contains(message.m_identityPeer.GetSteamID64()))
+                if (!networkPlayers.contains(senderID))
                 {
-                    // registerNetworkPlayer(message.m_identityPeer.GetSteamID64());
-                    Log::push(("ERROR: Received player character info for unregistered player ID " + std::to_string(message.m_identityPeer.GetSteamID64()) + "\n").c_str());
+                    // registerNetworkPlayer(senderID);
+                    Log::push(("ERROR: Received player character info for unregistered player ID " + std::to_string(senderID) + "\n").c_str());
                 }
             }
     
             PacketDataPlayerCharacterInfo packetData;
             packetData.deserialise(packet.data);
-            packetData.applyPingEstimate(getPlayerPingLocation(message.m_identityPeer.GetSteamID64()));
+            packetData.applyPingEstimate(getPlayerPingLocation(senderID));
     
             if (networkPlayers.contains(packetData.userID))
             {
@@ -658,6 +772,13 @@ void NetworkHandler::processMessage(const SteamNetworkingMessage_t& message, con
             PacketDataChatMessage packetData;
             packetData.deserialise(packet.data);
 
+            // Commands are executed by host and not forwarded, with reply sent to sender only
+            if (isLobbyHost && CommandConsole::isCommand(packetData.message))
+            {
+                game->executeChatCommand(senderID, packetData.message);
+                break;
+            }
+
             // Forward to clients if host
             if (isLobbyHost)
             {
@@ -746,7 +867,7 @@ void NetworkHandler::processMessage(const SteamNetworkingMessage_t& message, con
             // If host, redistribute to clients (except sending player)
             if (isLobbyHost)
             {
-                sendPacketToClients(packet, k_nSteamNetworkingSend_Reliable, 0, {message.m_identityPeer.GetSteamID64()});
+                sendPacketToClients(packet, k_nSteamNetworkingSend_Reliable, 0, {senderID});
                 
                 if (!game->isLocationStateInitialised(packetData.locationState))
                 {
@@ -768,7 +889,7 @@ void NetworkHandler::processMessage(const SteamNetworkingMessage_t& message, con
                         Packet itemPacket;
                         itemPacket.set(itemPacketData);
     
-                        sendPacketToClient(message.m_identityPeer.GetSteamID64(), itemPacket, k_nSteamNetworkingSend_Reliable, 0);
+                        sendPacketToClient(senderID, itemPacket, k_nSteamNetworkingSend_Reliable, 0);
                     }
                 }
             }
@@ -784,7 +905,14 @@ void NetworkHandler::processMessage(const SteamNetworkingMessage_t& message, con
         {
             PacketDataInventoryAddItem packetData;
             packetData.deserialise(packet.data);
-            game->getInventory().addItem(packetData.itemType, packetData.amount, true);
+            if (packetData.amount >= 0)
+            {
+                game->getInventory().addItem(packetData.itemType, packetData.amount, true);
+            }
+            else
+            {
+                game->getInventory().takeItem(packetData.itemType, -packetData.amount);
+            }
             queueSendPlayerData();
             break;
         }
@@ -856,6 +984,11 @@ void NetworkHandler::processMessage(const SteamNetworkingMessage_t& message, con
 
             landmarkObject->setLandmarkColour(packetData.newColorA, packetData.newColorB);
 
+            if (Chunk* chunkPtr = game->getChunkManager(packetData.planetType).getChunk(packetData.landmarkObjectReference.chunk))
+            {
+                chunkPtr->markContentModified();
+            }
+
             game->getLandmarkManager(packetData.planetType).addLandmark(packetData.landmarkObjectReference);
 
             // Forward to clients
@@ -914,7 +1047,7 @@ void NetworkHandler::processMessage(const SteamNetworkingMessage_t& message, con
             // Redistribute to clients (except sender) if host
             if (isLobbyHost)
             {
-                sendPacketToClients(packet, k_nSteamNetworkingSend_Reliable, 0, {message.m_identityPeer.GetSteamID64()});
+                sendPacketToClients(packet, k_nSteamNetworkingSend_Reliable, 0, {senderID});
             }
             break;
         }
@@ -923,14 +1056,16 @@ void NetworkHandler::processMessage(const SteamNetworkingMessage_t& message, con
     }
 }
 
-void NetworkHandler::processMessageAsHost(const SteamNetworkingMessage_t& message, const Packet& packet, ChatGUI& chatGUI)
+void NetworkHandler::processMessageAsHost(uint64_t senderID, const Packet& packet, ChatGUI& chatGUI)
 {
     switch (packet.type)
     {
         case PacketType::JoinReply:
         {
-            const char* steamName = SteamFriends()->GetFriendPersonaName(message.m_identityPeer.GetSteamID());
-            Log::push("NETWORK: Player joined: " + std::string(steamName) + " (" + std::to_string(message.m_identityPeer.GetSteamID64()) + ")\n");
+            CSteamID senderSteamID;
+            senderSteamID.SetFromUint64(senderID);
+            const char* steamName = SteamFriends()->GetFriendPersonaName(senderSteamID);
+            Log::push("NETWORK: Player joined: " + std::string(steamName) + " (" + std::to_string(senderID) + ")\n");
 
             PacketDataJoinReply packetDataJoinReply;
             packetDataJoinReply.deserialise(packet.data);
@@ -948,15 +1083,15 @@ void NetworkHandler::processMessageAsHost(const SteamNetworkingMessage_t& messag
             bool newPlayer = false;
 
             // Initialise new player data
-            if (!networkPlayerDatasSaved.contains(message.m_identityPeer.GetSteamID64()))
+            if (!networkPlayerDatasSaved.contains(senderID))
             {
                 // Player data does not exist - initialise
                 
                 // Get name from join reply packet
                 
-                networkPlayerDatasSaved[message.m_identityPeer.GetSteamID64()] = PlayerData();
+                networkPlayerDatasSaved[senderID] = PlayerData();
 
-                PlayerData& playerData = networkPlayerDatasSaved[message.m_identityPeer.GetSteamID64()];
+                PlayerData& playerData = networkPlayerDatasSaved[senderID];
 
                 playerData.name = packetDataJoinReply.playerName;
                 playerData.bodyColor = packetDataJoinReply.bodyColor;
@@ -973,11 +1108,11 @@ void NetworkHandler::processMessageAsHost(const SteamNetworkingMessage_t& messag
             else
             {
                 // Data exists - use stored name
-                packetDataJoinReply.playerName = networkPlayerDatasSaved[message.m_identityPeer.GetSteamID64()].name;
+                packetDataJoinReply.playerName = networkPlayerDatasSaved[senderID].name;
             }
 
             // Load planet if required
-            PlayerData& playerData = networkPlayerDatasSaved[message.m_identityPeer.GetSteamID64()];
+            PlayerData& playerData = networkPlayerDatasSaved[senderID];
             if (playerData.locationState.isOnPlanet())
             {    
                 game->loadPlanet(playerData.locationState.getPlanetType());
@@ -1022,11 +1157,11 @@ void NetworkHandler::processMessageAsHost(const SteamNetworkingMessage_t& messag
                 packetData.worldMap.setMapTextureData(game->getChunkManager(packetData.playerData.locationState.getPlanetType()).getWorldMap().getMapTextureData());
             }
 
-            registerNetworkPlayer(message.m_identityPeer.GetSteamID64(), packetDataJoinReply.playerName, packetDataJoinReply.pingLocation, &chatGUI);
+            registerNetworkPlayer(senderID, packetDataJoinReply.playerName, packetDataJoinReply.pingLocation, &chatGUI);
             
             Packet packetToSend;
             packetToSend.set(packetData, true);
-            sendPacketToClient(message.m_identityPeer.GetSteamID64(), packetToSend, k_nSteamNetworkingSend_Reliable, 0);
+            sendPacketToClient(senderID, packetToSend, k_nSteamNetworkingSend_Reliable, 0);
             break;
         }
         case PacketType::ItemPickupsCreateRequest:
@@ -1078,14 +1213,22 @@ void NetworkHandler::processMessageAsHost(const SteamNetworkingMessage_t& messag
         {
             PacketDataMeleeRequest packetData;
             packetData.deserialise(packet.data);
-            game->testMeleeCollision(LocationState::createFromPlanetType(packetData.planetType), packetData.hitRects, packetData.hitOrigin);
+            game->testMeleeCollision(LocationState::createFromPlanetType(packetData.planetType), packetData.hitRects, packetData.hitOrigin,
+                packetData.viewNetworkTick);
             break;
         }
         case PacketType::ChunkRequests:
         {
             PacketDataChunkRequests packetData;
             packetData.deserialise(packet.data);
-            game->handleChunkRequestsFromClient(packetData, message.m_identityPeer);
+            game->handleChunkRequestsFromClient(packetData, senderID);
+            break;
+        }
+        case PacketType::ChunkResyncRequests:
+        {
+            PacketDataChunkResyncRequests packetData;
+            packetData.deserialise(packet.data);
+            chunkStreamer.resyncChunks(senderID, packetData, *game, *this);
             break;
         }
         case PacketType::ChestDataModified:
@@ -1093,18 +1236,19 @@ void NetworkHandler::processMessageAsHost(const SteamNetworkingMessage_t& messag
             PacketDataChestDataModified packetData;
             packetData.deserialise(packet.data);
             game->getChestDataPool(packetData.locationState).overwriteChestData(packetData.chestID, packetData.chestData);
-            Log::push(("NETWORK: Received chest data from " + std::string(SteamFriends()->GetFriendPersonaName(message.m_identityPeer.GetSteamID())) + "\n").c_str());
+            Log::push(("NETWORK: Received chest data from " + getPlayerName(senderID) + "\n").c_str());
             break;
         }
         case PacketType::ProjectileCreateRequest:
         {
             PacketDataProjectileCreateRequest packetData;
             packetData.deserialise(packet.data);
-            packetData.applyPingEstimate(getPlayerPingLocation(message.m_identityPeer.GetSteamID64()));
+            packetData.applyPingEstimate(getPlayerPingLocation(senderID));
 
             const ToolData& weaponData = ToolDataLoader::getToolData(packetData.weaponType);
             Projectile projectile(packetData.projectile.getPosition(), packetData.projectile.getVelocity(),
-                packetData.projectile.getType(), weaponData.projectileDamageMult, HitLayer::Entity);
+                packetData.projectile.getType(), weaponData.projectileDamageMult, HitLayer::Entity,
+                game->getChunkManager(packetData.planetType).getRandomStream(RandomStreamType::Projectile));
 
             game->getProjectileManager(packetData.planetType).addProjectile(projectile, packetData.weaponType);
             break;
@@ -1120,7 +1264,7 @@ void NetworkHandler::processMessageAsHost(const SteamNetworkingMessage_t& messag
                 break;
             }
 
-            if (!game->canPlayerSpawnBoss(packetData.planetType, packetData.bossSpawnItem, *getNetworkPlayer(message.m_identityPeer.GetSteamID64())))
+            if (!game->canPlayerSpawnBoss(packetData.planetType, packetData.bossSpawnItem, *getNetworkPlayer(senderID)))
             {
                 break;
             }
@@ -1131,7 +1275,7 @@ void NetworkHandler::processMessageAsHost(const SteamNetworkingMessage_t& messag
             packetDataReply.bossSpawnItem = packetData.bossSpawnItem;
 
             Packet packetReply(packetDataReply);
-            sendPacketToClient(message.m_identityPeer.GetSteamID64(), packetDataReply, k_nSteamNetworkingSend_Reliable, 0);
+            sendPacketToClient(senderID, packetDataReply, k_nSteamNetworkingSend_Reliable, 0);
             break;
         }
         case PacketType::BossSpawnRequest:
@@ -1145,7 +1289,7 @@ void NetworkHandler::processMessageAsHost(const SteamNetworkingMessage_t& messag
                 break;
             }
 
-            game->attemptSpawnBoss(packetData.planetType, packetData.bossSpawnItem, *getNetworkPlayer(message.m_identityPeer.GetSteamID64()));
+            game->attemptSpawnBoss(packetData.planetType, packetData.bossSpawnItem, *getNetworkPlayer(senderID));
             break;
         }
         case PacketType::RocketEnterRequest:
@@ -1172,7 +1316,7 @@ void NetworkHandler::processMessageAsHost(const SteamNetworkingMessage_t& messag
                 rocketEnterReply.locationState = packetData.locationState;
                 rocketEnterReply.rocketObjectReference = packetData.rocketObjectReference;
                 Packet packetRocketEnterReply(rocketEnterReply);
-                sendPacketToClient(message.m_identityPeer.GetSteamID64(), packetRocketEnterReply, k_nSteamNetworkingSend_Reliable, 0);
+                sendPacketToClient(senderID, packetRocketEnterReply, k_nSteamNetworkingSend_Reliable, 0);
             }
             break;
         }
@@ -1180,7 +1324,7 @@ void NetworkHandler::processMessageAsHost(const SteamNetworkingMessage_t& messag
         {
             PacketDataPlanetTravelRequest packetData;
             packetData.deserialise(packet.data);
-            packetData.userId = message.m_identityPeer.GetSteamID64();
+            packetData.userId = senderID;
             planetTravelRequests.push_back(packetData);
             break;
         }
@@ -1188,7 +1332,7 @@ void NetworkHandler::processMessageAsHost(const SteamNetworkingMessage_t& messag
         {
             PacketDataRoomTravelRequest packetData;
             packetData.deserialise(packet.data);
-            packetData.userId = message.m_identityPeer.GetSteamID64();
+            packetData.userId = senderID;
             roomTravelRequests.push_back(packetData);
             break;
         }
@@ -1203,14 +1347,14 @@ void NetworkHandler::processMessageAsHost(const SteamNetworkingMessage_t& messag
             if (structureID.has_value())
             {
                 Log::push(("NETWORK: Sending structure enter reply to " +
-                    std::string(SteamFriends()->GetFriendPersonaName(message.m_identityPeer.GetSteamID())) + "\n").c_str());
+                    getPlayerName(senderID) + "\n").c_str());
 
                 packetDataReply.structureID = structureID.value();
                 packetDataReply.planetType = packetData.planetType;
                 packetDataReply.chunkPos = packetData.chunkPos;
                 Packet replyPacket;
                 replyPacket.set(packetDataReply);
-                sendPacketToClient(message.m_identityPeer.GetSteamID64(), replyPacket, k_nSteamNetworkingSend_Reliable, 0);
+                sendPacketToClient(senderID, replyPacket, k_nSteamNetworkingSend_Reliable, 0);
             }
             break;
         }
@@ -1219,7 +1363,7 @@ void NetworkHandler::processMessageAsHost(const SteamNetworkingMessage_t& messag
     }
 }
 
-void NetworkHandler::processMessageAsClient(const SteamNetworkingMessage_t& message, const Packet& packet, ChatGUI& chatGUI, MainMenuGUI& mainMenuGUI)
+void NetworkHandler::processMessageAsClient(uint64_t senderID, const Packet& packet, ChatGUI& chatGUI, MainMenuGUI& mainMenuGUI)
 {
     switch (packet.type)
     {
@@ -1235,7 +1379,7 @@ void NetworkHandler::processMessageAsClient(const SteamNetworkingMessage_t& mess
                 break;
             }
             
-            lobbyHost = message.m_identityPeer.GetSteamID64();
+            lobbyHost = senderID;
             isLobbyHost = false;
 
             game->joinedLobby(packetData.requiresNameInput);
@@ -1248,7 +1392,7 @@ void NetworkHandler::processMessageAsClient(const SteamNetworkingMessage_t& mess
             packetData.deserialise(packet.data);
 
             // Set lobby host
-            lobbyHost = message.m_identityPeer.GetSteamID64();
+            lobbyHost = senderID;
             isLobbyHost = false;
             
             multiplayerGame = true;
@@ -1288,11 +1432,18 @@ void NetworkHandler::processMessageAsClient(const SteamNetworkingMessage_t& mess
             game->quitWorld();
             break;
         }
+        case PacketType::PlayerTeleport:
+        {
+            PacketDataPlayerTeleport packetData;
+            packetData.deserialise(packet.data);
+            game->teleportLocalPlayer(pl::Vector2f(packetData.positionX, packetData.positionY));
+            break;
+        }
         case PacketType::ServerInfo:
         {
             PacketDataServerInfo serverInfo;
             serverInfo.deserialise(packet.data);
-            serverInfo.applyPingEstimate(getPlayerPingLocation(message.m_identityPeer.GetSteamID64()));
+            serverInfo.applyPingEstimate(getPlayerPingLocation(senderID));
 
             game->setGameTime(serverInfo.gameTime);
             game->getDayCycleManager(true).setCurrentDay(serverInfo.day);
@@ -1330,43 +1481,57 @@ void NetworkHandler::processMessageAsClient(const SteamNetworkingMessage_t& mess
             handleChunkModifiedAlertsFromHost(packetData);
             break;
         }
+        case PacketType::ChunkEdits:
+        {
+            PacketDataChunkEdits packetData;
+            packetData.deserialise(packet.data);
+            if (game->getLocationState().getPlanetType() != packetData.planetType)
+            {
+                Log::push("ERROR: Received chunk edits for incorrect planet type {}\n", packetData.planetType);
+                break;
+            }
+            game->handleChunkEditsFromHost(packetData);
+            break;
+        }
         case PacketType::Entities:
         {
             PacketDataEntities packetData;
             packetData.deserialise(packet.data);
-            packetData.applyPingEstimate(getPlayerPingLocation(message.m_identityPeer.GetSteamID64()));
+            packetData.applyPingEstimate(getPlayerPingLocation(senderID));
             if (game->getLocationState().getPlanetType() != packetData.planetType)
             {
                 Log::push("ERROR: Received entity data for incorrect planet type {}\n", packetData.planetType);
                 break;
             }
             game->getChunkManager().loadEntityPacketDatas(packetData);
+            entityViewNetworkTick = packetData.networkTick;
             break;
         }
         case PacketType::Projectiles:
         {
             PacketDataProjectiles packetData;
             packetData.deserialise(packet.data);
-            packetData.applyPingEstimate(getPlayerPingLocation(message.m_identityPeer.GetSteamID64()));
+            packetData.applyPingEstimate(getPlayerPingLocation(senderID));
             if (game->getLocationState().getPlanetType() != packetData.planetType)
             {
                 Log::push("ERROR: Received projectile data for incorrect planet type {}\n", packetData.planetType);
                 break;
             }
-            game->getProjectileManager(packetData.planetType).getProjectiles() = packetData.projectileManager.getProjectiles();
+            game->getProjectileManager(packetData.planetType).overwriteProjectiles(packetData.projectileManager);
             break;
         }
         case PacketType::Bosses:
         {
             PacketDataBosses packetData;
             packetData.deserialise(packet.data);
-            packetData.applyPingEstimate(getPlayerPingLocation(message.m_identityPeer.GetSteamID64()));
+            packetData.applyPingEstimate(getPlayerPingLocation(senderID));
             if (game->getLocationState().getPlanetType() != packetData.planetType)
             {
                 Log::push("ERROR: Received boss data for incorrect planet type {}\n", packetData.planetType);
                 break;
             }
             game->getBossManager(packetData.planetType) = packetData.bossManager;
+            bossViewNetworkTick = packetData.networkTick;
             break;
         }
         case PacketType::BossSpawnCheckReply:
@@ -1467,6 +1632,7 @@ void NetworkHandler::sendGameUpdates(float dt, const Camera& camera)
     // Update tick
     updateTick = 0.0f;
     updateTickCount = (updateTickCount + 1) % MAX_UPDATE_TICK_COUNT;
+    networkTick++;
 
     if (isLobbyHost)
     {
@@ -1485,7 +1651,8 @@ void NetworkHandler::sendGameUpdatesToClients(float dt)
         return;
     }
 
-    uint64_t steamID = SteamUser()->GetSteamID().ConvertToUint64();
+    // Host is lobby host, which is also set from recorded lobby creation when replaying without Steam
+    uint64_t steamID = lobbyHost;
 
     std::unordered_map<uint64_t, Packet> playerInfoPackets;
     
@@ -1539,6 +1706,21 @@ void NetworkHandler::sendGameUpdatesToClients(float dt)
         sendPacketToClient(client.first, serverInfoPacket, k_nSteamNetworkingSend_Unreliable, 0);
     }
 
+    // Record entity and boss positions being sent, for lag compensated hit tests
+    std::unordered_set<PlanetType> clientPlanetTypes;
+    for (auto iter = networkPlayers.begin(); iter != networkPlayers.end(); iter++)
+    {
+        if (iter->second.getPlayerData().locationState.isOnPlanet())
+        {
+            clientPlanetTypes.insert(iter->second.getPlayerData().locationState.getPlanetType());
+        }
+    }
+
+    for (PlanetType planetType : clientPlanetTypes)
+    {
+        game->getHitboxHistory(planetType).recordSnapshot(networkTick, game->getChunkManager(planetType), game->getBossManager(planetType));
+    }
+
     // Send entity datas to each client as required
     for (auto iter = networkPlayers.begin(); iter != networkPlayers.end(); iter++)
     {
@@ -1550,6 +1732,7 @@ void NetworkHandler::sendGameUpdatesToClients(float dt)
         PlanetType playerPlanetType = iter->second.getPlayerData().locationState.getPlanetType();
         
         PacketDataEntities packetData = game->getChunkManager(playerPlanetType).getEntityPacketDatas(iter->second.getChunkViewRange());
+        packetData.networkTick = networkTick;
         
         Packet packet;
         packet.set(packetData, true);
@@ -1594,6 +1777,7 @@ void NetworkHandler::sendGameUpdatesToClients(float dt)
         PacketDataBosses packetData;
         packetData.planetType = playerPlanetType;
         packetData.bossManager = game->getBossManager(playerPlanetType);
+        packetData.networkTick = networkTick;
 
         Packet packet;
         packet.set(packetData, true);
@@ -1699,7 +1883,19 @@ EResult NetworkHandler::sendPacketToClient(uint64_t steamID, const Packet& packe
         return EResult::k_EResultAccessDenied;
     }
 
+    if (threadPacketBuffer)
+    {
+        threadPacketBuffer->push_back(BufferedPacket{steamID, packet, nSendFlags, nRemoteChannel});
+        return EResult::k_EResultOK;
+    }
+
     totalBytesSent += packet.getSize();
+    telemetry.recordSent(steamID, packet, nSendFlags);
+
+    if (replaying)
+    {
+        return EResult::k_EResultOK;
+    }
 
     SteamNetworkingIdentity identity;
     identity.SetSteamID64(steamID);
@@ -1707,6 +1903,21 @@ EResult NetworkHandler::sendPacketToClient(uint64_t steamID, const Packet& packe
     return packet.sendToUser(identity, nSendFlags, nRemoteChannel);
 }
 
+void NetworkHandler::setThreadPacketBuffer(std::vector<BufferedPacket>* packetBuffer)
+{
+    threadPacketBuffer = packetBuffer;
+}
+
+void NetworkHandler::flushPacketBuffer(std::vector<BufferedPacket>& packetBuffer)
+{
+    for (const BufferedPacket& bufferedPacket : packetBuffer)
+    {
+        sendPacketToClient(bufferedPacket.steamID, bufferedPacket.packet, bufferedPacket.nSendFlags, bufferedPacket.nRemoteChannel);
+    }
+
+    packetBuffer.clear();
+}
+
 EResult NetworkHandler::sendPacketToHost(const Packet& packet, int nSendFlags, int nRemoteChannel)
 {
     if (!multiplayerGame)
@@ -1720,6 +1931,12 @@ EResult NetworkHandler::sendPacketToHost(const Packet& packet, int nSendFlags, i
     }
 
     totalBytesSent += packet.getSize();
+    telemetry.recordSent(lobbyHost, packet, nSendFlags);
+
+    if (replaying)
+    {
+        return EResult::k_EResultOK;
+    }
 
     SteamNetworkingIdentity hostIdentity;
     hostIdentity.SetSteamID64(lobbyHost);
@@ -1853,17 +2070,38 @@ void NetworkHandler::handleChunkModifiedAlertsFromHost(const PacketDataChunkModi
 {
     std::vector<ChunkPosition> chunksToRequest;
 
+    PacketDataChunkResyncRequests resyncRequests;
+    resyncRequests.planetType = chunkModifiedAlerts.planetType;
+
     // Only request chunks from host if already generated (as modification to chunk does not concern us if we do not already have it in memory)
     for (ChunkPosition chunkPosition : chunkModifiedAlerts.chunkRequests)
     {
-        if (game->getChunkManager().isChunkGenerated(chunkPosition))
+        if (!game->getChunkManager().isChunkGenerated(chunkPosition))
+        {
+            continue;
+        }
+
+        // Host version of chunk not known - request full chunk
+        Chunk* chunkPtr = game->getChunkManager().getChunk(chunkPosition);
+        if (!chunkPtr || chunkPtr->getHostContentVersion() == 0)
         {
             chunksToRequest.push_back(chunkPosition);
+            continue;
         }
+
+        resyncRequests.resyncRequests.push_back({chunkPosition, chunkPtr->getHostContentVersion()});
     }
 
     // Force request (ignore cooldown as host has alerted modification of chunks)
     requestChunksFromHost(chunkModifiedAlerts.planetType, chunksToRequest, true);
+
+    // Host sends edits since version held, or full chunks if required
+    if (resyncRequests.resyncRequests.size() > 0)
+    {
+        Packet packet;
+        packet.set(resyncRequests);
+        sendPacketToHost(packet, k_nSteamNetworkingSend_Reliable, 0);
+    }
 }
 
 void NetworkHandler::sendPlayerData()
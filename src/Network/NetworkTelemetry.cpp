@@ -0,0 +1,256 @@
+#include "Network/NetworkTelemetry.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <filesystem>
+
+#include "IO/Log.hpp"
+
+void PacketTypeCounters::add(const PacketTypeCounters& counters)
+{
+    messages += counters.messages;
+    rawBytes += counters.rawBytes;
+    compressedBytes += counters.compressedBytes;
+    reliableSends += counters.reliableSends;
+    unreliableSends += counters.unreliableSends;
+}
+
+std::array<float, PeerSendQueueStats::HISTOGRAM_BIN_COUNT> PeerSendQueueStats::getHistogram() const
+{
+    // Upper bound of each bin in bytes, last bin is unbounded
+    static constexpr std::array<int, HISTOGRAM_BIN_COUNT - 1> BIN_LIMITS = {1, 1024, 4 * 1024, 16 * 1024, 64 * 1024};
+
+    std::array<float, HISTOGRAM_BIN_COUNT> histogram = {};
+
+    for (int i = 0; i < sampleCount; i++)
+    {
+        int bin = 0;
+        while (bin < BIN_LIMITS.size() && pendingBytesSamples[i] >= BIN_LIMITS[bin])
+        {
+            bin++;
+        }
+        histogram[bin]++;
+    }
+
+    return histogram;
+}
+
+const char* PeerSendQueueStats::getHistogramBinName(int bin)
+{
+    static constexpr std::array<const char*, HISTOGRAM_BIN_COUNT> BIN_NAMES = {"0", "<1KB", "<4KB", "<16KB", "<64KB", ">=64KB"};
+    return BIN_NAMES[bin];
+}
+
+void NetworkTelemetry::reset()
+{
+    peers.clear();
+    currentBucket = 0;
+    bucketTime = 0.0f;
+    sendQueueSampleTime = 0.0f;
+}
+
+void NetworkTelemetry::recordSent(uint64_t peerID, const Packet& packet, int nSendFlags)
+{
+    PeerTelemetry& peer = peers[peerID];
+
+    PacketTypeCounters counters;
+    counters.messages = 1;
+    counters.rawBytes = packet.getUncompressedSize();
+    counters.compressedBytes = packet.getSize();
+
+    if (nSendFlags & k_nSteamNetworkingSend_Reliable)
+    {
+        counters.reliableSends = 1;
+    }
+    else
+    {
+        counters.unreliableSends = 1;
+    }
+
+    peer.windowBuckets[currentBucket].sent[packet.type].add(counters);
+    peer.total.sent[packet.type].add(counters);
+}
+
+void NetworkTelemetry::recordReceived(uint64_t peerID, const Packet& packet, int receivedSize)
+{
+    PeerTelemetry& peer = peers[peerID];
+
+    PacketTypeCounters counters;
+    counters.messages = 1;
+    counters.rawBytes = packet.getUncompressedSize();
+    counters.compressedBytes = receivedSize;
+
+    peer.windowBuckets[currentBucket].received[packet.type].add(counters);
+    peer.total.received[packet.type].add(counters);
+}
+
+void NetworkTelemetry::update(float dt, const std::vector<uint64_t>& peerIDs, bool sampleSendQueues)
+{
+    bucketTime += dt;
+    if (bucketTime >= WINDOW_BUCKET_TIME)
+    {
+        bucketTime = 0.0f;
+        currentBucket = (currentBucket + 1) % WINDOW_BUCKET_COUNT;
+
+        // Clear oldest bucket for reuse
+        for (auto& peer : peers)
+        {
+            peer.second.windowBuckets[currentBucket] = PeerPacketCounters();
+        }
+    }
+
+    if (!sampleSendQueues)
+    {
+        return;
+    }
+
+    sendQueueSampleTime += dt;
+    if (sendQueueSampleTime < SEND_QUEUE_SAMPLE_TIME)
+    {
+        return;
+    }
+
+    sendQueueSampleTime = 0.0f;
+
+    for (uint64_t peerID : peerIDs)
+    {
+        sampleSendQueue(peerID, peers[peerID].sendQueueStats);
+    }
+}
+
+void NetworkTelemetry::sampleSendQueue(uint64_t peerID, PeerSendQueueStats& sendQueueStats)
+{
+    SteamNetworkingIdentity identity;
+    identity.SetSteamID64(peerID);
+
+    SteamNetConnectionRealTimeStatus_t status;
+    ESteamNetworkingConnectionState state = SteamNetworkingMessages()->GetSessionConnectionInfo(identity, nullptr, &status);
+
+    if (state != k_ESteamNetworkingConnectionState_Connected)
+    {
+        return;
+    }
+
+    sendQueueStats.pendingBytes = status.m_cbPendingReliable + status.m_cbPendingUnreliable;
+    sendQueueStats.ping = status.m_nPing;
+    sendQueueStats.queueTimeMs = status.m_usecQueueTime / 1000.0f;
+
+    sendQueueStats.pendingBytesSamples[sendQueueStats.sampleIndex] = sendQueueStats.pendingBytes;
+    sendQueueStats.sampleIndex = (sendQueueStats.sampleIndex + 1) % PeerSendQueueStats::SAMPLE_COUNT;
+    sendQueueStats.sampleCount = std::min(sendQueueStats.sampleCount + 1, PeerSendQueueStats::SAMPLE_COUNT);
+}
+
+PeerPacketCounters NetworkTelemetry::getWindowCounters(uint64_t peerID) const
+{
+    PeerPacketCounters windowCounters;
+
+    auto iter = peers.find(peerID);
+    if (iter == peers.end())
+    {
+        return windowCounters;
+    }
+
+    for (const PeerPacketCounters& bucket : iter->second.windowBuckets)
+    {
+        for (const auto& [packetType, counters] : bucket.sent)
+        {
+            windowCounters.sent[packetType].add(counters);
+        }
+        for (const auto& [packetType, counters] : bucket.received)
+        {
+            windowCounters.received[packetType].add(counters);
+        }
+    }
+
+    return windowCounters;
+}
+
+PeerPacketCounters NetworkTelemetry::getTotalCounters(uint64_t peerID) const
+{
+    auto iter = peers.find(peerID);
+    if (iter == peers.end())
+    {
+        return PeerPacketCounters();
+    }
+
+    return iter->second.total;
+}
+
+const PeerSendQueueStats* NetworkTelemetry::getSendQueueStats(uint64_t peerID) const
+{
+    auto iter = peers.find(peerID);
+    if (iter == peers.end())
+    {
+        return nullptr;
+    }
+
+    return &iter->second.sendQueueStats;
+}
+
+std::vector<uint64_t> NetworkTelemetry::getPeerIDs() const
+{
+    std::vector<uint64_t> peerIDs;
+    for (const auto& peer : peers)
+    {
+        peerIDs.push_back(peer.first);
+    }
+
+    std::sort(peerIDs.begin(), peerIDs.end());
+
+    return peerIDs;
+}
+
+std::string NetworkTelemetry::getDefaultCSVPath()
+{
+    return sago::getDataHome() + "/Planeturem/Logs/" + Log::filename + "-network.csv";
+}
+
+bool NetworkTelemetry::exportCSV(const std::string& path) const
+{
+    std::filesystem::path dir = std::filesystem::path(path).parent_path();
+    if (!dir.empty() && !std::filesystem::exists(dir))
+    {
+        std::filesystem::create_directories(dir);
+    }
+
+    std::ofstream out(path);
+    if (!out)
+    {
+        Log::push("ERROR: Could not write network telemetry to \"{}\"\n", path);
+        return false;
+    }
+
+    out << "peer,direction,packet_type,window_messages,window_raw_bytes,window_compressed_bytes,window_reliable,window_unreliable,"
+        "total_messages,total_raw_bytes,total_compressed_bytes,total_reliable,total_unreliable\n";
+
+    auto writeRows = [&out](uint64_t peerID, const char* direction, const std::map<PacketType, PacketTypeCounters>& windowCounters,
+        const std::map<PacketType, PacketTypeCounters>& totalCounters)
+    {
+        // Total counters contain every packet type seen in window
+        for (const auto& [packetType, total] : totalCounters)
+        {
+            PacketTypeCounters window;
+            if (windowCounters.contains(packetType))
+            {
+                window = windowCounters.at(packetType);
+            }
+
+            out << peerID << ',' << direction << ',' << getPacketTypeName(packetType) << ','
+                << window.messages << ',' << window.rawBytes << ',' << window.compressedBytes << ',' << window.reliableSends << ',' << window.unreliableSends << ','
+                << total.messages << ',' << total.rawBytes << ',' << total.compressedBytes << ',' << total.reliableSends << ',' << total.unreliableSends << '\n';
+        }
+    };
+
+    for (uint64_t peerID : getPeerIDs())
+    {
+        PeerPacketCounters windowCounters = getWindowCounters(peerID);
+        const PeerPacketCounters& totalCounters = peers.at(peerID).total;
+
+        writeRows(peerID, "sent", windowCounters.sent, totalCounters.sent);
+        writeRows(peerID, "received", windowCounters.received, totalCounters.received);
+    }
+
+    Log::push("Wrote network telemetry to \"{}\"\n", path);
+
+    return true;
+}
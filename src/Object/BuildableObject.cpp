@@ -32,7 +32,7 @@ BuildableObject::BuildableObject(pl::Vector2f position, ObjectType objectType, c
     // Randomise animation start frame
     if (parameters.randomiseAnimation && objectData.textureRects.size() > 0)
     {
-        animatedTexture.setFrame(rand() % objectData.textureRects.size());
+        animatedTexture.setFrame(Helper::randInt(0, objectData.textureRects.size() - 1));
     }
 }
 
@@ -187,11 +187,11 @@ bool BuildableObject::damage(int amount, Game& game, ChunkManager& chunkManager,
     {
         // Play hit sound
         SoundType hitSound = SoundType::HitObject;
-        int soundChance = rand() % 3;
+        int soundChance = Helper::randInt(0, 2);
         if (soundChance == 1) hitSound = SoundType::HitObject2;
         else if (soundChance == 2) hitSound = SoundType::HitObject3;
 
-        Sounds::playSound(hitSound, 60.0f);
+        Sounds::playSoundAt(hitSound, position, 60.0f);
 
         if (particleSystem)
         {
@@ -292,7 +292,9 @@ void BuildableObject::createHitMarker(int amount)
 
 void BuildableObject::createItemPickups(ChunkManager& chunkManager, Game& game, const std::vector<ItemDrop>& itemDrops, float gameTime)
 {
-    float dropChance = (rand() % 1000) / 1000.0f;
+    RandomStream& randomStream = chunkManager.getRandomStream(RandomStreamType::ItemDrop);
+
+    float dropChance = randomStream.randInt(0, 999) / 1000.0f;
 
     const ObjectData& objectData = ObjectDataLoader::getObjectData(objectType);
 
@@ -301,11 +303,11 @@ void BuildableObject::createItemPickups(ChunkManager& chunkManager, Game& game,
         if (dropChance < itemDrop.chance)
         {
             // Give items
-            unsigned int itemAmount = rand() % std::max(itemDrop.maxAmount - itemDrop.minAmount + 1, 1U) + itemDrop.minAmount;
+            unsigned int itemAmount = randomStream.randInt(itemDrop.minAmount, std::max(itemDrop.maxAmount, itemDrop.minAmount));
 
             pl::Vector2f spawnPos = position - pl::Vector2f(0.5f, 0.5f) * TILE_SIZE_PIXELS_UNSCALED;
-            spawnPos.x += Helper::randFloat(0.0f, objectData.size.x * TILE_SIZE_PIXELS_UNSCALED);
-            spawnPos.y += Helper::randFloat(0.0f, objectData.size.y * TILE_SIZE_PIXELS_UNSCALED);
+            spawnPos.x += randomStream.randFloat(0.0f, objectData.size.x * TILE_SIZE_PIXELS_UNSCALED);
+            spawnPos.y += randomStream.randFloat(0.0f, objectData.size.y * TILE_SIZE_PIXELS_UNSCALED);
 
             chunkManager.addItemPickup(ItemPickup(spawnPos, itemDrop.item, gameTime, itemAmount), &game.getNetworkHandler());
         }
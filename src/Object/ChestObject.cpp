@@ -74,6 +74,7 @@ void ChestObject::interact(Game& game, bool isClient)
         {
             const ObjectData& objectData = ObjectDataLoader::getObjectData(objectType);
             chestID = game.getChestDataPool().createChest(objectData.chestCapacity);
+            markChestIDModified(game, std::nullopt);
         }
     
         // If chestID is still 0xFFFF, then max chest number has been reached
@@ -108,9 +109,42 @@ uint16_t ChestObject::createChestID(Game& game, std::optional<LocationState> loc
 {
     const ObjectData& objectData = ObjectDataLoader::getObjectData(objectType);
     chestID = game.getChestDataPool(locationState).createChest(objectData.chestCapacity);
+    markChestIDModified(game, locationState);
     return chestID;
 }
 
+void ChestObject::markChestIDModified(Game& game, std::optional<LocationState> locationState)
+{
+    if (chestID == 0xFFFF)
+    {
+        return;
+    }
+
+    if (!locationState.has_value())
+    {
+        locationState = game.getLocationState();
+    }
+
+    // Rooms are not versioned, only chunks
+    if (!locationState->isOnPlanet())
+    {
+        return;
+    }
+
+    ChunkManager& chunkManager = game.getChunkManager(locationState->getPlanetType());
+
+    Chunk* chunk = chunkManager.getChunk(getChunkInside(chunkManager.getWorldSize()));
+    if (chunk == nullptr)
+    {
+        return;
+    }
+
+    // Chest ID is saved and sent as part of object, so chunk must be saved and resent to clients
+    chunk->markModified();
+    pl::Vector2<int> tile = getChunkTileInside(chunkManager.getWorldSize());
+    chunk->markObjectModified(tile);
+}
+
 void ChestObject::openChest()
 {
     // Play open chest animation
@@ -2,69 +2,22 @@
 #include "Game.hpp"
 #include "Network/PacketData/PacketDataWorld/PacketDataParticle.hpp"
 
+#include <algorithm>
+
 Particle::Particle()
 {
-    currentFrame = 0;
-    frameTimer = 0.0f;
+    drawLayer = 0;
 }
 
 Particle::Particle(pl::Vector2f position, pl::Vector2f velocity, pl::Vector2f acceleration, int drawLayer, const ParticleStyle& style)
-    : WorldObject(position)
 {
+    this->position = position;
     this->velocity = velocity;
     this->acceleration = acceleration;
 
     this->drawLayer = drawLayer;
 
     particleStyle = style;
-    currentFrame = 0;
-    frameTimer = 0.0f;
-}
-
-void Particle::update(float dt)
-{
-    velocity += acceleration * dt;
-    position += velocity * dt;
-
-    frameTimer += dt;
-    if (frameTimer >= particleStyle.timePerFrame)
-    {
-        frameTimer = 0.0f;
-        currentFrame++;
-    }
-}
-
-void Particle::draw(pl::RenderTarget& window, pl::SpriteBatch& spriteBatch, Game& game, const Camera& camera, float dt, float gameTime, int worldSize,
-    const pl::Color& color) const
-{
-    draw(window, spriteBatch, camera, worldSize);
-}
-
-void Particle::draw(pl::RenderTarget& window, pl::SpriteBatch& spriteBatch, const Camera& camera, int worldSize) const
-{
-    float scale = ResolutionHandler::getScale();
-
-    pl::DrawData drawData;
-    drawData.position = camera.worldToScreenTransform(position, worldSize);
-    drawData.texture = TextureManager::getTexture(TextureType::Objects);
-    drawData.shader = Shaders::getShader(ShaderType::Default);
-    drawData.textureRect = particleStyle.textureRects[std::min(currentFrame, static_cast<int>(particleStyle.textureRects.size()) - 1)];
-    drawData.scale = pl::Vector2f(scale, scale);
-    drawData.centerRatio = pl::Vector2f(0.5, 0.5);
-
-    // float timeAlive = currentFrame * timePerFrame + frameTimer;
-    // float lifetime = textureRects.size() * timePerFrame;
-
-    // float alpha = std::min((lifetime - timeAlive) / (lifetime * 0.2f), 1.0f);
-
-    drawData.color = pl::Color(255, 255, 255, 255 * particleStyle.alpha);
-
-    spriteBatch.draw(window, drawData);
-}
-
-bool Particle::isAlive()
-{
-    return (currentFrame < particleStyle.textureRects.size());
 }
 
 // void Particle::handleWorldWrap(pl::Vector2f positionDelta)
@@ -86,32 +39,148 @@ void ParticleSystem::addParticle(const Particle& particle, const LocationState&
 
     if (!game || game->getLocationState() == locationState)
     {
-        particles.push_back(particle);
+        positions.push_back(particle.position);
+        velocities.push_back(particle.velocity);
+        accelerations.push_back(particle.acceleration);
+        frameTimers.push_back(0.0f);
+        timesPerFrame.push_back(particle.particleStyle.timePerFrame);
+        currentFrames.push_back(0);
+        frameCounts.push_back(particle.particleStyle.textureRects.size());
+        drawLayers.push_back(particle.drawLayer);
+        styles.push_back(particle.particleStyle);
     }
 }
 
 void ParticleSystem::update(float dt)
 {
-    for (auto iter = particles.begin(); iter != particles.end();)
+    int particleCount = positions.size();
+
+    // Kept as separate simple loops over contiguous data so can be vectorised
+    for (int i = 0; i < particleCount; i++)
+    {
+        velocities[i] += accelerations[i] * dt;
+    }
+
+    for (int i = 0; i < particleCount; i++)
+    {
+        positions[i] += velocities[i] * dt;
+    }
+
+    for (int i = 0; i < particleCount; i++)
+    {
+        frameTimers[i] += dt;
+    }
+
+    for (int i = 0; i < particleCount; i++)
+    {
+        bool nextFrame = (frameTimers[i] >= timesPerFrame[i]);
+        currentFrames[i] += nextFrame;
+        frameTimers[i] = nextFrame ? 0.0f : frameTimers[i];
+    }
+
+    compactParticles();
+}
+
+void ParticleSystem::compactParticles()
+{
+    int particleCount = positions.size();
+    int aliveCount = 0;
+
+    for (int i = 0; i < particleCount; i++)
     {
-        iter->update(dt);
-        if (!iter->isAlive())
+        if (currentFrames[i] >= frameCounts[i])
         {
-            iter = particles.erase(iter);
             continue;
         }
-        iter++;
+
+        if (aliveCount != i)
+        {
+            positions[aliveCount] = positions[i];
+            velocities[aliveCount] = velocities[i];
+            accelerations[aliveCount] = accelerations[i];
+            frameTimers[aliveCount] = frameTimers[i];
+            timesPerFrame[aliveCount] = timesPerFrame[i];
+            currentFrames[aliveCount] = currentFrames[i];
+            frameCounts[aliveCount] = frameCounts[i];
+            drawLayers[aliveCount] = drawLayers[i];
+            styles[aliveCount] = std::move(styles[i]);
+        }
+
+        aliveCount++;
+    }
+
+    if (aliveCount == particleCount)
+    {
+        return;
     }
+
+    positions.resize(aliveCount);
+    velocities.resize(aliveCount);
+    accelerations.resize(aliveCount);
+    frameTimers.resize(aliveCount);
+    timesPerFrame.resize(aliveCount);
+    currentFrames.resize(aliveCount);
+    frameCounts.resize(aliveCount);
+    drawLayers.resize(aliveCount);
+    styles.resize(aliveCount);
 }
 
 void ParticleSystem::draw(pl::RenderTarget& window, pl::SpriteBatch& spriteBatch, const Camera& camera, int worldSize) const
 {
-    for (auto iter = particles.begin(); iter != particles.end(); iter++)
+    for (int i = 0; i < positions.size(); i++)
     {
-        iter->draw(window, spriteBatch, camera, worldSize);
+        drawParticle(window, spriteBatch, camera, worldSize, i);
     }
 }
 
+void ParticleSystem::drawLayer(pl::RenderTarget& window, pl::SpriteBatch& spriteBatch, const Camera& camera, int worldSize, int drawLayer) const
+{
+    for (int i = 0; i < positions.size(); i++)
+    {
+        if (drawLayers[i] != drawLayer)
+        {
+            continue;
+        }
+
+        drawParticle(window, spriteBatch, camera, worldSize, i);
+    }
+}
+
+void ParticleSystem::drawParticle(pl::RenderTarget& window, pl::SpriteBatch& spriteBatch, const Camera& camera, int worldSize, int index) const
+{
+    float scale = ResolutionHandler::getScale();
+
+    const ParticleStyle& style = styles[index];
+
+    pl::DrawData drawData;
+    drawData.position = camera.worldToScreenTransform(positions[index], worldSize);
+    drawData.texture = TextureManager::getTexture(TextureType::Objects);
+    drawData.shader = Shaders::getShader(ShaderType::Default);
+    drawData.textureRect = style.textureRects[std::min(currentFrames[index], static_cast<int>(style.textureRects.size()) - 1)];
+    drawData.scale = pl::Vector2f(scale, scale);
+    drawData.centerRatio = pl::Vector2f(0.5, 0.5);
+    drawData.color = pl::Color(255, 255, 255, 255 * style.alpha);
+
+    spriteBatch.draw(window, drawData);
+}
+
+std::vector<int> ParticleSystem::getDrawLayers() const
+{
+    std::vector<int> particleDrawLayers;
+
+    for (int drawLayer : drawLayers)
+    {
+        if (std::find(particleDrawLayers.begin(), particleDrawLayers.end(), drawLayer) == particleDrawLayers.end())
+        {
+            particleDrawLayers.push_back(drawLayer);
+        }
+    }
+
+    std::sort(particleDrawLayers.begin(), particleDrawLayers.end(), std::greater<int>());
+
+    return particleDrawLayers;
+}
+
 // void ParticleSystem::handleWorldWrap(pl::Vector2f positionDelta)
 // {
 //     for (auto& particle : particles)
@@ -122,17 +191,13 @@ void ParticleSystem::draw(pl::RenderTarget& window, pl::SpriteBatch& spriteBatch
 
 void ParticleSystem::clear()
 {
-    particles.clear();
+    positions.clear();
+    velocities.clear();
+    accelerations.clear();
+    frameTimers.clear();
+    timesPerFrame.clear();
+    currentFrames.clear();
+    frameCounts.clear();
+    drawLayers.clear();
+    styles.clear();
 }
-
-std::vector<WorldObject*> ParticleSystem::getParticleWorldObjects()
-{
-    std::vector<WorldObject*> particleWorldObjects;
-    
-    for (Particle& particle : particles)
-    {
-        particleWorldObjects.push_back(&particle);
-    }
-
-    return particleWorldObjects;
-}
\ No newline at end of file
@@ -2,7 +2,7 @@
 #include "Game.hpp"
 #include "World/ChunkManager.hpp"
 
-PlantObject::PlantObject(pl::Vector2f position, ObjectType objectType, const BuildableObjectCreateParameters& parameters, Game& game, const ChunkManager* chunkManager)
+PlantObject::PlantObject(pl::Vector2f position, ObjectType objectType, const BuildableObjectCreateParameters& parameters, Game& game, ChunkManager* chunkManager)
     : BuildableObject(position, objectType, parameters)
 {
     int currentDay = game.getDayCycleManager().getCurrentDay();
@@ -20,7 +20,7 @@ PlantObject::PlantObject(pl::Vector2f position, ObjectType objectType, const Bui
         }
         else
         {
-            chunkSeed = rand();
+            chunkSeed = chunkManager ? chunkManager->getRandomStream(RandomStreamType::Object).next() : Helper::getRandom().next();
         }
 
         RandInt randGen(chunkSeed);
@@ -10,6 +10,8 @@ InventoryData::InventoryData(int size, bool achievementUnlocks)
     inventoryData = std::vector<std::optional<ItemCount>>(size, std::nullopt);
 
     this->achievementUnlocks = achievementUnlocks;
+
+    rebuildItemSlotIndex();
 }
 
 int InventoryData::addItem(ItemType item, int amount, bool createPopup, bool createPopupIfNotEnoughSpace, bool modifyInventory)
@@ -21,56 +23,51 @@ int InventoryData::addItem(ItemType item, int amount, bool createPopup, bool cre
 
     int amountToAdd = amount;
 
+    const ItemData& itemData = ItemDataLoader::getItemData(item);
+
     // Attempt to add items to existing stacks
-    for (std::optional<ItemCount>& itemSlot : inventoryData)
+    auto nonFullSlotsIter = nonFullItemSlots.find(item);
+    if (nonFullSlotsIter != nonFullItemSlots.end())
     {
-        if (!itemSlot.has_value())
-            continue;
-        
-        ItemCount& itemCount = itemSlot.value();
-
-        const ItemData& itemData = ItemDataLoader::getItemData(itemCount.first);
-
-        if (itemCount.first != item)
-            continue;
+        // Iterator is advanced before slot is set, as filled slots are removed from set
+        // Set itself is erased from index once its last slot is filled, so stop at last slot rather than comparing to end
+        std::set<int>& nonFullSlots = nonFullSlotsIter->second;
+        auto slotIter = nonFullSlots.begin();
+        bool lastSlot = false;
+        while (amountToAdd > 0 && !lastSlot)
+        {
+            int index = *slotIter;
+            slotIter = std::next(slotIter);
+            lastSlot = (slotIter == nonFullSlots.end());
 
-        if (itemCount.second >= itemData.maxStackSize)
-            continue;
+            const ItemCount& itemCount = inventoryData[index].value();
 
-        int amountAddedToStack = std::min(itemCount.second + amountToAdd, itemData.maxStackSize) - itemCount.second;
+            int amountAddedToStack = std::min(itemCount.second + amountToAdd, itemData.maxStackSize) - itemCount.second;
 
-        amountToAdd -= amountAddedToStack;
+            amountToAdd -= amountAddedToStack;
 
-        if (modifyInventory)
-        {
-            itemCount.second += amountAddedToStack;
+            if (modifyInventory)
+            {
+                setItemSlot(index, ItemCount(item, itemCount.second + amountAddedToStack));
+            }
         }
-
-        if (amountToAdd <= 0)
-            break;
     }
 
-    const ItemData& itemData = ItemDataLoader::getItemData(item);
-
     // Attempt to put remaining items in empty slot
-    if (amountToAdd > 0)
+    // Iterator is advanced before slot is set, as filled slots are removed from free slots
+    auto freeSlotIter = freeSlots.begin();
+    while (amountToAdd > 0 && freeSlotIter != freeSlots.end())
     {
-        for (std::optional<ItemCount>& itemSlot : inventoryData)
-        {
-            if (itemSlot.has_value())
-                continue;
-            
-            int amountPutInSlot = std::min(amountToAdd, static_cast<int>(itemData.maxStackSize));
+        int index = *freeSlotIter;
+        freeSlotIter = std::next(freeSlotIter);
 
-            amountToAdd -= amountPutInSlot;
+        int amountPutInSlot = std::min(amountToAdd, static_cast<int>(itemData.maxStackSize));
 
-            if (modifyInventory)
-            {
-                itemSlot = ItemCount(item, amountPutInSlot);
-            }
+        amountToAdd -= amountPutInSlot;
 
-            if (amountToAdd <= 0)
-                break;
+        if (modifyInventory)
+        {
+            setItemSlot(index, ItemCount(item, amountPutInSlot));
         }
     }
 
@@ -98,24 +95,21 @@ int InventoryData::addItem(ItemType item, int amount, bool createPopup, bool cre
 
 int InventoryData::takeItem(ItemType item, int amount)
 {
-    int amountToTake = amount;
-
-    // Go backwards over inventory and subtract from item stacks
-    for (int i = inventoryData.size() - 1; i >= 0; i--)
+    auto itemSlotsIter = itemSlots.find(item);
+    if (itemSlotsIter == itemSlots.end())
     {
-        std::optional<ItemCount>& itemSlot = inventoryData[i];
+        return 0;
+    }
 
-        if (!itemSlot.has_value())
-        {
-            continue;
-        }
-        
-        ItemCount& itemCount = itemSlot.value();
+    int amountToTake = amount;
 
-        if (itemCount.first != item)
-        {
-            continue;
-        }
+    // Go backwards over slots containing item and subtract from item stacks
+    // Copied as slots are removed from index when emptied
+    std::vector<int> slots(itemSlotsIter->second.rbegin(), itemSlotsIter->second.rend());
+
+    for (int index : slots)
+    {
+        const ItemCount& itemCount = inventoryData[index].value();
 
         int amountTaken = std::min(static_cast<int>(itemCount.second), amountToTake);
 
@@ -123,11 +117,11 @@ int InventoryData::takeItem(ItemType item, int amount)
 
         if (itemCount.second <= amountTaken)
         {
-            itemSlot = std::nullopt;
+            setItemSlot(index, std::nullopt);
         }
         else
         {
-            itemCount.second -= amountTaken;
+            setItemSlot(index, ItemCount(item, itemCount.second - amountTaken));
         }
 
         if (amountToTake <= 0)
@@ -144,7 +138,7 @@ void InventoryData::addItemAtIndex(int index, ItemType item, int amount)
     if (index >= inventoryData.size())
         return;
         
-    std::optional<ItemCount>& itemSlot = inventoryData[index];
+    const std::optional<ItemCount>& itemSlot = inventoryData[index];
 
     const ItemData& itemData = ItemDataLoader::getItemData(item);
 
@@ -156,14 +150,12 @@ void InventoryData::addItemAtIndex(int index, ItemType item, int amount)
     // Attempt to add to stack
     if (itemSlot.has_value())
     {
-        ItemCount& itemCount = itemSlot.value();
-
-        const ItemData& itemCountData = ItemDataLoader::getItemData(itemCount.first);
+        const ItemCount& itemCount = itemSlot.value();
 
         // Item to add is same as item at index, so add
         if (item == itemCount.first)
         {
-            itemCount.second = std::min(itemCount.second + amount, itemCountData.maxStackSize);
+            setItemSlot(index, ItemCount(item, std::min(itemCount.second + amount, itemData.maxStackSize)));
         }
 
         return;
@@ -174,7 +166,7 @@ void InventoryData::addItemAtIndex(int index, ItemType item, int amount)
     itemCount.first = item;
     itemCount.second = std::min(amount, static_cast<int>(itemData.maxStackSize));
 
-    itemSlot = itemCount;
+    setItemSlot(index, itemCount);
 }
 
 int InventoryData::takeItemAtIndex(int index, int amount)
@@ -182,22 +174,22 @@ int InventoryData::takeItemAtIndex(int index, int amount)
     if (index >= inventoryData.size())
         return 0;
     
-    std::optional<ItemCount>& itemSlot = inventoryData[index];
+    const std::optional<ItemCount>& itemSlot = inventoryData[index];
     if (!itemSlot.has_value())
         return 0;
     
-    ItemCount& itemCount = itemSlot.value();
+    const ItemCount& itemCount = itemSlot.value();
 
     int amountTaken = amount;
 
     if (amount >= itemCount.second)
     {
         amountTaken = itemCount.second;
-        itemSlot = std::nullopt;
+        setItemSlot(index, std::nullopt);
     }
     else
     {
-        itemCount.second -= amount;
+        setItemSlot(index, ItemCount(itemCount.first, itemCount.second - amount));
     }
 
     return amountTaken;
@@ -205,50 +197,32 @@ int InventoryData::takeItemAtIndex(int index, int amount)
 
 std::unordered_map<ItemType, unsigned int> InventoryData::getTotalItemCount() const
 {
-    std::unordered_map<ItemType, unsigned int> totalItemCount;
+    return itemTotals;
+}
 
-    for (const std::optional<ItemCount>& itemSlot : inventoryData)
+unsigned int InventoryData::getItemAmount(ItemType item) const
+{
+    auto itemTotalIter = itemTotals.find(item);
+    if (itemTotalIter == itemTotals.end())
     {
-        if (!itemSlot.has_value())
-            continue;
-        
-        const ItemCount& itemCount = itemSlot.value();
-
-        // If item already in map, add to it
-        if (totalItemCount.count(itemCount.first))
-        {
-            totalItemCount[itemCount.first] += itemCount.second;
-            continue;
-        }
-
-        totalItemCount[itemCount.first] = itemCount.second;
+        return 0;
     }
 
-    return totalItemCount;
+    return itemTotalIter->second;
 }
 
-std::optional<ItemCount>& InventoryData::getItemSlotData(int index)
+const std::optional<ItemCount>& InventoryData::getItemSlotData(int index) const
 {
     assert(index < inventoryData.size());
 
-    std::optional<ItemCount>& itemSlotData = inventoryData.at(index);
+    const std::optional<ItemCount>& itemSlotData = inventoryData.at(index);
 
     return itemSlotData;
 }
 
 bool InventoryData::isEmpty() const
 {
-    // Check all slots
-    for (auto& itemSlot : inventoryData)
-    {
-        if (itemSlot.has_value())
-        {
-            return false;
-        }
-    }
-
-    // Default case
-    return true;
+    return (freeSlots.size() >= inventoryData.size());
 }
 
 int InventoryData::getProjectileCountForWeapon(ToolType weapon) const
@@ -262,20 +236,15 @@ int InventoryData::getProjectileCountForWeapon(ToolType weapon) const
 
     int count = 0;
 
-    // Iterate over inventory and count valid projectiles
-    for (auto& itemSlot : inventoryData)
+    // Iterate over items in inventory and count valid projectiles
+    for (const auto& [item, itemTotal] : itemTotals)
     {
-        if (!itemSlot.has_value())
-        {
-            continue;
-        }
-
         // Check projectile types for tool against this item
         for (ProjectileType projectileType : toolData.projectileShootTypes)
         {
-            if (projectileType == ItemDataLoader::getItemData(itemSlot->first).projectileType)
+            if (projectileType == ItemDataLoader::getItemData(item).projectileType)
             {
-                count += itemSlot->second;
+                count += itemTotal;
                 break;
             }
         }
@@ -293,41 +262,41 @@ ProjectileType InventoryData::getValidProjectileNearestToEnd(ToolType weapon) co
         return 0;
     }
 
-    for (int i = inventoryData.size() - 1; i >= 0; i--)
-    {
-        const std::optional<ItemCount>& itemSlot = inventoryData[i];
+    ProjectileType nearestProjectileType = -1;
+    int nearestIndex = -1;
 
-        if (!itemSlot.has_value())
+    // Find valid projectile item with latest slot
+    for (const auto& [item, slots] : itemSlots)
+    {
+        int lastIndex = *slots.rbegin();
+        if (lastIndex <= nearestIndex)
         {
             continue;
         }
 
         for (ProjectileType projectileType : toolData.projectileShootTypes)
         {
-            if (projectileType == ItemDataLoader::getItemData(itemSlot->first).projectileType)
+            if (projectileType == ItemDataLoader::getItemData(item).projectileType)
             {
-                return projectileType;
+                nearestProjectileType = projectileType;
+                nearestIndex = lastIndex;
+                break;
             }
         }
     }
 
-    return -1;
+    return nearestProjectileType;
 }
 
 int InventoryData::getCurrencyValueTotal() const
 {
     int total = 0;
 
-    for (const auto& itemSlot : inventoryData)
+    for (const auto& [item, itemTotal] : itemTotals)
     {
-        if (!itemSlot.has_value())
-        {
-            continue;
-        }
-
-        const ItemData& itemData = ItemDataLoader::getItemData(itemSlot->first);
+        const ItemData& itemData = ItemDataLoader::getItemData(item);
 
-        total += itemData.currencyValue * itemSlot->second;
+        total += itemData.currencyValue * itemTotal;
     }
 
     return total;
@@ -396,6 +365,118 @@ void InventoryData::enableAchievementUnlocks()
     achievementUnlocks = true;
 }
 
+void InventoryData::setData(const std::vector<std::optional<ItemCount>>& inventoryData)
+{
+    this->inventoryData = inventoryData;
+    rebuildItemSlotIndex();
+}
+
+void InventoryData::rebuildItemSlotIndex()
+{
+    itemSlots.clear();
+    nonFullItemSlots.clear();
+    freeSlots.clear();
+    itemTotals.clear();
+
+    for (int i = 0; i < inventoryData.size(); i++)
+    {
+        addSlotToIndex(i);
+    }
+}
+
+bool InventoryData::isItemSlotIndexValid() const
+{
+    std::unordered_map<ItemType, std::set<int>> scannedItemSlots;
+    std::unordered_map<ItemType, std::set<int>> scannedNonFullItemSlots;
+    std::set<int> scannedFreeSlots;
+    std::unordered_map<ItemType, unsigned int> scannedItemTotals;
+
+    for (int i = 0; i < inventoryData.size(); i++)
+    {
+        const std::optional<ItemCount>& itemSlot = inventoryData[i];
+
+        if (!itemSlot.has_value())
+        {
+            scannedFreeSlots.insert(i);
+            continue;
+        }
+
+        scannedItemSlots[itemSlot->first].insert(i);
+        scannedItemTotals[itemSlot->first] += itemSlot->second;
+
+        if (itemSlot->second < ItemDataLoader::getItemData(itemSlot->first).maxStackSize)
+        {
+            scannedNonFullItemSlots[itemSlot->first].insert(i);
+        }
+    }
+
+    return (itemSlots == scannedItemSlots && nonFullItemSlots == scannedNonFullItemSlots && freeSlots == scannedFreeSlots &&
+        itemTotals == scannedItemTotals);
+}
+
+void InventoryData::setItemSlot(int index, const std::optional<ItemCount>& itemSlot)
+{
+    removeSlotFromIndex(index);
+    inventoryData[index] = itemSlot;
+    addSlotToIndex(index);
+}
+
+void InventoryData::addSlotToIndex(int index)
+{
+    const std::optional<ItemCount>& itemSlot = inventoryData[index];
+
+    if (!itemSlot.has_value())
+    {
+        freeSlots.insert(index);
+        return;
+    }
+
+    itemSlots[itemSlot->first].insert(index);
+    itemTotals[itemSlot->first] += itemSlot->second;
+
+    if (itemSlot->second < ItemDataLoader::getItemData(itemSlot->first).maxStackSize)
+    {
+        nonFullItemSlots[itemSlot->first].insert(index);
+    }
+}
+
+void InventoryData::removeSlotFromIndex(int index)
+{
+    const std::optional<ItemCount>& itemSlot = inventoryData[index];
+
+    if (!itemSlot.has_value())
+    {
+        freeSlots.erase(index);
+        return;
+    }
+
+    ItemType item = itemSlot->first;
+
+    auto itemSlotsIter = itemSlots.find(item);
+    itemSlotsIter->second.erase(index);
+
+    // Remove item from index entirely if no longer in inventory
+    if (itemSlotsIter->second.empty())
+    {
+        itemSlots.erase(itemSlotsIter);
+        itemTotals.erase(item);
+    }
+    else
+    {
+        itemTotals[item] -= itemSlot->second;
+    }
+
+    auto nonFullSlotsIter = nonFullItemSlots.find(item);
+    if (nonFullSlotsIter != nonFullItemSlots.end())
+    {
+        nonFullSlotsIter->second.erase(index);
+        if (nonFullSlotsIter->second.empty())
+        {
+            nonFullItemSlots.erase(nonFullSlotsIter);
+        }
+    }
+}
+
 // Save / load
 void to_json(nlohmann::json& json, const InventoryData& inventory)
 {
@@ -416,14 +497,15 @@ void to_json(nlohmann::json& json, const InventoryData& inventory)
 
 void from_json(const nlohmann::json& json, InventoryData& inventory)
 {
-    inventory.getData().resize(json.size());
+    std::vector<std::optional<ItemCount>> inventoryData = inventory.getData();
+    inventoryData.resize(json.size());
     
     int idx = 0;
     for (auto iter = json.begin(); iter != json.end(); ++iter)
     {
         if (iter.value()[0].empty())
         {
-            inventory.getData()[idx] = std::nullopt;
+            inventoryData[idx] = std::nullopt;
         }
         else if (iter.value()[1] > 0)
         {
@@ -431,9 +513,11 @@ void from_json(const nlohmann::json& json, InventoryData& inventory)
             itemSlot.first = ItemDataLoader::getItemTypeFromName(iter.value()[0]);
             itemSlot.second = iter.value()[1];
 
-            inventory.getData()[idx] = itemSlot;
+            inventoryData[idx] = itemSlot;
         }
 
         idx++;
     }
+
+    inventory.setData(inventoryData);
 }
\ No newline at end of file
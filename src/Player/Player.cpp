@@ -79,18 +79,18 @@ void Player::update(float dt, pl::Vector2f mouseWorldPos, ChunkManager& chunkMan
     position.y = collisionRect.y + collisionRect.height / 2.0f;
 
     // Test projectile collisions
-    for (auto& projectile : projectileManager.getProjectiles())
+    projectileManager.forEachProjectileNear(collisionRect, chunkManager.getWorldSize(), [&](Projectile& projectile)
     {
         if (testHitCollision(projectile, chunkManager.getWorldSize()))
         {
             projectile.onCollision();
         }
-    }
+    });
 
     // Update fishing rod if required
     if (fishingRodCasted)
     {
-        updateFishingRodCatch(dt);
+        updateFishingRodCatch(dt, chunkManager);
     }
 
     // Update on water
@@ -394,7 +394,7 @@ void Player::respawn(Game& game)
     reelInFishingRod();
 }
 
-void Player::updateFishingRodCatch(float dt)
+void Player::updateFishingRodCatch(float dt, ChunkManager& chunkManager)
 {
     if (equippedTool < 0)
     {
@@ -410,7 +410,7 @@ void Player::updateFishingRodCatch(float dt)
         const ToolData& fishingRodToolData = ToolDataLoader::getToolData(equippedTool);
 
         // Chance for fish to bite line
-        int fishBiteChance = Helper::randFloat(0.0f, 5.0f / fishingRodToolData.fishingEfficiency);
+        int fishBiteChance = chunkManager.getRandomStream(RandomStreamType::Fishing).randFloat(0.0f, 5.0f / fishingRodToolData.fishingEfficiency);
         if (fishBiteChance < 1)
         {
             fishBitingLine = true;
@@ -624,10 +624,8 @@ void Player::draw(pl::RenderTarget& window, pl::SpriteBatch& spriteBatch, Game&
     #endif
 }
 
-std::vector<WorldObject*> Player::getDrawWorldObjects(const Camera& camera, int worldSize, float gameTime)
+void Player::getDrawWorldObjects(const Camera& camera, int worldSize, float gameTime, std::vector<WorldObject*>& worldObjects)
 {
-    std::vector<WorldObject*> worldObjects;
-
     worldObjects.push_back(this);
 
     // Add line parts
@@ -778,8 +776,6 @@ std::vector<WorldObject*> Player::getDrawWorldObjects(const Camera& camera, int
             worldObjects.push_back(worldObject.get());
         }
     }
-
-    return worldObjects;
 }
 
 // void Player::createLightSource(LightingEngine& lightingEngine, pl::Vector2f topLeftChunkPos) const
@@ -1002,7 +998,8 @@ void Player::useTool(ProjectileManager& projectileManager, InventoryData& invent
             spawnPos += position;
 
             // Create projectile
-            Projectile projectile(spawnPos, angle, projectileType, toolData.projectileDamageMult, toolData.shootPower, HitLayer::Entity);
+            Projectile projectile(spawnPos, angle, projectileType, toolData.projectileDamageMult, toolData.shootPower, HitLayer::Entity,
+                game.getChunkManager().getRandomStream(RandomStreamType::Projectile));
 
             // Add projectile to manager
             projectileManager.addProjectile(projectile, equippedTool);
@@ -9,6 +9,8 @@ ShopInventoryData::ShopInventoryData(const std::vector<ItemCount>& items, const
         inventoryData.push_back(itemCount);
     }
 
+    rebuildItemSlotIndex();
+
     this->buyItemPriceMult = buyItemPriceMult;
     this->sellItemPriceMult = sellItemPriceMult;
 }
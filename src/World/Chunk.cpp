@@ -1,8 +1,11 @@
 #include "World/Chunk.hpp"
 #include "World/ChunkManager.hpp"
 #include "Entity/Entity.hpp"
+#include "Entity/HitboxHistory.hpp"
 #include "Game.hpp"
 
+std::atomic<uint64_t> Chunk::contentVersionCounter = 0;
+
 Chunk::Chunk(ChunkPosition chunkPosition, float gameTime)
 {
     this->chunkPosition = chunkPosition;
@@ -22,6 +25,8 @@ void Chunk::reset(bool fullReset)
     containsWater = false;
     modified = false;
 
+    markContentModified();
+
     for (int i = 0; i < groundTileGrid.size(); i++)
     {
         groundTileGrid[i].fill(0);
@@ -42,6 +47,7 @@ void Chunk::reset(bool fullReset)
     tileMaps.clear();
     tileMapDrawOrder.clear();
     entities.clear();
+    entitiesVersion++;
     structureObject = std::nullopt;
 
     for (int y = 0; y < objectGrid.size(); y++)
@@ -58,11 +64,24 @@ void Chunk::generateChunk(const FastNoise& heightNoise, const FastNoise& biomeNo
 {
     RandInt randGen = generateTilesAndStructure(heightNoise, biomeNoise, riverNoise, planetType, chunkManager, allowStructureGen, forceStructureType);
 
+    generateFromTilesAndStructure(heightNoise, biomeNoise, riverNoise, planetType, randGen, game, chunkManager, pathfindingEngine, spawnEntities, initialise);
+
+    // If altering generation, set modified to prevent loss of change
+    if (forceStructureType || !allowStructureGen)
+    {
+        modified = true;
+    }
+}
+
+void Chunk::generateFromTilesAndStructure(const FastNoise& heightNoise, const FastNoise& biomeNoise, const FastNoise& riverNoise, PlanetType planetType,
+    RandInt& randGen, Game& game, ChunkManager& chunkManager, PathfindingEngine& pathfindingEngine, bool spawnEntities, bool initialise)
+{
     generateObjects(heightNoise, biomeNoise, riverNoise, planetType, randGen, game, chunkManager, pathfindingEngine);
 
     if (spawnEntities)
     {
-        spawnChunkEntities(chunkManager.getWorldSize(), heightNoise, biomeNoise, riverNoise, planetType);
+        spawnChunkEntities(chunkManager.getWorldSize(), heightNoise, biomeNoise, riverNoise, planetType,
+            chunkManager.getRandomStream(RandomStreamType::EntitySpawn));
     }
 
     if (initialise)
@@ -77,14 +96,11 @@ void Chunk::generateChunk(const FastNoise& heightNoise, const FastNoise& biomeNo
     const BiomeGenData* biomeGenData = chunkManager.getChunkBiome(chunkPosition);
     if (biomeGenData)
     {
-        nextResourceRegenerationTime = gameTimeCreated + Helper::randFloat(biomeGenData->resourceRegenerationTimeMin, biomeGenData->resourceRegenerationTimeMax);
+        nextResourceRegenerationTime = gameTimeCreated + chunkManager.getRandomStream(RandomStreamType::ResourceRegeneration).randFloat(
+            biomeGenData->resourceRegenerationTimeMin, biomeGenData->resourceRegenerationTimeMax);
     }
 
-    // If altering generation, set modified to prevent loss of change
-    if (forceStructureType || !allowStructureGen)
-    {
-        modified = true;
-    }
+    markContentModified();
 }
 
 RandInt Chunk::generateTilesAndStructure(const FastNoise& heightNoise, const FastNoise& biomeNoise, const FastNoise& riverNoise, PlanetType planetType,
@@ -180,7 +196,8 @@ bool Chunk::generateObjects(const FastNoise& heightNoise, const FastNoise& biome
     return modified;
 }
 
-void Chunk::spawnChunkEntities(int worldSize, const FastNoise& heightNoise, const FastNoise& biomeNoise, const FastNoise& riverNoise, PlanetType planetType)
+void Chunk::spawnChunkEntities(int worldSize, const FastNoise& heightNoise, const FastNoise& biomeNoise, const FastNoise& riverNoise, PlanetType planetType,
+    RandomStream& randomStream)
 {
     pl::Vector2<int> worldNoisePosition = pl::Vector2<int>(chunkPosition.x, chunkPosition.y) * static_cast<int>(CHUNK_TILE_SIZE);
 
@@ -190,7 +207,7 @@ void Chunk::spawnChunkEntities(int worldSize, const FastNoise& heightNoise, cons
         {
             // Create random entity
             EntityType entitySpawnType = getRandomEntityToSpawnAtWorldTile(pl::Vector2<int>(worldNoisePosition.x + x, worldNoisePosition.y + y),
-                worldSize, heightNoise, biomeNoise, riverNoise, planetType);
+                worldSize, heightNoise, biomeNoise, riverNoise, planetType, randomStream);
             
             if (entitySpawnType >= 0)
             {
@@ -198,8 +215,14 @@ void Chunk::spawnChunkEntities(int worldSize, const FastNoise& heightNoise, cons
                 entityPos.x = worldPosition.x + (x + 0.5) * TILE_SIZE_PIXELS_UNSCALED;
                 entityPos.y = worldPosition.y + (y + 0.5) * TILE_SIZE_PIXELS_UNSCALED;
 
-                std::unique_ptr<Entity> entity = std::make_unique<Entity>(entityPos, entitySpawnType);
+                // Entity stream derived from spawn stream, so entity behaviour depends on planet seed only
+                uint64_t entitySeed = static_cast<uint64_t>(randomStream.next()) << 32;
+                entitySeed |= randomStream.next();
+                RandomStream entityRandomStream = RandomStreams::createStream(entitySeed, RandomStreamType::Entity, entitySpawnType);
+
+                std::unique_ptr<Entity> entity = std::make_unique<Entity>(entityPos, entitySpawnType, entityRandomStream);
                 entities.push_back(std::move(entity));
+                entitiesVersion++;
             }
         }
     }
@@ -207,34 +230,8 @@ void Chunk::spawnChunkEntities(int worldSize, const FastNoise& heightNoise, cons
 
 void Chunk::generateTilemapsAndInit(ChunkManager& chunkManager, PathfindingEngine& pathfindingEngine)
 {
-    int worldSize = chunkManager.getWorldSize();
-
-    Chunk* upChunk = chunkManager.getChunk(ChunkPosition(chunkPosition.x, ((chunkPosition.y - 1) % worldSize + worldSize) % worldSize));
-    Chunk* downChunk = chunkManager.getChunk(ChunkPosition(chunkPosition.x, ((chunkPosition.y + 1) % worldSize + worldSize) % worldSize));
-    Chunk* leftChunk = chunkManager.getChunk(ChunkPosition(((chunkPosition.x - 1) % worldSize + worldSize) % worldSize, chunkPosition.y));
-    Chunk* rightChunk = chunkManager.getChunk(ChunkPosition(((chunkPosition.x + 1) % worldSize + worldSize) % worldSize, chunkPosition.y));
-
-    std::set<int> tileMapsModified;
-
-    for (int y = 0; y < CHUNK_TILE_SIZE; y++)
-    {
-        for (int x = 0; x < CHUNK_TILE_SIZE; x++)
-        {
-            int tileType = groundTileGrid[y][x];
-
-            // Tile is water
-            if (tileType == 0)
-            {
-                continue;
-            }
-
-            // Set tile without graphics update
-            std::set<int> additional_tileMapsModified = chunkManager.setChunkTile(chunkPosition, tileType, pl::Vector2<int>(x, y), false);
-            tileMapsModified.insert(additional_tileMapsModified.begin(), additional_tileMapsModified.end());
-        }
-    }
-
-    chunkManager.performChunkSetTileUpdate(chunkPosition, tileMapsModified);
+    // Set all tiles in single pass rather than per tile
+    chunkManager.setChunkTilesFromGround(chunkPosition);
 
     generateVisualEffectTiles(chunkManager);
 
@@ -263,18 +260,8 @@ void Chunk::generateRandomStructure(int worldSize, const FastNoise& biomeNoise,
     }
     else
     {
-        float cumulativeChance = 0;
         float randomSpawn = randGen.generate(0, 10000) / 10000.0f;
-        for (const StructureGenData& structureGenData : biomeGenData->structureGenDatas)
-        {
-            cumulativeChance += structureGenData.spawnChance;
-    
-            if (randomSpawn <= cumulativeChance)
-            {
-                structureType = structureGenData.structure;
-                break;
-            }
-        }
+        structureType = biomeGenData->structureSpawnTable.sample(randomSpawn).value_or(-1);
     }
     
     // No structure chosen
@@ -373,7 +360,7 @@ const BiomeGenData* Chunk::getBiomeGenAtWorldTile(pl::Vector2<int> worldTile, in
 }
 
 const TileGenData* Chunk::getTileGenAtWorldTile(pl::Vector2<int> worldTile, int worldSize, const FastNoise& heightNoise, const FastNoise& biomeNoise, const FastNoise& riverNoise,
-    PlanetType planetType)
+    PlanetType planetType, const BiomeGenData** biomeGenDataOut)
 {
     int worldTileSize = worldSize * CHUNK_TILE_SIZE;
 
@@ -390,6 +377,11 @@ const TileGenData* Chunk::getTileGenAtWorldTile(pl::Vector2<int> worldTile, int
     
     if (!biomeGenData)
         return nullptr;
+
+    if (biomeGenDataOut)
+    {
+        *biomeGenDataOut = biomeGenData;
+    }
     
     float heightNoiseValue = heightNoise.GetNoiseSeamless2D(worldTile.x, worldTile.y, worldTileSize, worldTileSize);
     heightNoiseValue = FastNoise::Normalise(heightNoiseValue);
@@ -439,32 +431,20 @@ ObjectType Chunk::getRandomObjectToSpawnAtWorldTile(pl::Vector2<int> worldTile,
 
     assert(biomeGenData->tileGenDatas.contains(tileType));
 
-    const TileGenData& tileGenData = biomeGenData->tileGenDatas.at(tileType);
-
-    if (!tileGenData.objectsCanSpawn)
+    if (!biomeGenData->canObjectsSpawnOnTile(tileType))
     {
         return -1;
     }
 
-    float cumulativeChance = 0;
     float randomSpawn = static_cast<float>(randGen.generate(0, 10000)) / 10000.0f;
-    for (const ObjectGenData& objectGenData : biomeGenData->objectGenDatas)
-    {
-        cumulativeChance += objectGenData.spawnChance * probabilityMult;
-
-        if (randomSpawn <= cumulativeChance)
-        {
-            return objectGenData.object;
-        }
-    }
-
-    return -1;
+    return biomeGenData->objectSpawnTable.sample(randomSpawn, probabilityMult).value_or(-1);
 }
 
 EntityType Chunk::getRandomEntityToSpawnAtWorldTile(pl::Vector2<int> worldTile, int worldSize, const FastNoise& heightNoise, const FastNoise& biomeNoise,
-    const FastNoise& riverNoise, PlanetType planetType)
+    const FastNoise& riverNoise, PlanetType planetType, RandomStream& randomStream)
 {
-    const TileGenData* tileGenData = getTileGenAtWorldTile(worldTile, worldSize, heightNoise, biomeNoise, riverNoise, planetType);
+    const BiomeGenData* biomeGenData = nullptr;
+    const TileGenData* tileGenData = getTileGenAtWorldTile(worldTile, worldSize, heightNoise, biomeNoise, riverNoise, planetType, &biomeGenData);
 
     if (tileGenData == nullptr)
     {
@@ -474,21 +454,8 @@ EntityType Chunk::getRandomEntityToSpawnAtWorldTile(pl::Vector2<int> worldTile,
     if (!tileGenData->objectsCanSpawn)
         return -1;
 
-    const BiomeGenData* biomeGenData = getBiomeGenAtWorldTile(worldTile, worldSize, biomeNoise, planetType);
-
-    float cumulativeChance = 0;
-    float randomSpawn = Helper::randFloat(0.0f, 1.0f);
-    for (const EntityGenData& entityGenData : biomeGenData->entityGenDatas)
-    {
-        cumulativeChance += entityGenData.spawnChance;
-
-        if (randomSpawn <= cumulativeChance)
-        {
-            return entityGenData.entity;
-        }
-    }
-
-    return -1;
+    float randomSpawn = randomStream.randFloat(0.0f, 1.0f);
+    return biomeGenData->entitySpawnTable.sample(randomSpawn).value_or(-1);
 }
 
 void Chunk::generateVisualEffectTiles(ChunkManager& chunkManager)
@@ -567,32 +534,37 @@ void Chunk::generateVisualEffectTiles(ChunkManager& chunkManager)
     }
 }
 
-void Chunk::setTile(int tileMap, pl::Vector2<int> position, TileMap* upTiles, TileMap* downTiles, TileMap* leftTiles, TileMap* rightTiles, bool graphicsUpdate)
+void Chunk::createTileMap(int tileMap)
 {
-    if (!tileMaps.contains(tileMap))
+    if (tileMaps.contains(tileMap))
+        return;
+
+    const TileMapData& tileMapData = PlanetGenDataLoader::getTileMapDataFromID(tileMap);
+    tileMaps[tileMap] = TileMap(tileMapData.textureOffset, tileMapData.variation);
+    tileMapDrawOrder.push_back(tileMap);
+
+    // Recalculate tile draw order
+    std::sort(tileMapDrawOrder.begin(), tileMapDrawOrder.end(), [](int tileMapIdA, int tileMapIdB)
     {
-        const TileMapData& tileMapData = PlanetGenDataLoader::getTileMapDataFromID(tileMap);
-        tileMaps[tileMap] = TileMap(tileMapData.textureOffset, tileMapData.variation);
-        tileMapDrawOrder.push_back(tileMap);
+        int drawLayerA = PlanetGenDataLoader::getTileMapDataFromID(tileMapIdA).drawLayer;
+        int drawLayerB = PlanetGenDataLoader::getTileMapDataFromID(tileMapIdB).drawLayer;
+        if (drawLayerA == drawLayerB) return tileMapIdA < tileMapIdB;
+        return drawLayerA < drawLayerB;
+    });
+}
 
-        // Recalculate tile draw order
-        std::sort(tileMapDrawOrder.begin(), tileMapDrawOrder.end(), [](int tileMapIdA, int tileMapIdB)
-        {
-            int drawLayerA = PlanetGenDataLoader::getTileMapDataFromID(tileMapIdA).drawLayer;
-            int drawLayerB = PlanetGenDataLoader::getTileMapDataFromID(tileMapIdB).drawLayer;
-            if (drawLayerA == drawLayerB) return tileMapIdA < tileMapIdB;
-            return drawLayerA < drawLayerB;
-        });
-    }
+void Chunk::setTile(int tileMap, pl::Vector2<int> position, TileMap* upTiles, TileMap* downTiles, TileMap* leftTiles, TileMap* rightTiles, bool graphicsUpdate)
+{
+    createTileMap(tileMap);
 
     // Set tile for tilemap
     if (graphicsUpdate)
     {
-        tileMaps[tileMap].setTile(position.x, position.y, upTiles, downTiles, leftTiles, rightTiles);
+        tileMaps[tileMap].setTile(position.x, position.y, tileVariationRandom, upTiles, downTiles, leftTiles, rightTiles);
     }
     else
     {
-        tileMaps[tileMap].setTileWithoutGraphicsUpdate(position.x, position.y, upTiles, downTiles, leftTiles, rightTiles);
+        tileMaps[tileMap].setTileWithoutGraphicsUpdate(position.x, position.y, tileVariationRandom, upTiles, downTiles, leftTiles, rightTiles);
     }
 }
 
@@ -632,6 +604,12 @@ void Chunk::setTile(int tileMap, pl::Vector2<int> position, Chunk* upChunk, Chun
     // }
 }
 
+void Chunk::setTileMapTiles(int tileMap, const TileMap::TilePresenceGrid& presenceGrid)
+{
+    createTileMap(tileMap);
+    tileMaps[tileMap].setTilesFromPresenceGrid(presenceGrid, tileVariationRandom);
+}
+
 void Chunk::updateTileMap(int tileMap, int xRel, int yRel, TileMap* upTiles, TileMap* downTiles, TileMap* leftTiles, TileMap* rightTiles)
 {
     if (tileMaps.count(tileMap) <= 0)
@@ -666,22 +644,18 @@ TileMap* Chunk::getTileMap(int tileMap)
     return &(tileMaps[tileMap]);
 }
 
-void Chunk::drawChunkTerrain(pl::RenderTarget& window, const Camera& camera, float time, int worldSize)
+uint64_t Chunk::getTileMapsVersion() const
 {
-    // Get tile size and scale
-    float scale = ResolutionHandler::getScale();
-
-    for (int tileMapID : tileMapDrawOrder)
+    uint64_t version = 0;
+    for (const auto& tileMap : tileMaps)
     {
-        #if (!RELEASE_BUILD)
-        if (!DebugOptions::tileMapsVisible[tileMapID])
-            continue;
-        #endif
-
-        tileMaps.at(tileMapID).draw(window, camera.worldToScreenTransform(worldPosition, worldSize), pl::Vector2f(scale, scale));
+        version = std::max(version, tileMap.second.getVersion());
     }
+    return version;
+}
 
-
+void Chunk::drawChunkDebug(pl::RenderTarget& window, const Camera& camera, int worldSize)
+{
     #if (!RELEASE_BUILD)
     pl::VertexArray debugLines;
     debugLines.setPrimitiveMode(pl::PrimitiveMode::Lines);
@@ -783,69 +757,6 @@ void Chunk::drawChunkTerrainVisual(pl::RenderTarget& window, pl::SpriteBatch& sp
     }
 }
 
-void Chunk::drawChunkWater(pl::RenderTarget& window, const Camera& camera, ChunkManager& chunkManager)
-{
-    // Get scale
-    float scale = ResolutionHandler::getScale();
-
-    // Set water color
-    const BiomeGenData* chunkBiome = chunkManager.getChunkBiome(chunkPosition);
-    
-    const BiomeGenData* surroundingChunkBiomes[8] = {
-        chunkManager.getChunkBiome(ChunkPosition{chunkPosition.x, Helper::wrap(chunkPosition.y - 1, chunkManager.getWorldSize())}),
-        chunkManager.getChunkBiome(ChunkPosition{Helper::wrap(chunkPosition.x + 1, chunkManager.getWorldSize()), chunkPosition.y}),
-        chunkManager.getChunkBiome(ChunkPosition{chunkPosition.x, Helper::wrap(chunkPosition.y + 1, chunkManager.getWorldSize())}),
-        chunkManager.getChunkBiome(ChunkPosition{Helper::wrap(chunkPosition.x - 1, chunkManager.getWorldSize()), chunkPosition.y}),
-        chunkManager.getChunkBiome(
-        ChunkPosition{Helper::wrap(chunkPosition.x - 1, chunkManager.getWorldSize()), Helper::wrap(chunkPosition.y - 1, chunkManager.getWorldSize())}),
-        chunkManager.getChunkBiome(
-        ChunkPosition{Helper::wrap(chunkPosition.x + 1, chunkManager.getWorldSize()), Helper::wrap(chunkPosition.y - 1, chunkManager.getWorldSize())}),
-        chunkManager.getChunkBiome(
-        ChunkPosition{Helper::wrap(chunkPosition.x + 1, chunkManager.getWorldSize()), Helper::wrap(chunkPosition.y + 1, chunkManager.getWorldSize())}),
-        chunkManager.getChunkBiome(
-        ChunkPosition{Helper::wrap(chunkPosition.x - 1, chunkManager.getWorldSize()), Helper::wrap(chunkPosition.y + 1, chunkManager.getWorldSize())})
-    };
-
-    if (chunkBiome == nullptr)
-    {
-        return;
-    }
-
-    std::vector<float> surroundingWaterColors(8 * 4);
-    
-    for (int i = 0; i < 8; i++)
-    {
-        if (surroundingChunkBiomes[i] == nullptr)
-        {
-            return;
-        }
-
-        pl::Color waterColorNormalised = surroundingChunkBiomes[i]->waterColor.normalise();
-
-        surroundingWaterColors[i * 4] = waterColorNormalised.r;
-        surroundingWaterColors[i * 4 + 1] = waterColorNormalised.g;
-        surroundingWaterColors[i * 4 + 2] = waterColorNormalised.b;
-        surroundingWaterColors[i * 4 + 3] = waterColorNormalised.a;
-    }
-
-    pl::Texture* waterTexture = TextureManager::getTexture(TextureType::Water);
-    pl::Shader* waterShader = Shaders::getShader(ShaderType::Water);
-
-    waterShader->setUniformColor("waterColor", chunkBiome->waterColor);
-    waterShader->setUniform4fv("surroundingWaterColors", surroundingWaterColors);
-
-    const PlanetGenData& planetGenData = PlanetGenDataLoader::getPlanetGenData(chunkManager.getPlanetType());
-
-    // Draw water
-    pl::Vector2f waterPos = camera.worldToScreenTransform(worldPosition, chunkManager.getWorldSize());
-    pl::Rect<int> waterRect(waterPos.x, waterPos.y, TILE_SIZE_PIXELS_UNSCALED * CHUNK_TILE_SIZE * scale, TILE_SIZE_PIXELS_UNSCALED * CHUNK_TILE_SIZE * scale);
-
-    pl::VertexArray waterVertices;
-    waterVertices.addQuad(waterRect, pl::Color(), pl::Rect<float>(planetGenData.waterTextureOffset.x, planetGenData.waterTextureOffset.y, 32 * 4, 32 * 4));
-
-    window.draw(waterVertices, *waterShader, waterTexture, pl::BlendMode::Alpha);
-}
-
 bool Chunk::updateChunkObjects(Game& game, float dt, float gameTime, int worldSize, ChunkManager& chunkManager, PathfindingEngine& pathfindingEngine)
 {
     LocationState locationState = LocationState::createFromPlanetType(chunkManager.getPlanetType());
@@ -880,11 +791,13 @@ bool Chunk::updateChunkObjects(Game& game, float dt, float gameTime, int worldSi
     {
         const BiomeGenData* biomeGenData = chunkManager.getChunkBiome(chunkPosition);
 
-        nextResourceRegenerationTime = gameTime + Helper::randFloat(biomeGenData->resourceRegenerationTimeMin, biomeGenData->resourceRegenerationTimeMax);
+        RandomStream& randomStream = chunkManager.getRandomStream(RandomStreamType::ResourceRegeneration);
+
+        nextResourceRegenerationTime = gameTime + randomStream.randFloat(biomeGenData->resourceRegenerationTimeMin, biomeGenData->resourceRegenerationTimeMax);
 
         if (biomeGenData && getObjectCountInGrid() < MAX_OBJECTS_FOR_REGENERATION)
         {
-            RandInt randGen(rand());
+            RandInt randGen(randomStream.next());
             modifiedObjects = generateObjects(chunkManager.getHeightNoise(), chunkManager.getBiomeNoise(), chunkManager.getRiverNoise(),
                 chunkManager.getPlanetType(), randGen, game, chunkManager, pathfindingEngine, false, biomeGenData->resourceRegenerationDensity);
         }
@@ -960,6 +873,8 @@ void Chunk::setObject(pl::Vector2<int> position, ObjectType objectType, Game& ga
         modified = true;
     }
 
+    markObjectModified(position);
+
     // pl::Vector2f worldPosition = static_cast<pl::Vector2f>(chunkPosition) * 8.0f * tileSize;
     pl::Vector2f objectPos;
     objectPos.x = worldPosition.x + position.x * TILE_SIZE_PIXELS_UNSCALED + TILE_SIZE_PIXELS_UNSCALED / 2.0f;
@@ -1027,6 +942,7 @@ void Chunk::deleteObject(pl::Vector2<int> position, Game& game, ChunkManager& ch
     }
 
     modified = true;
+    markObjectModified(position);
 
     // Get size of object to handle different deletion cases
     ObjectType objectType = object->getObjectType();
@@ -1066,12 +982,14 @@ void Chunk::deleteObject(pl::Vector2<int> position, Game& game, ChunkManager& ch
 void Chunk::deleteSingleObject(pl::Vector2<int> position, ChunkManager& chunkManager, PathfindingEngine& pathfindingEngine)
 {
     objectGrid[position.y][position.x].reset();
+    markObjectModified(position);
     recalculateCollisionRects(chunkManager, &pathfindingEngine);
 }
 
 void Chunk::setObjectReference(const ObjectReference& objectReference, pl::Vector2<int> tile, ChunkManager& chunkManager, PathfindingEngine& pathfindingEngine)
 {
     modified = true;
+    markObjectModified(tile);
 
     objectGrid[tile.y][tile.x] = std::make_unique<BuildableObject>(objectReference);
 
@@ -1114,13 +1032,20 @@ bool Chunk::canPlaceObject(pl::Vector2<int> position, ObjectType objectType, int
     return true;
 }
 
-void Chunk::updateChunkEntities(float dt, int worldSize, ProjectileManager* projectileManager, ChunkManager& chunkManager, Game* game, bool networkUpdateOnly)
+void Chunk::updateChunkEntities(float dt, int worldSize, ProjectileManager* projectileManager, ChunkManager& chunkManager, Game* game, bool networkUpdateOnly,
+    EntityUpdateScheduler* entityUpdateScheduler)
 {
     if (!networkUpdateOnly && (!projectileManager || !game))
     {
         return;
     }
 
+    EntityUpdateTier updateTier = EntityUpdateTier::Full;
+    if (entityUpdateScheduler && !networkUpdateOnly)
+    {
+        updateTier = entityUpdateScheduler->getChunkTier(chunkPosition);
+    }
+
     for (auto entityIter = entities.begin(); entityIter != entities.end();)
     {
         std::unique_ptr<Entity>& entity = *entityIter;
@@ -1128,7 +1053,13 @@ void Chunk::updateChunkEntities(float dt, int worldSize, ProjectileManager* proj
         // Determine whether on water
         bool onWater = (getTileType(entity->getChunkTileInside(worldSize)) == 0);
 
-        entity->update(dt, *projectileManager, chunkManager, *game, onWater, game->getGameTime(), networkUpdateOnly);
+        bool updateBehaviour = true;
+        if (entityUpdateScheduler && !networkUpdateOnly)
+        {
+            updateBehaviour = entityUpdateScheduler->scheduleBehaviourUpdate(updateTier, entity->getUpdateSchedule());
+        }
+
+        entity->update(dt, *projectileManager, chunkManager, *game, onWater, game->getGameTime(), networkUpdateOnly, updateBehaviour);
 
         if (networkUpdateOnly)
         {
@@ -1140,6 +1071,7 @@ void Chunk::updateChunkEntities(float dt, int worldSize, ProjectileManager* proj
         if (!entity->isAlive())
         {
             entityIter = entities.erase(entityIter);
+            entitiesVersion++;
             continue;
         }
 
@@ -1183,6 +1115,7 @@ void Chunk::updateChunkEntities(float dt, int worldSize, ProjectileManager* proj
                 chunkManager.moveEntityToChunkFromChunk(std::move(entity), newChunk);
             }
             entityIter = entities.erase(entityIter);
+            entitiesVersion++;
             continue;
         }
 
@@ -1190,10 +1123,19 @@ void Chunk::updateChunkEntities(float dt, int worldSize, ProjectileManager* proj
     }
 }
 
-void Chunk::testEntityHitCollision(const std::vector<HitRect>& hitRects, pl::Vector2f hitOrigin, ChunkManager& chunkManager, Game& game, float gameTime)
+void Chunk::testEntityHitCollision(const std::vector<HitRect>& hitRects, pl::Vector2f hitOrigin, ChunkManager& chunkManager, Game& game, float gameTime,
+    const HitboxSnapshot* rewindSnapshot)
 {
     for (auto& entity : entities)
     {
+        if (rewindSnapshot)
+        {
+            std::vector<HitRect> rewoundHitRects = HitboxHistory::rewindHitRects(hitRects, rewindSnapshot, entity->getHitboxObjectID(), entity->getPosition(),
+                chunkManager.getWorldSize());
+            entity->testHitCollision(rewoundHitRects, hitOrigin, game, LocationState::createFromPlanetType(chunkManager.getPlanetType()), gameTime);
+            continue;
+        }
+
         entity->testHitCollision(hitRects, hitOrigin, game, LocationState::createFromPlanetType(chunkManager.getPlanetType()), gameTime);
     }
 }
@@ -1224,6 +1166,7 @@ bool Chunk::testEntityPlayerDamageCollision(const CollisionRect& playerCollision
 void Chunk::moveEntityToChunk(std::unique_ptr<Entity> entity)
 {
     entities.push_back(std::move(entity));
+    entitiesVersion++;
 }
 
 Entity* Chunk::getSelectedEntity(pl::Vector2f cursorPos)
@@ -1253,15 +1196,19 @@ void Chunk::loadEntityPacketData(const PacketDataEntities::EntityPacketData& pac
     auto entity = std::make_unique<Entity>(pl::Vector2f(0, 0), 0);
     entity->loadFromPacketData(packetData, worldPosition);
     entities.push_back(std::move(entity));
+    entitiesVersion++;
 }
 
 void Chunk::clearEntities()
 {
     entities.clear();
+    entitiesVersion++;
 }
 
 uint64_t Chunk::addItemPickup(const ItemPickup& itemPickup, std::optional<uint64_t> idOverride)
 {
+    markItemPickupsModified();
+
     if (idOverride.has_value())
     {
         itemPickups[idOverride.value()] = itemPickup;
@@ -1296,6 +1243,7 @@ void Chunk::deleteItemPickup(uint64_t id)
     }
 
     itemPickups.erase(id);
+    markItemPickupsModified();
 }
 
 ItemPickup* Chunk::getItemPickup(uint64_t id)
@@ -1323,6 +1271,7 @@ std::vector<WorldObject*> Chunk::getItemPickups()
 void Chunk::overwriteItemPickupsMap(const std::unordered_map<uint64_t, ItemPickup>& itemPickups)
 {
     this->itemPickups = itemPickups;
+    markItemPickupsModified();
 }
 
 const std::unordered_map<uint64_t, ItemPickup>& Chunk::getItemPickupsMap()
@@ -1494,6 +1443,7 @@ void Chunk::placeLand(pl::Vector2<int> tile, int worldSize, const FastNoise& hei
     PlanetType planetType, ChunkManager& chunkManager, PathfindingEngine& pathfindingEngine)
 {
     modified = true;
+    markContentModified();
 
     // Chunk* upChunk = chunkManager.getChunk(ChunkPosition(chunkPosition.x, ((chunkPosition.y - 1) % worldSize + worldSize) % worldSize));
     // Chunk* downChunk = chunkManager.getChunk(ChunkPosition(chunkPosition.x, ((chunkPosition.y + 1) % worldSize + worldSize) % worldSize));
@@ -1563,42 +1513,47 @@ ChunkWorldMapSection Chunk::createChunkWorldMapSection(ChunkManager& chunkManage
     ChunkWorldMapSection chunkMapSection;
     chunkMapSection.chunkPosition = chunkPosition;
 
-    for (int y = 0; y < CHUNK_TILE_SIZE; y += CHUNK_MAP_TILE_AREA_SIZE)
+    // Biomes are cached per chunk, so only tiles already generated are read here
+    const ChunkManager::ChunkMapBiomeGrid& chunkMapBiomes = chunkManager.getChunkMapBiomes(chunkPosition);
+
+    for (int y = 0; y < CHUNK_MAP_TILE_SIZE; y++)
     {
-        for (int x = 0; x < CHUNK_TILE_SIZE; x += CHUNK_MAP_TILE_AREA_SIZE)
+        for (int x = 0; x < CHUNK_MAP_TILE_SIZE; x++)
         {
             int tileCounter = 0;
             uint16_t tileId = 0;
-            const BiomeGenData* biomeGenData = getBiomeGenAtWorldTile(pl::Vector2<int>(chunkPosition.x * CHUNK_TILE_SIZE + x,
-                chunkPosition.y * CHUNK_TILE_SIZE + y), chunkManager.getWorldSize(), chunkManager.getBiomeNoise(), chunkManager.getPlanetType());
+            pl::Vector2<int> groundTile;
 
             for (int ySub = 0; ySub < CHUNK_MAP_TILE_AREA_SIZE; ySub++)
             {
                 for (int xSub = 0; xSub < CHUNK_MAP_TILE_AREA_SIZE; xSub++)
                 {
-                    if (groundTileGrid[y + ySub][x + xSub] != 0)
+                    uint16_t subTileId = groundTileGrid[y * CHUNK_MAP_TILE_AREA_SIZE + ySub][x * CHUNK_MAP_TILE_AREA_SIZE + xSub];
+                    if (subTileId != 0)
                     {
                         tileCounter++;
-                        tileId = groundTileGrid[y + ySub][x + xSub];
-                        biomeGenData = getBiomeGenAtWorldTile(pl::Vector2<int>(chunkPosition.x * CHUNK_TILE_SIZE + x + xSub,
-                            chunkPosition.y * CHUNK_TILE_SIZE + y + ySub),
-                            chunkManager.getWorldSize(), chunkManager.getBiomeNoise(), chunkManager.getPlanetType());
+                        tileId = subTileId;
+                        groundTile = pl::Vector2<int>(x * CHUNK_MAP_TILE_AREA_SIZE + xSub, y * CHUNK_MAP_TILE_AREA_SIZE + ySub);
                     }
                 }
             }
-            
-            // if (!biomeGenData)
-            // {
-            //     continue;
-            // }
 
             if (tileCounter >= 2)
             {
-                chunkMapSection.colorGrid[y / CHUNK_MAP_TILE_AREA_SIZE][x / CHUNK_MAP_TILE_AREA_SIZE] = PlanetGenDataLoader::getTileMapDataFromID(tileId).mapColor;
+                chunkMapSection.colorGrid[y][x] = PlanetGenDataLoader::getTileMapDataFromID(tileId).mapColor;
                 continue;
             }
+
+            const BiomeGenData* biomeGenData = chunkMapBiomes[y][x];
+
+            // Water colour is taken from biome of single land tile in area, if any (rare, so not cached)
+            if (tileCounter == 1)
+            {
+                biomeGenData = getBiomeGenAtWorldTile(pl::Vector2<int>(chunkPosition.x * CHUNK_TILE_SIZE + groundTile.x,
+                    chunkPosition.y * CHUNK_TILE_SIZE + groundTile.y), chunkManager.getWorldSize(), chunkManager.getBiomeNoise(), chunkManager.getPlanetType());
+            }
             
-            chunkMapSection.colorGrid[y / CHUNK_MAP_TILE_AREA_SIZE][x / CHUNK_MAP_TILE_AREA_SIZE] = biomeGenData->waterColor;
+            chunkMapSection.colorGrid[y][x] = biomeGenData->waterColor;
         }
     }
 
@@ -1652,12 +1607,14 @@ void Chunk::loadFromChunkPOD(const ChunkPOD& pod, Game& game, ChunkManager& chun
 {
     generatedFromPOD = true;
     modified = pod.modified;
+    markContentModified();
     gameTimeCreated = (pod.gameTimeCreated >= 0.0f) ? pod.gameTimeCreated : game.getGameTime();
 
     const BiomeGenData* biomeGenData = chunkManager.getChunkBiome(chunkPosition);
     if (biomeGenData)
     {
-        nextResourceRegenerationTime = gameTimeCreated + Helper::randFloat(biomeGenData->resourceRegenerationTimeMin, biomeGenData->resourceRegenerationTimeMax);
+        nextResourceRegenerationTime = gameTimeCreated + chunkManager.getRandomStream(RandomStreamType::ResourceRegeneration).randFloat(
+            biomeGenData->resourceRegenerationTimeMin, biomeGenData->resourceRegenerationTimeMax);
     }
 
     groundTileGrid = pod.groundTileGrid;
@@ -1701,6 +1658,7 @@ void Chunk::loadFromChunkPOD(const ChunkPOD& pod, Game& game, ChunkManager& chun
         std::unique_ptr<Entity> entity = std::make_unique<Entity>(pl::Vector2f(0, 0), 0);
         entity->loadFromPOD(entityPOD, worldPosition);
         entities.push_back(std::move(entity));
+        entitiesVersion++;
     }
 
     if (pod.structureObject.has_value())
@@ -1781,11 +1739,165 @@ bool Chunk::hasBeenModified()
     return modified;
 }
 
+void Chunk::markModified()
+{
+    modified = true;
+}
+
+void Chunk::markContentModified()
+{
+    contentVersion = ++contentVersionCounter;
+
+    objectEditLog.clear();
+    objectEditLogStartVersion = contentVersion;
+}
+
+void Chunk::markItemPickupsModified()
+{
+    contentVersion = ++contentVersionCounter;
+}
+
+void Chunk::markObjectModified(pl::Vector2<int> tile)
+{
+    contentVersion = ++contentVersionCounter;
+
+    // Drop oldest edit, so edits are now only logged since dropped edit
+    if (objectEditLog.size() >= MAX_OBJECT_EDIT_LOG_SIZE)
+    {
+        objectEditLogStartVersion = objectEditLog.front().contentVersion;
+        objectEditLog.erase(objectEditLog.begin());
+    }
+
+    objectEditLog.push_back({contentVersion, static_cast<uint8_t>(tile.y * 8 + tile.x)});
+}
+
+bool Chunk::getObjectEditsSince(uint64_t sinceContentVersion, std::vector<PacketDataChunkEdits::ObjectEdit>& objectEdits)
+{
+    if (sinceContentVersion < objectEditLogStartVersion || sinceContentVersion > contentVersion)
+    {
+        return false;
+    }
+
+    std::array<std::array<bool, 8>, 8> tilesEdited = {};
+
+    for (const ObjectEditLogEntry& entry : objectEditLog)
+    {
+        PacketDataChunkEdits::ObjectEdit objectEdit;
+        objectEdit.tileIndex = entry.tileIndex;
+
+        pl::Vector2<int> tile = objectEdit.getTile();
+
+        if (entry.contentVersion <= sinceContentVersion || tilesEdited[tile.y][tile.x])
+        {
+            continue;
+        }
+
+        tilesEdited[tile.y][tile.x] = true;
+
+        if (objectGrid[tile.y][tile.x])
+        {
+            objectEdit.object = objectGrid[tile.y][tile.x]->getPOD();
+        }
+
+        objectEdits.push_back(objectEdit);
+    }
+
+    return true;
+}
+
+void Chunk::loadObjectEdits(const PacketDataChunkEdits::ChunkEdits& chunkEdits, Game& game, ChunkManager& chunkManager, PathfindingEngine& pathfindingEngine)
+{
+    BuildableObjectCreateParameters createParameters;
+    createParameters.flashOnCreate = true;
+
+    for (const PacketDataChunkEdits::ObjectEdit& objectEdit : chunkEdits.objectEdits)
+    {
+        pl::Vector2<int> tile = objectEdit.getTile();
+        std::unique_ptr<BuildableObject>& object = objectGrid[tile.y][tile.x];
+
+        if (!objectEdit.object.has_value())
+        {
+            object = nullptr;
+            continue;
+        }
+
+        // Keep existing object if unchanged
+        if (object && object->getObjectType() == objectEdit.object->objectType)
+        {
+            object->loadFromPOD(objectEdit.object.value());
+            continue;
+        }
+
+        pl::Vector2f objectPos;
+        objectPos.x = worldPosition.x + (tile.x + 0.5f) * TILE_SIZE_PIXELS_UNSCALED;
+        objectPos.y = worldPosition.y + (tile.y + 0.5f) * TILE_SIZE_PIXELS_UNSCALED;
+
+        object = BuildableObjectFactory::create(objectPos, objectEdit.object->objectType, createParameters, &game, &chunkManager);
+        object->loadFromPOD(objectEdit.object.value());
+    }
+
+    markContentModified();
+    hostContentVersion = chunkEdits.contentVersion;
+
+    recalculateCollisionRects(chunkManager, &pathfindingEngine);
+}
+
 ChunkPosition Chunk::getChunkPosition()
 {
     return chunkPosition;
 }
 
+const std::vector<WorldObject*>& Chunk::getDrawableObjects(VisibleObjectStats& stats)
+{
+    if (drawableObjectsBuilt && drawableContentVersion == contentVersion && drawableEntitiesVersion == entitiesVersion)
+    {
+        return drawableObjects;
+    }
+
+    // Rebuild in place, reusing capacity from previous build
+    size_t capacity = drawableObjects.capacity();
+    drawableObjects.clear();
+
+    for (int y = 0; y < 8; y++)
+    {
+        for (int x = 0; x < 8; x++)
+        {
+            // Object references are drawn by the object they reference
+            if (!objectGrid[y][x] || objectGrid[y][x]->isObjectReference())
+                continue;
+
+            drawableObjects.push_back(objectGrid[y][x].get());
+        }
+    }
+
+    if (structureObject.has_value())
+    {
+        drawableObjects.push_back(&structureObject.value());
+    }
+
+    for (auto& entity : entities)
+    {
+        drawableObjects.push_back(entity.get());
+    }
+
+    for (auto& itemPickup : itemPickups)
+    {
+        drawableObjects.push_back(&itemPickup.second);
+    }
+
+    drawableContentVersion = contentVersion;
+    drawableEntitiesVersion = entitiesVersion;
+    drawableObjectsBuilt = true;
+
+    stats.chunkListRebuilds++;
+    if (drawableObjects.capacity() != capacity)
+    {
+        stats.allocations++;
+    }
+
+    return drawableObjects;
+}
+
 std::vector<WorldObject*> Chunk::getEntities()
 {
     std::vector<WorldObject*> entities_worldObject;
@@ -1794,4 +1906,20 @@ std::vector<WorldObject*> Chunk::getEntities()
         entities_worldObject.push_back(entity.get());
     }
     return entities_worldObject;
+}
+
+uint64_t Chunk::getEntitiesStateHash(uint64_t hash)
+{
+    for (auto& entity : entities)
+    {
+        EntityPOD pod = entity->getPOD(worldPosition);
+
+        hash = Helper::hashBytes(&pod.entityType, sizeof(pod.entityType), hash);
+        hash = Helper::hashBytes(&pod.chunkRelativePosition.x, sizeof(pod.chunkRelativePosition.x), hash);
+        hash = Helper::hashBytes(&pod.chunkRelativePosition.y, sizeof(pod.chunkRelativePosition.y), hash);
+        hash = Helper::hashBytes(&pod.velocity.x, sizeof(pod.velocity.x), hash);
+        hash = Helper::hashBytes(&pod.velocity.y, sizeof(pod.velocity.y), hash);
+    }
+
+    return hash;
 }
\ No newline at end of file
@@ -0,0 +1,339 @@
+#include "World/ChunkColdStorage.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <sstream>
+#include <chrono>
+#include <filesystem>
+
+#include <extlib/cereal/archives/binary.hpp>
+#include <extlib/cereal/types/unordered_map.hpp>
+
+#include "IO/Log.hpp"
+
+ChunkColdStorage::SpillFile::SpillFile()
+{
+    uint64_t time = std::chrono::system_clock::now().time_since_epoch() / std::chrono::microseconds(1);
+
+    path = (std::filesystem::temp_directory_path() / ("planeturem_chunks_" + std::to_string(time) + "_" +
+        std::to_string(reinterpret_cast<uintptr_t>(this)) + ".tmp")).string();
+
+    stream.open(path, std::ios::in | std::ios::out | std::ios::binary | std::ios::trunc);
+}
+
+ChunkColdStorage::SpillFile::~SpillFile()
+{
+    stream.close();
+
+    std::error_code error;
+    std::filesystem::remove(path, error);
+}
+
+void ChunkColdStorage::storeChunk(const ChunkPOD& pod, const std::unordered_map<uint64_t, ItemPickup>& itemPickups)
+{
+    std::stringstream stream;
+    {
+        cereal::BinaryOutputArchive archive(stream);
+        archive(pod, itemPickups);
+    }
+
+    std::string dataString = stream.str();
+
+    ColdChunk& coldChunk = coldChunks[pod.chunkPosition];
+    coldChunk.compressedData = CompressedData(std::vector<char>(dataString.begin(), dataString.end()));
+    coldChunk.groundTileGrid = pod.groundTileGrid;
+    coldChunk.storeIndex = nextStoreIndex++;
+
+    memoryBytes += coldChunk.compressedData.data.size();
+    uncompressedBytes += coldChunk.compressedData.uncompressedSize;
+    chunksStored++;
+}
+
+bool ChunkColdStorage::takeChunk(ChunkPosition chunk, ChunkPOD& pod, std::unordered_map<uint64_t, ItemPickup>& itemPickups)
+{
+    auto iter = coldChunks.find(chunk);
+    if (iter == coldChunks.end())
+    {
+        return false;
+    }
+
+    // Chunk is kept if it could not be read, so modified chunk is not lost
+    if (!readChunk(iter->second, pod, itemPickups))
+    {
+        return false;
+    }
+
+    if (iter->second.spilled)
+    {
+        spilledBytes -= iter->second.spillSize;
+        freeSpillRange(iter->second.spillOffset, iter->second.spillSize);
+    }
+    else
+    {
+        memoryBytes -= iter->second.compressedData.data.size();
+    }
+    uncompressedBytes -= iter->second.compressedData.uncompressedSize;
+
+    coldChunks.erase(iter);
+    chunksRehydrated++;
+
+    // No chunks left in spill file, so delete
+    if (spilledBytes <= 0)
+    {
+        spillFile.reset();
+        spillFileSize = 0;
+        freeSpillRanges.clear();
+    }
+
+    return true;
+}
+
+bool ChunkColdStorage::readChunk(ColdChunk& coldChunk, ChunkPOD& pod, std::unordered_map<uint64_t, ItemPickup>& itemPickups)
+{
+    CompressedData compressedData;
+
+    if (coldChunk.spilled)
+    {
+        if (!spillFile || !spillFile->stream.is_open())
+        {
+            Log::push("ERROR: Could not read spilled chunk from \"{}\"\n", spillFile ? spillFile->path : "");
+            return false;
+        }
+
+        compressedData.uncompressedSize = coldChunk.compressedData.uncompressedSize;
+        compressedData.data.resize(coldChunk.spillSize);
+
+        spillFile->stream.clear();
+        spillFile->stream.seekg(coldChunk.spillOffset);
+        spillFile->stream.read(compressedData.data.data(), coldChunk.spillSize);
+
+        if (!spillFile->stream || spillFile->stream.gcount() != coldChunk.spillSize)
+        {
+            Log::push("ERROR: Could not read spilled chunk from \"{}\", read {} of {} bytes\n", spillFile->path,
+                spillFile->stream.gcount(), coldChunk.spillSize);
+            return false;
+        }
+    }
+    else
+    {
+        compressedData = coldChunk.compressedData;
+    }
+
+    std::vector<char> data = compressedData.decompress();
+
+    try
+    {
+        std::stringstream stream(std::string(data.begin(), data.end()));
+        cereal::BinaryInputArchive archive(stream);
+        archive(pod, itemPickups);
+    }
+    catch (const std::exception& e)
+    {
+        Log::push("ERROR: Could not read cold stored chunk: {}\n", e.what());
+        return false;
+    }
+
+    return true;
+}
+
+int ChunkColdStorage::getTileType(ChunkPosition chunk, pl::Vector2<int> tile) const
+{
+    auto iter = coldChunks.find(chunk);
+    if (iter == coldChunks.end())
+    {
+        return 0;
+    }
+
+    return iter->second.groundTileGrid[tile.y][tile.x];
+}
+
+std::vector<ChunkPOD> ChunkColdStorage::getChunkPODs()
+{
+    std::vector<ChunkPOD> pods;
+
+    for (auto& [chunkPosition, coldChunk] : coldChunks)
+    {
+        ChunkPOD pod;
+        std::unordered_map<uint64_t, ItemPickup> itemPickups;
+
+        if (readChunk(coldChunk, pod, itemPickups))
+        {
+            pods.push_back(pod);
+        }
+    }
+
+    return pods;
+}
+
+void ChunkColdStorage::enforceMemoryBudget()
+{
+    if (!spillEnabled || memoryBytes <= MAX_MEMORY_BYTES)
+    {
+        return;
+    }
+
+    std::vector<std::pair<uint64_t, ChunkPosition>> chunksInMemory;
+    for (const auto& [chunkPosition, coldChunk] : coldChunks)
+    {
+        if (!coldChunk.spilled)
+        {
+            chunksInMemory.push_back({coldChunk.storeIndex, chunkPosition});
+        }
+    }
+
+    // Spill least recently stored first
+    std::sort(chunksInMemory.begin(), chunksInMemory.end());
+
+    for (const auto& chunkInMemory : chunksInMemory)
+    {
+        if (memoryBytes <= MAX_MEMORY_BYTES)
+        {
+            break;
+        }
+
+        if (!spillChunk(coldChunks.at(chunkInMemory.second)))
+        {
+            break;
+        }
+    }
+}
+
+bool ChunkColdStorage::spillChunk(ColdChunk& coldChunk)
+{
+    if (!spillFile)
+    {
+        spillFile = std::make_unique<SpillFile>();
+    }
+
+    spillFile->stream.clear();
+
+    if (!spillFile->stream.is_open())
+    {
+        Log::push("WARNING: Could not write to chunk spill file \"{}\", disabling spill\n", spillFile->path);
+        spillEnabled = false;
+        return false;
+    }
+
+    uint32_t spillSize = coldChunk.compressedData.data.size();
+    uint64_t spillOffset = allocateSpillRange(spillSize);
+
+    spillFile->stream.seekp(spillOffset);
+    spillFile->stream.write(coldChunk.compressedData.data.data(), spillSize);
+
+    if (!spillFile->stream)
+    {
+        Log::push("WARNING: Could not write to chunk spill file \"{}\", disabling spill\n", spillFile->path);
+        freeSpillRange(spillOffset, spillSize);
+        spillEnabled = false;
+        return false;
+    }
+
+    coldChunk.spillOffset = spillOffset;
+    coldChunk.spillSize = spillSize;
+
+    coldChunk.spilled = true;
+
+    memoryBytes -= coldChunk.spillSize;
+    spilledBytes += coldChunk.spillSize;
+
+    // Keep uncompressed size to decompress when read back
+    coldChunk.compressedData.data.clear();
+    coldChunk.compressedData.data.shrink_to_fit();
+
+    return true;
+}
+
+uint64_t ChunkColdStorage::allocateSpillRange(uint64_t size)
+{
+    // First freed range large enough
+    for (auto iter = freeSpillRanges.begin(); iter != freeSpillRanges.end(); iter++)
+    {
+        if (iter->second < size)
+        {
+            continue;
+        }
+
+        uint64_t offset = iter->first;
+        uint64_t remainingSize = iter->second - size;
+        freeSpillRanges.erase(iter);
+
+        if (remainingSize > 0)
+        {
+            freeSpillRanges[offset + size] = remainingSize;
+        }
+
+        return offset;
+    }
+
+    uint64_t offset = spillFileSize;
+    spillFileSize += size;
+    return offset;
+}
+
+void ChunkColdStorage::freeSpillRange(uint64_t offset, uint64_t size)
+{
+    auto iter = freeSpillRanges.emplace(offset, size).first;
+
+    // Merge with following range
+    auto nextIter = std::next(iter);
+    if (nextIter != freeSpillRanges.end() && iter->first + iter->second == nextIter->first)
+    {
+        iter->second += nextIter->second;
+        freeSpillRanges.erase(nextIter);
+    }
+
+    // Merge with preceding range
+    if (iter != freeSpillRanges.begin())
+    {
+        auto previousIter = std::prev(iter);
+        if (previousIter->first + previousIter->second == iter->first)
+        {
+            previousIter->second += iter->second;
+            freeSpillRanges.erase(iter);
+            iter = previousIter;
+        }
+    }
+
+    // Range at end of file is not kept, so next spill writes from its start
+    if (iter->first + iter->second == spillFileSize)
+    {
+        spillFileSize = iter->first;
+        freeSpillRanges.erase(iter);
+    }
+}
+
+void ChunkColdStorage::clear()
+{
+    coldChunks.clear();
+    nextStoreIndex = 0;
+
+    memoryBytes = 0;
+    spilledBytes = 0;
+    uncompressedBytes = 0;
+
+    chunksStored = 0;
+    chunksRehydrated = 0;
+
+    spillFile.reset();
+    spillFileSize = 0;
+    freeSpillRanges.clear();
+}
+
+ChunkColdStorageStats ChunkColdStorage::getStats() const
+{
+    ChunkColdStorageStats stats;
+    stats.chunkCount = coldChunks.size();
+    stats.memoryBytes = memoryBytes;
+    stats.spilledBytes = spilledBytes;
+    stats.spillFileBytes = spillFileSize;
+    stats.uncompressedBytes = uncompressedBytes;
+    stats.chunksStored = chunksStored;
+    stats.chunksRehydrated = chunksRehydrated;
+
+    for (const auto& coldChunk : coldChunks)
+    {
+        stats.spilledChunkCount += coldChunk.second.spilled;
+    }
+
+    return stats;
+}
@@ -3,6 +3,12 @@
 #include "Game.hpp"
 #include "Player/Player.hpp"
 #include "IO/Log.hpp"
+#include "Core/WorkerPool.hpp"
+
+#include <sstream>
+#include <algorithm>
+
+#include <extlib/cereal/archives/binary.hpp>
 
 void ChunkManager::setSeed(int seed)
 {
@@ -20,6 +26,8 @@ void ChunkManager::setSeed(int seed)
     heightNoise.SetSeed(seed + planetType);
     biomeNoise.SetSeed(seed + planetType + 1);
     riverNoise.SetSeed(seed + planetType + 2);
+
+    randomStreams.seed(seed, planetType);
 }
 
 int ChunkManager::getSeed() const
@@ -56,13 +64,21 @@ void ChunkManager::deleteAllChunks()
     loadedChunks.clear();
     storedChunks.clear();
 
+    coldStorage.clear();
+    storedChunkLastUsedTime.clear();
+
     chunkBiomeCache.clear();
+    chunkMapBiomeCache.clear();
+
+    terrainRenderer.reset();
     chunkLastEntitySpawnTime.clear();
 }
 
 bool ChunkManager::updateChunks(Game& game, float gameTime, const std::vector<ChunkViewRange>& chunkViewRanges,
     NetworkHandler* networkHandler, std::vector<ChunkPosition>* chunksToRequestFromHost)
 {
+    currentTime = gameTime * 1000;
+
     // Chunk load/unload
 
     bool hasModifiedChunks = false;
@@ -77,6 +93,13 @@ bool ChunkManager::updateChunks(Game& game, float gameTime, const std::vector<Ch
         }
 
         hasModifiedChunks = true;
+
+        // Decompress chunk from cold storage into stored chunks, to be loaded
+        // Chunk is not regenerated if it could not be rehydrated, as regenerating would lose modifications
+        if (coldStorage.containsChunk(chunkPos) && !rehydrateColdChunk(chunkPos))
+        {
+            continue;
+        }
     
         // Check if chunk is in memory, and load if so
         if (storedChunks.count(chunkPos))
@@ -105,7 +128,7 @@ bool ChunkManager::updateChunks(Game& game, float gameTime, const std::vector<Ch
     
                 if (getChunkEntitySpawnCooldown(chunkPos) >= MAX_CHUNK_ENTITY_SPAWN_COOLDOWN)
                 {
-                    chunk->spawnChunkEntities(worldSize, heightNoise, biomeNoise, riverNoise, planetType);
+                    chunk->spawnChunkEntities(worldSize, heightNoise, biomeNoise, riverNoise, planetType, randomStreams.get(RandomStreamType::EntitySpawn));
                     resetChunkEntitySpawnCooldown(chunkPos);
                 }
             }
@@ -197,6 +220,96 @@ bool ChunkManager::unloadChunksOutOfView(const std::vector<ChunkViewRange>& chun
     return hasUnloadedChunks;
 }
 
+void ChunkManager::updateColdStorage(Game& game)
+{
+    this->game = &game;
+
+    currentTime = game.getGameTime() * 1000;
+    uint64_t time = currentTime;
+
+    if (time - lastColdStorageUpdateTime < COLD_STORAGE_UPDATE_TIME)
+    {
+        return;
+    }
+
+    lastColdStorageUpdateTime = time;
+
+    // Remove times for chunks which are no longer stored (loaded into view)
+    std::erase_if(storedChunkLastUsedTime, [this](const auto& lastUsedTime)
+    {
+        return !storedChunks.contains(lastUsedTime.first);
+    });
+
+    std::vector<std::pair<uint64_t, ChunkPosition>> storedChunkTimes;
+    for (auto& storedChunk : storedChunks)
+    {
+        auto lastUsedTime = storedChunkLastUsedTime.try_emplace(storedChunk.first, time);
+        storedChunkTimes.push_back({lastUsedTime.first->second, storedChunk.first});
+    }
+
+    // Least recently used first
+    std::sort(storedChunkTimes.begin(), storedChunkTimes.end());
+
+    int overBudgetCount = static_cast<int>(storedChunkTimes.size()) - MAX_STORED_CHUNKS;
+
+    // Limit chunks compressed per update to avoid frame spikes
+    for (int i = 0; i < std::min(static_cast<int>(storedChunkTimes.size()), MAX_COLD_STORED_CHUNKS_PER_UPDATE); i++)
+    {
+        if (i >= overBudgetCount && time - storedChunkTimes[i].first < STORED_CHUNK_COLD_TIME)
+        {
+            break;
+        }
+
+        storeChunkCold(storedChunkTimes[i].second);
+    }
+
+    coldStorage.enforceMemoryBudget();
+}
+
+void ChunkManager::storeChunkCold(ChunkPosition chunk)
+{
+    auto iter = storedChunks.find(chunk);
+    if (iter == storedChunks.end())
+    {
+        return;
+    }
+
+    // Unmodified chunks can be regenerated, so do not need to be kept
+    if (iter->second->hasBeenModified())
+    {
+        coldStorage.storeChunk(iter->second->getChunkPOD(), iter->second->getItemPickupsMap());
+    }
+
+    storedChunks.erase(iter);
+    storedChunkLastUsedTime.erase(chunk);
+}
+
+Chunk* ChunkManager::rehydrateColdChunk(ChunkPosition chunk)
+{
+    if (!game)
+    {
+        return nullptr;
+    }
+
+    ChunkPOD pod;
+    std::unordered_map<uint64_t, ItemPickup> itemPickups;
+
+    if (!coldStorage.takeChunk(chunk, pod, itemPickups))
+    {
+        Log::push("ERROR: Could not rehydrate cold chunk ({}, {}), chunk will not be loaded\n", chunk.x, chunk.y);
+        return nullptr;
+    }
+
+    std::unique_ptr<Chunk> chunkPtr = std::make_unique<Chunk>(chunk, 0.0f);
+    chunkPtr->loadFromChunkPOD(pod, *game, *this);
+    chunkPtr->overwriteItemPickupsMap(itemPickups);
+
+    storedChunks[chunk] = std::move(chunkPtr);
+    storedChunkLastUsedTime[chunk] = currentTime;
+
+    return storedChunks[chunk].get();
+}
+
 // void ChunkManager::reloadChunks(ChunkViewRange chunkViewRange)
 // {
 //     for (auto iter = loadedChunks.begin(); iter != loadedChunks.end();)
@@ -235,22 +348,84 @@ void ChunkManager::regenerateChunkWithStructureType(ChunkPosition chunk, Game& g
     chunkPtr->generateChunk(heightNoise, biomeNoise, riverNoise, planetType, game, *this, pathfindingEngine, structureType.has_value(), structureType);
 }
 
+int ChunkManager::pregenerateChunks(const std::vector<ChunkPosition>& chunks, Game& game, WorkerPool& workerPool)
+{
+    std::vector<ChunkPosition> chunksToGenerate;
+    for (ChunkPosition chunk : chunks)
+    {
+        if (!isChunkGenerated(chunk))
+        {
+            chunksToGenerate.push_back(chunk);
+        }
+    }
+
+    std::vector<std::unique_ptr<Chunk>> generatedChunks(chunksToGenerate.size());
+    std::vector<std::optional<RandInt>> chunkRandGens(chunksToGenerate.size());
+
+    // Tiles and structure only depend on chunk position and seed, so can be generated in parallel
+    // Each job generates every jobCount-th chunk, to avoid dispatching a job per chunk
+    int jobCount = std::max(workerPool.getWorkerCount(), 1) * 4;
+    float gameTime = game.getGameTime();
+
+    for (int job = 0; job < jobCount; job++)
+    {
+        workerPool.dispatch([this, job, jobCount, gameTime, &chunksToGenerate, &generatedChunks, &chunkRandGens]()
+        {
+            for (int i = job; i < chunksToGenerate.size(); i += jobCount)
+            {
+                generatedChunks[i] = std::make_unique<Chunk>(chunksToGenerate[i], gameTime);
+                chunkRandGens[i] = generatedChunks[i]->generateTilesAndStructure(heightNoise, biomeNoise, riverNoise, planetType, *this);
+            }
+        });
+    }
+
+    workerPool.wait();
+
+    // Objects may place references in adjacent chunks, and resource regeneration uses planet random streams,
+    // so remaining generation is in order given, with each chunk stored as it is generated
+    for (int i = 0; i < chunksToGenerate.size(); i++)
+    {
+        ChunkPosition chunkPosition = chunksToGenerate[i];
+
+        storedChunks[chunkPosition] = std::move(generatedChunks[i]);
+        Chunk* chunkPtr = storedChunks[chunkPosition].get();
+
+        resetChunkEntitySpawnCooldown(chunkPosition);
+
+        chunkPtr->generateFromTilesAndStructure(heightNoise, biomeNoise, riverNoise, planetType, chunkRandGens[i].value(), game, *this,
+            pathfindingEngine, false, false);
+
+        chunkPtr->markModified();
+    }
+
+    return chunksToGenerate.size();
+}
+
 void ChunkManager::drawChunkTerrain(pl::RenderTarget& window, pl::SpriteBatch& spriteBatch, const Camera& camera, float time)
 {
     ChunkViewRange chunkViewRange = camera.getChunkViewDrawRange();
-    
-    // Draw terrain
+
+    std::vector<Chunk*> chunksInView;
+    chunksInView.reserve(chunkViewRange.getSize());
+
     for (auto iter = chunkViewRange.begin(); iter != chunkViewRange.end(); iter++)
     {
-        ChunkPosition chunkPos = iter.get(worldSize);
-        
-        if (!loadedChunks.contains(chunkPos))
+        auto chunkIter = loadedChunks.find(iter.get(worldSize));
+        chunksInView.push_back(chunkIter != loadedChunks.end() ? chunkIter->second.get() : nullptr);
+    }
+    
+    // Draw terrain tilemaps for all chunks at once
+    terrainRenderer.drawTerrain(window, camera, chunkViewRange, chunksInView, drawStats);
+
+    #if (!RELEASE_BUILD)
+    for (Chunk* chunk : chunksInView)
+    {
+        if (chunk)
         {
-            continue;
+            chunk->drawChunkDebug(window, camera, worldSize);
         }
-        
-        loadedChunks[chunkPos]->drawChunkTerrain(window, camera, time, worldSize);
     }
+    #endif
 
     // Draw visual terrain features e.g. cliffs
     for (auto iter = chunkViewRange.begin(); iter != chunkViewRange.end(); iter++)
@@ -279,17 +454,27 @@ void ChunkManager::drawChunkWater(pl::RenderTarget& window, const Camera& camera
 
     ChunkViewRange chunkViewRange = camera.getChunkViewDrawRange();
 
+    std::vector<Chunk*> chunksInView;
+    chunksInView.reserve(chunkViewRange.getSize());
+
     for (auto iter = chunkViewRange.begin(); iter != chunkViewRange.end(); iter++)
     {
-        ChunkPosition chunkPos = iter.get(worldSize);
-        
-        if (!loadedChunks.contains(chunkPos))
+        auto chunkIter = loadedChunks.find(iter.get(worldSize));
+        chunksInView.push_back(chunkIter != loadedChunks.end() ? chunkIter->second.get() : nullptr);
+    }
+
+    pl::Rect<float> waterTextureRect(planetGenData.waterTextureOffset.x, planetGenData.waterTextureOffset.y, 32 * 4, 32 * 4);
+
+    // Draw water for all chunks at once, with chunk and surrounding water colours looked up by shader
+    terrainRenderer.drawWater(window, camera, chunkViewRange, chunksInView, waterTextureRect, [this](ChunkPosition chunkPos) -> std::optional<pl::Color>
+    {
+        const BiomeGenData* biomeGenData = getChunkBiome(ChunkPosition(Helper::wrap(chunkPos.x, worldSize), Helper::wrap(chunkPos.y, worldSize)));
+        if (biomeGenData == nullptr)
         {
-            continue;
+            return std::nullopt;
         }
-        
-        loadedChunks[chunkPos]->drawChunkWater(window, camera, *this);
-    }
+        return biomeGenData->waterColor;
+    }, drawStats);
 }
 
 Chunk* ChunkManager::getChunk(ChunkPosition chunk)
@@ -300,8 +485,17 @@ Chunk* ChunkManager::getChunk(ChunkPosition chunk)
     }
     else if (storedChunks.count(chunk) > 0)
     {
+        if (storedChunkLastUsedTime.contains(chunk))
+        {
+            storedChunkLastUsedTime[chunk] = currentTime;
+        }
+
         return storedChunks[chunk].get();
     }
+    else if (coldStorage.containsChunk(chunk))
+    {
+        return rehydrateColdChunk(chunk);
+    }
 
     return nullptr;
 }
@@ -357,6 +551,122 @@ std::set<int> ChunkManager::setChunkTile(ChunkPosition chunk, int tileMap, pl::V
     return tileMapsModified;
 }
 
+void ChunkManager::setChunkTilesFromGround(ChunkPosition chunk)
+{
+    Chunk* chunkPtr = getChunk(chunk);
+    if (!chunkPtr)
+        return;
+
+    static constexpr int TILE_SIZE = static_cast<int>(CHUNK_TILE_SIZE);
+
+    ChunkPosition upChunk(chunk.x, ((chunk.y - 1) % worldSize + worldSize) % worldSize);
+    ChunkPosition downChunk(chunk.x, ((chunk.y + 1) % worldSize + worldSize) % worldSize);
+    ChunkPosition leftChunk(((chunk.x - 1) % worldSize + worldSize) % worldSize, chunk.y);
+    ChunkPosition rightChunk(((chunk.x + 1) % worldSize + worldSize) % worldSize, chunk.y);
+
+    // Tile types for chunk with one tile border from adjacent chunks, indexed [y + 1][x + 1]
+    // Tiles in chunks not yet generated are 0 (water), so are ignored as in setChunkTile
+    std::array<std::array<int, TILE_SIZE + 2>, TILE_SIZE + 2> tileTypeGrid = {};
+
+    for (int y = 0; y < TILE_SIZE; y++)
+    {
+        for (int x = 0; x < TILE_SIZE; x++)
+        {
+            tileTypeGrid[y + 1][x + 1] = chunkPtr->getTileType(pl::Vector2<int>(x, y));
+        }
+    }
+
+    for (int i = 0; i < TILE_SIZE; i++)
+    {
+        tileTypeGrid[0][i + 1] = getChunkTileType(upChunk, pl::Vector2<int>(i, TILE_SIZE - 1));
+        tileTypeGrid[TILE_SIZE + 1][i + 1] = getChunkTileType(downChunk, pl::Vector2<int>(i, 0));
+        tileTypeGrid[i + 1][0] = getChunkTileType(leftChunk, pl::Vector2<int>(TILE_SIZE - 1, i));
+        tileTypeGrid[i + 1][TILE_SIZE + 1] = getChunkTileType(rightChunk, pl::Vector2<int>(0, i));
+    }
+
+    static constexpr int ADJACENT_OFFSETS[4][2] = {{0, -1}, {0, 1}, {-1, 0}, {1, 0}};
+
+    // Same placement rules as setChunkTile / setBackgroundAdjacentTilesForTile, applied to all tiles at once
+    std::map<int, TileMap::TilePresenceGrid> tileMapPresenceGrids;
+    std::set<int> tileMapsModified;
+
+    for (int y = 1; y <= TILE_SIZE; y++)
+    {
+        for (int x = 1; x <= TILE_SIZE; x++)
+        {
+            int tileType = tileTypeGrid[y][x];
+
+            // Tile is water
+            if (tileType == 0)
+                continue;
+
+            tileMapPresenceGrids[tileType][y][x] = true;
+
+            int drawLayer = PlanetGenDataLoader::getTileMapDataFromID(tileType).drawLayer;
+
+            for (const auto& offset : ADJACENT_OFFSETS)
+            {
+                int adjacentTileType = tileTypeGrid[y + offset[1]][x + offset[0]];
+
+                if (adjacentTileType == 0)
+                    continue;
+
+                int adjacentTileDrawLayer = PlanetGenDataLoader::getTileMapDataFromID(adjacentTileType).drawLayer;
+
+                if (adjacentTileDrawLayer < drawLayer)
+                {
+                    // Adjacent tile is lower, so must be set underneath this tile
+                    tileMapPresenceGrids[adjacentTileType][y][x] = true;
+                    continue;
+                }
+
+                // Adjacent tile is higher, so this tile must be set underneath it
+                // Handled from other side for tiles within chunk, so only required for tiles in adjacent chunks
+                bool adjacentInChunk = (x + offset[0] >= 1 && x + offset[0] <= TILE_SIZE && y + offset[1] >= 1 && y + offset[1] <= TILE_SIZE);
+                if (adjacentTileDrawLayer <= drawLayer || adjacentInChunk)
+                    continue;
+
+                std::pair<ChunkPosition, pl::Vector2<int>> adjacentChunkTile = getChunkTileFromOffset(chunk, pl::Vector2<int>(x - 1, y - 1),
+                    offset[0], offset[1], worldSize);
+                ChunkPosition adjacentChunk = adjacentChunkTile.first;
+
+                TileMap* upTilesAdjacent = getChunkTileMap(ChunkPosition(adjacentChunk.x, ((adjacentChunk.y - 1) % worldSize + worldSize) % worldSize), tileType);
+                TileMap* downTilesAdjacent = getChunkTileMap(ChunkPosition(adjacentChunk.x, ((adjacentChunk.y + 1) % worldSize + worldSize) % worldSize), tileType);
+                TileMap* leftTilesAdjacent = getChunkTileMap(ChunkPosition(((adjacentChunk.x - 1) % worldSize + worldSize) % worldSize, adjacentChunk.y), tileType);
+                TileMap* rightTilesAdjacent = getChunkTileMap(ChunkPosition(((adjacentChunk.x + 1) % worldSize + worldSize) % worldSize, adjacentChunk.y), tileType);
+
+                getChunk(adjacentChunk)->setTile(tileType, adjacentChunkTile.second, upTilesAdjacent, downTilesAdjacent, leftTilesAdjacent, rightTilesAdjacent);
+                tileMapsModified.insert(tileType);
+            }
+        }
+    }
+
+    uint64_t chunkKey = (static_cast<uint64_t>(static_cast<uint32_t>(chunk.x)) << 32) | static_cast<uint32_t>(chunk.y);
+    chunkPtr->setTileVariationRandom(randomStreams.createStream(RandomStreamType::TileVariation, chunkKey));
+
+    // Fill border from adjacent chunk tilemaps and set all tiles for each tilemap
+    for (auto& [tileMap, presenceGrid] : tileMapPresenceGrids)
+    {
+        TileMap* upTiles = getChunkTileMap(upChunk, tileMap);
+        TileMap* downTiles = getChunkTileMap(downChunk, tileMap);
+        TileMap* leftTiles = getChunkTileMap(leftChunk, tileMap);
+        TileMap* rightTiles = getChunkTileMap(rightChunk, tileMap);
+
+        for (int i = 0; i < TILE_SIZE; i++)
+        {
+            presenceGrid[0][i + 1] = (upTiles && upTiles->isTilePresent(i, TILE_SIZE - 1));
+            presenceGrid[TILE_SIZE + 1][i + 1] = (downTiles && downTiles->isTilePresent(i, 0));
+            presenceGrid[i + 1][0] = (leftTiles && leftTiles->isTilePresent(TILE_SIZE - 1, i));
+            presenceGrid[i + 1][TILE_SIZE + 1] = (rightTiles && rightTiles->isTilePresent(0, i));
+        }
+
+        chunkPtr->setTileMapTiles(tileMap, presenceGrid);
+        tileMapsModified.insert(tileMap);
+    }
+
+    performChunkSetTileUpdate(chunk, tileMapsModified);
+}
+
 std::set<int> ChunkManager::setBackgroundAdjacentTilesForTile(ChunkPosition chunk, int tileMap, pl::Vector2<int> position)
 {
     // Update surrounding tiles for "underneath" tile placements
@@ -498,6 +808,10 @@ int ChunkManager::getChunkTileType(ChunkPosition chunk, pl::Vector2<int> tile) c
     if (!isChunkGenerated(chunk))
         return 0;
     
+    // Cold chunks keep tile grid uncompressed
+    if (coldStorage.containsChunk(chunk))
+        return coldStorage.getTileType(chunk, tile);
+
     // Not in loaded chunks, go to stored chunks
     if (loadedChunks.count(chunk) <= 0)
         return storedChunks.at(chunk)->getTileType(tile);
@@ -531,7 +845,7 @@ int ChunkManager::getChunkTileTypeOrPredicted(ChunkPosition chunk, pl::Vector2<i
 
 bool ChunkManager::isChunkGenerated(ChunkPosition chunk) const
 {
-    return (loadedChunks.count(chunk) + storedChunks.count(chunk)) > 0;
+    return (loadedChunks.count(chunk) + storedChunks.count(chunk) + coldStorage.containsChunk(chunk)) > 0;
 }
 
 const BiomeGenData* ChunkManager::getChunkBiome(ChunkPosition chunk)
@@ -558,6 +872,30 @@ const BiomeGenData* ChunkManager::getChunkBiome(ChunkPosition chunk)
     return biomeGenData;
 }
 
+const ChunkManager::ChunkMapBiomeGrid& ChunkManager::getChunkMapBiomes(ChunkPosition chunk)
+{
+    auto iter = chunkMapBiomeCache.find(chunk);
+    if (iter != chunkMapBiomeCache.end())
+    {
+        return iter->second;
+    }
+
+    static constexpr int CHUNK_MAP_TILE_AREA_SIZE = static_cast<int>(CHUNK_TILE_SIZE) / CHUNK_MAP_TILE_SIZE;
+
+    ChunkMapBiomeGrid& biomeGrid = chunkMapBiomeCache[chunk];
+
+    for (int y = 0; y < CHUNK_MAP_TILE_SIZE; y++)
+    {
+        for (int x = 0; x < CHUNK_MAP_TILE_SIZE; x++)
+        {
+            pl::Vector2<int> worldTile(chunk.x * CHUNK_TILE_SIZE + x * CHUNK_MAP_TILE_AREA_SIZE, chunk.y * CHUNK_TILE_SIZE + y * CHUNK_MAP_TILE_AREA_SIZE);
+            biomeGrid[y][x] = Chunk::getBiomeGenAtWorldTile(worldTile, worldSize, biomeNoise, planetType);
+        }
+    }
+
+    return biomeGrid;
+}
+
 void ChunkManager::setObject(ChunkPosition chunk, pl::Vector2<int> tile, ObjectType objectType, Game& game, const BuildableObjectCreateParameters& parameters)
 {
     Chunk* chunkPtr = getChunk(chunk);
@@ -745,19 +1083,53 @@ std::vector<WorldObject*> ChunkManager::getChunkObjects(ChunkViewRange chunkView
     return objects;
 }
 
-void ChunkManager::updateChunksEntities(float dt, ProjectileManager& projectileManager, Game& game, bool networkUpdateOnly)
+void ChunkManager::getChunkDrawableObjects(ChunkViewRange chunkViewRange, std::vector<WorldObject*>& worldObjects, VisibleObjectStats& stats)
 {
+    for (auto iter = chunkViewRange.begin(); iter != chunkViewRange.end(); iter++)
+    {
+        auto chunkIter = loadedChunks.find(iter.get(worldSize));
+        if (chunkIter == loadedChunks.end())
+        {
+            continue;
+        }
+
+        const std::vector<WorldObject*>& chunkObjects = chunkIter->second->getDrawableObjects(stats);
+        worldObjects.insert(worldObjects.end(), chunkObjects.begin(), chunkObjects.end());
+    }
+}
+
+void ChunkManager::updateChunksEntities(float dt, ProjectileManager& projectileManager, Game& game, bool networkUpdateOnly,
+    const std::vector<ChunkViewRange>& chunkViewRanges)
+{
+    entityUpdateScheduler.beginFrame(chunkViewRanges, worldSize);
+
+    entityUpdateChunks.clear();
     for (auto& chunkPair : loadedChunks)
     {
-        chunkPair.second->updateChunkEntities(dt, worldSize, &projectileManager, *this, &game, networkUpdateOnly);
+        entityUpdateChunks.push_back(chunkPair.second.get());
+    }
+
+    if (entityUpdateChunks.empty())
+    {
+        return;
+    }
+
+    // Start from a different chunk each frame, so entities deferred by update budget are not always the same
+    int startIndex = entityUpdateScheduler.getFrame() % entityUpdateChunks.size();
+
+    for (int i = 0; i < entityUpdateChunks.size(); i++)
+    {
+        Chunk* chunk = entityUpdateChunks[(startIndex + i) % entityUpdateChunks.size()];
+        chunk->updateChunkEntities(dt, worldSize, &projectileManager, *this, &game, networkUpdateOnly, &entityUpdateScheduler);
     }
 }
 
-void ChunkManager::testChunkEntityHitCollision(const std::vector<HitRect>& hitRects, pl::Vector2f hitOrigin, Game& game, float gameTime)
+void ChunkManager::testChunkEntityHitCollision(const std::vector<HitRect>& hitRects, pl::Vector2f hitOrigin, Game& game, float gameTime,
+    const HitboxSnapshot* rewindSnapshot)
 {
     for (auto& chunkPair : loadedChunks)
     {
-        chunkPair.second->testEntityHitCollision(hitRects, hitOrigin, *this, game, gameTime);
+        chunkPair.second->testEntityHitCollision(hitRects, hitOrigin, *this, game, gameTime, rewindSnapshot);
     }
 }
 
@@ -845,9 +1217,31 @@ std::vector<WorldObject*> ChunkManager::getChunkEntities(ChunkViewRange chunkVie
     return entities;
 }
 
+std::vector<WorldObject*> ChunkManager::getLoadedChunkEntities()
+{
+    std::vector<WorldObject*> entities;
+    for (auto& chunkPair : loadedChunks)
+    {
+        std::vector<WorldObject*> chunkEntities = chunkPair.second->getEntities();
+        entities.insert(entities.end(), chunkEntities.begin(), chunkEntities.end());
+    }
+    return entities;
+}
+
+int ChunkManager::clearLoadedChunksEntities()
+{
+    int entitiesCleared = 0;
+    for (auto& chunkPair : loadedChunks)
+    {
+        entitiesCleared += chunkPair.second->getEntityCount();
+        chunkPair.second->clearEntities();
+    }
+    return entitiesCleared;
+}
+
 int ChunkManager::getChunkEntitySpawnCooldown(ChunkPosition chunk)
 {
-    uint64_t time = std::chrono::system_clock::now().time_since_epoch() / std::chrono::milliseconds(1);
+    uint64_t time = currentTime;
 
     if (!chunkLastEntitySpawnTime.contains(chunk))
     {
@@ -859,8 +1253,7 @@ int ChunkManager::getChunkEntitySpawnCooldown(ChunkPosition chunk)
 
 void ChunkManager::resetChunkEntitySpawnCooldown(ChunkPosition chunk)
 {
-    uint64_t time = std::chrono::system_clock::now().time_since_epoch() / std::chrono::milliseconds(1);
-    chunkLastEntitySpawnTime[chunk] = time;
+    chunkLastEntitySpawnTime[chunk] = currentTime;
 }
 
 PacketDataEntities ChunkManager::getEntityPacketDatas(ChunkViewRange chunkViewRange)
@@ -1041,6 +1434,7 @@ void ChunkManager::reduceItemPickupCount(const ItemPickupReference& itemPickupRe
     else
     {
         itemPickupPtr->setItemCount(newCount);
+        chunkPtr->markItemPickupsModified();
     }
 }
 
@@ -1235,9 +1629,85 @@ std::vector<ChunkPOD> ChunkManager::getChunkPODs()
         pods.push_back(iter->second->getChunkPOD());
     }
 
+    std::vector<ChunkPOD> coldPods = coldStorage.getChunkPODs();
+    pods.insert(pods.end(), coldPods.begin(), coldPods.end());
+
     return pods;
 }
 
+size_t ChunkManager::getChunkTileMapsVertexBytes() const
+{
+    size_t bytes = 0;
+
+    for (const auto& [chunkPosition, chunk] : loadedChunks)
+    {
+        bytes += chunk->getTileMapsVertexBytes();
+    }
+
+    for (const auto& [chunkPosition, chunk] : storedChunks)
+    {
+        bytes += chunk->getTileMapsVertexBytes();
+    }
+
+    return bytes;
+}
+
+uint64_t ChunkManager::getLoadedChunksStateHash(bool fullHash)
+{
+    std::vector<ChunkPosition> chunkPositions;
+    for (const auto& loadedChunk : loadedChunks)
+    {
+        chunkPositions.push_back(loadedChunk.first);
+    }
+
+    // Hash in consistent order
+    std::sort(chunkPositions.begin(), chunkPositions.end(), [](ChunkPosition a, ChunkPosition b)
+    {
+        return (a.y == b.y) ? (a.x < b.x) : (a.y < b.y);
+    });
+
+    uint64_t hash = Helper::hashBytes(&planetType, sizeof(planetType));
+
+    std::unordered_map<ChunkPosition, std::pair<uint64_t, uint64_t>> loadedChunkStateHashes;
+
+    for (ChunkPosition chunkPosition : chunkPositions)
+    {
+        Chunk* chunk = loadedChunks.at(chunkPosition).get();
+
+        auto chunkStateHashIter = chunkStateHashes.find(chunkPosition);
+
+        uint64_t chunkStateHash = 0;
+        if (!fullHash && chunkStateHashIter != chunkStateHashes.end() && chunkStateHashIter->second.first == chunk->getContentVersion())
+        {
+            chunkStateHash = chunkStateHashIter->second.second;
+        }
+        else
+        {
+            ChunkPOD pod = chunk->getChunkPOD();
+            pod.entities.clear();
+
+            std::stringstream stream;
+            {
+                cereal::BinaryOutputArchive archive(stream);
+                archive(pod);
+            }
+
+            std::string data = stream.str();
+            chunkStateHash = Helper::hashBytes(data.data(), data.size());
+        }
+
+        loadedChunkStateHashes[chunkPosition] = {chunk->getContentVersion(), chunkStateHash};
+
+        hash = Helper::hashBytes(&chunkStateHash, sizeof(chunkStateHash), hash);
+        hash = chunk->getEntitiesStateHash(hash);
+    }
+
+    // Unloaded chunks are dropped
+    chunkStateHashes = std::move(loadedChunkStateHashes);
+
+    return hash;
+}
+
 void ChunkManager::loadFromChunkPODs(const std::vector<ChunkPOD>& pods, Game& game)
 {
     deleteAllChunks();
@@ -1253,7 +1723,7 @@ void ChunkManager::loadFromChunkPODs(const std::vector<ChunkPOD>& pods, Game& ga
 
 // -- Networking --
 
-PacketDataChunkDatas::ChunkData ChunkManager::getChunkDataAndGenerate(ChunkPosition chunk, Game& game)
+Chunk* ChunkManager::getChunkAndGenerate(ChunkPosition chunk, Game& game)
 {
     Chunk* chunkPtr = getChunk(chunk);
     
@@ -1263,18 +1733,25 @@ PacketDataChunkDatas::ChunkData ChunkManager::getChunkDataAndGenerate(ChunkPosit
         chunkPtr = generateChunk(chunk, game, 0.0f, false);
     }
 
-    ChunkPOD chunkPODNoEntities = chunkPtr->getChunkPOD(false);
+    return chunkPtr;
+}
+
+PacketDataChunkDatas::ChunkData ChunkManager::getChunkData(Chunk& chunk)
+{
+    ChunkPOD chunkPODNoEntities = chunk.getChunkPOD(false);
 
     PacketDataChunkDatas::ChunkData chunkData;
     chunkData.setFromPOD(chunkPODNoEntities);
 
+    chunkData.contentVersion = chunk.getContentVersion();
+
     // Get item pickups
-    chunkData.itemPickupsRelative = chunkPtr->getItemPickupsMap();
+    chunkData.itemPickupsRelative = chunk.getItemPickupsMap();
 
     // Normalise item pickup positions to chunk-relative
     for (auto& itemPickup : chunkData.itemPickupsRelative)
     {
-        itemPickup.second.setPosition(itemPickup.second.getPosition() - chunkPtr->getWorldPosition());
+        itemPickup.second.setPosition(itemPickup.second.getPosition() - chunk.getWorldPosition());
     }
 
     return chunkData;
@@ -1308,6 +1785,27 @@ void ChunkManager::setChunkData(const PacketDataChunkDatas::ChunkData& chunkData
     }
 
     chunkPtr->overwriteItemPickupsMap(itemPickups);
+
+    chunkPtr->setHostContentVersion(chunkData.contentVersion);
+}
+
+bool ChunkManager::setChunkEdits(const PacketDataChunkEdits::ChunkEdits& chunkEdits, Game& game)
+{
+    Chunk* chunkPtr = getChunk(chunkEdits.chunkPosition);
+    if (!chunkPtr)
+    {
+        return false;
+    }
+
+    // Newer chunk data already received
+    if (chunkPtr->getHostContentVersion() >= chunkEdits.contentVersion)
+    {
+        return true;
+    }
+
+    chunkPtr->loadObjectEdits(chunkEdits, game, *this, pathfindingEngine);
+
+    return true;
 }
 
 
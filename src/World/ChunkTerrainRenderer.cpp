@@ -0,0 +1,388 @@
+#include "World/ChunkTerrainRenderer.hpp"
+#include "World/Chunk.hpp"
+
+#include <algorithm>
+
+#include "Data/PlanetGenDataLoader.hpp"
+
+#include "Core/ResolutionHandler.hpp"
+#include "Core/TextureManager.hpp"
+#include "Core/Shaders.hpp"
+
+#include "DebugOptions.hpp"
+
+void ChunkTerrainRenderer::drawTerrain(pl::RenderTarget& window, const Camera& camera, const ChunkViewRange& chunkViewRange,
+    const std::vector<Chunk*>& chunksInView, ChunkDrawStats& drawStats)
+{
+    updateTerrainVertices(chunkViewRange, chunksInView, drawStats);
+
+    float scale = ResolutionHandler::getScale();
+
+    // All vertices relative to top left chunk, not wrapped as view range is unwrapped
+    static constexpr float CHUNK_SIZE_PIXELS = TILE_SIZE_PIXELS_UNSCALED * CHUNK_TILE_SIZE;
+    pl::Vector2f position = camera.worldToScreenTransform(pl::Vector2f(chunkViewRange.topLeft.x, chunkViewRange.topLeft.y) * CHUNK_SIZE_PIXELS, 0);
+
+    for (const auto& [tileMapID, vertexArray] : tileMapVertexArrays)
+    {
+        #if (!RELEASE_BUILD)
+        if (!DebugOptions::tileMapsVisible[tileMapID])
+            continue;
+        #endif
+
+        if (vertexArray.size() <= 0)
+            continue;
+
+        TileMap::drawVertexArray(window, vertexArray, position, pl::Vector2f(scale, scale));
+
+        drawStats.terrainDrawCalls++;
+        drawStats.terrainVertices += vertexArray.size();
+    }
+}
+
+void ChunkTerrainRenderer::updateTerrainVertices(const ChunkViewRange& chunkViewRange, const std::vector<Chunk*>& chunksInView, ChunkDrawStats& drawStats)
+{
+    // View range changed, so every chunk's vertex range has moved
+    if (!built || !(chunkViewRange == builtChunkViewRange) || chunksInView.size() != builtChunkTileMapVersions.size())
+    {
+        tileMapVertexArrays = buildTerrainVertices(chunkViewRange, chunksInView);
+
+        builtChunkViewRange = chunkViewRange;
+        builtChunkTileMapVersions.resize(chunksInView.size());
+        for (int i = 0; i < chunksInView.size(); i++)
+        {
+            builtChunkTileMapVersions[i] = chunksInView[i] ? chunksInView[i]->getTileMapsVersion() : 0;
+        }
+        built = true;
+
+        drawStats.terrainRebuilds++;
+        for (const auto& tileMapVertexArray : tileMapVertexArrays)
+        {
+            drawStats.terrainVerticesRebuilt += tileMapVertexArray.second.size();
+        }
+        return;
+    }
+
+    for (int i = 0; i < chunksInView.size(); i++)
+    {
+        uint64_t tileMapsVersion = chunksInView[i] ? chunksInView[i]->getTileMapsVersion() : 0;
+        if (tileMapsVersion == builtChunkTileMapVersions[i])
+        {
+            continue;
+        }
+
+        builtChunkTileMapVersions[i] = tileMapsVersion;
+
+        rebuildChunkVertices(i, chunkViewRange, chunksInView[i]);
+
+        drawStats.terrainChunkRebuilds++;
+        drawStats.terrainVerticesRebuilt += TileMap::CHUNK_VERTEX_COUNT * tileMapVertexArrays.size();
+    }
+}
+
+void ChunkTerrainRenderer::rebuildChunkVertices(int chunkIndex, const ChunkViewRange& chunkViewRange, Chunk* chunk)
+{
+    pl::Vector2f offset;
+    if (chunk)
+    {
+        auto iter = chunkViewRange.begin();
+        for (int i = 0; i < chunkIndex; i++)
+        {
+            iter++;
+        }
+        offset = getChunkVertexOffset(chunkViewRange, iter.getUnwrapped());
+
+        // Chunk has a tilemap type not yet in view, so add vertex array for type with empty ranges for all chunks
+        bool tileMapTypeAdded = false;
+        for (const auto& tileMapPair : chunk->getTileMaps())
+        {
+            auto tileMapVertexArrayIter = std::find_if(tileMapVertexArrays.begin(), tileMapVertexArrays.end(), [&tileMapPair](const auto& tileMapVertexArray)
+            {
+                return tileMapVertexArray.first == tileMapPair.first;
+            });
+
+            if (tileMapVertexArrayIter != tileMapVertexArrays.end())
+            {
+                continue;
+            }
+
+            pl::VertexArray vertexArray;
+            for (int i = 0; i < builtChunkTileMapVersions.size(); i++)
+            {
+                TileMap::addEmptyTileQuads(vertexArray);
+            }
+
+            tileMapVertexArrays.push_back({tileMapPair.first, vertexArray});
+            tileMapTypeAdded = true;
+        }
+
+        if (tileMapTypeAdded)
+        {
+            sortTileMapVertexArrays(tileMapVertexArrays);
+        }
+    }
+
+    int vertexIndex = chunkIndex * TileMap::CHUNK_VERTEX_COUNT;
+
+    for (auto& [tileMapID, vertexArray] : tileMapVertexArrays)
+    {
+        pl::VertexArray chunkVertexArray;
+
+        const TileMap* tileMap = nullptr;
+        if (chunk)
+        {
+            auto tileMapIter = chunk->getTileMaps().find(tileMapID);
+            if (tileMapIter != chunk->getTileMaps().end())
+            {
+                tileMap = &tileMapIter->second;
+            }
+        }
+
+        if (tileMap)
+        {
+            tileMap->addTileQuads(chunkVertexArray, offset);
+        }
+        else
+        {
+            TileMap::addEmptyTileQuads(chunkVertexArray);
+        }
+
+        // Overwrite only this chunk's range
+        for (int i = 0; i < TileMap::CHUNK_VERTEX_COUNT; i++)
+        {
+            vertexArray[vertexIndex + i] = chunkVertexArray[i];
+        }
+    }
+}
+
+void ChunkTerrainRenderer::reset()
+{
+    tileMapVertexArrays.clear();
+    builtChunkTileMapVersions.clear();
+    built = false;
+
+    waterVertexArray.clear();
+    builtWaterChunksLoaded.clear();
+    waterBuilt = false;
+}
+
+std::vector<std::pair<int, pl::VertexArray>> ChunkTerrainRenderer::buildTerrainVertices(const ChunkViewRange& chunkViewRange,
+    const std::vector<Chunk*>& chunksInView)
+{
+    std::map<int, pl::VertexArray> tileMapVertexArrayMap;
+
+    // Create vertex array for each tilemap type in view
+    for (int i = 0; i < chunksInView.size(); i++)
+    {
+        if (chunksInView[i] == nullptr)
+        {
+            continue;
+        }
+
+        for (const auto& tileMapPair : chunksInView[i]->getTileMaps())
+        {
+            tileMapVertexArrayMap[tileMapPair.first];
+        }
+    }
+
+    int chunkIndex = 0;
+    for (auto iter = chunkViewRange.begin(); iter != chunkViewRange.end(); iter++, chunkIndex++)
+    {
+        Chunk* chunk = (chunkIndex < chunksInView.size()) ? chunksInView[chunkIndex] : nullptr;
+
+        pl::Vector2f offset = getChunkVertexOffset(chunkViewRange, iter.getUnwrapped());
+
+        // Every chunk adds the same number of vertices to every array, so each chunk has a fixed range
+        for (auto& [tileMapID, vertexArray] : tileMapVertexArrayMap)
+        {
+            if (chunk)
+            {
+                auto tileMapIter = chunk->getTileMaps().find(tileMapID);
+                if (tileMapIter != chunk->getTileMaps().end())
+                {
+                    tileMapIter->second.addTileQuads(vertexArray, offset);
+                    continue;
+                }
+            }
+
+            TileMap::addEmptyTileQuads(vertexArray);
+        }
+    }
+
+    std::vector<std::pair<int, pl::VertexArray>> tileMapVertexArrays(tileMapVertexArrayMap.begin(), tileMapVertexArrayMap.end());
+
+    sortTileMapVertexArrays(tileMapVertexArrays);
+
+    return tileMapVertexArrays;
+}
+
+pl::Vector2f ChunkTerrainRenderer::getChunkVertexOffset(const ChunkViewRange& chunkViewRange, ChunkPosition unwrappedChunkPos)
+{
+    static constexpr float CHUNK_SIZE_PIXELS = TILE_SIZE_PIXELS_UNSCALED * CHUNK_TILE_SIZE;
+
+    return pl::Vector2f(unwrappedChunkPos.x - chunkViewRange.topLeft.x, unwrappedChunkPos.y - chunkViewRange.topLeft.y) * CHUNK_SIZE_PIXELS;
+}
+
+void ChunkTerrainRenderer::sortTileMapVertexArrays(std::vector<std::pair<int, pl::VertexArray>>& tileMapVertexArrays)
+{
+    // Same draw order as chunk tilemaps
+    std::sort(tileMapVertexArrays.begin(), tileMapVertexArrays.end(), [](const auto& tileMapA, const auto& tileMapB)
+    {
+        int drawLayerA = PlanetGenDataLoader::getTileMapDataFromID(tileMapA.first).drawLayer;
+        int drawLayerB = PlanetGenDataLoader::getTileMapDataFromID(tileMapB.first).drawLayer;
+        if (drawLayerA == drawLayerB) return tileMapA.first < tileMapB.first;
+        return drawLayerA < drawLayerB;
+    });
+}
+
+void ChunkTerrainRenderer::drawWater(pl::RenderTarget& window, const Camera& camera, const ChunkViewRange& chunkViewRange,
+    const std::vector<Chunk*>& chunksInView, const pl::Rect<float>& waterTextureRect, std::function<std::optional<pl::Color>(ChunkPosition)> getWaterColor,
+    ChunkDrawStats& drawStats)
+{
+    // Biome water colours do not change, so water is only rebuilt when view range or loaded chunks in view change
+    bool rebuild = !waterBuilt || !(chunkViewRange == builtWaterChunkViewRange) || chunksInView.size() != builtWaterChunksLoaded.size();
+
+    for (int i = 0; i < chunksInView.size() && !rebuild; i++)
+    {
+        rebuild = ((chunksInView[i] != nullptr) != builtWaterChunksLoaded[i]);
+    }
+
+    if (rebuild)
+    {
+        std::vector<std::optional<pl::Color>> waterColorGrid = buildWaterColorGrid(chunkViewRange, getWaterColor);
+
+        waterVertexArray = buildWaterVertices(chunkViewRange, chunksInView, waterTextureRect, waterColorGrid);
+        uploadWaterColorGrid(chunkViewRange, waterColorGrid);
+
+        builtWaterChunkViewRange = chunkViewRange;
+        builtWaterChunksLoaded.resize(chunksInView.size());
+        for (int i = 0; i < chunksInView.size(); i++)
+        {
+            builtWaterChunksLoaded[i] = (chunksInView[i] != nullptr);
+        }
+        waterBuilt = true;
+
+        drawStats.waterRebuilds++;
+    }
+
+    if (waterVertexArray.size() <= 0)
+    {
+        return;
+    }
+
+    float scale = ResolutionHandler::getScale();
+
+    static constexpr float CHUNK_SIZE_PIXELS = TILE_SIZE_PIXELS_UNSCALED * CHUNK_TILE_SIZE;
+    pl::Vector2f position = camera.worldToScreenTransform(pl::Vector2f(chunkViewRange.topLeft.x, chunkViewRange.topLeft.y) * CHUNK_SIZE_PIXELS, 0);
+
+    pl::Shader* waterShader = Shaders::getShader(ShaderType::Water);
+
+    float halfTargetWidth = window.getWidth() / 2.0f;
+    float halfTargetHeight = window.getHeight() / 2.0f;
+
+    waterShader->setUniform2f("position", (position.x - halfTargetWidth) / halfTargetWidth, -(position.y - halfTargetHeight) / halfTargetHeight);
+    waterShader->setUniform2f("scale", scale, scale);
+    waterShader->setUniformTexture("waterColorGrid", waterColorGridTexture);
+
+    window.draw(waterVertexArray, *waterShader, TextureManager::getTexture(TextureType::Water), pl::BlendMode::Alpha);
+
+    drawStats.waterDrawCalls++;
+}
+
+pl::VertexArray ChunkTerrainRenderer::buildWaterVertices(const ChunkViewRange& chunkViewRange, const std::vector<Chunk*>& chunksInView,
+    const pl::Rect<float>& waterTextureRect, const std::vector<std::optional<pl::Color>>& waterColorGrid)
+{
+    static constexpr float CHUNK_SIZE_PIXELS = TILE_SIZE_PIXELS_UNSCALED * CHUNK_TILE_SIZE;
+
+    int width = chunkViewRange.bottomRight.x - chunkViewRange.topLeft.x + 1;
+    int gridWidth = width + 2;
+
+    pl::VertexArray waterVertices;
+
+    int chunkIndex = 0;
+    for (auto iter = chunkViewRange.begin(); iter != chunkViewRange.end(); iter++, chunkIndex++)
+    {
+        if (chunkIndex >= chunksInView.size() || chunksInView[chunkIndex] == nullptr)
+        {
+            continue;
+        }
+
+        int x = chunkIndex % width;
+        int y = chunkIndex / width;
+
+        // Water is not drawn if colour of chunk or any surrounding chunk is not known
+        bool waterColorsKnown = true;
+        for (int yOffset = 0; yOffset <= 2 && waterColorsKnown; yOffset++)
+        {
+            for (int xOffset = 0; xOffset <= 2; xOffset++)
+            {
+                if (!waterColorGrid[(y + yOffset) * gridWidth + x + xOffset].has_value())
+                {
+                    waterColorsKnown = false;
+                    break;
+                }
+            }
+        }
+
+        if (!waterColorsKnown)
+        {
+            continue;
+        }
+
+        pl::Vector2f offset = getChunkVertexOffset(chunkViewRange, iter.getUnwrapped());
+
+        waterVertices.addQuad(pl::Rect<float>(offset, pl::Vector2f(CHUNK_SIZE_PIXELS, CHUNK_SIZE_PIXELS)), pl::Color(x, y, 0, 255), waterTextureRect);
+    }
+
+    return waterVertices;
+}
+
+std::vector<std::optional<pl::Color>> ChunkTerrainRenderer::buildWaterColorGrid(const ChunkViewRange& chunkViewRange,
+    std::function<std::optional<pl::Color>(ChunkPosition)> getWaterColor)
+{
+    std::vector<std::optional<pl::Color>> waterColorGrid;
+
+    for (int y = chunkViewRange.topLeft.y - 1; y <= chunkViewRange.bottomRight.y + 1; y++)
+    {
+        for (int x = chunkViewRange.topLeft.x - 1; x <= chunkViewRange.bottomRight.x + 1; x++)
+        {
+            waterColorGrid.push_back(getWaterColor(ChunkPosition(x, y)));
+        }
+    }
+
+    return waterColorGrid;
+}
+
+void ChunkTerrainRenderer::uploadWaterColorGrid(const ChunkViewRange& chunkViewRange, const std::vector<std::optional<pl::Color>>& waterColorGrid)
+{
+    int gridWidth = chunkViewRange.bottomRight.x - chunkViewRange.topLeft.x + 3;
+    int gridHeight = chunkViewRange.bottomRight.y - chunkViewRange.topLeft.y + 3;
+
+    std::vector<uint8_t> colorData(gridWidth * gridHeight * 4, 0);
+    for (int i = 0; i < waterColorGrid.size(); i++)
+    {
+        if (!waterColorGrid[i].has_value())
+        {
+            continue;
+        }
+
+        colorData[i * 4] = static_cast<uint8_t>(waterColorGrid[i]->r);
+        colorData[i * 4 + 1] = static_cast<uint8_t>(waterColorGrid[i]->g);
+        colorData[i * 4 + 2] = static_cast<uint8_t>(waterColorGrid[i]->b);
+        colorData[i * 4 + 3] = static_cast<uint8_t>(waterColorGrid[i]->a);
+    }
+
+    if (waterColorGridTexture.getID() == 0)
+    {
+        GLuint textureId;
+        glGenTextures(1, &textureId);
+        pl::Texture::bindTextureID(textureId, 0);
+
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+
+        waterColorGridTexture.setFromAllocated(textureId, gridWidth, gridHeight);
+        waterColorGridTexture.setLinearFilter(false);
+    }
+
+    waterColorGridTexture.overwriteData(gridWidth, gridHeight, colorData.data(), GL_RGBA, GL_UNSIGNED_BYTE);
+}
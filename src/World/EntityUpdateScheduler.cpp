@@ -0,0 +1,130 @@
+#include "World/EntityUpdateScheduler.hpp"
+
+#include <algorithm>
+
+#include "Core/Helper.hpp"
+#include "GameConstants.hpp"
+
+void EntityUpdateScheduler::beginFrame(const std::vector<ChunkViewRange>& chunkViewRanges, int worldSize)
+{
+    this->worldSize = worldSize;
+
+    screenChunkRanges.clear();
+    for (const ChunkViewRange& chunkViewRange : chunkViewRanges)
+    {
+        ChunkViewRange screenChunkRange = chunkViewRange;
+        screenChunkRange.topLeft.x += CHUNK_VIEW_LOAD_BORDER;
+        screenChunkRange.topLeft.y += CHUNK_VIEW_LOAD_BORDER;
+        screenChunkRange.bottomRight.x -= CHUNK_VIEW_LOAD_BORDER;
+        screenChunkRange.bottomRight.y -= CHUNK_VIEW_LOAD_BORDER;
+        screenChunkRanges.push_back(screenChunkRange);
+    }
+
+    frame++;
+    budgetRemaining = REDUCED_RATE_UPDATE_BUDGET;
+    stats = EntityUpdateStats();
+}
+
+EntityUpdateTier EntityUpdateScheduler::getChunkTier(ChunkPosition chunk) const
+{
+    if (screenChunkRanges.empty() || worldSize <= 0)
+    {
+        return EntityUpdateTier::Full;
+    }
+
+    int distance = worldSize;
+    for (const ChunkViewRange& screenChunkRange : screenChunkRanges)
+    {
+        distance = std::min(distance, getChunkDistanceFromRange(chunk, screenChunkRange));
+    }
+
+    return static_cast<EntityUpdateTier>(std::min(distance, ENTITY_UPDATE_TIER_COUNT - 1));
+}
+
+bool EntityUpdateScheduler::scheduleBehaviourUpdate(EntityUpdateTier tier, EntityUpdateSchedule& schedule)
+{
+    int tierIndex = static_cast<int>(tier);
+
+    stats.entityCounts[tierIndex]++;
+
+    // Spread entities across buckets, so reduced rate updates are not all on the same frame
+    if (!schedule.assigned)
+    {
+        schedule.assigned = true;
+        schedule.bucket = bucketCounter;
+        schedule.tier = tier;
+        schedule.framesWaited = schedule.bucket % TIER_UPDATE_INTERVALS[tierIndex];
+        bucketCounter = (bucketCounter + 1) % TIER_UPDATE_INTERVALS.back();
+    }
+
+    // Re-phase within new tier's interval, so entities moving between tiers stay spread across frames
+    if (schedule.tier != tier)
+    {
+        schedule.tier = tier;
+        schedule.framesWaited = schedule.bucket % TIER_UPDATE_INTERVALS[tierIndex];
+    }
+
+    schedule.framesWaited++;
+
+    if (tier == EntityUpdateTier::Full)
+    {
+        schedule.framesWaited = 0;
+        schedule.behaviourSteps = 0;
+        stats.behaviourUpdates[tierIndex]++;
+        return true;
+    }
+
+    if (schedule.framesWaited < TIER_UPDATE_INTERVALS[tierIndex])
+    {
+        return false;
+    }
+
+    if (budgetRemaining <= 0)
+    {
+        stats.behaviourUpdatesDeferred++;
+        return false;
+    }
+
+    budgetRemaining--;
+    schedule.framesWaited = 0;
+    schedule.behaviourSteps = 0;
+    stats.behaviourUpdates[tierIndex]++;
+    return true;
+}
+
+std::optional<float> EntityUpdateScheduler::takeBehaviourStep(EntityUpdateSchedule& schedule)
+{
+    if (schedule.behaviourTime <= 0.0f || schedule.behaviourSteps >= MAX_BEHAVIOUR_STEPS)
+    {
+        return std::nullopt;
+    }
+
+    float step = std::min(schedule.behaviourTime, MAX_BEHAVIOUR_DT);
+    schedule.behaviourTime -= step;
+    schedule.behaviourSteps++;
+    return step;
+}
+
+int EntityUpdateScheduler::getChunkDistanceFromRange(ChunkPosition chunk, const ChunkViewRange& chunkViewRange) const
+{
+    // Distance along axis outside of range, across world wrap
+    auto getAxisDistance = [this](int value, int rangeMin, int rangeMax) -> int
+    {
+        int rangeSize = rangeMax - rangeMin;
+        if (rangeSize + 1 >= worldSize)
+        {
+            return 0;
+        }
+
+        int offset = Helper::wrap(value - rangeMin, worldSize);
+        if (offset <= rangeSize)
+        {
+            return 0;
+        }
+
+        return std::min(offset - rangeSize, worldSize - offset);
+    };
+
+    return std::max(getAxisDistance(chunk.x, chunkViewRange.topLeft.x, chunkViewRange.bottomRight.x),
+        getAxisDistance(chunk.y, chunkViewRange.topLeft.y, chunkViewRange.bottomRight.y));
+}
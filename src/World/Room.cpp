@@ -1,18 +1,21 @@
 #include "World/Room.hpp"
 #include "IO/Log.hpp"
 
+#include <cmath>
+#include <algorithm>
+
 Room::Room()
 {
     
 }
 
-Room::Room(RoomType roomType, ChestDataPool* chestDataPool)
+Room::Room(RoomType roomType, ChestDataPool* chestDataPool, RandomStream* randomStream)
 {
     this->roomType = roomType;
 
-    createObjects(chestDataPool);
+    createObjects(chestDataPool, randomStream);
 
-    createCollisionRects();
+    createCollisionGrid();
 }
 
 Room::Room(const Room& room)
@@ -23,7 +26,7 @@ Room::Room(const Room& room)
 Room& Room::operator=(const Room& room)
 {
     roomType = room.roomType;
-    collisionRects = room.collisionRects;
+    collisionGrid = room.collisionGrid;
     warpExitRect = room.warpExitRect;
 
     objectGrid.clear();
@@ -48,32 +51,75 @@ Room& Room::operator=(const Room& room)
         }
     }
 
+    // Drawable objects point to copied objects
+    rebuildObjectIndex();
+
     return *this;
 }
 
 bool Room::handleStaticCollisionX(CollisionRect& collisionRect, float dx) const
 {
+    pl::Vector2<int> tileMin, tileMax;
+    getCollisionTileRange(collisionRect, tileMin, tileMax);
+
+    // Test in same order as rects were previously created in, so collisions resolve identically
     bool collision = false;
-    for (const CollisionRect& rect : collisionRects)
+    for (int x = tileMin.x; x <= tileMax.x; x++)
     {
-        if (collisionRect.handleStaticCollisionX(rect, dx, 0))
-            collision = true;
+        for (int y = tileMin.y; y <= tileMax.y; y++)
+        {
+            if (!collisionGrid[y][x])
+                continue;
+
+            if (collisionRect.handleStaticCollisionX(createTileCollisionRect(x, y), dx, 0))
+                collision = true;
+        }
     }
     return collision;
 }
 
 bool Room::handleStaticCollisionY(CollisionRect& collisionRect, float dy) const
 {
+    pl::Vector2<int> tileMin, tileMax;
+    getCollisionTileRange(collisionRect, tileMin, tileMax);
+
     bool collision = false;
-    for (const CollisionRect& rect : collisionRects)
+    for (int x = tileMin.x; x <= tileMax.x; x++)
     {
-        if (collisionRect.handleStaticCollisionY(rect, dy, 0))
-            collision = true;
+        for (int y = tileMin.y; y <= tileMax.y; y++)
+        {
+            if (!collisionGrid[y][x])
+                continue;
+
+            if (collisionRect.handleStaticCollisionY(createTileCollisionRect(x, y), dy, 0))
+                collision = true;
+        }
     }
     return collision;
 }
 
-void Room::createObjects(ChestDataPool* chestDataPool)
+void Room::getCollisionTileRange(const CollisionRect& collisionRect, pl::Vector2<int>& tileMin, pl::Vector2<int>& tileMax) const
+{
+    int gridHeight = collisionGrid.size();
+    int gridWidth = gridHeight > 0 ? collisionGrid[0].size() : 0;
+
+    tileMin.x = std::max(static_cast<int>(std::floor(collisionRect.x / TILE_SIZE_PIXELS_UNSCALED)) - 1, 0);
+    tileMin.y = std::max(static_cast<int>(std::floor(collisionRect.y / TILE_SIZE_PIXELS_UNSCALED)) - 1, 0);
+    tileMax.x = std::min(static_cast<int>(std::floor((collisionRect.x + collisionRect.width) / TILE_SIZE_PIXELS_UNSCALED)) + 1, gridWidth - 1);
+    tileMax.y = std::min(static_cast<int>(std::floor((collisionRect.y + collisionRect.height) / TILE_SIZE_PIXELS_UNSCALED)) + 1, gridHeight - 1);
+}
+
+CollisionRect Room::createTileCollisionRect(int x, int y)
+{
+    CollisionRect collisionRect;
+    collisionRect.x = x * TILE_SIZE_PIXELS_UNSCALED;
+    collisionRect.y = y * TILE_SIZE_PIXELS_UNSCALED;
+    collisionRect.height = TILE_SIZE_PIXELS_UNSCALED;
+    collisionRect.width = TILE_SIZE_PIXELS_UNSCALED;
+    return collisionRect;
+}
+
+void Room::createObjects(ChestDataPool* chestDataPool, RandomStream* randomStream)
 {
     const pl::Image& bitmaskImage = TextureManager::getBitmask(BitmaskType::Structures);
 
@@ -102,34 +148,28 @@ void Room::createObjects(ChestDataPool* chestDataPool)
             pl::Color bitmaskColour = bitmaskImage.getPixel(roomData.collisionBitmaskOffset.x + x, roomData.collisionBitmaskOffset.y + y);
 
             // Create object
-            setObjectFromBitmask(pl::Vector2<int>(x, y), bitmaskColour.b, chestDataPool);
+            setObjectFromBitmask(pl::Vector2<int>(x, y), bitmaskColour.b, chestDataPool, randomStream);
 
             // Add to array
             // objectGrid.back().push_back(std::move(object));
         }
     }
+
+    rebuildObjectIndex();
 }
 
-void Room::createCollisionRects()
+void Room::createCollisionGrid()
 {
-    collisionRects.clear();
-
     const pl::Image& bitmaskImage = TextureManager::getBitmask(BitmaskType::Structures);
 
     const RoomData& roomData = StructureDataLoader::getRoomData(roomType);
 
+    collisionGrid.assign(roomData.tileSize.y, std::vector<bool>(roomData.tileSize.x, false));
+
     for (int x = 0; x < roomData.tileSize.x; x++)
     {
         for (int y = 0; y < roomData.tileSize.y; y++)
         {
-            CollisionRect collisionRect;
-            collisionRect.x = x * TILE_SIZE_PIXELS_UNSCALED;
-            collisionRect.y = y * TILE_SIZE_PIXELS_UNSCALED;
-            collisionRect.height = TILE_SIZE_PIXELS_UNSCALED;
-            collisionRect.width = TILE_SIZE_PIXELS_UNSCALED;
-
-            bool collisionCreated = false;
-
             // Check object first
             BuildableObject* object = getObject(pl::Vector2<int>(x, y));
             if (object)
@@ -137,8 +177,7 @@ void Room::createCollisionRects()
                 const ObjectData& objectData = ObjectDataLoader::getObjectData(object->getObjectType());
                 if (objectData.hasCollision)
                 {
-                    collisionRects.push_back(collisionRect);
-                    collisionCreated = true;
+                    collisionGrid[y][x] = true;
                 }
             }
 
@@ -151,15 +190,41 @@ void Room::createCollisionRects()
             }
 
             // Collision
-            if (bitmaskColor == pl::Color(255, 0, 0) && !collisionCreated)
+            if (bitmaskColor == pl::Color(255, 0, 0))
             {
-                collisionRects.push_back(collisionRect);
+                collisionGrid[y][x] = true;
             }
 
             // Warp
             if (bitmaskColor == pl::Color(0, 255, 0))
             {
-                warpExitRect = collisionRect;
+                warpExitRect = createTileCollisionRect(x, y);
+            }
+        }
+    }
+}
+
+void Room::rebuildObjectIndex()
+{
+    drawableObjects.clear();
+    objectTypeTiles.clear();
+
+    for (int y = 0; y < objectGrid.size(); y++)
+    {
+        for (int x = 0; x < objectGrid[y].size(); x++)
+        {
+            BuildableObject* object = objectGrid[y][x].get();
+
+            if (!object || object->isObjectReference())
+            {
+                continue;
+            }
+
+            drawableObjects.push_back(object);
+
+            if (!object->isDummyObject())
+            {
+                objectTypeTiles[object->getObjectType()].push_back(pl::Vector2<int>(x, y));
             }
         }
     }
@@ -212,7 +277,7 @@ void Room::updateObjects(Game& game, const LocationState& locationState, float d
 //     return getObject(selectedTile);
 // }
 
-void Room::setObjectFromBitmask(pl::Vector2<int> tile, uint8_t bitmaskValue, ChestDataPool* chestDataPool)
+void Room::setObjectFromBitmask(pl::Vector2<int> tile, uint8_t bitmaskValue, ChestDataPool* chestDataPool, RandomStream* randomStream)
 {
     const RoomData& roomData = StructureDataLoader::getRoomData(roomType);
 
@@ -242,7 +307,10 @@ void Room::setObjectFromBitmask(pl::Vector2<int> tile, uint8_t bitmaskValue, Che
         {
             if (ChestObject* chest = dynamic_cast<ChestObject*>(object.get()))
             {
-                const InventoryData& randomChestContents = roomObjectData.chestContents.value()[rand() % roomObjectData.chestContents->size()];
+                int maxContentsIndex = roomObjectData.chestContents->size() - 1;
+                int contentsIndex = randomStream ? randomStream->randInt(0, maxContentsIndex) : Helper::randInt(0, maxContentsIndex);
+
+                const InventoryData& randomChestContents = roomObjectData.chestContents.value()[contentsIndex];
 
                 uint16_t chestID = chestDataPool->createChest(randomChestContents);
 
@@ -288,34 +356,33 @@ void Room::setObjectFromBitmask(pl::Vector2<int> tile, uint8_t bitmaskValue, Che
 
 bool Room::getFirstRocketObjectReference(ObjectReference& objectReference) const
 {
-    for (int y = 0; y < objectGrid.size(); y++)
-    {
-        for (int x = 0; x < objectGrid[y].size(); x++)
-        {
-            BuildableObject* object = objectGrid[y][x].get();
+    std::optional<pl::Vector2<int>> rocketTile;
 
-            if (!object)
-            {
-                continue;
-            }
-
-            if (object->isObjectReference() || object->isDummyObject())
-            {
-                continue;
-            }
+    // Only check first object of each type, as tiles are in row order
+    for (const auto& [objectType, tiles] : objectTypeTiles)
+    {
+        const ObjectData& objectData = ObjectDataLoader::getObjectData(objectType);
 
-            const ObjectData& objectData = ObjectDataLoader::getObjectData(object->getObjectType());
+        if (!objectData.rocketObjectData.has_value())
+        {
+            continue;
+        }
 
-            if (objectData.rocketObjectData.has_value())
-            {
-                objectReference.chunk = ChunkPosition(0, 0);
-                objectReference.tile = pl::Vector2<int>(x, y);
-                return true;
-            }
+        pl::Vector2<int> tile = tiles.front();
+        if (!rocketTile.has_value() || tile.y < rocketTile->y || (tile.y == rocketTile->y && tile.x < rocketTile->x))
+        {
+            rocketTile = tile;
         }
     }
 
-    return false;
+    if (!rocketTile.has_value())
+    {
+        return false;
+    }
+
+    objectReference.chunk = ChunkPosition(0, 0);
+    objectReference.tile = rocketTile.value();
+    return true;
 }
 
 RoomType Room::getRoomType() const
@@ -331,33 +398,6 @@ RoomType Room::getRoomType() const
 //     return selectedTile;
 // }
 
-std::vector<const WorldObject*> Room::getObjects() const
-{
-    std::vector<const WorldObject*> objects;
-    for (int y = 0; y < objectGrid.size(); y++)
-    {
-        for (int x = 0; x < objectGrid[y].size(); x++)
-        {
-            BuildableObject* object = objectGrid[y][x].get();
-
-            if (!object)
-            {
-                continue;
-            }
-
-            if (object->isObjectReference())
-            {
-                continue;
-            }
-
-            // Add object to vector
-            objects.push_back(object);
-        }
-    }
-
-    return objects;
-}
-
 void Room::draw(pl::RenderTarget& window, const Camera& camera) const
 {
     float scale = ResolutionHandler::getScale();
@@ -376,15 +416,39 @@ void Room::draw(pl::RenderTarget& window, const Camera& camera) const
     #if (!RELEASE_BUILD)
     if (DebugOptions::drawCollisionRects)
     {
-        for (const CollisionRect& rect : collisionRects)
+        for (int y = 0; y < collisionGrid.size(); y++)
         {
-            rect.debugDraw(window, camera, 0);
+            for (int x = 0; x < collisionGrid[y].size(); x++)
+            {
+                if (collisionGrid[y][x])
+                {
+                    createTileCollisionRect(x, y).debugDraw(window, camera, 0);
+                }
+            }
         }
     }
     #endif
 }
 
 
+size_t Room::getGridBytes() const
+{
+    size_t bytes = objectGrid.capacity() * sizeof(objectGrid[0]) + collisionGrid.capacity() * sizeof(collisionGrid[0]);
+
+    for (const auto& objectRow : objectGrid)
+    {
+        bytes += objectRow.capacity() * sizeof(std::unique_ptr<BuildableObject>);
+    }
+
+    // Bools are packed into bits
+    for (const auto& collisionRow : collisionGrid)
+    {
+        bytes += (collisionRow.capacity() + 7) / 8;
+    }
+
+    return bytes;
+}
+
 std::vector<std::vector<std::optional<BuildableObjectPOD>>> Room::getObjectPODs() const
 {
     std::vector<std::vector<std::optional<BuildableObjectPOD>>> pods(objectGrid.size());
@@ -417,6 +481,7 @@ void Room::loadObjectPODs()
     if (loadingObjectPodsTemp == nullptr)
     {
         Log::push("ERROR: Room has no object POD loaded\n");
+        rebuildObjectIndex();
         return;
     }
 
@@ -443,5 +508,7 @@ void Room::loadObjectPODs()
         }
     }
 
-    createCollisionRects();
+    rebuildObjectIndex();
+
+    createCollisionGrid();
 }
\ No newline at end of file
@@ -1,11 +1,11 @@
 #include "World/RoomPool.hpp"
 
-uint32_t RoomPool::createRoom(RoomType roomType, ChestDataPool& chestDataPool)
+uint32_t RoomPool::createRoom(RoomType roomType, ChestDataPool& chestDataPool, RandomStream& randomStream)
 {
     if (std::make_signed_t<std::size_t>(rooms.size()) - 1 >= 0xFFFFFFFF)
         return 0xFFFFFFFF;
     
-    rooms[topDataSlot] = Room(roomType, &chestDataPool);
+    rooms[topDataSlot] = Room(roomType, &chestDataPool, &randomStream);
 
     return topDataSlot++;
 }
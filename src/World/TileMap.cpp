@@ -1,5 +1,14 @@
 #include "World/TileMap.hpp"
 
+const std::array<pl::Vector2<int>, 16> TileMap::ADJACENT_TILES_TEXTURE_OFFSETS = {
+    pl::Vector2<int>(48, 48), pl::Vector2<int>(48, 0), pl::Vector2<int>(0, 48), pl::Vector2<int>(0, 0),
+    pl::Vector2<int>(32, 48), pl::Vector2<int>(32, 0), pl::Vector2<int>(16, 48), pl::Vector2<int>(16, 0),
+    pl::Vector2<int>(48, 32), pl::Vector2<int>(48, 16), pl::Vector2<int>(0, 32), pl::Vector2<int>(0, 16),
+    pl::Vector2<int>(32, 32), pl::Vector2<int>(32, 16), pl::Vector2<int>(16, 32), pl::Vector2<int>(16, 16)
+};
+
+std::atomic<uint64_t> TileMap::versionCounter = 0;
+
 TileMap::TileMap()
 {
     TileMap(pl::Vector2<int>(0, 0), 1);
@@ -28,7 +37,7 @@ void TileMap::setTilesetVariation(int variation)
     this->variation = variation;
 }
 
-void TileMap::setTile(int x, int y, TileMap* upTiles, TileMap* downTiles, TileMap* leftTiles, TileMap* rightTiles)
+void TileMap::setTile(int x, int y, RandomStream& randomStream, TileMap* upTiles, TileMap* downTiles, TileMap* leftTiles, TileMap* rightTiles)
 {
     if (isTilePresent(x, y))
         return;
@@ -36,7 +45,7 @@ void TileMap::setTile(int x, int y, TileMap* upTiles, TileMap* downTiles, TileMa
     tiles[y][x] = 0b1 << 7;
 
     // Randomise variation
-    uint8_t tileVariation = (rand() % variation) & 0b111;
+    uint8_t tileVariation = randomStream.randInt(0, variation - 1) & 0b111;
     tiles[y][x] |= tileVariation << 4;
 
     updateTiles(x, y, upTiles, downTiles, leftTiles, rightTiles);
@@ -48,20 +57,76 @@ void TileMap::removeTile(int x, int y, TileMap* upTiles, TileMap* downTiles, Til
     updateTiles(x, y, upTiles, downTiles, leftTiles, rightTiles);
 }
 
-void TileMap::setTileWithoutGraphicsUpdate(int x, int y, TileMap* upTiles, TileMap* downTiles, TileMap* leftTiles, TileMap* rightTiles)
+void TileMap::setTileWithoutGraphicsUpdate(int x, int y, RandomStream& randomStream, TileMap* upTiles, TileMap* downTiles, TileMap* leftTiles, TileMap* rightTiles)
 {
     tiles[y][x] = 0b1 << 7;
 
     // Randomise variation
-    uint8_t tileVariation = (rand() % variation) & 0b111;
+    uint8_t tileVariation = randomStream.randInt(0, variation - 1) & 0b111;
     tiles[y][x] |= tileVariation << 4;
 
     updateTiles(x, y, upTiles, downTiles, leftTiles, rightTiles, false);
 }
 
+void TileMap::setTilesFromPresenceGrid(const TilePresenceGrid& presenceGrid, RandomStream& randomStream)
+{
+    for (int y = 0; y < tiles.size(); y++)
+    {
+        for (int x = 0; x < tiles[0].size(); x++)
+        {
+            if (!presenceGrid[y + 1][x + 1] || isTilePresent(tiles[y][x]))
+                continue;
+
+            tiles[y][x] = 0b1 << 7;
+
+            // Randomise variation
+            uint8_t tileVariation = randomStream.randInt(0, variation - 1) & 0b111;
+            tiles[y][x] |= tileVariation << 4;
+        }
+    }
+
+    // Calculate adjacent values, using grid border for tiles in adjacent chunks
+    auto isPresent = [this, &presenceGrid](int x, int y) -> bool
+    {
+        if (x < 0 || y < 0 || x >= tiles[0].size() || y >= tiles.size())
+        {
+            return presenceGrid[y + 1][x + 1];
+        }
+        return isTilePresent(tiles[y][x]);
+    };
+
+    for (int y = 0; y < tiles.size(); y++)
+    {
+        for (int x = 0; x < tiles[0].size(); x++)
+        {
+            uint8_t& tile = tiles[y][x];
+            if (!isTilePresent(tile))
+                continue;
+
+            tile &= 0b11110000;
+            tile |= (static_cast<int>(isPresent(x, y - 1)) << 3) | (static_cast<int>(isPresent(x - 1, y)) << 2) |
+                (static_cast<int>(isPresent(x + 1, y)) << 1) | static_cast<int>(isPresent(x, y + 1));
+        }
+    }
+
+    buildVertexArray();
+}
+
 void TileMap::draw(pl::RenderTarget& window, pl::Vector2f position, pl::Vector2f scale)
 {
-    if (tileVertexArray.size() <= 0)
+    drawVertexArray(window, tileVertexArray, position, scale);
+
+    // sf::RenderStates renderState;
+    // renderState.transform.translate(position);
+    // renderState.transform.scale(scale);
+    // renderState.texture = TextureManager::getTexture(TextureType::GroundTiles);
+
+    // window.draw(&(tileVertexArray[0]), tileVertexArray.getVertexCount(), sf::Quads, renderState);
+}
+
+void TileMap::drawVertexArray(pl::RenderTarget& window, const pl::VertexArray& vertexArray, pl::Vector2f position, pl::Vector2f scale)
+{
+    if (vertexArray.size() <= 0)
     {
         return;
     }
@@ -75,14 +140,35 @@ void TileMap::draw(pl::RenderTarget& window, pl::Vector2f position, pl::Vector2f
 
     shader->setUniform2f("scale", scale.x, scale.y);
 
-    window.draw(tileVertexArray, *shader, TextureManager::getTexture(TextureType::GroundTiles), pl::BlendMode::Alpha);
+    window.draw(vertexArray, *shader, TextureManager::getTexture(TextureType::GroundTiles), pl::BlendMode::Alpha);
+}
 
-    // sf::RenderStates renderState;
-    // renderState.transform.translate(position);
-    // renderState.transform.scale(scale);
-    // renderState.texture = TextureManager::getTexture(TextureType::GroundTiles);
+void TileMap::addTileQuads(pl::VertexArray& vertexArray, pl::Vector2f offset) const
+{
+    for (int y = 0; y < tiles.size(); y++)
+    {
+        for (int x = 0; x < tiles[0].size(); x++)
+        {
+            if (!isTilePresent(tiles[y][x]))
+            {
+                vertexArray.addQuad(pl::Rect<float>(offset, pl::Vector2f(0, 0)), pl::Color(0, 0, 0, 0), pl::Rect<float>());
+                continue;
+            }
 
-    // window.draw(&(tileVertexArray[0]), tileVertexArray.getVertexCount(), sf::Quads, renderState);
+            pl::Vector2<int> textureOffset = getTextureOffsetForTile(x, y);
+
+            vertexArray.addQuad(pl::Rect<float>(offset + pl::Vector2f(x, y) * TILE_SIZE_PIXELS_UNSCALED, pl::Vector2f(1, 1) * TILE_SIZE_PIXELS_UNSCALED),
+                pl::Color(255, 255, 255, 255), pl::Rect<float>(pl::Vector2f(tilesetOffset.x + textureOffset.x, tilesetOffset.y + textureOffset.y), pl::Vector2f(16, 16)));
+        }
+    }
+}
+
+void TileMap::addEmptyTileQuads(pl::VertexArray& vertexArray)
+{
+    for (int i = 0; i < CHUNK_TILE_SIZE * CHUNK_TILE_SIZE; i++)
+    {
+        vertexArray.addQuad(pl::Rect<float>(0, 0, 0, 0), pl::Color(0, 0, 0, 0), pl::Rect<float>());
+    }
 }
 
 void TileMap::updateTiles(int xModified, int yModified, TileMap* upTiles, TileMap* downTiles, TileMap* leftTiles, TileMap* rightTiles, bool rebuildVertices)
@@ -163,6 +249,8 @@ void TileMap::refreshVerticiesForTile(int x, int y)
         return;
     }
 
+    incrementVersion();
+
     if (!isTilePresent(tiles[y][x]))
     {
         for (int i = 0; i < 6; i++)
@@ -249,32 +337,12 @@ void TileMap::updateTileFromAdjacent(int x, int y, TileMap* upTiles, TileMap* do
     }
 }
 
-pl::Vector2<int> TileMap::getTextureOffsetForTile(int x, int y)
+pl::Vector2<int> TileMap::getTextureOffsetForTile(int x, int y) const
 {
     uint8_t tileVariation = (tiles[y][x] >> 4) & 0b111;
     pl::Vector2<int> variationOffset(64 * tileVariation, 0);
 
-    switch(tiles[y][x] & 0b1111)
-    {
-        case 0: return pl::Vector2<int>(48, 48) + variationOffset;
-        case 1: return pl::Vector2<int>(48, 0) + variationOffset;
-        case 2: return pl::Vector2<int>(0, 48) + variationOffset;
-        case 3: return pl::Vector2<int>(0, 0) + variationOffset;
-        case 4: return pl::Vector2<int>(32, 48) + variationOffset;
-        case 5: return pl::Vector2<int>(32, 0) + variationOffset;
-        case 6: return pl::Vector2<int>(16, 48) + variationOffset;
-        case 7: return pl::Vector2<int>(16, 0) + variationOffset;
-        case 8: return pl::Vector2<int>(48, 32) + variationOffset;
-        case 9: return pl::Vector2<int>(48, 16) + variationOffset;
-        case 10: return pl::Vector2<int>(0, 32) + variationOffset;
-        case 11: return pl::Vector2<int>(0, 16) + variationOffset;
-        case 12: return pl::Vector2<int>(32, 32) + variationOffset;
-        case 13: return pl::Vector2<int>(32, 16) + variationOffset;
-        case 14: return pl::Vector2<int>(16, 32) + variationOffset;
-        case 15: return pl::Vector2<int>(16, 16) + variationOffset;
-    }
-
-    return pl::Vector2<int>(0, 0);
+    return ADJACENT_TILES_TEXTURE_OFFSETS[tiles[y][x] & 0b1111] + variationOffset;
 }
 
 bool TileMap::isTilePresent(int x, int y)
@@ -282,13 +350,15 @@ bool TileMap::isTilePresent(int x, int y)
     return isTilePresent(tiles[y][x]);
 }
 
-bool TileMap::isTilePresent(uint8_t tileValue)
+bool TileMap::isTilePresent(uint8_t tileValue) const
 {
     return ((tileValue >> 7) & 0b1) != 0;
 }
 
 void TileMap::buildVertexArray()
 {
+    incrementVersion();
+
     tileVertexArray.clear();
 
     for (int y = 0; y < tiles.size(); y++)
@@ -305,7 +375,7 @@ void TileMap::buildVertexArray()
             pl::Vector2<int> textureOffset = getTextureOffsetForTile(x, y);
             
             tileVertexArray.addQuad(pl::Rect<float>(pl::Vector2f(x, y) * TILE_SIZE_PIXELS_UNSCALED, pl::Vector2f(1, 1) * TILE_SIZE_PIXELS_UNSCALED),
-                pl::Color(), pl::Rect<float>(pl::Vector2f(textureOffset.x, textureOffset.y), pl::Vector2f(16, 16)));
+                pl::Color(255, 255, 255, 255), pl::Rect<float>(pl::Vector2f(tilesetOffset.x + textureOffset.x, tilesetOffset.y + textureOffset.y), pl::Vector2f(16, 16)));
         }
     }
 }
@@ -318,4 +388,9 @@ pl::Vector2<int> TileMap::getTextureOffset()
 int TileMap::getVariation()
 {
     return variation;
+}
+
+void TileMap::incrementVersion()
+{
+    version = ++versionCounter;
 }
\ No newline at end of file
@@ -1,71 +1,6 @@
 #include "World/WeatherSystem.hpp"
 #include "World/ChunkManager.hpp"
 
-WeatherParticle::WeatherParticle(pl::Vector2f position, const WeatherTypeData& weatherTypeData)
-    : WorldObject(position)
-{
-    pl::Vector2<uint32_t> resolution = ResolutionHandler::getResolution();
-    float scale = ResolutionHandler::getScale();
-
-    animatedTexture = weatherTypeData.particleAnimatedTexture;
-
-    float fallSpeed = Helper::randFloat(weatherTypeData.fallSpeedMin, weatherTypeData.fallSpeedMax);
-    velocity = pl::Vector2f(1, 0).rotate(weatherTypeData.fallAngle / 180.0f * M_PI) * fallSpeed;
-
-    fallTime = 0.0f;
-    targetFallTime = Helper::randFloat(0.2f, resolution.y / velocity.y / scale * 1.2f);
-}
-
-bool WeatherParticle::update(float dt, const Camera& camera, ChunkManager& chunkManager)
-{
-    fallTime += dt;
-    if (fallTime < targetFallTime)
-    {
-        position += velocity * dt;
-    }
-    else
-    {
-        animatedTexture.update(dt);
-        if (animatedTexture.isFinished())
-        {
-            return false;
-        }
-    }
-
-    return true;
-}
-
-pl::Vector2f WeatherParticle::getPosition() const
-{
-    return (position + (targetFallTime - fallTime) * velocity);
-}
-
-// void WeatherParticle::handleWorldWrap(pl::Vector2f positionDelta)
-// {
-//     position += positionDelta;
-// }
-
-void WeatherParticle::draw(pl::RenderTarget& window, pl::SpriteBatch& spriteBatch, Game& game, const Camera& camera, float dt, float gameTime, int worldSize,
-    const pl::Color& color) const
-{
-    static constexpr float START_FADE_TIME = 0.2f;
-
-    float scale = ResolutionHandler::getScale();
-
-    pl::DrawData drawData;
-    drawData.texture = TextureManager::getTexture(TextureType::Objects);
-    drawData.shader = Shaders::getShader(ShaderType::Default);
-    drawData.position = camera.worldToScreenTransform(position, worldSize);
-    drawData.centerRatio = pl::Vector2f(0.5f, 1.0f);
-    drawData.scale = pl::Vector2f(scale, scale);
-    drawData.textureRect = animatedTexture.getTextureRect();
-
-    float alpha = std::min(fallTime, START_FADE_TIME) / START_FADE_TIME * 255.0f;
-    drawData.color.a = alpha;
-
-    spriteBatch.draw(window, drawData);
-}
-
 const std::unordered_map<WeatherType, WeatherTypeData> WeatherSystem::weatherTypeDatas = {
     {WeatherType::None, {{}, 1.0f, 1.0f, 1.0f}},
     {WeatherType::Rain, {{4, 16, 16, 0, 272, 0.05f, false}, 0.6f, 0.75f, 0.85f, 110.0f, 130.0f, 175.0f}}
@@ -125,7 +60,7 @@ void WeatherSystem::update(float dt, float gameTime, const Camera& camera, Chunk
             // Spawn current weather particle
             if (currentWeatherType != WeatherType::None)
             {
-                weatherParticles.push_back(WeatherParticle(position, weatherTypeDatas.at(currentWeatherType)));
+                spawnParticle(position, weatherTypeDatas.at(currentWeatherType));
             }
         }
         else
@@ -133,7 +68,7 @@ void WeatherSystem::update(float dt, float gameTime, const Camera& camera, Chunk
             // Spawn destination weather particle
             if (destinationWeatherType != WeatherType::None)
             {
-                weatherParticles.push_back(WeatherParticle(position, destinationWeatherTypeData));
+                spawnParticle(position, destinationWeatherTypeData);
             }
         }
     }
@@ -144,14 +79,90 @@ void WeatherSystem::update(float dt, float gameTime, const Camera& camera, Chunk
 
     updateCurrentWeather(gameTime, false);
 
-    for (auto iter = weatherParticles.begin(); iter != weatherParticles.end();)
+    updateParticles(dt);
+}
+
+void WeatherSystem::spawnParticle(pl::Vector2f position, const WeatherTypeData& weatherTypeData)
+{
+    pl::Vector2<uint32_t> resolution = ResolutionHandler::getResolution();
+    float scale = ResolutionHandler::getScale();
+
+    float fallSpeed = Helper::randFloat(weatherTypeData.fallSpeedMin, weatherTypeData.fallSpeedMax);
+    pl::Vector2f velocity = pl::Vector2f(1, 0).rotate(weatherTypeData.fallAngle / 180.0f * M_PI) * fallSpeed;
+
+    particlePositions.push_back(position);
+    particleVelocities.push_back(velocity);
+    particleFallTimes.push_back(0.0f);
+    particleTargetFallTimes.push_back(Helper::randFloat(0.2f, resolution.y / velocity.y / scale * 1.2f));
+    particleAnimatedTextures.push_back(weatherTypeData.particleAnimatedTexture);
+}
+
+void WeatherSystem::updateParticles(float dt)
+{
+    int particleCount = particlePositions.size();
+
+    for (int i = 0; i < particleCount; i++)
+    {
+        particleFallTimes[i] += dt;
+    }
+
+    // Falling particles move, landed particles animate
+    for (int i = 0; i < particleCount; i++)
+    {
+        float falling = (particleFallTimes[i] < particleTargetFallTimes[i]) ? 1.0f : 0.0f;
+        particlePositions[i] += particleVelocities[i] * (dt * falling);
+    }
+
+    int aliveCount = 0;
+    for (int i = 0; i < particleCount; i++)
     {
-        if (!iter->update(dt, camera, chunkManager))
+        if (particleFallTimes[i] >= particleTargetFallTimes[i])
         {
-            iter = weatherParticles.erase(iter);
-            continue;
+            particleAnimatedTextures[i].update(dt);
+            if (particleAnimatedTextures[i].isFinished())
+            {
+                continue;
+            }
         }
-        iter++;
+
+        if (aliveCount != i)
+        {
+            particlePositions[aliveCount] = particlePositions[i];
+            particleVelocities[aliveCount] = particleVelocities[i];
+            particleFallTimes[aliveCount] = particleFallTimes[i];
+            particleTargetFallTimes[aliveCount] = particleTargetFallTimes[i];
+            particleAnimatedTextures[aliveCount] = particleAnimatedTextures[i];
+        }
+
+        aliveCount++;
+    }
+
+    particlePositions.resize(aliveCount);
+    particleVelocities.resize(aliveCount);
+    particleFallTimes.resize(aliveCount);
+    particleTargetFallTimes.resize(aliveCount);
+    particleAnimatedTextures.resize(aliveCount);
+}
+
+void WeatherSystem::draw(pl::RenderTarget& window, pl::SpriteBatch& spriteBatch, const Camera& camera, int worldSize) const
+{
+    static constexpr float START_FADE_TIME = 0.2f;
+
+    float scale = ResolutionHandler::getScale();
+
+    pl::DrawData drawData;
+    drawData.texture = TextureManager::getTexture(TextureType::Objects);
+    drawData.shader = Shaders::getShader(ShaderType::Default);
+    drawData.centerRatio = pl::Vector2f(0.5f, 1.0f);
+    drawData.scale = pl::Vector2f(scale, scale);
+
+    for (int i = 0; i < particlePositions.size(); i++)
+    {
+        drawData.position = camera.worldToScreenTransform(particlePositions[i], worldSize);
+        drawData.textureRect = particleAnimatedTextures[i].getTextureRect();
+        drawData.color.a = std::min(particleFallTimes[i], START_FADE_TIME) / START_FADE_TIME * 255.0f;
+
+        spriteBatch.draw(window, drawData);
     }
 }
 
@@ -228,16 +239,6 @@ void WeatherSystem::presimulateWeather(float gameTime, const Camera& camera, Chu
 //     }
 // }
 
-std::vector<WorldObject*> WeatherSystem::getWeatherParticles()
-{
-    std::vector<WorldObject*> particles;
-    for (WeatherParticle& weatherParticle : weatherParticles)
-    {
-        particles.push_back(&weatherParticle);
-    }
-    return particles;
-}
-
 const WeatherTypeData& WeatherSystem::getWeatherTypeData() const
 {
     return weatherTypeDatas.at(currentWeatherType);
@@ -1,5 +1,7 @@
 #include "World/WorldMap.hpp"
 
+#include <algorithm>
+
 void WorldMap::setSize(int worldSize)
 {
     mapTextureData.clear();
@@ -9,13 +11,13 @@ void WorldMap::setSize(int worldSize)
 
     this->worldSize = worldSize;
 
-    initTexture();
+    // Texture is created on next upload, so map can be used without a window (e.g. save tool, tests)
+    dirtyRegions.clear();
+    fullUploadRequired = true;
 }
 
 void WorldMap::setChunkMapSection(const ChunkWorldMapSection& chunkMapSection)
 {
-    mapTexture.use();
-
     int startIdx = chunkMapSection.chunkPosition.x * CHUNK_MAP_TILE_SIZE * 3 + chunkMapSection.chunkPosition.y * CHUNK_MAP_TILE_SIZE * CHUNK_MAP_TILE_SIZE * worldSize * 3;
 
     for (int y = 0; y < CHUNK_MAP_TILE_SIZE; y++)
@@ -27,15 +29,88 @@ void WorldMap::setChunkMapSection(const ChunkWorldMapSection& chunkMapSection)
             mapTextureData[startIdx + yIdxOffset + x * 3 + 1] = static_cast<uint8_t>(chunkMapSection.colorGrid[y][x].g);
             mapTextureData[startIdx + yIdxOffset + x * 3 + 2] = static_cast<uint8_t>(chunkMapSection.colorGrid[y][x].b);
         }
-
-        glTexSubImage2D(GL_TEXTURE_2D, 0, chunkMapSection.chunkPosition.x * CHUNK_MAP_TILE_SIZE,
-            chunkMapSection.chunkPosition.y * CHUNK_MAP_TILE_SIZE + y, CHUNK_MAP_TILE_SIZE, 1,
-            GL_RGB, GL_UNSIGNED_BYTE, &mapTextureData[startIdx + yIdxOffset]);
     }
 
+    addDirtyRegion(pl::Rect<int>(chunkMapSection.chunkPosition.x * CHUNK_MAP_TILE_SIZE, chunkMapSection.chunkPosition.y * CHUNK_MAP_TILE_SIZE,
+        CHUNK_MAP_TILE_SIZE, CHUNK_MAP_TILE_SIZE));
+
     chunksDiscovered.insert(chunkMapSection.chunkPosition);
 }
 
+void WorldMap::addDirtyRegion(pl::Rect<int> region)
+{
+    if (fullUploadRequired)
+    {
+        return;
+    }
+
+    // Merge with existing regions while merged region would not upload any extra area
+    // e.g. a row of newly discovered chunks becomes a single region
+    bool merged = true;
+    while (merged)
+    {
+        merged = false;
+
+        for (auto iter = dirtyRegions.begin(); iter != dirtyRegions.end(); iter++)
+        {
+            int left = std::min(region.x, iter->x);
+            int top = std::min(region.y, iter->y);
+            int right = std::max(region.x + region.width, iter->x + iter->width);
+            int bottom = std::max(region.y + region.height, iter->y + iter->height);
+
+            if ((right - left) * (bottom - top) > region.width * region.height + iter->width * iter->height)
+            {
+                continue;
+            }
+
+            region = pl::Rect<int>(left, top, right - left, bottom - top);
+            dirtyRegions.erase(iter);
+            merged = true;
+            break;
+        }
+    }
+
+    dirtyRegions.push_back(region);
+
+    if (dirtyRegions.size() > MAX_DIRTY_REGIONS)
+    {
+        dirtyRegions.clear();
+        fullUploadRequired = true;
+    }
+}
+
+void WorldMap::uploadDirtyRegions()
+{
+    if (fullUploadRequired)
+    {
+        // Also clears dirty regions
+        initTexture();
+        return;
+    }
+
+    if (dirtyRegions.empty())
+    {
+        return;
+    }
+
+    mapTexture.use();
+
+    int mapTileSize = CHUNK_MAP_TILE_SIZE * worldSize;
+
+    // Upload each region directly from full map data
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, mapTileSize);
+
+    for (const pl::Rect<int>& region : dirtyRegions)
+    {
+        glTexSubImage2D(GL_TEXTURE_2D, 0, region.x, region.y, region.width, region.height, GL_RGB, GL_UNSIGNED_BYTE,
+            &mapTextureData[(region.x + region.y * mapTileSize) * 3]);
+    }
+
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+
+    dirtyRegions.clear();
+}
+
 const pl::Texture& WorldMap::getTexture() const
 {
     return mapTexture;
@@ -44,7 +119,9 @@ const pl::Texture& WorldMap::getTexture() const
 void WorldMap::setMapTextureData(const std::vector<uint8_t>& mapTextureData)
 {
     this->mapTextureData = mapTextureData;
-    initTexture();
+
+    dirtyRegions.clear();
+    fullUploadRequired = true;
 }
 
 const std::vector<uint8_t>& WorldMap::getMapTextureData() const
@@ -69,6 +146,10 @@ void WorldMap::initTexture()
     }
 
     mapTexture.overwriteData(CHUNK_MAP_TILE_SIZE * worldSize, CHUNK_MAP_TILE_SIZE * worldSize, mapTextureData.data(), GL_RGB, GL_UNSIGNED_BYTE);
+
+    // Full texture is now up to date
+    dirtyRegions.clear();
+    fullUploadRequired = false;
 }
 
 bool WorldMap::isChunkDiscovered(ChunkPosition chunkPosition) const
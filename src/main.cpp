@@ -1,10 +1,98 @@
+#include <cstring>
+#include <cstdlib>
+#include <vector>
+#include <optional>
+
 #include "Game.hpp"
 
+#include "Data/GameDataCache.hpp"
+#include "IO/Log.hpp"
+
 int main(int argc, char* argv[])
 {
+    // Data packs applied over base game data in order given, e.g. "Planeturem --data-pack [directory] --data-pack [directory]"
+    // Data pack pairs are removed from arguments, so positional arguments of modes below are read correctly
+    // wherever data packs are given, e.g. "Planeturem --compile-game-data --data-pack [directory] [cache path]"
+    std::vector<std::string> dataPackDirectories;
+    std::vector<char*> args = {argv[0]};
+    for (int i = 1; i < argc; i++)
+    {
+        if (std::strcmp(argv[i], "--data-pack") == 0 && i < argc - 1)
+        {
+            dataPackDirectories.push_back(argv[++i]);
+            continue;
+        }
+        args.push_back(argv[i]);
+    }
+    GameDataCache::setDataPackDirectories(dataPackDirectories);
+
+    argc = args.size();
+    argv = args.data();
+
+    // Offline game data compile, e.g. "Planeturem --compile-game-data [cache path]"
+    if (argc >= 2 && std::strcmp(argv[1], "--compile-game-data") == 0)
+    {
+        Log::init();
+
+        std::string cachePath = (argc >= 3) ? argv[2] : GameDataCache::getDefaultCachePath();
+        return GameDataCache::compileGameData("Data/Info/", cachePath) ? 0 : -1;
+    }
+
     Game game;
     if (!game.initialise())
         return -1;
+
+    // Headless replay of recorded session, e.g. "Planeturem --replay [replay path]"
+    if (argc >= 3 && std::strcmp(argv[1], "--replay") == 0)
+    {
+        int result = game.runReplay(argv[2]);
+        game.deinit();
+        return result;
+    }
+
+    // Headless admin commands run against save, e.g. "Planeturem --run-commands [save name] [script path]"
+    if (argc >= 4 && std::strcmp(argv[1], "--run-commands") == 0)
+    {
+        int result = game.runCommandScript(argv[2], argv[3]);
+        game.deinit();
+        return result;
+    }
+
+    // Headless planet pregeneration into save, e.g. "Planeturem --pregenerate-planet [save name] [planet name] [chunk radius|all] [seed]"
+    if (argc >= 5 && std::strcmp(argv[1], "--pregenerate-planet") == 0)
+    {
+        std::optional<int> chunkRadius;
+        if (std::strcmp(argv[4], "all") != 0)
+        {
+            chunkRadius = std::atoi(argv[4]);
+        }
+
+        std::optional<int> seed;
+        if (argc >= 6 && std::strncmp(argv[5], "--", 2) != 0)
+        {
+            seed = std::atoi(argv[5]);
+        }
+
+        int result = game.runPlanetPregeneration(argv[2], argv[3], chunkRadius, seed);
+        game.deinit();
+        return result;
+    }
+
+    // Headless check that loading and unloading planet does not leak memory, e.g. "Planeturem --memory-test [save name] [planet name]"
+    if (argc >= 4 && std::strcmp(argv[1], "--memory-test") == 0)
+    {
+        int result = game.runMemoryTest(argv[2], argv[3]);
+        game.deinit();
+        return result;
+    }
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (std::strcmp(argv[i], "--record-replay") == 0)
+        {
+            game.setReplayRecordingEnabled(true);
+        }
+    }
     
     game.run();
     game.deinit();
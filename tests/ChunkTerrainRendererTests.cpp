@@ -0,0 +1,167 @@
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "Test.hpp"
+
+#include "World/Chunk.hpp"
+#include "Entity/Entity.hpp"
+#include "World/ChunkTerrainRenderer.hpp"
+#include "Data/PlanetGenDataLoader.hpp"
+
+static bool vertexArraysMatch(const std::vector<std::pair<int, pl::VertexArray>>& vertexArrays, const std::vector<std::pair<int, pl::VertexArray>>& expected)
+{
+    if (vertexArrays.size() != expected.size())
+    {
+        return false;
+    }
+
+    for (int i = 0; i < expected.size(); i++)
+    {
+        if (vertexArrays[i].first != expected[i].first || vertexArrays[i].second.size() != expected[i].second.size())
+        {
+            return false;
+        }
+
+        for (int j = 0; j < expected[i].second.size(); j++)
+        {
+            const pl::Vertex& vertex = vertexArrays[i].second[j];
+            const pl::Vertex& expectedVertex = expected[i].second[j];
+
+            if (vertex.position.x != expectedVertex.position.x || vertex.position.y != expectedVertex.position.y ||
+                vertex.textureUV.x != expectedVertex.textureUV.x || vertex.textureUV.y != expectedVertex.textureUV.y ||
+                vertex.color.a != expectedVertex.color.a)
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+TEST(TerrainChunkRebuildMatchesFullRebuild)
+{
+    std::vector<int> tileMapIDs;
+    for (const auto& tileMapPair : PlanetGenDataLoader::getTileMapNameToIdMap())
+    {
+        tileMapIDs.push_back(tileMapPair.second);
+    }
+    std::sort(tileMapIDs.begin(), tileMapIDs.end());
+
+    REQUIRE(tileMapIDs.size() >= 2);
+
+    ChunkViewRange chunkViewRange;
+    chunkViewRange.topLeft = ChunkPosition(-1, -1);
+    chunkViewRange.bottomRight = ChunkPosition(1, 1);
+
+    std::vector<std::unique_ptr<Chunk>> chunks;
+    std::vector<Chunk*> chunksInView;
+
+    for (auto iter = chunkViewRange.begin(); iter != chunkViewRange.end(); iter++)
+    {
+        chunks.push_back(std::make_unique<Chunk>(iter.getUnwrapped(), 0.0f));
+
+        // Leave one chunk unloaded
+        chunksInView.push_back(chunks.size() == 3 ? nullptr : chunks.back().get());
+    }
+
+    // First tilemap type only, in diagonal line through each chunk
+    for (Chunk* chunk : chunksInView)
+    {
+        if (chunk == nullptr)
+        {
+            continue;
+        }
+
+        for (int i = 0; i < CHUNK_TILE_SIZE; i++)
+        {
+            chunk->setTile(tileMapIDs[0], pl::Vector2<int>(i, i));
+        }
+    }
+
+    ChunkTerrainRenderer terrainRenderer;
+    ChunkDrawStats drawStats;
+
+    terrainRenderer.updateTerrainVertices(chunkViewRange, chunksInView, drawStats);
+    CHECK(drawStats.terrainRebuilds == 1);
+    CHECK(vertexArraysMatch(terrainRenderer.getTerrainVertexArrays(), ChunkTerrainRenderer::buildTerrainVertices(chunkViewRange, chunksInView)));
+
+    // Nothing changed
+    drawStats = ChunkDrawStats();
+    terrainRenderer.updateTerrainVertices(chunkViewRange, chunksInView, drawStats);
+    CHECK(drawStats.terrainRebuilds == 0 && drawStats.terrainChunkRebuilds == 0);
+
+    // Change existing tilemap in centre chunk
+    Chunk* centreChunk = chunksInView[4];
+    centreChunk->setTile(tileMapIDs[0], pl::Vector2<int>(0, CHUNK_TILE_SIZE - 1));
+
+    drawStats = ChunkDrawStats();
+    terrainRenderer.updateTerrainVertices(chunkViewRange, chunksInView, drawStats);
+    CHECK(drawStats.terrainRebuilds == 0 && drawStats.terrainChunkRebuilds == 1);
+    CHECK(vertexArraysMatch(terrainRenderer.getTerrainVertexArrays(), ChunkTerrainRenderer::buildTerrainVertices(chunkViewRange, chunksInView)));
+
+    // Add tilemap type not yet in view
+    chunksInView[7]->setTile(tileMapIDs[1], pl::Vector2<int>(2, 3));
+
+    drawStats = ChunkDrawStats();
+    terrainRenderer.updateTerrainVertices(chunkViewRange, chunksInView, drawStats);
+    CHECK(drawStats.terrainRebuilds == 0 && drawStats.terrainChunkRebuilds == 1);
+    CHECK(vertexArraysMatch(terrainRenderer.getTerrainVertexArrays(), ChunkTerrainRenderer::buildTerrainVertices(chunkViewRange, chunksInView)));
+
+    // Each chunk has a fixed vertex range in every vertex array
+    for (const auto& [tileMapID, vertexArray] : terrainRenderer.getTerrainVertexArrays())
+    {
+        CHECK(vertexArray.size() == chunkViewRange.getSize() * TileMap::CHUNK_VERTEX_COUNT);
+    }
+
+    // View range moved
+    chunkViewRange.topLeft.x++;
+    chunkViewRange.bottomRight.x++;
+
+    drawStats = ChunkDrawStats();
+    terrainRenderer.updateTerrainVertices(chunkViewRange, chunksInView, drawStats);
+    CHECK(drawStats.terrainRebuilds == 1);
+}
+
+TEST(WaterVerticesSkipUnknownWaterColors)
+{
+    ChunkViewRange chunkViewRange;
+    chunkViewRange.topLeft = ChunkPosition(0, 0);
+    chunkViewRange.bottomRight = ChunkPosition(2, 1);
+
+    std::vector<std::unique_ptr<Chunk>> chunks;
+    std::vector<Chunk*> chunksInView;
+
+    for (auto iter = chunkViewRange.begin(); iter != chunkViewRange.end(); iter++)
+    {
+        chunks.push_back(std::make_unique<Chunk>(iter.getUnwrapped(), 0.0f));
+        chunksInView.push_back(chunks.back().get());
+    }
+
+    // Water colour unknown in border chunk next to chunk (2, 1) only
+    std::vector<std::optional<pl::Color>> waterColorGrid = ChunkTerrainRenderer::buildWaterColorGrid(chunkViewRange,
+        [](ChunkPosition chunkPos) -> std::optional<pl::Color>
+        {
+            if (chunkPos.x == 3 && chunkPos.y == 2)
+            {
+                return std::nullopt;
+            }
+            return pl::Color(chunkPos.x * 10 + 50, chunkPos.y * 10 + 50, 100);
+        });
+
+    CHECK(waterColorGrid.size() == 5 * 4);
+    CHECK(waterColorGrid[0].has_value() && waterColorGrid[0]->r == 40 && waterColorGrid[0]->g == 40);
+
+    pl::VertexArray waterVertices = ChunkTerrainRenderer::buildWaterVertices(chunkViewRange, chunksInView, pl::Rect<float>(0, 0, 128, 128), waterColorGrid);
+
+    // One quad per chunk, except chunk (2, 1)
+    REQUIRE(waterVertices.size() == 5 * 6);
+
+    // Vertex colour holds chunk index in view
+    for (int i = 0; i < 5; i++)
+    {
+        const pl::Vertex& vertex = waterVertices[i * 6];
+        CHECK_MESSAGE(vertex.color.r == i % 3 && vertex.color.g == i / 3, "water quad {}", i);
+    }
+}
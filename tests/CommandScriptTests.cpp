@@ -0,0 +1,25 @@
+#include "Test.hpp"
+
+#include "IO/GameSaveIO.hpp"
+#include "Data/PlanetGenDataLoader.hpp"
+
+// Writes new player save on planet with empty inventory, which "tests/scripts/admin_commands.txt" is run against
+// with "Planeturem --run-commands", as set up in CMakeLists.txt
+TEST(CreateCommandScriptSave)
+{
+    PlayerGameSave playerGameSave;
+    playerGameSave.seed = 1;
+    playerGameSave.time = 0.0f;
+    playerGameSave.day = 1;
+
+    PlayerData& playerData = playerGameSave.playerData;
+    playerData.inventory = InventoryData(32);
+    playerData.armourInventory = InventoryData(3);
+    playerData.lastUsedPlanetRocketType = -1;
+    playerData.name = "Tester";
+    playerData.locationState = LocationState::createFromPlanetType(PlanetGenDataLoader::getPlanetTypeFromName("Earthlike"));
+
+    GameSaveIO io("Command Script Test");
+    io.attemptDeleteSave();
+    REQUIRE(io.writePlayerSave(playerGameSave));
+}
@@ -0,0 +1,212 @@
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "Test.hpp"
+
+#include "Core/json.hpp"
+#include "Data/DataPackResolver.hpp"
+#include "Data/GameDataCache.hpp"
+
+static const std::string BASE_RECIPES_DATA = R"([
+    {"product": "Coal", "item-requirements": {"Raw Coal": 1}, "crafting-station": "bench", "crafting-station-level": 1},
+    {"product": "Torch", "item-requirements": {"Wood": 2, "Coal": 1}},
+    {"product": "Coal", "item-requirements": {"Wood": 3}, "crafting-station": "furnace", "crafting-station-level": 1}
+])";
+
+static const std::string BASE_ITEMS_DATA = R"([
+    {"name": "Wood", "sell-value": 1, "texture": [0, 0, 16, 16]},
+    {"name": "Stone", "sell-value": 2, "texture": [16, 0, 16, 16]}
+])";
+
+// Creates empty directory in temp directory for data files, replacing any left by previous run
+static std::filesystem::path createTestDirectory(const std::string& name)
+{
+    std::filesystem::path directory = std::filesystem::temp_directory_path() / "planeturem_tests_data_packs" / name;
+    std::filesystem::remove_all(directory);
+    std::filesystem::create_directories(directory);
+    return directory;
+}
+
+static void writeDataFile(const std::filesystem::path& directory, const std::string& fileName, const std::string& contents)
+{
+    std::ofstream file(directory / fileName);
+    file << contents;
+}
+
+// Merges data file of base directory with data packs, in order
+// Returns null json if data packs could not be applied
+static nlohmann::ordered_json loadMergedData(const std::filesystem::path& baseDirectory, const std::string& fileName,
+    const std::vector<std::string>& dataPackDirectories, std::vector<std::string>& conflicts)
+{
+    DataPackResolver resolver(baseDirectory.string() + "/", dataPackDirectories);
+    std::optional<std::string> mergedData = resolver.loadMergedData(fileName);
+    conflicts = resolver.getConflicts();
+
+    if (!mergedData.has_value())
+    {
+        return nlohmann::ordered_json();
+    }
+
+    return nlohmann::ordered_json::parse(mergedData.value());
+}
+
+// Data pack overrides fields of base entries by name, replaces non-entry arrays, and appends new entries after base entries
+TEST(DataPackOverridesAndAppendsEntries)
+{
+    std::filesystem::path baseDirectory = createTestDirectory("base");
+    writeDataFile(baseDirectory, "items.data", BASE_ITEMS_DATA);
+
+    std::filesystem::path dataPackDirectory = createTestDirectory("pack");
+    writeDataFile(dataPackDirectory, "items.data", R"([
+        {"name": "Gem", "sell-value": 50},
+        {"name": "Wood", "sell-value": 5, "texture": [32, 32, 8, 8, 1]}
+    ])");
+
+    std::vector<std::string> conflicts;
+    nlohmann::ordered_json items = loadMergedData(baseDirectory, "items.data", {dataPackDirectory.string()}, conflicts);
+
+    REQUIRE(items.is_array());
+    REQUIRE(items.size() == 3);
+    CHECK(conflicts.empty());
+
+    // Base entries keep their order, so existing item types are unchanged
+    CHECK(items[0]["name"] == "Wood");
+    CHECK(items[1]["name"] == "Stone");
+    CHECK(items[2]["name"] == "Gem");
+
+    CHECK(items[0]["sell-value"] == 5);
+    CHECK(items[1]["sell-value"] == 2);
+    CHECK(items[2]["sell-value"] == 50);
+
+    // Texture rect is not an entry array, so is replaced rather than merged
+    CHECK_MESSAGE(items[0]["texture"] == nlohmann::ordered_json::parse("[32, 32, 8, 8, 1]"), "texture {}", items[0]["texture"].dump());
+    CHECK(items[1]["texture"] == nlohmann::ordered_json::parse("[16, 0, 16, 16]"));
+}
+
+// Two data packs setting the same field are reported as a conflict, with the later data pack used
+TEST(DataPackConflictsUseLaterPack)
+{
+    std::filesystem::path baseDirectory = createTestDirectory("base");
+    writeDataFile(baseDirectory, "items.data", BASE_ITEMS_DATA);
+
+    std::filesystem::path firstDataPackDirectory = createTestDirectory("first");
+    writeDataFile(firstDataPackDirectory, "items.data", R"([{"name": "Wood", "sell-value": 5}])");
+
+    std::filesystem::path secondDataPackDirectory = createTestDirectory("second");
+    writeDataFile(secondDataPackDirectory, "items.data", R"([{"name": "Wood", "sell-value": 7}, {"name": "Stone", "sell-value": 3}])");
+
+    std::vector<std::string> conflicts;
+    nlohmann::ordered_json items = loadMergedData(baseDirectory, "items.data", {firstDataPackDirectory.string(), secondDataPackDirectory.string()}, conflicts);
+
+    REQUIRE(items.is_array());
+    REQUIRE(items.size() == 2);
+    CHECK(items[0]["sell-value"] == 7);
+    CHECK(items[1]["sell-value"] == 3);
+
+    // Stone is only set by second data pack, so only Wood conflicts
+    REQUIRE(conflicts.size() == 1);
+    CHECK_MESSAGE(conflicts[0].find("Wood/sell-value") != std::string::npos, "conflict \"{}\"", conflicts[0]);
+    CHECK_MESSAGE(conflicts[0].find("\"first\"") < conflicts[0].find("\"second\""), "conflict \"{}\"", conflicts[0]);
+}
+
+// Cache must be rebuilt when data packs are reordered, as later data packs win conflicts
+TEST(GameDataSourceHashDependsOnPackOrder)
+{
+    std::filesystem::path firstDataPackDirectory = createTestDirectory("first");
+    writeDataFile(firstDataPackDirectory, "items.data", R"([{"name": "Wood", "sell-value": 5}])");
+
+    std::filesystem::path secondDataPackDirectory = createTestDirectory("second");
+    writeDataFile(secondDataPackDirectory, "items.data", R"([{"name": "Wood", "sell-value": 7}])");
+
+    std::vector<std::string> previousDataPackDirectories = GameDataCache::getDataPackDirectories();
+
+    GameDataCache::setDataPackDirectories({});
+    std::string baseHash = GameDataCache::createSourceHash("Data/Info/");
+
+    GameDataCache::setDataPackDirectories({firstDataPackDirectory.string(), secondDataPackDirectory.string()});
+    std::string firstSecondHash = GameDataCache::createSourceHash("Data/Info/");
+    CHECK(GameDataCache::createSourceHash("Data/Info/") == firstSecondHash);
+
+    GameDataCache::setDataPackDirectories({secondDataPackDirectory.string(), firstDataPackDirectory.string()});
+    std::string secondFirstHash = GameDataCache::createSourceHash("Data/Info/");
+
+    GameDataCache::setDataPackDirectories(previousDataPackDirectories);
+
+    CHECK(firstSecondHash != baseHash);
+    CHECK(secondFirstHash != baseHash);
+    CHECK(firstSecondHash != secondFirstHash);
+}
+
+// Recipes are matched by product and crafting station, so recipes of same product at different stations can each be patched
+TEST(DataPackMatchesRecipesByCraftingStation)
+{
+    std::filesystem::path baseDirectory = createTestDirectory("base");
+    writeDataFile(baseDirectory, "item_recipes.data", BASE_RECIPES_DATA);
+
+    std::filesystem::path dataPackDirectory = createTestDirectory("pack");
+    writeDataFile(dataPackDirectory, "item_recipes.data", R"([
+        {"product": "Coal", "crafting-station": "furnace", "item-requirements": {"Wood": 1}},
+        {"product": "Torch", "item-requirements": {"Sticks": 1}}
+    ])");
+
+    std::vector<std::string> conflicts;
+    nlohmann::ordered_json recipes = loadMergedData(baseDirectory, "item_recipes.data", {dataPackDirectory.string()}, conflicts);
+
+    REQUIRE(recipes.is_array());
+    REQUIRE(recipes.size() == 3);
+
+    // Bench recipe is unchanged
+    CHECK_MESSAGE(recipes[0]["item-requirements"] == nlohmann::ordered_json::parse(R"({"Raw Coal": 1})"), "bench coal {}", recipes[0].dump());
+    CHECK_MESSAGE(recipes[2]["item-requirements"] == nlohmann::ordered_json::parse(R"({"Wood": 1})"), "furnace coal {}", recipes[2].dump());
+
+    // Recipe without crafting station is matched by product alone, with ingredients merged by key
+    CHECK_MESSAGE(recipes[1]["item-requirements"] == nlohmann::ordered_json::parse(R"({"Wood": 2, "Coal": 1, "Sticks": 1})"), "torch {}",
+        recipes[1].dump());
+}
+
+// Entry matching more than one base entry is rejected, rather than patching whichever is first
+TEST(DataPackRejectsAmbiguousEntries)
+{
+    std::filesystem::path baseDirectory = createTestDirectory("base");
+    writeDataFile(baseDirectory, "items.data", R"([
+        {"name": "Wood", "sell-value": 1},
+        {"name": "Wood", "sell-value": 2}
+    ])");
+
+    std::filesystem::path dataPackDirectory = createTestDirectory("pack");
+    writeDataFile(dataPackDirectory, "items.data", R"([{"name": "Wood", "sell-value": 5}])");
+
+    std::vector<std::string> conflicts;
+    nlohmann::ordered_json items = loadMergedData(baseDirectory, "items.data", {dataPackDirectory.string()}, conflicts);
+    CHECK_MESSAGE(items.is_null(), "merged {}", items.dump());
+}
+
+// Null removes key from keyed object, so recipe ingredient can be replaced
+TEST(DataPackNullRemovesKey)
+{
+    std::filesystem::path baseDirectory = createTestDirectory("base");
+    writeDataFile(baseDirectory, "item_recipes.data", BASE_RECIPES_DATA);
+
+    std::filesystem::path dataPackDirectory = createTestDirectory("pack");
+    writeDataFile(dataPackDirectory, "item_recipes.data", R"([
+        {"product": "Torch", "item-requirements": {"Coal": null, "Raw Coal": 1}},
+        {"product": "Coal", "crafting-station": "bench", "crafting-station-level": null, "item-requirements": {"Missing": null}}
+    ])");
+
+    std::vector<std::string> conflicts;
+    nlohmann::ordered_json recipes = loadMergedData(baseDirectory, "item_recipes.data", {dataPackDirectory.string()}, conflicts);
+
+    REQUIRE(recipes.is_array());
+    REQUIRE(recipes.size() == 3);
+    CHECK(conflicts.empty());
+
+    CHECK_MESSAGE(recipes[1]["item-requirements"] == nlohmann::ordered_json::parse(R"({"Wood": 2, "Raw Coal": 1})"), "torch {}",
+        recipes[1].dump());
+
+    CHECK_MESSAGE(!recipes[0].contains("crafting-station-level"), "bench coal {}", recipes[0].dump());
+
+    // Removing key not present does nothing, rather than adding null
+    CHECK_MESSAGE(recipes[0]["item-requirements"] == nlohmann::ordered_json::parse(R"({"Raw Coal": 1})"), "bench coal {}", recipes[0].dump());
+}
@@ -0,0 +1,177 @@
+#include <cmath>
+#include <optional>
+#include <vector>
+
+#include "Test.hpp"
+
+#include "World/EntityUpdateScheduler.hpp"
+
+static constexpr int ENTITY_UPDATE_TEST_WORLD_SIZE = 64;
+
+// Schedules behaviour updates for one frame, returning whether each entity updated
+static std::vector<bool> scheduleFrame(EntityUpdateScheduler& scheduler, std::vector<EntityUpdateSchedule>& schedules, EntityUpdateTier tier)
+{
+    scheduler.beginFrame({}, ENTITY_UPDATE_TEST_WORLD_SIZE);
+
+    std::vector<bool> updated;
+    for (EntityUpdateSchedule& schedule : schedules)
+    {
+        updated.push_back(scheduler.scheduleBehaviourUpdate(tier, schedule));
+    }
+    return updated;
+}
+
+// Reduced rate updates are spread evenly across frames of tier interval, including after entities change tier
+TEST(EntityUpdateSchedulerSpreadsPhases)
+{
+    static constexpr int ENTITY_COUNT = 16;
+
+    EntityUpdateScheduler scheduler;
+    std::vector<EntityUpdateSchedule> schedules(ENTITY_COUNT);
+
+    for (EntityUpdateTier tier : {EntityUpdateTier::Reduced, EntityUpdateTier::Distant})
+    {
+        int tierIndex = static_cast<int>(tier);
+        int interval = EntityUpdateScheduler::TIER_UPDATE_INTERVALS[tierIndex];
+
+        std::vector<int> entityUpdateCounts(ENTITY_COUNT, 0);
+
+        for (int frame = 0; frame < interval; frame++)
+        {
+            std::vector<bool> updated = scheduleFrame(scheduler, schedules, tier);
+            for (int i = 0; i < ENTITY_COUNT; i++)
+            {
+                entityUpdateCounts[i] += updated[i];
+            }
+
+            int updates = scheduler.getStats().behaviourUpdates[tierIndex];
+            CHECK_MESSAGE(updates == ENTITY_COUNT / interval, "tier {} frame {}: {} updates", tierIndex, frame, updates);
+            CHECK(scheduler.getStats().behaviourUpdatesDeferred == 0);
+        }
+
+        // Every entity updates once per interval
+        for (int i = 0; i < ENTITY_COUNT; i++)
+        {
+            CHECK_MESSAGE(entityUpdateCounts[i] == 1, "tier {} entity {}: {} updates", tierIndex, i, entityUpdateCounts[i]);
+        }
+    }
+}
+
+// Entities due to update over budget are deferred to following frame
+TEST(EntityUpdateSchedulerDefersOverBudget)
+{
+    static constexpr int OVER_BUDGET_COUNT = 8;
+    static constexpr int ENTITY_COUNT = EntityUpdateScheduler::REDUCED_RATE_UPDATE_BUDGET + OVER_BUDGET_COUNT;
+
+    EntityUpdateScheduler scheduler;
+
+    // All entities in same bucket, so all are due on same frame
+    EntityUpdateSchedule sameBucketSchedule;
+    sameBucketSchedule.assigned = true;
+    sameBucketSchedule.bucket = 0;
+    sameBucketSchedule.tier = EntityUpdateTier::Reduced;
+    std::vector<EntityUpdateSchedule> schedules(ENTITY_COUNT, sameBucketSchedule);
+
+    int interval = EntityUpdateScheduler::TIER_UPDATE_INTERVALS[static_cast<int>(EntityUpdateTier::Reduced)];
+    for (int frame = 0; frame < interval - 1; frame++)
+    {
+        scheduleFrame(scheduler, schedules, EntityUpdateTier::Reduced);
+        CHECK(scheduler.getStats().behaviourUpdates[static_cast<int>(EntityUpdateTier::Reduced)] == 0);
+    }
+
+    std::vector<bool> updated = scheduleFrame(scheduler, schedules, EntityUpdateTier::Reduced);
+    CHECK(scheduler.getStats().behaviourUpdates[static_cast<int>(EntityUpdateTier::Reduced)] == EntityUpdateScheduler::REDUCED_RATE_UPDATE_BUDGET);
+    CHECK_MESSAGE(scheduler.getStats().behaviourUpdatesDeferred == OVER_BUDGET_COUNT, "{} deferred", scheduler.getStats().behaviourUpdatesDeferred);
+
+    // Deferred entities update on next frame, and only those
+    std::vector<bool> updatedNextFrame = scheduleFrame(scheduler, schedules, EntityUpdateTier::Reduced);
+    CHECK(scheduler.getStats().behaviourUpdatesDeferred == 0);
+    for (int i = 0; i < ENTITY_COUNT; i++)
+    {
+        CHECK_MESSAGE(updated[i] != updatedNextFrame[i], "entity {} updated {} then {}", i, static_cast<bool>(updated[i]), static_cast<bool>(updatedNextFrame[i]));
+    }
+}
+
+// Time since last update is given to behaviour in steps no larger than MAX_BEHAVIOUR_DT, without dropping time
+TEST(EntityUpdateSchedulerKeepsBehaviourTime)
+{
+    static constexpr float DT = 0.1f;
+    static constexpr int FRAMES = 32;
+
+    EntityUpdateScheduler scheduler;
+    std::vector<EntityUpdateSchedule> schedules(1);
+
+    float totalStepTime = 0.0f;
+    int updates = 0;
+    int steps = 0;
+
+    for (int frame = 0; frame < FRAMES; frame++)
+    {
+        // As in Entity::update
+        schedules[0].behaviourTime += DT;
+
+        if (!scheduleFrame(scheduler, schedules, EntityUpdateTier::Distant)[0])
+        {
+            continue;
+        }
+
+        updates++;
+        while (std::optional<float> step = EntityUpdateScheduler::takeBehaviourStep(schedules[0]))
+        {
+            CHECK_MESSAGE(step.value() > 0.0f && step.value() <= EntityUpdateScheduler::MAX_BEHAVIOUR_DT, "step {}", step.value());
+            totalStepTime += step.value();
+            steps++;
+        }
+    }
+
+    // Distant interval at this dt is longer than MAX_BEHAVIOUR_DT, so updates take several steps
+    REQUIRE(updates > 0);
+    CHECK_MESSAGE(steps > updates, "{} steps over {} updates", steps, updates);
+    CHECK_MESSAGE(std::abs(totalStepTime + schedules[0].behaviourTime - FRAMES * DT) < 0.001f, "{} step time, {} remaining",
+        totalStepTime, schedules[0].behaviourTime);
+}
+
+// Large frame dt (e.g. after a hitch) runs at most MAX_BEHAVIOUR_STEPS per update, carrying remaining time to following updates
+TEST(EntityUpdateSchedulerBoundsStepsAfterHitch)
+{
+    static constexpr float HITCH_DT = 3.0f;
+    static constexpr float DT = 1.0f / 60.0f;
+    static constexpr int FRAMES = 32;
+
+    EntityUpdateScheduler scheduler;
+    std::vector<EntityUpdateSchedule> schedules(1);
+
+    float totalDt = 0.0f;
+    float totalStepTime = 0.0f;
+
+    for (int frame = 0; frame < FRAMES; frame++)
+    {
+        float dt = (frame == 0) ? HITCH_DT : DT;
+        totalDt += dt;
+
+        // As in Entity::update
+        schedules[0].behaviourTime += dt;
+
+        REQUIRE(scheduleFrame(scheduler, schedules, EntityUpdateTier::Full)[0]);
+
+        int steps = 0;
+        while (std::optional<float> step = EntityUpdateScheduler::takeBehaviourStep(schedules[0]))
+        {
+            totalStepTime += step.value();
+            steps++;
+        }
+
+        CHECK_MESSAGE(steps <= EntityUpdateScheduler::MAX_BEHAVIOUR_STEPS, "frame {}: {} steps", frame, steps);
+
+        if (frame == 0)
+        {
+            CHECK(steps == EntityUpdateScheduler::MAX_BEHAVIOUR_STEPS);
+            float expectedRemaining = HITCH_DT - EntityUpdateScheduler::MAX_BEHAVIOUR_STEPS * EntityUpdateScheduler::MAX_BEHAVIOUR_DT;
+            CHECK_MESSAGE(std::abs(schedules[0].behaviourTime - expectedRemaining) < 0.001f, "{} remaining", schedules[0].behaviourTime);
+        }
+    }
+
+    // Carried time is caught up over following frames, without being dropped
+    CHECK_MESSAGE(schedules[0].behaviourTime < 0.001f, "{} remaining", schedules[0].behaviourTime);
+    CHECK_MESSAGE(std::abs(totalStepTime - totalDt) < 0.001f, "{} step time, {} total dt", totalStepTime, totalDt);
+}
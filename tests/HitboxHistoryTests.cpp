@@ -0,0 +1,233 @@
+#include <deque>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "Test.hpp"
+
+#include "Game.hpp"
+#include "Entity/HitboxHistory.hpp"
+#include "Data/PlanetGenDataLoader.hpp"
+#include "GUI/MainMenuGUI.hpp"
+#include "Network/PacketData/PacketDataWorld/PacketDataMeleeRequest.hpp"
+
+namespace
+{
+
+// Entity state as sent from host, arriving at client after latency
+struct LoopbackEntityPacket
+{
+    uint32_t arrivalTick;
+    uint32_t networkTick;
+    pl::Vector2f position;
+};
+
+}
+
+// Host moves an entity each tick and sends its state to a loopback client with latency
+// Client hits the entity where it sees it, and host must rewind to the tick the client was viewing
+TEST(HitboxHistoryRewindsToClientViewTick)
+{
+    static constexpr int WORLD_SIZE = 64;
+    static constexpr int ENTITY_PACKET_DELAY_TICKS = 6;
+    static constexpr int SERVER_INFO_DELAY_TICKS = 1;
+    static constexpr int TICKS = 20;
+    static constexpr float ENTITY_SPEED = 8.0f;
+    static constexpr float ENTITY_SIZE = 16.0f;
+
+    HitboxHistory hitboxHistory;
+    HitboxObjectID entityID = HitboxHistory::createObjectID();
+    HitboxObjectID otherEntityID = HitboxHistory::createObjectID();
+    CHECK(entityID != otherEntityID);
+
+    pl::Vector2f startPosition(100.0f, 100.0f);
+    auto getHostPosition = [startPosition](uint32_t tick) -> pl::Vector2f
+    {
+        return startPosition + pl::Vector2f(ENTITY_SPEED * tick, 0);
+    };
+
+    std::deque<LoopbackEntityPacket> entityPacketsInFlight;
+
+    uint32_t clientViewTick = 0;
+    pl::Vector2f clientViewPosition = startPosition;
+    uint32_t clientLatestServerInfoTick = 0;
+
+    for (uint32_t tick = 0; tick < TICKS; tick++)
+    {
+        // Host update
+        pl::Vector2f hostPosition = getHostPosition(tick);
+        hitboxHistory.beginSnapshot(tick).objectPositions[entityID] = hostPosition;
+        entityPacketsInFlight.push_back({tick + ENTITY_PACKET_DELAY_TICKS, tick, hostPosition});
+
+        // Client receives packets that have arrived
+        while (!entityPacketsInFlight.empty() && entityPacketsInFlight.front().arrivalTick <= tick)
+        {
+            clientViewTick = entityPacketsInFlight.front().networkTick;
+            clientViewPosition = entityPacketsInFlight.front().position;
+            entityPacketsInFlight.pop_front();
+        }
+
+        if (tick >= SERVER_INFO_DELAY_TICKS)
+        {
+            clientLatestServerInfoTick = tick - SERVER_INFO_DELAY_TICKS;
+        }
+    }
+
+    uint32_t currentTick = TICKS - 1;
+    pl::Vector2f hostPosition = getHostPosition(currentTick);
+    CHECK_MESSAGE(clientViewTick == currentTick - ENTITY_PACKET_DELAY_TICKS, "client viewing tick {}", clientViewTick);
+
+    // Client swings at entity where it sees it
+    HitRect hitRect;
+    hitRect.x = clientViewPosition.x;
+    hitRect.y = clientViewPosition.y;
+    hitRect.width = ENTITY_SIZE;
+    hitRect.height = ENTITY_SIZE;
+    hitRect.damage = 1;
+    std::vector<HitRect> hitRects = {hitRect};
+
+    CollisionRect entityHitbox(hostPosition.x, hostPosition.y, ENTITY_SIZE, ENTITY_SIZE);
+
+    // Without rewind, hit lands behind entity
+    CHECK(!hitRects[0].isColliding(entityHitbox, WORLD_SIZE));
+
+    // Rewinding to tick of entity data client was viewing hits
+    const HitboxSnapshot* viewSnapshot = hitboxHistory.getRewindSnapshot(clientViewTick, currentTick);
+    REQUIRE(viewSnapshot != nullptr);
+    CHECK(viewSnapshot->networkTick == clientViewTick);
+    std::vector<HitRect> rewoundHitRects = HitboxHistory::rewindHitRects(hitRects, viewSnapshot, entityID, hostPosition, WORLD_SIZE);
+    CHECK(rewoundHitRects[0].isColliding(entityHitbox, WORLD_SIZE));
+
+    // Rewinding to latest server info tick does not, as client was not viewing entities at that tick
+    const HitboxSnapshot* serverInfoSnapshot = hitboxHistory.getRewindSnapshot(clientLatestServerInfoTick, currentTick);
+    REQUIRE(serverInfoSnapshot != nullptr);
+    std::vector<HitRect> serverInfoHitRects = HitboxHistory::rewindHitRects(hitRects, serverInfoSnapshot, entityID, hostPosition, WORLD_SIZE);
+    CHECK(!serverInfoHitRects[0].isColliding(entityHitbox, WORLD_SIZE));
+
+    // Objects not in snapshot are not rewound, e.g. entity created after view tick
+    CHECK(viewSnapshot->getRewindOffset(otherEntityID, hostPosition, WORLD_SIZE) == pl::Vector2f(0, 0));
+
+    // Client cannot rewind further than limit
+    const HitboxSnapshot* oldSnapshot = hitboxHistory.getRewindSnapshot(0, currentTick);
+    REQUIRE(oldSnapshot != nullptr);
+    CHECK(oldSnapshot->networkTick == currentTick - HitboxHistory::MAX_REWIND_TICKS);
+}
+
+// Host receives client melee requests through network handler after latency, while entity keeps moving
+// Request must be tested against entities in loaded chunks at the tick of entity data the client was viewing
+TEST(MeleeRequestRewindsChunkEntitiesOnHost)
+{
+    static constexpr int ENTITY_PACKET_DELAY_TICKS = 6;
+    static constexpr int SWING_TICK = 16;
+    static constexpr float ENTITY_SPEED = 4.0f;
+    static constexpr float HIT_SIZE = 2.0f;
+    static constexpr int HIT_DAMAGE = 100000;
+
+    Game game;
+    REQUIRE(game.initialise());
+
+    PlanetType planetType = PlanetGenDataLoader::getPlanetTypeFromName("Earthlike");
+    game.loadPlanet(planetType);
+
+    ChunkManager& chunkManager = game.getChunkManager(planetType);
+    NetworkHandler& networkHandler = game.getNetworkHandler();
+
+    // Load row of chunks entity moves through, with only test entity in them
+    ChunkPosition chunk = chunkManager.findValidSpawnChunk(2);
+    ChunkViewRange chunkViewRange;
+    chunkViewRange.topLeft = chunk;
+    chunkViewRange.bottomRight = ChunkPosition(chunk.x + 2, chunk.y);
+    chunkManager.updateChunks(game, 0.0f, {chunkViewRange}, &networkHandler);
+    chunkManager.clearLoadedChunksEntities();
+
+    Chunk* chunkPtr = chunkManager.getChunk(chunk);
+    REQUIRE(chunkPtr != nullptr);
+
+    pl::Vector2f startPosition = chunkPtr->getWorldPosition() + pl::Vector2f(16.0f, 64.0f);
+    auto getHostPosition = [startPosition](uint32_t tick) -> pl::Vector2f
+    {
+        return startPosition + pl::Vector2f(ENTITY_SPEED * tick, 0);
+    };
+
+    std::unique_ptr<Entity> entityOwned = std::make_unique<Entity>(startPosition, 0);
+    Entity* entity = entityOwned.get();
+    chunkPtr->moveEntityToChunk(std::move(entityOwned));
+
+    // Host lobby, with packets from client delivered as if received from Steam
+    networkHandler.setReplaying(true);
+
+    ReplayFrame lobbyCreatedFrame;
+    lobbyCreatedFrame.networkEvents.push_back({ReplayNetworkEventType::LobbyCreated, 1});
+    networkHandler.applyReplayNetworkEvents(lobbyCreatedFrame);
+    REQUIRE(networkHandler.getIsLobbyHost());
+
+    MainMenuGUI mainMenuGUI;
+
+    // Client swings where it sees entity, which is where entity was when entity data it is viewing was sent
+    pl::Vector2f clientViewPosition = getHostPosition(SWING_TICK - ENTITY_PACKET_DELAY_TICKS);
+
+    HitRect hitRect;
+    hitRect.x = clientViewPosition.x - HIT_SIZE / 2.0f;
+    hitRect.y = clientViewPosition.y - HIT_SIZE / 2.0f;
+    hitRect.width = HIT_SIZE;
+    hitRect.height = HIT_SIZE;
+    hitRect.damage = HIT_DAMAGE;
+
+    auto createMeleeRequest = [&](uint32_t viewNetworkTick) -> ReplayPacket
+    {
+        PacketDataMeleeRequest packetData;
+        packetData.planetType = planetType;
+        packetData.hitRects = {hitRect};
+        packetData.hitOrigin = clientViewPosition;
+        packetData.viewNetworkTick = viewNetworkTick;
+
+        ReplayPacket replayPacket;
+        replayPacket.senderID = 2;
+        replayPacket.data = Packet(packetData).serialise();
+        return replayPacket;
+    };
+
+    // Request claiming client viewed current host tick is not rewound, so misses as entity has moved on
+    // Request with tick of entity data client was viewing is rewound and hits
+    std::map<uint32_t, ReplayPacket> meleeRequestArrivals;
+    meleeRequestArrivals[SWING_TICK + 3] = createMeleeRequest(SWING_TICK);
+    meleeRequestArrivals[SWING_TICK + 4] = createMeleeRequest(SWING_TICK - ENTITY_PACKET_DELAY_TICKS);
+
+    REQUIRE(SWING_TICK + 4 - (SWING_TICK - ENTITY_PACKET_DELAY_TICKS) <= HitboxHistory::MAX_REWIND_TICKS);
+
+    while (networkHandler.getNetworkTick() < SWING_TICK + 4)
+    {
+        // Host tick, recording entity positions as sent to clients on planet
+        networkHandler.sendGameUpdates(SERVER_UPDATE_TICK, game.getCamera());
+        uint32_t networkTick = networkHandler.getNetworkTick();
+
+        pl::Vector2f hostPosition = getHostPosition(networkTick);
+        entity->setWorldPosition(hostPosition);
+        entity->setPosition(hostPosition);
+
+        game.getHitboxHistory(planetType).recordSnapshot(networkTick, chunkManager, game.getBossManager(planetType));
+
+        auto meleeRequestIter = meleeRequestArrivals.find(networkTick);
+        if (meleeRequestIter == meleeRequestArrivals.end())
+        {
+            continue;
+        }
+
+        ReplayFrame frame;
+        frame.packets.push_back(meleeRequestIter->second);
+        networkHandler.setReplayFrame(frame);
+        networkHandler.receiveMessages(game.getChatGUI(), mainMenuGUI);
+
+        if (networkTick == SWING_TICK + 3)
+        {
+            CHECK_MESSAGE(entity->isAlive(), "unrewound request hit entity at tick {}", networkTick);
+        }
+        else
+        {
+            CHECK_MESSAGE(!entity->isAlive(), "rewound request missed entity at tick {}", networkTick);
+        }
+    }
+
+    networkHandler.setReplaying(false);
+    game.deinit();
+}
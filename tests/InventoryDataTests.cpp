@@ -0,0 +1,290 @@
+#include <algorithm>
+#include <vector>
+
+#include "Test.hpp"
+
+#include "Player/InventoryData.hpp"
+#include "Data/ItemDataLoader.hpp"
+#include "Core/Random.hpp"
+
+// Amount of item which can be added, from scan of all slots
+static int getAddCapacity(const InventoryData& inventory, ItemType item)
+{
+    int maxStackSize = ItemDataLoader::getItemData(item).maxStackSize;
+    int capacity = 0;
+
+    for (const std::optional<ItemCount>& itemSlot : inventory.getData())
+    {
+        if (!itemSlot.has_value())
+        {
+            capacity += maxStackSize;
+        }
+        else if (itemSlot->first == item)
+        {
+            capacity += maxStackSize - static_cast<int>(itemSlot->second);
+        }
+    }
+
+    return capacity;
+}
+
+static int getScannedItemAmount(const InventoryData& inventory, ItemType item)
+{
+    int amount = 0;
+
+    for (const std::optional<ItemCount>& itemSlot : inventory.getData())
+    {
+        if (itemSlot.has_value() && itemSlot->first == item)
+        {
+            amount += itemSlot->second;
+        }
+    }
+
+    return amount;
+}
+
+TEST(InventoryIndexProperties)
+{
+    static constexpr int SEED_COUNT = 20;
+    static constexpr int STEPS = 2000;
+    static constexpr int INVENTORY_SIZE = 12;
+
+    // Mix of stackable and unstackable items
+    std::vector<ItemType> items;
+    for (const auto& [itemName, itemType] : ItemDataLoader::getItemNameToTypeMap())
+    {
+        items.push_back(itemType);
+    }
+    std::sort(items.begin(), items.end());
+
+    std::vector<ItemType> testItems;
+    for (ItemType item : items)
+    {
+        if (ItemDataLoader::getItemData(item).maxStackSize <= 1 && testItems.size() < 2)
+        {
+            testItems.push_back(item);
+        }
+    }
+    for (ItemType item : items)
+    {
+        if (ItemDataLoader::getItemData(item).maxStackSize > 1 && testItems.size() < 6)
+        {
+            testItems.push_back(item);
+        }
+    }
+
+    REQUIRE(testItems.size() >= 3);
+
+    for (int seed = 0; seed < SEED_COUNT; seed++)
+    {
+        RandomStream random(seed);
+        InventoryData inventory(INVENTORY_SIZE);
+
+        for (int step = 0; step < STEPS; step++)
+        {
+            ItemType item = testItems[random.randInt(0, testItems.size() - 1)];
+            int maxStackSize = ItemDataLoader::getItemData(item).maxStackSize;
+            int amount = random.randInt(1, maxStackSize * 3);
+            int index = random.randInt(0, INVENTORY_SIZE - 1);
+
+            int operation = random.randInt(0, 5);
+
+            int amountBefore = getScannedItemAmount(inventory, item);
+
+            switch (operation)
+            {
+                case 0:
+                {
+                    int expectedAdded = std::min(amount, getAddCapacity(inventory, item));
+                    int added = inventory.addItem(item, amount);
+                    CHECK_MESSAGE(added == expectedAdded, "seed {} step {} add {} expected {}", seed, step, added, expectedAdded);
+                    CHECK_MESSAGE(getScannedItemAmount(inventory, item) == amountBefore + added, "seed {} step {}", seed, step);
+                    break;
+                }
+                case 1:
+                {
+                    // Test whether items fit without modifying inventory
+                    std::vector<std::optional<ItemCount>> dataBefore = inventory.getData();
+                    int expectedAdded = std::min(amount, getAddCapacity(inventory, item));
+                    int added = inventory.addItem(item, amount, false, false, false);
+                    CHECK_MESSAGE(added == expectedAdded, "seed {} step {} test add {} expected {}", seed, step, added, expectedAdded);
+                    CHECK_MESSAGE(inventory.getData() == dataBefore, "seed {} step {}", seed, step);
+                    break;
+                }
+                case 2:
+                {
+                    int taken = inventory.takeItem(item, amount);
+                    CHECK_MESSAGE(taken == std::min(amount, amountBefore), "seed {} step {} take {}", seed, step, taken);
+                    CHECK_MESSAGE(getScannedItemAmount(inventory, item) == amountBefore - taken, "seed {} step {}", seed, step);
+                    break;
+                }
+                case 3:
+                {
+                    inventory.takeItemAtIndex(index, amount);
+                    break;
+                }
+                case 4:
+                {
+                    inventory.addItemAtIndex(index, item, amount);
+                    break;
+                }
+                case 5:
+                {
+                    // Move whole stack between slots, swapping if other slot contains different item
+                    int otherIndex = random.randInt(0, INVENTORY_SIZE - 1);
+                    std::optional<ItemCount> itemSlot = inventory.getItemSlotData(index);
+                    std::optional<ItemCount> otherItemSlot = inventory.getItemSlotData(otherIndex);
+                    if (!itemSlot.has_value() || index == otherIndex)
+                    {
+                        break;
+                    }
+
+                    inventory.takeItemAtIndex(index, itemSlot->second);
+                    if (otherItemSlot.has_value() && otherItemSlot->first != itemSlot->first)
+                    {
+                        inventory.takeItemAtIndex(otherIndex, otherItemSlot->second);
+                        inventory.addItemAtIndex(index, otherItemSlot->first, otherItemSlot->second);
+                    }
+                    inventory.addItemAtIndex(otherIndex, itemSlot->first, itemSlot->second);
+                    break;
+                }
+            }
+
+            bool indexValid = inventory.isItemSlotIndexValid();
+            CHECK_MESSAGE(indexValid, "seed {} step {} operation {}", seed, step, operation);
+            if (!indexValid)
+            {
+                break;
+            }
+
+            for (ItemType testItem : testItems)
+            {
+                CHECK_MESSAGE(inventory.getItemAmount(testItem) == getScannedItemAmount(inventory, testItem), "seed {} step {} item {}",
+                    seed, step, testItem);
+            }
+
+            CHECK_MESSAGE(inventory.isEmpty() == std::none_of(inventory.getData().begin(), inventory.getData().end(),
+                [](const std::optional<ItemCount>& itemSlot) {return itemSlot.has_value();}), "seed {} step {}", seed, step);
+        }
+    }
+}
+
+// Adds item by linear scan over all slots, as inventory did before slot index, returning amount added
+static int addItemLinearScan(std::vector<std::optional<ItemCount>>& inventoryData, ItemType item, int amount)
+{
+    int maxStackSize = ItemDataLoader::getItemData(item).maxStackSize;
+    int amountToAdd = amount;
+
+    for (std::optional<ItemCount>& itemSlot : inventoryData)
+    {
+        if (amountToAdd <= 0)
+        {
+            break;
+        }
+
+        if (!itemSlot.has_value() || itemSlot->first != item || itemSlot->second >= maxStackSize)
+        {
+            continue;
+        }
+
+        int amountAddedToStack = std::min(static_cast<int>(itemSlot->second) + amountToAdd, maxStackSize) - static_cast<int>(itemSlot->second);
+        amountToAdd -= amountAddedToStack;
+        itemSlot->second += amountAddedToStack;
+    }
+
+    for (std::optional<ItemCount>& itemSlot : inventoryData)
+    {
+        if (amountToAdd <= 0)
+        {
+            break;
+        }
+
+        if (itemSlot.has_value())
+        {
+            continue;
+        }
+
+        int amountPutInSlot = std::min(amountToAdd, maxStackSize);
+        amountToAdd -= amountPutInSlot;
+        itemSlot = ItemCount(item, amountPutInSlot);
+    }
+
+    return amount - amountToAdd;
+}
+
+TEST(InventoryAddMatchesLinearScan)
+{
+    static constexpr int SEED_COUNT = 20;
+    static constexpr int STEPS = 500;
+    static constexpr int INVENTORY_SIZE = 16;
+
+    std::vector<ItemType> items;
+    for (const auto& [itemName, itemType] : ItemDataLoader::getItemNameToTypeMap())
+    {
+        if (ItemDataLoader::getItemData(itemType).maxStackSize > 1)
+        {
+            items.push_back(itemType);
+        }
+    }
+    std::sort(items.begin(), items.end());
+    items.resize(std::min(items.size(), static_cast<size_t>(3)));
+
+    REQUIRE(items.size() >= 2);
+
+    for (int seed = 0; seed < SEED_COUNT; seed++)
+    {
+        RandomStream random(seed);
+        InventoryData inventory(INVENTORY_SIZE);
+
+        // Scatter partial stacks of several items with gaps, so added items must fill stacks and gaps in slot order
+        for (int index = 0; index < INVENTORY_SIZE; index++)
+        {
+            if (random.randInt(0, 2) == 0)
+            {
+                continue;
+            }
+
+            ItemType item = items[random.randInt(0, items.size() - 1)];
+            inventory.addItemAtIndex(index, item, random.randInt(1, ItemDataLoader::getItemData(item).maxStackSize));
+        }
+
+        std::vector<std::optional<ItemCount>> expectedData = inventory.getData();
+
+        for (int step = 0; step < STEPS; step++)
+        {
+            ItemType item = items[random.randInt(0, items.size() - 1)];
+            int amount = random.randInt(1, ItemDataLoader::getItemData(item).maxStackSize * 2);
+
+            // Take from random slot to open up new partial stacks and gaps
+            if (random.randInt(0, 1) == 0)
+            {
+                int index = random.randInt(0, INVENTORY_SIZE - 1);
+                int takeAmount = random.randInt(1, amount);
+                inventory.takeItemAtIndex(index, takeAmount);
+
+                if (expectedData[index].has_value())
+                {
+                    if (static_cast<int>(expectedData[index]->second) <= takeAmount)
+                    {
+                        expectedData[index] = std::nullopt;
+                    }
+                    else
+                    {
+                        expectedData[index]->second -= takeAmount;
+                    }
+                }
+            }
+
+            int expectedAdded = addItemLinearScan(expectedData, item, amount);
+            int added = inventory.addItem(item, amount);
+
+            CHECK_MESSAGE(added == expectedAdded, "seed {} step {} add {} expected {}", seed, step, added, expectedAdded);
+            CHECK_MESSAGE(inventory.getData() == expectedData, "seed {} step {} slots differ from linear scan", seed, step);
+
+            if (inventory.getData() != expectedData)
+            {
+                break;
+            }
+        }
+    }
+}
@@ -0,0 +1,108 @@
+#include <chrono>
+#include <sstream>
+#include <vector>
+#include <iostream>
+
+#include <extlib/cereal/archives/binary.hpp>
+#include <extlib/cereal/types/vector.hpp>
+
+#include "Test.hpp"
+
+#include "Entity/Projectile/ProjectileManager.hpp"
+#include "Core/Random.hpp"
+
+// Hundreds of projectiles fired into a dense night-time mob wave around the player
+// Compares grid hit queries against testing every projectile against every mob, for the same hits and fewer projectiles visited
+TEST(ProjectileHitTestBenchmark)
+{
+    static constexpr int WORLD_SIZE = 64;
+    static constexpr int PROJECTILE_COUNT = 600;
+    static constexpr int MOB_COUNT = 250;
+    static constexpr int TICKS = 60;
+    static constexpr float WAVE_RADIUS = CHUNK_TILE_SIZE * TILE_SIZE_PIXELS_UNSCALED * 3;
+
+    RandomStream random(4821);
+
+    pl::Vector2f centre(WORLD_SIZE / 2 * CHUNK_TILE_SIZE * TILE_SIZE_PIXELS_UNSCALED, WORLD_SIZE / 2 * CHUNK_TILE_SIZE * TILE_SIZE_PIXELS_UNSCALED);
+
+    std::vector<Projectile> projectiles;
+    for (int i = 0; i < PROJECTILE_COUNT; i++)
+    {
+        pl::Vector2f position = centre + pl::Vector2f(random.randFloat(-WAVE_RADIUS, WAVE_RADIUS), random.randFloat(-WAVE_RADIUS, WAVE_RADIUS));
+        pl::Vector2f velocity(random.randFloat(-200.0f, 200.0f), random.randFloat(-200.0f, 200.0f));
+        projectiles.push_back(Projectile(position, velocity, 0, 1.0f, HitLayer::Entity, random));
+    }
+
+    std::vector<CollisionRect> mobHitCollisions;
+    for (int i = 0; i < MOB_COUNT; i++)
+    {
+        mobHitCollisions.push_back(CollisionRect(centre.x + random.randFloat(-WAVE_RADIUS, WAVE_RADIUS), centre.y + random.randFloat(-WAVE_RADIUS, WAVE_RADIUS),
+            random.randFloat(8.0f, 32.0f), random.randFloat(8.0f, 32.0f)));
+    }
+
+    // Load projectiles as from save, as projectile manager is not initialised with game
+    std::stringstream projectileStream;
+    {
+        cereal::BinaryOutputArchive archive(projectileStream);
+        archive(projectiles);
+    }
+
+    ProjectileManager projectileManager;
+    {
+        cereal::BinaryInputArchive archive(projectileStream);
+        projectileManager.load(archive, 1);
+    }
+
+    REQUIRE(projectileManager.getProjectileCount() == PROJECTILE_COUNT);
+
+    long long gridVisited = 0;
+    long long linearVisited = 0;
+    long long gridHits = 0;
+    long long linearHits = 0;
+
+    std::chrono::nanoseconds gridTime(0);
+    std::chrono::nanoseconds linearTime(0);
+
+    for (int tick = 0; tick < TICKS; tick++)
+    {
+        projectileManager.update(1.0f / 60.0f, WORLD_SIZE);
+
+        auto start = std::chrono::high_resolution_clock::now();
+
+        for (const CollisionRect& hitCollision : mobHitCollisions)
+        {
+            projectileManager.forEachProjectileNear(hitCollision, WORLD_SIZE, [&](Projectile& projectile)
+            {
+                gridVisited++;
+                if (projectile.getCollisionCircle().isColliding(hitCollision, WORLD_SIZE))
+                {
+                    gridHits++;
+                }
+            });
+        }
+
+        gridTime += std::chrono::high_resolution_clock::now() - start;
+        start = std::chrono::high_resolution_clock::now();
+
+        for (const CollisionRect& hitCollision : mobHitCollisions)
+        {
+            projectileManager.forEachProjectile([&](Projectile& projectile)
+            {
+                linearVisited++;
+                if (projectile.getCollisionCircle().isColliding(hitCollision, WORLD_SIZE))
+                {
+                    linearHits++;
+                }
+            });
+        }
+
+        linearTime += std::chrono::high_resolution_clock::now() - start;
+    }
+
+    CHECK_MESSAGE(gridHits == linearHits, "grid hits {} linear hits {}", gridHits, linearHits);
+    CHECK_MESSAGE(gridVisited < linearVisited, "grid visited {} linear visited {}", gridVisited, linearVisited);
+
+    std::cout << std::format("ProjectileHitTestBenchmark: {} projectiles, {} mobs, {} ticks\n", PROJECTILE_COUNT, MOB_COUNT, TICKS);
+    std::cout << std::format("    grid: {:.3f} ms, {} projectiles visited\n", gridTime.count() / 1e6, gridVisited);
+    std::cout << std::format("    linear: {:.3f} ms, {} projectiles visited\n", linearTime.count() / 1e6, linearVisited);
+}
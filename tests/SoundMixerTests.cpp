@@ -0,0 +1,144 @@
+#include <cmath>
+#include <vector>
+
+#include "Test.hpp"
+
+#include "Core/SoundMixer.hpp"
+#include "Core/Sounds.hpp"
+
+static constexpr float SOUND_MIXER_TEST_EPSILON = 0.001f;
+
+// Advances mixer past merge cooldown, so next sound of same type is not merged
+static void advancePastMergeCooldown(SoundMixer& soundMixer)
+{
+    soundMixer.update(SoundMixer::MERGE_COOLDOWN * 1.5f);
+}
+
+// Plays sounds through mixer with a recording null backend and checks which voices the backend was told to play and stop
+TEST(SoundMixerPlaysExpectedVoices)
+{
+    static constexpr int WORLD_SIZE = 64;
+    static constexpr float WORLD_PIXEL_SIZE = WORLD_SIZE * CHUNK_TILE_SIZE * TILE_SIZE_PIXELS_UNSCALED;
+
+    NullSoundBackend backend;
+    backend.setRecording(true);
+
+    SoundMixer soundMixer;
+    soundMixer.setBackend(&backend);
+
+    pl::Vector2f listenerPosition(20.0f, 500.0f);
+    soundMixer.setListener(listenerPosition, WORLD_SIZE);
+
+    // Sound at listener plays at full volume, centred
+    soundMixer.playSoundAt(SoundType::HitObject, listenerPosition, 80.0f);
+    REQUIRE(backend.playedVoices.size() == 1);
+    CHECK(backend.playedVoices[0].type == SoundType::HitObject);
+    CHECK(std::abs(backend.playedVoices[0].volume - 80.0f) < SOUND_MIXER_TEST_EPSILON);
+    CHECK(std::abs(backend.playedVoices[0].pan) < SOUND_MIXER_TEST_EPSILON);
+
+    // Sound just over world wrap edge is to the left of listener, and within inner distance
+    soundMixer.playSoundAt(SoundType::HitAnimal, pl::Vector2f(WORLD_PIXEL_SIZE - 20.0f, 500.0f), 80.0f);
+    REQUIRE(backend.playedVoices.size() == 2);
+    CHECK(backend.playedVoices[1].type == SoundType::HitAnimal);
+    CHECK_MESSAGE(backend.playedVoices[1].pan < 0.0f, "pan {}", backend.playedVoices[1].pan);
+    CHECK(std::abs(backend.playedVoices[1].volume - 80.0f) < SOUND_MIXER_TEST_EPSILON);
+
+    // Sound halfway between inner and max distance is attenuated to half volume
+    float halfDistance = (SoundMixer::ATTENUATION_INNER_DISTANCE + SoundMixer::ATTENUATION_MAX_DISTANCE) / 2.0f;
+    soundMixer.playSoundAt(SoundType::Pop0, listenerPosition + pl::Vector2f(0, halfDistance), 80.0f);
+    REQUIRE(backend.playedVoices.size() == 3);
+    CHECK_MESSAGE(std::abs(backend.playedVoices[2].volume - 40.0f) < SOUND_MIXER_TEST_EPSILON, "volume {}", backend.playedVoices[2].volume);
+
+    // Sound beyond max distance is culled, and does not reach backend
+    soundMixer.playSoundAt(SoundType::Pop1, listenerPosition + pl::Vector2f(SoundMixer::ATTENUATION_MAX_DISTANCE + 1.0f, 0), 80.0f);
+    CHECK(backend.playedVoices.size() == 3);
+    CHECK(soundMixer.getStats().voicesCulled == 1);
+
+    soundMixer.stopAllVoices();
+    CHECK(backend.stoppedVoices.size() == 3);
+    backend.clear();
+
+    // Identical sound started within merge cooldown is merged, unless louder, which replaces the recent voice
+    soundMixer.playSound(SoundType::UIClick0, 30.0f);
+    soundMixer.playSound(SoundType::UIClick0, 20.0f);
+    CHECK(backend.playedVoices.size() == 1);
+    soundMixer.playSound(SoundType::UIClick0, 50.0f);
+    REQUIRE(backend.playedVoices.size() == 2);
+    REQUIRE(backend.stoppedVoices.size() == 1);
+    CHECK(backend.stoppedVoices[0].id == backend.playedVoices[0].id);
+    CHECK(std::abs(backend.playedVoices[1].volume - 50.0f) < SOUND_MIXER_TEST_EPSILON);
+
+    soundMixer.stopAllVoices();
+    backend.clear();
+
+    // Per type limit steals quietest voice of type for a louder one, and rejects quieter ones
+    soundMixer.setVoiceLimit(SoundType::Crow, 2);
+    for (float volume : {40.0f, 20.0f, 60.0f, 10.0f})
+    {
+        advancePastMergeCooldown(soundMixer);
+        soundMixer.playSound(SoundType::Crow, volume);
+    }
+
+    REQUIRE(backend.playedVoices.size() == 3);
+    CHECK(std::abs(backend.playedVoices[2].volume - 60.0f) < SOUND_MIXER_TEST_EPSILON);
+    REQUIRE(backend.stoppedVoices.size() == 1);
+    CHECK(std::abs(backend.stoppedVoices[0].volume - 20.0f) < SOUND_MIXER_TEST_EPSILON);
+    CHECK(soundMixer.getActiveVoices().size() == 2);
+
+    // Voices expire after voice duration, freeing slots
+    soundMixer.update(SoundMixer::VOICE_DURATION);
+    CHECK(soundMixer.getActiveVoices().empty());
+    backend.clear();
+    soundMixer.playSound(SoundType::Crow, 5.0f);
+    CHECK(backend.playedVoices.size() == 1);
+
+    soundMixer.stopAllVoices();
+    backend.clear();
+
+    // Global limit steals quietest voice of any type
+    soundMixer.setGlobalVoiceLimit(2);
+    soundMixer.playSound(SoundType::Pop0, 30.0f);
+    soundMixer.playSound(SoundType::Pop1, 10.0f);
+    soundMixer.playSound(SoundType::Pop2, 20.0f);
+
+    REQUIRE(backend.playedVoices.size() == 3);
+    REQUIRE(backend.stoppedVoices.size() == 1);
+    CHECK(backend.stoppedVoices[0].type == SoundType::Pop1);
+
+    soundMixer.setBackend(nullptr);
+}
+
+// Backend that cannot stop voices keeps recent voice when merging, rather than playing both
+TEST(SoundMixerKeepsVoicesBackendCannotStop)
+{
+    NullSoundBackend backend;
+    backend.setRecording(true);
+    backend.setCanStopVoices(false);
+
+    SoundMixer soundMixer;
+    soundMixer.setBackend(&backend);
+
+    // Louder identical sound within merge cooldown is dropped, as recent voice would keep playing
+    soundMixer.playSound(SoundType::UIClick0, 30.0f);
+    soundMixer.playSound(SoundType::UIClick0, 50.0f);
+    REQUIRE(backend.playedVoices.size() == 1);
+    CHECK(backend.stoppedVoices.empty());
+    CHECK(std::abs(backend.playedVoices[0].volume - 30.0f) < SOUND_MIXER_TEST_EPSILON);
+    CHECK(soundMixer.getActiveVoices().size() == 1);
+    CHECK(soundMixer.getStats().voicesMerged == 1);
+
+    soundMixer.stopAllVoices();
+    backend.clear();
+
+    // Stolen voices are counted as still playing
+    soundMixer.setVoiceLimit(SoundType::Crow, 1);
+    soundMixer.playSound(SoundType::Crow, 20.0f);
+    advancePastMergeCooldown(soundMixer);
+    soundMixer.playSound(SoundType::Crow, 40.0f);
+
+    CHECK(backend.playedVoices.size() == 2);
+    CHECK(soundMixer.getStats().voicesStolen == 1);
+    CHECK(soundMixer.getStats().voicesStolenStillPlaying == 1);
+
+    soundMixer.setBackend(nullptr);
+}
@@ -0,0 +1,150 @@
+#include <cmath>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Test.hpp"
+
+#include "Data/SpawnTable.hpp"
+#include "Data/PlanetGenDataLoader.hpp"
+#include "Core/Random.hpp"
+
+// Expected chance of each value being sampled, from entries in order
+// Roll is in [0, 1], so entries past a cumulative chance of 1 are only partly or never reached
+template <typename T>
+static std::map<T, float> getExpectedFrequencies(const std::vector<std::pair<T, float>>& entries, float probabilityMult)
+{
+    std::map<T, float> expectedFrequencies;
+
+    float cumulativeChance = 0.0f;
+    for (const auto& [value, chance] : entries)
+    {
+        float previous = std::min(cumulativeChance * probabilityMult, 1.0f);
+        cumulativeChance += chance;
+        float current = std::min(cumulativeChance * probabilityMult, 1.0f);
+
+        expectedFrequencies[value] += current - previous;
+    }
+
+    return expectedFrequencies;
+}
+
+// Samples table many times with uniform rolls and checks each value's frequency is within tolerance of its weight
+template <typename T>
+static void checkSampleFrequencies(const SpawnTable<T>& spawnTable, const std::vector<std::pair<T, float>>& entries, float probabilityMult,
+    RandomStream& random, const std::string& tableName)
+{
+    static constexpr int SAMPLE_COUNT = 200000;
+
+    std::map<T, int> sampleCounts;
+    int noneCount = 0;
+
+    for (int i = 0; i < SAMPLE_COUNT; i++)
+    {
+        std::optional<T> value = spawnTable.sample(random.randFloat(0.0f, 1.0f), probabilityMult);
+        if (value.has_value())
+        {
+            sampleCounts[value.value()]++;
+        }
+        else
+        {
+            noneCount++;
+        }
+    }
+
+    std::map<T, float> expectedFrequencies = getExpectedFrequencies(entries, probabilityMult);
+
+    float expectedNoneFrequency = 1.0f;
+    for (const auto& [value, expectedFrequency] : expectedFrequencies)
+    {
+        expectedNoneFrequency -= expectedFrequency;
+    }
+
+    // 5 standard deviations of a binomial proportion, plus rounding slack of float rolls
+    auto getTolerance = [](float frequency)
+    {
+        return 5.0f * std::sqrt(std::max(frequency * (1.0f - frequency), 0.0f) / SAMPLE_COUNT) + 1e-3f;
+    };
+
+    for (const auto& [value, expectedFrequency] : expectedFrequencies)
+    {
+        float frequency = static_cast<float>(sampleCounts[value]) / SAMPLE_COUNT;
+        CHECK_MESSAGE(std::abs(frequency - expectedFrequency) <= getTolerance(expectedFrequency),
+            "{} value {} sampled {} expected {}", tableName, static_cast<int>(value), frequency, expectedFrequency);
+    }
+
+    for (const auto& [value, count] : sampleCounts)
+    {
+        CHECK_MESSAGE(expectedFrequencies.contains(value), "{} sampled value {} not in table", tableName, static_cast<int>(value));
+    }
+
+    float noneFrequency = static_cast<float>(noneCount) / SAMPLE_COUNT;
+    CHECK_MESSAGE(std::abs(noneFrequency - expectedNoneFrequency) <= getTolerance(expectedNoneFrequency),
+        "{} sampled nothing {} expected {}", tableName, noneFrequency, expectedNoneFrequency);
+}
+
+template <typename T>
+static SpawnTable<T> createSpawnTable(const std::vector<std::pair<T, float>>& entries)
+{
+    SpawnTable<T> spawnTable;
+    for (const auto& [value, chance] : entries)
+    {
+        spawnTable.addEntry(value, chance);
+    }
+    return spawnTable;
+}
+
+TEST(SpawnTableSampleFrequenciesMatchWeights)
+{
+    RandomStream random(9137);
+
+    // Repeated value, zero weight entry, and total chance both below and above 1
+    std::vector<std::pair<int, float>> entries = {{3, 0.05f}, {7, 0.2f}, {1, 0.0f}, {3, 0.1f}, {9, 0.3f}};
+    SpawnTable<int> spawnTable = createSpawnTable(entries);
+
+    checkSampleFrequencies(spawnTable, entries, 1.0f, random, "weights");
+    checkSampleFrequencies(spawnTable, entries, 0.5f, random, "weights x0.5");
+    checkSampleFrequencies(spawnTable, entries, 2.5f, random, "weights x2.5");
+
+    SpawnTable<int> emptySpawnTable;
+    CHECK(!emptySpawnTable.sample(0.0f).has_value());
+
+    // Compiled tables of every biome in game data
+    for (const auto& [planetName, planetType] : PlanetGenDataLoader::getPlanetStringToTypeMap())
+    {
+        for (const BiomeGenData& biomeGenData : PlanetGenDataLoader::getPlanetGenData(planetType).biomeGenDatas)
+        {
+            std::string tableName = planetName + " " + biomeGenData.name;
+
+            std::vector<std::pair<ObjectType, float>> objectEntries;
+            for (const ObjectGenData& objectGenData : biomeGenData.objectGenDatas)
+            {
+                objectEntries.push_back({objectGenData.object, objectGenData.spawnChance});
+            }
+            checkSampleFrequencies(biomeGenData.objectSpawnTable, objectEntries, 1.0f, random, tableName + " objects");
+            checkSampleFrequencies(biomeGenData.objectSpawnTable, objectEntries, 0.5f, random, tableName + " objects x0.5");
+
+            std::vector<std::pair<EntityType, float>> entityEntries;
+            for (const EntityGenData& entityGenData : biomeGenData.entityGenDatas)
+            {
+                entityEntries.push_back({entityGenData.entity, entityGenData.spawnChance});
+            }
+            checkSampleFrequencies(biomeGenData.entitySpawnTable, entityEntries, 1.0f, random, tableName + " entities");
+
+            std::vector<std::pair<StructureType, float>> structureEntries;
+            for (const StructureGenData& structureGenData : biomeGenData.structureGenDatas)
+            {
+                structureEntries.push_back({structureGenData.structure, structureGenData.spawnChance});
+            }
+            checkSampleFrequencies(biomeGenData.structureSpawnTable, structureEntries, 1.0f, random, tableName + " structures");
+
+            std::vector<std::pair<int, float>> fishCatchEntries;
+            for (int i = 0; i < biomeGenData.fishCatchDatas.size(); i++)
+            {
+                fishCatchEntries.push_back({i, biomeGenData.fishCatchDatas[i].chance});
+            }
+            checkSampleFrequencies(biomeGenData.fishCatchSpawnTable, fishCatchEntries, 1.0f, random, tableName + " fish");
+        }
+    }
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <vector>
+#include <string>
+#include <functional>
+#include <format>
+#include <iostream>
+#include <stdexcept>
+
+// Minimal test registry, each test is run by name as its own CTest test, e.g. "planeturem-tests InventoryIndexProperties"
+// Tests run headlessly, with game data loaded from "Data/Info/" before any test runs
+namespace Test
+{
+    struct TestCase
+    {
+        std::string name;
+        std::function<void()> function;
+    };
+
+    std::vector<TestCase>& getTestCases();
+
+    struct Registration
+    {
+        inline Registration(const std::string& name, std::function<void()> function)
+        {
+            getTestCases().push_back({name, function});
+        }
+    };
+
+    // Thrown by REQUIRE to stop current test
+    struct RequireFailure : public std::runtime_error
+    {
+        using std::runtime_error::runtime_error;
+    };
+
+    extern int failureCount;
+
+    inline void fail(const std::string& message, const char* file, int line)
+    {
+        std::cerr << file << ":" << line << ": FAILED: " << message << "\n";
+        failureCount++;
+    }
+}
+
+#define TEST(name) \
+    static void name(); \
+    static Test::Registration name##Registration(#name, name); \
+    static void name()
+
+// Records failure and continues test
+#define CHECK(condition) \
+    do { if (!(condition)) Test::fail(#condition, __FILE__, __LINE__); } while (false)
+
+#define CHECK_MESSAGE(condition, ...) \
+    do { if (!(condition)) Test::fail(std::string(#condition) + " (" + std::format(__VA_ARGS__) + ")", __FILE__, __LINE__); } while (false)
+
+// Records failure and stops test
+#define REQUIRE(condition) \
+    do { if (!(condition)) { Test::fail(#condition, __FILE__, __LINE__); throw Test::RequireFailure(#condition); } } while (false)
@@ -0,0 +1,65 @@
+#include <cstring>
+#include <filesystem>
+
+#include "Test.hpp"
+
+#include "Data/GameDataCache.hpp"
+#include "IO/Log.hpp"
+
+int Test::failureCount = 0;
+
+std::vector<Test::TestCase>& Test::getTestCases()
+{
+    static std::vector<TestCase> testCases;
+    return testCases;
+}
+
+// Runs test given by name, or all tests if no name given
+int main(int argc, char* argv[])
+{
+    Log::init();
+
+    // Cache is kept separate from game's cache, so tests never read a stale cache written by a different build
+    std::string cachePath = (std::filesystem::temp_directory_path() / "planeturem_tests_game_data.cache").string();
+    if (!GameDataCache::loadGameData("Data/Info/", cachePath))
+    {
+        std::cerr << "Could not load game data from \"Data/Info/\"\n";
+        return -1;
+    }
+
+    int testsRun = 0;
+
+    for (const Test::TestCase& testCase : Test::getTestCases())
+    {
+        if (argc >= 2 && testCase.name != argv[1])
+        {
+            continue;
+        }
+
+        testsRun++;
+
+        int failuresBefore = Test::failureCount;
+
+        try
+        {
+            testCase.function();
+        }
+        catch (const Test::RequireFailure&)
+        {
+        }
+        catch (const std::exception& e)
+        {
+            Test::fail(std::string("Exception thrown: ") + e.what(), testCase.name.c_str(), 0);
+        }
+
+        std::cout << ((Test::failureCount == failuresBefore) ? "PASSED: " : "FAILED: ") << testCase.name << "\n";
+    }
+
+    if (testsRun == 0)
+    {
+        std::cerr << "No test named \"" << (argc >= 2 ? argv[1] : "") << "\"\n";
+        return -1;
+    }
+
+    return (Test::failureCount == 0) ? 0 : 1;
+}
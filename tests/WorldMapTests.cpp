@@ -0,0 +1,98 @@
+#include <algorithm>
+
+#include "Test.hpp"
+
+#include "World/Chunk.hpp"
+#include "World/ChunkManager.hpp"
+#include "Data/PlanetGenDataLoader.hpp"
+
+// Map section as created before sections were built from cached biomes, sampling biome noise for each map pixel
+static ChunkWorldMapSection createNoiseSampledMapSection(const Chunk& chunk, ChunkPosition chunkPosition, ChunkManager& chunkManager)
+{
+    static constexpr int CHUNK_MAP_TILE_AREA_SIZE = static_cast<int>(CHUNK_TILE_SIZE) / CHUNK_MAP_TILE_SIZE;
+
+    ChunkWorldMapSection chunkMapSection;
+    chunkMapSection.chunkPosition = chunkPosition;
+
+    for (int y = 0; y < CHUNK_TILE_SIZE; y += CHUNK_MAP_TILE_AREA_SIZE)
+    {
+        for (int x = 0; x < CHUNK_TILE_SIZE; x += CHUNK_MAP_TILE_AREA_SIZE)
+        {
+            int tileCounter = 0;
+            uint16_t tileId = 0;
+            const BiomeGenData* biomeGenData = Chunk::getBiomeGenAtWorldTile(pl::Vector2<int>(chunkPosition.x * CHUNK_TILE_SIZE + x,
+                chunkPosition.y * CHUNK_TILE_SIZE + y), chunkManager.getWorldSize(), chunkManager.getBiomeNoise(), chunkManager.getPlanetType());
+
+            for (int ySub = 0; ySub < CHUNK_MAP_TILE_AREA_SIZE; ySub++)
+            {
+                for (int xSub = 0; xSub < CHUNK_MAP_TILE_AREA_SIZE; xSub++)
+                {
+                    int subTileId = chunk.getTileType(pl::Vector2<int>(x + xSub, y + ySub));
+                    if (subTileId != 0)
+                    {
+                        tileCounter++;
+                        tileId = subTileId;
+                        biomeGenData = Chunk::getBiomeGenAtWorldTile(pl::Vector2<int>(chunkPosition.x * CHUNK_TILE_SIZE + x + xSub,
+                            chunkPosition.y * CHUNK_TILE_SIZE + y + ySub),
+                            chunkManager.getWorldSize(), chunkManager.getBiomeNoise(), chunkManager.getPlanetType());
+                    }
+                }
+            }
+
+            if (tileCounter >= 2)
+            {
+                chunkMapSection.colorGrid[y / CHUNK_MAP_TILE_AREA_SIZE][x / CHUNK_MAP_TILE_AREA_SIZE] = PlanetGenDataLoader::getTileMapDataFromID(tileId).mapColor;
+                continue;
+            }
+
+            chunkMapSection.colorGrid[y / CHUNK_MAP_TILE_AREA_SIZE][x / CHUNK_MAP_TILE_AREA_SIZE] = biomeGenData->waterColor;
+        }
+    }
+
+    return chunkMapSection;
+}
+
+TEST(WorldMapSectionsMatchNoiseSampled)
+{
+    static constexpr int SEEDS[] = {1, 4821, 99173};
+    static constexpr int CHUNKS_PER_AXIS = 12;
+
+    for (const auto& planetPair : PlanetGenDataLoader::getPlanetStringToTypeMap())
+    {
+        for (int seed : SEEDS)
+        {
+            ChunkManager chunkManager;
+            chunkManager.setSeed(seed);
+            chunkManager.setPlanetType(planetPair.second);
+
+            int chunksPerAxis = std::min(CHUNKS_PER_AXIS, chunkManager.getWorldSize());
+
+            for (int chunkY = 0; chunkY < chunksPerAxis; chunkY++)
+            {
+                for (int chunkX = 0; chunkX < chunksPerAxis; chunkX++)
+                {
+                    ChunkPosition chunkPosition(chunkX, chunkY);
+
+                    Chunk chunk(chunkPosition, 0.0f);
+                    chunk.generateTilesAndStructure(chunkManager.getHeightNoise(), chunkManager.getBiomeNoise(), chunkManager.getRiverNoise(),
+                        planetPair.second, chunkManager, false);
+
+                    ChunkWorldMapSection expected = createNoiseSampledMapSection(chunk, chunkPosition, chunkManager);
+                    ChunkWorldMapSection section = chunk.createChunkWorldMapSection(chunkManager);
+
+                    for (int y = 0; y < CHUNK_MAP_TILE_SIZE; y++)
+                    {
+                        for (int x = 0; x < CHUNK_MAP_TILE_SIZE; x++)
+                        {
+                            const pl::Color& expectedColor = expected.colorGrid[y][x];
+                            const pl::Color& color = section.colorGrid[y][x];
+
+                            CHECK_MESSAGE(color.r == expectedColor.r && color.g == expectedColor.g && color.b == expectedColor.b,
+                                "planet {} seed {} chunk ({}, {}) map tile ({}, {})", planetPair.first, seed, chunkX, chunkY, x, y);
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
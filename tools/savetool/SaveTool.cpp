@@ -0,0 +1,482 @@
+#include "SaveTool.hpp"
+
+#include <iostream>
+#include <sstream>
+#include <unordered_set>
+#include <algorithm>
+#include <optional>
+
+#include "World/ChunkPosition.hpp"
+
+namespace
+{
+
+// Planet save deserialised in the same order as PlanetGameSave, but chunk by chunk, so the chunk which fails can be reported
+// Types are not remapped, as only deserialisation is checked
+struct PlanetSaveChunkReader
+{
+    std::vector<std::string> problems;
+    int chunkCount = 0;
+
+    template <class Archive>
+    void load(Archive& ar, const std::uint32_t version)
+    {
+        if (version < 4)
+        {
+            problems.push_back("planet save version " + std::to_string(version) + " is not supported");
+            return;
+        }
+
+        GameDataVersionState versionState;
+        ar(versionState);
+
+        cereal::size_type savedChunkCount = 0;
+        ar(cereal::make_size_tag(savedChunkCount));
+
+        std::optional<ChunkPosition> lastChunkPosition;
+
+        for (cereal::size_type i = 0; i < savedChunkCount; i++)
+        {
+            ChunkPOD chunk;
+
+            try
+            {
+                ar(chunk);
+            }
+            catch (const std::exception& e)
+            {
+                // Rest of data cannot be located once a chunk has failed
+                std::string after = lastChunkPosition.has_value() ? " (after chunk (" + std::to_string(lastChunkPosition->x) + ", " +
+                    std::to_string(lastChunkPosition->y) + "))" : "";
+                problems.push_back("chunk " + std::to_string(i) + " of " + std::to_string(savedChunkCount) + after +
+                    " could not be deserialised: " + e.what() + ", remaining chunks not checked");
+                return;
+            }
+
+            lastChunkPosition = chunk.chunkPosition;
+            chunkCount++;
+        }
+    }
+};
+
+}
+
+std::vector<SaveTool::SaveFile> SaveTool::getSaveFiles(const std::string& saveDirectory, const std::string& subdirectory)
+{
+    std::vector<SaveFile> saveFiles;
+
+    std::filesystem::path dir = std::filesystem::path(saveDirectory) / subdirectory;
+
+    std::error_code error;
+    if (!std::filesystem::is_directory(dir, error))
+    {
+        return saveFiles;
+    }
+
+    for (const auto& entry : std::filesystem::directory_iterator(dir, error))
+    {
+        if (!entry.is_regular_file() || entry.path().extension() != ".dat")
+        {
+            continue;
+        }
+
+        SaveFile saveFile;
+        saveFile.name = entry.path().stem().string();
+        saveFile.path = entry.path();
+        saveFile.fileBytes = entry.file_size(error);
+        saveFiles.push_back(saveFile);
+    }
+
+    std::sort(saveFiles.begin(), saveFiles.end(), [](const SaveFile& a, const SaveFile& b)
+    {
+        return a.name < b.name;
+    });
+
+    return saveFiles;
+}
+
+int SaveTool::list(const std::string& saveDirectory)
+{
+    GameSaveIO io;
+    io.setSaveDirectory(saveDirectory);
+
+    PlayerGameSave playerGameSave;
+    if (!io.loadPlayerSave(playerGameSave))
+    {
+        std::cerr << "Could not load player save in \"" << saveDirectory << "\"\n";
+        return -1;
+    }
+
+    std::cout << "Save: " << saveDirectory << "\n";
+    std::cout << "Game version: " << playerGameSave.gameVersion << "\n";
+    std::cout << "Seed: " << playerGameSave.seed << "\n";
+    std::cout << "Day: " << playerGameSave.day << "\n";
+    std::cout << "Players: " << (playerGameSave.networkPlayerDatas.size() + 1) << "\n";
+
+    std::cout << "Planets:\n";
+    for (const SaveFile& saveFile : getSaveFiles(saveDirectory, "Planets"))
+    {
+        bool known = PlanetGenDataLoader::getPlanetStringToTypeMap().contains(saveFile.name);
+        std::cout << "  " << saveFile.name << " (" << saveFile.fileBytes << " bytes)" << (known ? "" : " [unknown planet]") << "\n";
+    }
+
+    std::cout << "Rooms:\n";
+    for (const SaveFile& saveFile : getSaveFiles(saveDirectory, "Rooms"))
+    {
+        bool known = StructureDataLoader::getRoomTravelLocationNameToTypeMap().contains(saveFile.name);
+        std::cout << "  " << saveFile.name << " (" << saveFile.fileBytes << " bytes)" << (known ? "" : " [unknown room]") << "\n";
+    }
+
+    return 0;
+}
+
+nlohmann::json SaveTool::createPlanetStats(const SaveFile& saveFile, const PlanetGameSave& planetGameSave)
+{
+    int modifiedChunks = 0;
+    int objects = 0;
+    int objectReferences = 0;
+    int entities = 0;
+    int structures = 0;
+
+    for (const ChunkPOD& chunk : planetGameSave.chunks)
+    {
+        modifiedChunks += chunk.modified;
+        entities += chunk.entities.size();
+        structures += chunk.structureObject.has_value();
+
+        for (const auto& objectRow : chunk.objectGrid)
+        {
+            for (const auto& object : objectRow)
+            {
+                if (!object.has_value())
+                {
+                    continue;
+                }
+
+                if (object->objectReference.has_value())
+                {
+                    objectReferences++;
+                }
+                else
+                {
+                    objects++;
+                }
+            }
+        }
+    }
+
+    nlohmann::json json;
+    json["name"] = saveFile.name;
+    json["file-bytes"] = saveFile.fileBytes;
+    json["chunks"] = planetGameSave.chunks.size();
+    json["modified-chunks"] = modifiedChunks;
+    json["objects"] = objects;
+    json["object-references"] = objectReferences;
+    json["entities"] = entities;
+    json["structures"] = structures;
+    json["chests"] = planetGameSave.chestDataPool.getChestCount();
+    json["structure-rooms"] = planetGameSave.structureRoomPool.getRoomCount();
+    return json;
+}
+
+int SaveTool::stats(const std::string& saveDirectory)
+{
+    GameSaveIO io;
+    io.setSaveDirectory(saveDirectory);
+
+    nlohmann::json json;
+    json["save"] = saveDirectory;
+    json["planets"] = nlohmann::json::array();
+    json["rooms"] = nlohmann::json::array();
+
+    PlayerGameSave playerGameSave;
+    if (io.loadPlayerSave(playerGameSave))
+    {
+        json["game-version"] = playerGameSave.gameVersion;
+        json["seed"] = playerGameSave.seed;
+        json["players"] = playerGameSave.networkPlayerDatas.size() + 1;
+    }
+
+    int failures = 0;
+
+    for (const SaveFile& saveFile : getSaveFiles(saveDirectory, "Planets"))
+    {
+        auto planetIter = PlanetGenDataLoader::getPlanetStringToTypeMap().find(saveFile.name);
+
+        PlanetGameSave planetGameSave;
+        if (planetIter == PlanetGenDataLoader::getPlanetStringToTypeMap().end() || !io.loadPlanetSave(planetIter->second, planetGameSave))
+        {
+            std::cerr << "Could not load planet \"" << saveFile.name << "\"\n";
+            failures++;
+            continue;
+        }
+
+        json["planets"].push_back(createPlanetStats(saveFile, planetGameSave));
+    }
+
+    for (const SaveFile& saveFile : getSaveFiles(saveDirectory, "Rooms"))
+    {
+        auto roomIter = StructureDataLoader::getRoomTravelLocationNameToTypeMap().find(saveFile.name);
+
+        RoomDestinationGameSave roomDestinationGameSave;
+        if (roomIter == StructureDataLoader::getRoomTravelLocationNameToTypeMap().end() ||
+            !io.loadRoomDestinationSave(roomIter->second, roomDestinationGameSave))
+        {
+            std::cerr << "Could not load room \"" << saveFile.name << "\"\n";
+            failures++;
+            continue;
+        }
+
+        nlohmann::json roomJson;
+        roomJson["name"] = saveFile.name;
+        roomJson["file-bytes"] = saveFile.fileBytes;
+        roomJson["chests"] = roomDestinationGameSave.chestDataPool.getChestCount();
+        json["rooms"].push_back(roomJson);
+    }
+
+    std::cout << json.dump(4) << "\n";
+
+    return (failures > 0) ? 1 : 0;
+}
+
+std::vector<std::string> SaveTool::verifyPlanetSave(PlanetType planetType, PlanetGameSave& planetGameSave)
+{
+    std::vector<std::string> problems;
+
+    int worldSize = PlanetGenDataLoader::getPlanetGenData(planetType).worldSize;
+    int objectTypeCount = ObjectDataLoader::getObjectNameToTypeMap().size();
+
+    std::unordered_set<int> tileIDs;
+    for (const auto& tileMapNameToId : PlanetGenDataLoader::getTileMapNameToIdMap())
+    {
+        tileIDs.insert(tileMapNameToId.second);
+    }
+
+    std::unordered_set<ChunkPosition> chunkPositions;
+
+    for (const ChunkPOD& chunk : planetGameSave.chunks)
+    {
+        std::string chunkName = "chunk (" + std::to_string(chunk.chunkPosition.x) + ", " + std::to_string(chunk.chunkPosition.y) + ")";
+
+        if (chunk.chunkPosition.x < 0 || chunk.chunkPosition.x >= worldSize || chunk.chunkPosition.y < 0 || chunk.chunkPosition.y >= worldSize)
+        {
+            problems.push_back(chunkName + " is outside of world size " + std::to_string(worldSize));
+        }
+
+        if (!chunkPositions.insert(chunk.chunkPosition).second)
+        {
+            problems.push_back(chunkName + " is saved more than once");
+        }
+
+        for (const auto& tileRow : chunk.groundTileGrid)
+        {
+            for (uint16_t tileID : tileRow)
+            {
+                if (tileID != 0 && !tileIDs.contains(tileID))
+                {
+                    problems.push_back(chunkName + " has unknown tile ID " + std::to_string(tileID));
+                }
+            }
+        }
+
+        for (const auto& objectRow : chunk.objectGrid)
+        {
+            for (const auto& object : objectRow)
+            {
+                if (!object.has_value() || object->objectReference.has_value())
+                {
+                    continue;
+                }
+
+                if (object->objectType >= objectTypeCount)
+                {
+                    problems.push_back(chunkName + " has unknown object type " + std::to_string(object->objectType));
+                }
+
+                if (object->chestID != 0xFFFF && !planetGameSave.chestDataPool.getChestDataPtr(object->chestID))
+                {
+                    problems.push_back(chunkName + " has object with missing chest " + std::to_string(object->chestID));
+                }
+            }
+        }
+
+    }
+
+    return problems;
+}
+
+std::vector<std::string> SaveTool::verifyPlanetSaveChunkData(const std::vector<char>& planetSaveData)
+{
+    PlanetSaveChunkReader planetSaveChunkReader;
+
+    try
+    {
+        std::stringstream stream(std::string(planetSaveData.begin(), planetSaveData.end()));
+        cereal::BinaryInputArchive archive(stream);
+        archive(planetSaveChunkReader);
+    }
+    catch (const std::exception& e)
+    {
+        planetSaveChunkReader.problems.push_back(std::string("planet header could not be deserialised: ") + e.what());
+    }
+
+    return planetSaveChunkReader.problems;
+}
+
+int SaveTool::verify(const std::string& saveDirectory)
+{
+    GameSaveIO io;
+    io.setSaveDirectory(saveDirectory);
+
+    int failures = 0;
+
+    PlayerGameSave playerGameSave;
+    if (!io.loadPlayerSave(playerGameSave))
+    {
+        std::cout << "Player: could not be loaded\n";
+        failures++;
+    }
+
+    for (const SaveFile& saveFile : getSaveFiles(saveDirectory, "Planets"))
+    {
+        auto planetIter = PlanetGenDataLoader::getPlanetStringToTypeMap().find(saveFile.name);
+        if (planetIter == PlanetGenDataLoader::getPlanetStringToTypeMap().end())
+        {
+            std::cout << "Planet \"" << saveFile.name << "\": unknown planet\n";
+            failures++;
+            continue;
+        }
+
+        std::vector<char> planetSaveData;
+        if (!io.readPlanetSaveData(planetIter->second, planetSaveData))
+        {
+            std::cout << "Planet \"" << saveFile.name << "\": could not be read\n";
+            failures++;
+            continue;
+        }
+
+        // Chunks deserialised individually from saved data, so a chunk which cannot be loaded is reported
+        std::vector<std::string> problems = verifyPlanetSaveChunkData(planetSaveData);
+
+        // Loading maps types to current game data, to check chunk contents against
+        PlanetGameSave planetGameSave;
+        if (io.loadPlanetSave(planetIter->second, planetGameSave))
+        {
+            std::vector<std::string> chunkProblems = verifyPlanetSave(planetIter->second, planetGameSave);
+            problems.insert(problems.end(), chunkProblems.begin(), chunkProblems.end());
+        }
+        else if (problems.empty())
+        {
+            problems.push_back("could not be loaded");
+        }
+
+        std::cout << "Planet \"" << saveFile.name << "\": " << planetGameSave.chunks.size() << " chunks, " <<
+            (problems.empty() ? "OK" : std::to_string(problems.size()) + " problems") << "\n";
+
+        for (const std::string& problem : problems)
+        {
+            std::cout << "    " << problem << "\n";
+        }
+
+        failures += problems.size();
+    }
+
+    for (const SaveFile& saveFile : getSaveFiles(saveDirectory, "Rooms"))
+    {
+        auto roomIter = StructureDataLoader::getRoomTravelLocationNameToTypeMap().find(saveFile.name);
+        if (roomIter == StructureDataLoader::getRoomTravelLocationNameToTypeMap().end())
+        {
+            std::cout << "Room \"" << saveFile.name << "\": unknown room\n";
+            failures++;
+            continue;
+        }
+
+        RoomDestinationGameSave roomDestinationGameSave;
+        if (!io.loadRoomDestinationSave(roomIter->second, roomDestinationGameSave))
+        {
+            std::cout << "Room \"" << saveFile.name << "\": could not be loaded\n";
+            failures++;
+            continue;
+        }
+
+        std::cout << "Room \"" << saveFile.name << "\": OK\n";
+    }
+
+    std::cout << (failures > 0 ? "FAILED" : "PASSED") << " (" << failures << " problems)\n";
+
+    return (failures > 0) ? 1 : 0;
+}
+
+int SaveTool::migrate(const std::string& saveDirectory, bool stripUnmodifiedChunks)
+{
+    GameSaveIO io;
+    io.setSaveDirectory(saveDirectory);
+
+    int failures = 0;
+
+    for (const SaveFile& saveFile : getSaveFiles(saveDirectory, "Planets"))
+    {
+        auto planetIter = PlanetGenDataLoader::getPlanetStringToTypeMap().find(saveFile.name);
+
+        // Saves which cannot be loaded are left untouched
+        PlanetGameSave planetGameSave;
+        if (planetIter == PlanetGenDataLoader::getPlanetStringToTypeMap().end() || !io.loadPlanetSave(planetIter->second, planetGameSave))
+        {
+            std::cerr << "Could not load planet \"" << saveFile.name << "\", not migrated\n";
+            failures++;
+            continue;
+        }
+
+        int chunksStripped = 0;
+        if (stripUnmodifiedChunks)
+        {
+            // Unmodified chunks are regenerated from seed when next visited
+            chunksStripped = std::erase_if(planetGameSave.chunks, [](const ChunkPOD& chunk)
+            {
+                return !chunk.modified;
+            });
+        }
+
+        // Types were mapped to current game data on load, so save with current version state
+        planetGameSave.versionState = GameDataVersionState();
+
+        // Written to temporary file and moved over original, so original is kept if writing fails
+        if (!io.writePlanetSave(planetIter->second, planetGameSave))
+        {
+            std::cerr << "Could not write planet \"" << saveFile.name << "\"\n";
+            failures++;
+            continue;
+        }
+
+        std::error_code error;
+        std::cout << "Planet \"" << saveFile.name << "\": " << saveFile.fileBytes << " -> " << std::filesystem::file_size(saveFile.path, error) <<
+            " bytes, " << chunksStripped << " unmodified chunks stripped\n";
+    }
+
+    for (const SaveFile& saveFile : getSaveFiles(saveDirectory, "Rooms"))
+    {
+        auto roomIter = StructureDataLoader::getRoomTravelLocationNameToTypeMap().find(saveFile.name);
+
+        RoomDestinationGameSave roomDestinationGameSave;
+        if (roomIter == StructureDataLoader::getRoomTravelLocationNameToTypeMap().end() ||
+            !io.loadRoomDestinationSave(roomIter->second, roomDestinationGameSave))
+        {
+            std::cerr << "Could not load room \"" << saveFile.name << "\", not migrated\n";
+            failures++;
+            continue;
+        }
+
+        roomDestinationGameSave.versionState = GameDataVersionState();
+
+        if (!io.writeRoomDestinationSave(roomDestinationGameSave))
+        {
+            std::cerr << "Could not write room \"" << saveFile.name << "\"\n";
+            failures++;
+            continue;
+        }
+
+        std::cout << "Room \"" << saveFile.name << "\": migrated\n";
+    }
+
+    return (failures > 0) ? 1 : 0;
+}
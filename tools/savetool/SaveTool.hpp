@@ -0,0 +1,53 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <filesystem>
+
+#include <Core/json.hpp>
+
+#include "IO/GameSaveIO.hpp"
+
+#include "Data/typedefs.hpp"
+
+// Offline inspection, validation and migration of save directories, without a window or Steam
+// Game data must be loaded before running commands, as planet / room types and version mappings depend on it
+class SaveTool
+{
+    SaveTool() = delete;
+
+public:
+    // Lists planet and room files in save, along with player save info
+    static int list(const std::string& saveDirectory);
+
+    // Prints chunk / object / chest statistics for all planets and rooms as json
+    static int stats(const std::string& saveDirectory);
+
+    // Loads every planet and room and checks chunk data is valid against current game data
+    // Returns non-zero if any problems are found
+    static int verify(const std::string& saveDirectory);
+
+    // Loads every planet and room (remapping item / object / tile types to current game data)
+    // and rewrites with current version state and compression
+    static int migrate(const std::string& saveDirectory, bool stripUnmodifiedChunks);
+
+private:
+    struct SaveFile
+    {
+        std::string name;
+        std::filesystem::path path;
+        uint64_t fileBytes = 0;
+    };
+
+    // Planet / room save files in subdirectory of save, e.g. "Planets"
+    static std::vector<SaveFile> getSaveFiles(const std::string& saveDirectory, const std::string& subdirectory);
+
+    // Returns list of problems found in chunks of planet save
+    static std::vector<std::string> verifyPlanetSave(PlanetType planetType, PlanetGameSave& planetGameSave);
+
+    // Deserialises each chunk from decompressed planet save data, returning the chunk which could not be deserialised
+    static std::vector<std::string> verifyPlanetSaveChunkData(const std::vector<char>& planetSaveData);
+
+    static nlohmann::json createPlanetStats(const SaveFile& saveFile, const PlanetGameSave& planetGameSave);
+
+};
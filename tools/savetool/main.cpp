@@ -0,0 +1,79 @@
+#include <cstring>
+#include <vector>
+#include <string>
+#include <iostream>
+
+#include "SaveTool.hpp"
+
+#include "Data/GameDataCache.hpp"
+#include "IO/Log.hpp"
+
+static void printUsage()
+{
+    std::cout << "Usage: planeturem-savetool <command> <save directory> [options]\n";
+    std::cout << "Commands:\n";
+    std::cout << "  list       List planets and rooms in save\n";
+    std::cout << "  stats      Print chunk statistics as json\n";
+    std::cout << "  verify     Check every planet, chunk and room loads and is valid\n";
+    std::cout << "  migrate    Remap types to current game data and rewrite save with current compression\n";
+    std::cout << "Options:\n";
+    std::cout << "  --data <directory>    Game data directory (default \"Data/Info/\")\n";
+    std::cout << "  --data-pack <directory>  Data pack applied over game data, in order given (must match game)\n";
+    std::cout << "  --strip-unmodified    (migrate) Remove unmodified chunks, which are regenerated from seed\n";
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc < 3)
+    {
+        printUsage();
+        return -1;
+    }
+
+    std::string command = argv[1];
+    std::string saveDirectory = argv[2];
+
+    std::string dataDirectory = "Data/Info/";
+    std::vector<std::string> dataPackDirectories;
+    bool stripUnmodifiedChunks = false;
+
+    for (int i = 3; i < argc; i++)
+    {
+        if (std::strcmp(argv[i], "--data") == 0 && i + 1 < argc)
+        {
+            dataDirectory = argv[++i];
+        }
+        else if (std::strcmp(argv[i], "--data-pack") == 0 && i + 1 < argc)
+        {
+            dataPackDirectories.push_back(argv[++i]);
+        }
+        else if (std::strcmp(argv[i], "--strip-unmodified") == 0)
+        {
+            stripUnmodifiedChunks = true;
+        }
+        else
+        {
+            printUsage();
+            return -1;
+        }
+    }
+
+    Log::init();
+
+    GameDataCache::setDataPackDirectories(dataPackDirectories);
+
+    // Same data as game, so types are mapped identically to loading in game
+    if (!GameDataCache::loadGameData(dataDirectory, GameDataCache::getDefaultCachePath()))
+    {
+        std::cerr << "Could not load game data from \"" << dataDirectory << "\"\n";
+        return -1;
+    }
+
+    if (command == "list") return SaveTool::list(saveDirectory);
+    if (command == "stats") return SaveTool::stats(saveDirectory);
+    if (command == "verify") return SaveTool::verify(saveDirectory);
+    if (command == "migrate") return SaveTool::migrate(saveDirectory, stripUnmodifiedChunks);
+
+    printUsage();
+    return -1;
+}